@@ -19,6 +19,7 @@
 #include <cstdlib> // For size_t
 #include <string> // For OverrideParameters function
 #include <unordered_map> // For OverrideParameters function
+#include <vector> // For SetAuxiliaryQueues and FusedVectorOperations functions
 
 // Includes the normal OpenCL C header
 #if defined(__APPLE__) || defined(__MACOSX)
@@ -97,6 +98,7 @@ enum class StatusCode {
   kInsufficientMemoryY       = -1007, // Vector Y's OpenCL buffer is too small
 
   // Custom additional status codes for CLBlast
+  kInvalidTuningResults      = -2050, // The tuning results could not be read or are invalid
   kInvalidBatchCount         = -2049, // The batch count needs to be positive
   kInvalidOverrideKernel     = -2048, // Trying to override parameters for an invalid kernel
   kMissingOverrideParameter  = -2047, // Missing override parameter(s) for the target kernel
@@ -261,6 +263,52 @@ StatusCode Min(const size_t n,
                const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
                cl_command_queue* queue, cl_event* event = nullptr);
 
+// Scaled vector addition (non-BLAS function): SAXPBY/DAXPBY/CAXPBY/ZAXPBY/HAXPBY
+template <typename T>
+StatusCode Axpby(const size_t n,
+                 const T alpha,
+                 const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                 const T beta,
+                 cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                 cl_command_queue* queue, cl_event* event = nullptr);
+
+// Scaled vector addition into a third vector (non-BLAS function): SWAXPBY/DWAXPBY/CWAXPBY/ZWAXPBY/HWAXPBY
+template <typename T>
+StatusCode Waxpby(const size_t n,
+                  const T alpha,
+                  const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                  const T beta,
+                  const cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                  cl_mem z_buffer, const size_t z_offset, const size_t z_inc,
+                  cl_command_queue* queue, cl_event* event = nullptr);
+
+// Vector update followed by its dot product (non-BLAS function): SAXPYDOT/DAXPYDOT/HAXPYDOT
+template <typename T>
+StatusCode Axpydot(const size_t n,
+                   cl_mem dot_buffer, const size_t dot_offset,
+                   const T alpha,
+                   const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                   cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                   cl_command_queue* queue, cl_event* event = nullptr);
+
+// Vector update followed by its Euclidian norm (non-BLAS function): SAXPYNRM2/DAXPYNRM2/HAXPYNRM2
+template <typename T>
+StatusCode Axpynrm2(const size_t n,
+                    cl_mem nrm2_buffer, const size_t nrm2_offset,
+                    const T alpha,
+                    const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                    cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                    cl_command_queue* queue, cl_event* event = nullptr);
+
+// Dot products of a vector with two other vectors (non-BLAS function): SDOT2/DDOT2/HDOT2
+template <typename T>
+StatusCode Dot2(const size_t n,
+                cl_mem dot_buffer, const size_t dot_offset,
+                const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                const cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                const cl_mem z_buffer, const size_t z_offset, const size_t z_inc,
+                cl_command_queue* queue, cl_event* event = nullptr);
+
 // =================================================================================================
 // BLAS level-2 (matrix-vector) routines
 // =================================================================================================
@@ -431,6 +479,16 @@ StatusCode Gerc(const Layout layout,
                 cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
                 cl_command_queue* queue, cl_event* event = nullptr);
 
+// General rank-k matrix update (non-BLAS function): SGERK/DGERK/CGERK/ZGERK/HGERK
+template <typename T>
+StatusCode Gerk(const Layout layout,
+                const size_t m, const size_t n, const size_t k,
+                const T alpha,
+                const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                const cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                cl_command_queue* queue, cl_event* event = nullptr);
+
 // Hermitian rank-1 matrix update: CHER/ZHER
 template <typename T>
 StatusCode Her(const Layout layout, const Triangle triangle,
@@ -626,6 +684,35 @@ StatusCode AxpyBatched(const size_t n,
                        const size_t batch_count,
                        cl_command_queue* queue, cl_event* event = nullptr);
 
+// Batched version of DOT: SDOTBATCHED/DDOTBATCHED/HDOTBATCHED
+template <typename T>
+StatusCode DotBatched(const size_t n,
+                      cl_mem dot_buffer, const size_t *dot_offsets,
+                      const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                      const cl_mem y_buffer, const size_t *y_offsets, const size_t y_inc,
+                      const size_t batch_count,
+                      cl_command_queue* queue, cl_event* event = nullptr);
+
+// Batched version of NRM2: SNRM2BATCHED/DNRM2BATCHED/ScNRM2BATCHED/DzNRM2BATCHED/HNRM2BATCHED
+template <typename T>
+StatusCode Nrm2Batched(const size_t n,
+                       cl_mem nrm2_buffer, const size_t *nrm2_offsets,
+                       const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                       const size_t batch_count,
+                       cl_command_queue* queue, cl_event* event = nullptr);
+
+// Batched version of GEMV: SGEMVBATCHED/DGEMVBATCHED/CGEMVBATCHED/ZGEMVBATCHED/HGEMVBATCHED
+template <typename T>
+StatusCode GemvBatched(const Layout layout, const Transpose a_transpose,
+                       const size_t m, const size_t n,
+                       const T *alphas,
+                       const cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld,
+                       const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                       const T *betas,
+                       cl_mem y_buffer, const size_t *y_offsets, const size_t y_inc,
+                       const size_t batch_count,
+                       cl_command_queue* queue, cl_event* event = nullptr);
+
 // Batched version of GEMM: SGEMMBATCHED/DGEMMBATCHED/CGEMMBATCHED/ZGEMMBATCHED/HGEMMBATCHED
 template <typename T>
 StatusCode GemmBatched(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
@@ -656,6 +743,63 @@ StatusCode PUBLIC_API OverrideParameters(const cl_device_id device, const std::s
                                          const Precision precision,
                                          const std::unordered_map<std::string,size_t> &parameters);
 
+// Loads tuning results as written by the tuners (JSON files) without re-building the library. The
+// path is either a single file or a directory, of which all '*.json' files are loaded. The results
+// take precedence over the built-in database for the devices they were tuned for. Invalid files are
+// skipped, returning the status code of the first. The caches are cleared, such that routines use
+// the new parameters from then on (this also undoes earlier calls to OverrideParameters). Setting
+// the environmental variable CLBLAST_TUNING_RESULTS to such a path loads these on first use.
+StatusCode PUBLIC_API LoadTuningResults(const std::string &path);
+
+// Retrieves the tuning parameters currently used for a specific device-precision-kernel combination,
+// together with a description of the database entry these are taken from. This shows whether the
+// device was found in the database, and if not, which tuned device or which defaults are used (e.g.
+// "NVIDIA GPU 'GeForce GTX 1080' (nearest device)"). The target routine has to be called first.
+StatusCode PUBLIC_API RetrieveParameters(const cl_device_id device, const std::string &kernel_name,
+                                         const Precision precision,
+                                         std::unordered_map<std::string,size_t> &parameters,
+                                         std::string &database_entry);
+
+// =================================================================================================
+
+// Registers auxiliary command-queues for a command-queue. Routines called on that queue can then
+// run independent steps (e.g. the pre-processing of the input matrices of GEMM) concurrently on
+// the auxiliary queues. These have to share the context and the device of the main queue and have
+// to remain valid while registered. An empty list of auxiliary queues removes the registration.
+StatusCode PUBLIC_API SetAuxiliaryQueues(const cl_command_queue queue,
+                                         const std::vector<cl_command_queue> &auxiliary_queues);
+
+// =================================================================================================
+
+// Fused chains of level-1 vector operations (non-BLAS function). A chain of steps is composed on
+// the host and evaluated lazily: a single kernel is generated for the whole chain, compiled once
+// per chain signature, and each element of the vectors is loaded and stored only once. Each step
+// refers to the vectors by their index in 'buffers', with 'x' the source and 'y' the target:
+// - kCopy: y = x
+// - kScal: y = alpha * y
+// - kAxpy: y = alpha * x + y
+// - kMul:  y = x * y (element-wise)
+// - kAdd:  y = x + y
+// - kDot:  result = x . y (using the values after the preceding steps)
+// - kNrm2: result = ||x||
+// The results of the reductions are stored in order in 'result_buffer', starting at
+// 'result_offset'. This is only available for real precisions (half, float and double).
+enum class VectorOperation { kCopy, kScal, kAxpy, kMul, kAdd, kDot, kNrm2 };
+template <typename T>
+struct VectorStep {
+  VectorOperation operation;
+  size_t x;
+  size_t y;
+  T alpha;
+};
+template <typename T>
+StatusCode FusedVectorOperations(const size_t n, const std::vector<VectorStep<T>> &steps,
+                                 const std::vector<cl_mem> &buffers,
+                                 const std::vector<size_t> &offsets,
+                                 const std::vector<size_t> &incs,
+                                 cl_mem result_buffer, const size_t result_offset,
+                                 cl_command_queue* queue, cl_event* event = nullptr);
+
 // =================================================================================================
 
 } // namespace clblast
@@ -96,6 +96,7 @@ typedef enum CLBlastStatusCode_ {
   CLBlastInsufficientMemoryY       = -1007, // Vector Y's OpenCL buffer is too small
 
   // Custom additional status codes for CLBlast
+  CLBlastInvalidTuningResults      = -2050, // The tuning results could not be read or are invalid
   CLBlastInvalidBatchCount         = -2049, // The batch count needs to be positive
   CLBlastInvalidOverrideKernel     = -2048, // Trying to override parameters for an invalid kernel
   CLBlastMissingOverrideParameter  = -2047, // Missing override parameter(s) for the target kernel
@@ -469,6 +470,135 @@ CLBlastStatusCode PUBLIC_API CLBlastiHmin(const size_t n,
                                          const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
                                          cl_command_queue* queue, cl_event* event);
 
+// Scaled vector addition (non-BLAS function): SAXPBY/DAXPBY/CAXPBY/ZAXPBY/HAXPBY
+CLBlastStatusCode PUBLIC_API CLBlastSaxpby(const size_t n,
+                                           const float alpha,
+                                           const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                           const float beta,
+                                           cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                           cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastDaxpby(const size_t n,
+                                           const double alpha,
+                                           const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                           const double beta,
+                                           cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                           cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastCaxpby(const size_t n,
+                                           const cl_float2 alpha,
+                                           const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                           const cl_float2 beta,
+                                           cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                           cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastZaxpby(const size_t n,
+                                           const cl_double2 alpha,
+                                           const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                           const cl_double2 beta,
+                                           cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                           cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastHaxpby(const size_t n,
+                                           const cl_half alpha,
+                                           const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                           const cl_half beta,
+                                           cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                           cl_command_queue* queue, cl_event* event);
+
+// Scaled vector addition into a third vector (non-BLAS function): SWAXPBY/DWAXPBY/CWAXPBY/ZWAXPBY/HWAXPBY
+CLBlastStatusCode PUBLIC_API CLBlastSwaxpby(const size_t n,
+                                            const float alpha,
+                                            const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                            const float beta,
+                                            const cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                            cl_mem z_buffer, const size_t z_offset, const size_t z_inc,
+                                            cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastDwaxpby(const size_t n,
+                                            const double alpha,
+                                            const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                            const double beta,
+                                            const cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                            cl_mem z_buffer, const size_t z_offset, const size_t z_inc,
+                                            cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastCwaxpby(const size_t n,
+                                            const cl_float2 alpha,
+                                            const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                            const cl_float2 beta,
+                                            const cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                            cl_mem z_buffer, const size_t z_offset, const size_t z_inc,
+                                            cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastZwaxpby(const size_t n,
+                                            const cl_double2 alpha,
+                                            const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                            const cl_double2 beta,
+                                            const cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                            cl_mem z_buffer, const size_t z_offset, const size_t z_inc,
+                                            cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastHwaxpby(const size_t n,
+                                            const cl_half alpha,
+                                            const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                            const cl_half beta,
+                                            const cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                            cl_mem z_buffer, const size_t z_offset, const size_t z_inc,
+                                            cl_command_queue* queue, cl_event* event);
+
+// Vector update followed by its dot product (non-BLAS function): SAXPYDOT/DAXPYDOT/HAXPYDOT
+CLBlastStatusCode PUBLIC_API CLBlastSaxpydot(const size_t n,
+                                             cl_mem dot_buffer, const size_t dot_offset,
+                                             const float alpha,
+                                             const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                             cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                             cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastDaxpydot(const size_t n,
+                                             cl_mem dot_buffer, const size_t dot_offset,
+                                             const double alpha,
+                                             const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                             cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                             cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastHaxpydot(const size_t n,
+                                             cl_mem dot_buffer, const size_t dot_offset,
+                                             const cl_half alpha,
+                                             const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                             cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                             cl_command_queue* queue, cl_event* event);
+
+// Vector update followed by its Euclidian norm (non-BLAS function): SAXPYNRM2/DAXPYNRM2/HAXPYNRM2
+CLBlastStatusCode PUBLIC_API CLBlastSaxpynrm2(const size_t n,
+                                              cl_mem nrm2_buffer, const size_t nrm2_offset,
+                                              const float alpha,
+                                              const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                              cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                              cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastDaxpynrm2(const size_t n,
+                                              cl_mem nrm2_buffer, const size_t nrm2_offset,
+                                              const double alpha,
+                                              const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                              cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                              cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastHaxpynrm2(const size_t n,
+                                              cl_mem nrm2_buffer, const size_t nrm2_offset,
+                                              const cl_half alpha,
+                                              const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                              cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                              cl_command_queue* queue, cl_event* event);
+
+// Dot products of a vector with two other vectors (non-BLAS function): SDOT2/DDOT2/HDOT2
+CLBlastStatusCode PUBLIC_API CLBlastSdot2(const size_t n,
+                                          cl_mem dot_buffer, const size_t dot_offset,
+                                          const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                          const cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                          const cl_mem z_buffer, const size_t z_offset, const size_t z_inc,
+                                          cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastDdot2(const size_t n,
+                                          cl_mem dot_buffer, const size_t dot_offset,
+                                          const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                          const cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                          const cl_mem z_buffer, const size_t z_offset, const size_t z_inc,
+                                          cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastHdot2(const size_t n,
+                                          cl_mem dot_buffer, const size_t dot_offset,
+                                          const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                          const cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                          const cl_mem z_buffer, const size_t z_offset, const size_t z_inc,
+                                          cl_command_queue* queue, cl_event* event);
+
 // =================================================================================================
 // BLAS level-2 (matrix-vector) routines
 // =================================================================================================
@@ -891,6 +1021,43 @@ CLBlastStatusCode PUBLIC_API CLBlastZgerc(const CLBlastLayout layout,
                                           cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
                                           cl_command_queue* queue, cl_event* event);
 
+// General rank-k matrix update (non-BLAS function): SGERK/DGERK/CGERK/ZGERK/HGERK
+CLBlastStatusCode PUBLIC_API CLBlastSgerk(const CLBlastLayout layout,
+                                          const size_t m, const size_t n, const size_t k,
+                                          const float alpha,
+                                          const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                          const cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                          cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                          cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastDgerk(const CLBlastLayout layout,
+                                          const size_t m, const size_t n, const size_t k,
+                                          const double alpha,
+                                          const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                          const cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                          cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                          cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastCgerk(const CLBlastLayout layout,
+                                          const size_t m, const size_t n, const size_t k,
+                                          const cl_float2 alpha,
+                                          const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                          const cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                          cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                          cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastZgerk(const CLBlastLayout layout,
+                                          const size_t m, const size_t n, const size_t k,
+                                          const cl_double2 alpha,
+                                          const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                          const cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                          cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                          cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastHgerk(const CLBlastLayout layout,
+                                          const size_t m, const size_t n, const size_t k,
+                                          const cl_half alpha,
+                                          const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                          const cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                          cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                          cl_command_queue* queue, cl_event* event);
+
 // Hermitian rank-1 matrix update: CHER/ZHER
 CLBlastStatusCode PUBLIC_API CLBlastCher(const CLBlastLayout layout, const CLBlastTriangle triangle,
                                          const size_t n,
@@ -1382,6 +1549,100 @@ CLBlastStatusCode PUBLIC_API CLBlastHaxpyBatched(const size_t n,
                                                  const size_t batch_count,
                                                  cl_command_queue* queue, cl_event* event);
 
+// Batched version of DOT: SDOTBATCHED/DDOTBATCHED/HDOTBATCHED
+CLBlastStatusCode PUBLIC_API CLBlastSdotBatched(const size_t n,
+                                                cl_mem dot_buffer, const size_t *dot_offsets,
+                                                const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                                                const cl_mem y_buffer, const size_t *y_offsets, const size_t y_inc,
+                                                const size_t batch_count,
+                                                cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastDdotBatched(const size_t n,
+                                                cl_mem dot_buffer, const size_t *dot_offsets,
+                                                const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                                                const cl_mem y_buffer, const size_t *y_offsets, const size_t y_inc,
+                                                const size_t batch_count,
+                                                cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastHdotBatched(const size_t n,
+                                                cl_mem dot_buffer, const size_t *dot_offsets,
+                                                const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                                                const cl_mem y_buffer, const size_t *y_offsets, const size_t y_inc,
+                                                const size_t batch_count,
+                                                cl_command_queue* queue, cl_event* event);
+
+// Batched version of NRM2: SNRM2BATCHED/DNRM2BATCHED/ScNRM2BATCHED/DzNRM2BATCHED/HNRM2BATCHED
+CLBlastStatusCode PUBLIC_API CLBlastSnrm2Batched(const size_t n,
+                                                 cl_mem nrm2_buffer, const size_t *nrm2_offsets,
+                                                 const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                                                 const size_t batch_count,
+                                                 cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastDnrm2Batched(const size_t n,
+                                                 cl_mem nrm2_buffer, const size_t *nrm2_offsets,
+                                                 const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                                                 const size_t batch_count,
+                                                 cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastScnrm2Batched(const size_t n,
+                                                 cl_mem nrm2_buffer, const size_t *nrm2_offsets,
+                                                 const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                                                 const size_t batch_count,
+                                                 cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastDznrm2Batched(const size_t n,
+                                                 cl_mem nrm2_buffer, const size_t *nrm2_offsets,
+                                                 const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                                                 const size_t batch_count,
+                                                 cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastHnrm2Batched(const size_t n,
+                                                 cl_mem nrm2_buffer, const size_t *nrm2_offsets,
+                                                 const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                                                 const size_t batch_count,
+                                                 cl_command_queue* queue, cl_event* event);
+
+// Batched version of GEMV: SGEMVBATCHED/DGEMVBATCHED/CGEMVBATCHED/ZGEMVBATCHED/HGEMVBATCHED
+CLBlastStatusCode PUBLIC_API CLBlastSgemvBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                                 const size_t m, const size_t n,
+                                                 const float *alphas,
+                                                 const cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld,
+                                                 const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                                                 const float *betas,
+                                                 cl_mem y_buffer, const size_t *y_offsets, const size_t y_inc,
+                                                 const size_t batch_count,
+                                                 cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastDgemvBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                                 const size_t m, const size_t n,
+                                                 const double *alphas,
+                                                 const cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld,
+                                                 const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                                                 const double *betas,
+                                                 cl_mem y_buffer, const size_t *y_offsets, const size_t y_inc,
+                                                 const size_t batch_count,
+                                                 cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastCgemvBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                                 const size_t m, const size_t n,
+                                                 const cl_float2 *alphas,
+                                                 const cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld,
+                                                 const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                                                 const cl_float2 *betas,
+                                                 cl_mem y_buffer, const size_t *y_offsets, const size_t y_inc,
+                                                 const size_t batch_count,
+                                                 cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastZgemvBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                                 const size_t m, const size_t n,
+                                                 const cl_double2 *alphas,
+                                                 const cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld,
+                                                 const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                                                 const cl_double2 *betas,
+                                                 cl_mem y_buffer, const size_t *y_offsets, const size_t y_inc,
+                                                 const size_t batch_count,
+                                                 cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastHgemvBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                                 const size_t m, const size_t n,
+                                                 const cl_half *alphas,
+                                                 const cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld,
+                                                 const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                                                 const cl_half *betas,
+                                                 cl_mem y_buffer, const size_t *y_offsets, const size_t y_inc,
+                                                 const size_t batch_count,
+                                                 cl_command_queue* queue, cl_event* event);
+
 // Batched version of GEMM: SGEMMBATCHED/DGEMMBATCHED/CGEMMBATCHED/ZGEMMBATCHED/HGEMMBATCHED
 CLBlastStatusCode PUBLIC_API CLBlastSgemmBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
                                                  const size_t m, const size_t n, const size_t k,
@@ -1447,6 +1708,54 @@ CLBlastStatusCode PUBLIC_API CLBlastOverrideParameters(const cl_device_id device
                                                        const CLBlastPrecision precision, const size_t num_parameters,
                                                        const char** parameters_names, const size_t* parameters_values);
 
+// Loads tuning results as written by the tuners (JSON files) from a file or a directory. The results
+// take precedence over the built-in database and are used by the routines from then on.
+CLBlastStatusCode PUBLIC_API CLBlastLoadTuningResults(const char* path);
+
+// =================================================================================================
+
+// Registers auxiliary command-queues for a command-queue. Routines called on that queue can then
+// run independent steps (e.g. the pre-processing of the input matrices of GEMM) concurrently on
+// the auxiliary queues. These have to share the context and the device of the main queue and have
+// to remain valid while registered. Zero auxiliary queues removes the registration.
+CLBlastStatusCode PUBLIC_API CLBlastSetAuxiliaryQueues(const cl_command_queue queue, const size_t num_auxiliary_queues,
+                                                       const cl_command_queue* auxiliary_queues);
+
+// =================================================================================================
+
+// Fused chains of level-1 vector operations (non-BLAS function). Step 'i' performs 'operations[i]'
+// with source vector 'xs[i]', target vector 'ys[i]' and scalar 'alphas[i]', in which the vectors
+// are indices into 'buffers'. See the C++ API for the meaning of the operations. The results of
+// the reductions are stored in order in 'result_buffer', starting at 'result_offset'.
+typedef enum CLBlastVectorOperation_ { CLBlastVectorOperationCopy = 0, CLBlastVectorOperationScal = 1,
+                                       CLBlastVectorOperationAxpy = 2, CLBlastVectorOperationMul = 3,
+                                       CLBlastVectorOperationAdd = 4, CLBlastVectorOperationDot = 5,
+                                       CLBlastVectorOperationNrm2 = 6 } CLBlastVectorOperation;
+CLBlastStatusCode PUBLIC_API CLBlastSFusedVectorOperations(const size_t n, const size_t num_steps,
+                                                           const CLBlastVectorOperation* operations,
+                                                           const size_t* xs, const size_t* ys,
+                                                           const float* alphas,
+                                                           const size_t num_vectors, const cl_mem* buffers,
+                                                           const size_t* offsets, const size_t* incs,
+                                                           cl_mem result_buffer, const size_t result_offset,
+                                                           cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastDFusedVectorOperations(const size_t n, const size_t num_steps,
+                                                           const CLBlastVectorOperation* operations,
+                                                           const size_t* xs, const size_t* ys,
+                                                           const double* alphas,
+                                                           const size_t num_vectors, const cl_mem* buffers,
+                                                           const size_t* offsets, const size_t* incs,
+                                                           cl_mem result_buffer, const size_t result_offset,
+                                                           cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastHFusedVectorOperations(const size_t n, const size_t num_steps,
+                                                           const CLBlastVectorOperation* operations,
+                                                           const size_t* xs, const size_t* ys,
+                                                           const cl_half* alphas,
+                                                           const size_t num_vectors, const cl_mem* buffers,
+                                                           const size_t* offsets, const size_t* incs,
+                                                           cl_mem result_buffer, const size_t result_offset,
+                                                           cl_command_queue* queue, cl_event* event);
+
 // =================================================================================================
 
 #ifdef __cplusplus
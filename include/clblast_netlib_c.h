@@ -270,6 +270,86 @@ int PUBLIC_API cblas_icmin(const int n,
 int PUBLIC_API cblas_izmin(const int n,
                           const void* x, const int x_inc);
 
+// Scaled vector addition (non-BLAS function): SAXPBY/DAXPBY/CAXPBY/ZAXPBY/HAXPBY
+void PUBLIC_API cblas_saxpby(const int n,
+                             const float alpha,
+                             const float* x, const int x_inc,
+                             const float beta,
+                             float* y, const int y_inc);
+void PUBLIC_API cblas_daxpby(const int n,
+                             const double alpha,
+                             const double* x, const int x_inc,
+                             const double beta,
+                             double* y, const int y_inc);
+void PUBLIC_API cblas_caxpby(const int n,
+                             const void* alpha,
+                             const void* x, const int x_inc,
+                             const void* beta,
+                             void* y, const int y_inc);
+void PUBLIC_API cblas_zaxpby(const int n,
+                             const void* alpha,
+                             const void* x, const int x_inc,
+                             const void* beta,
+                             void* y, const int y_inc);
+
+// Scaled vector addition into a third vector (non-BLAS function): SWAXPBY/DWAXPBY/CWAXPBY/ZWAXPBY/HWAXPBY
+void PUBLIC_API cblas_swaxpby(const int n,
+                              const float alpha,
+                              const float* x, const int x_inc,
+                              const float beta,
+                              const float* y, const int y_inc,
+                              float* z, const int z_inc);
+void PUBLIC_API cblas_dwaxpby(const int n,
+                              const double alpha,
+                              const double* x, const int x_inc,
+                              const double beta,
+                              const double* y, const int y_inc,
+                              double* z, const int z_inc);
+void PUBLIC_API cblas_cwaxpby(const int n,
+                              const void* alpha,
+                              const void* x, const int x_inc,
+                              const void* beta,
+                              const void* y, const int y_inc,
+                              void* z, const int z_inc);
+void PUBLIC_API cblas_zwaxpby(const int n,
+                              const void* alpha,
+                              const void* x, const int x_inc,
+                              const void* beta,
+                              const void* y, const int y_inc,
+                              void* z, const int z_inc);
+
+// Vector update followed by its dot product (non-BLAS function): SAXPYDOT/DAXPYDOT/HAXPYDOT
+float PUBLIC_API cblas_saxpydot(const int n,
+                                const float alpha,
+                                const float* x, const int x_inc,
+                                float* y, const int y_inc);
+double PUBLIC_API cblas_daxpydot(const int n,
+                                 const double alpha,
+                                 const double* x, const int x_inc,
+                                 double* y, const int y_inc);
+
+// Vector update followed by its Euclidian norm (non-BLAS function): SAXPYNRM2/DAXPYNRM2/HAXPYNRM2
+float PUBLIC_API cblas_saxpynrm2(const int n,
+                                 const float alpha,
+                                 const float* x, const int x_inc,
+                                 float* y, const int y_inc);
+double PUBLIC_API cblas_daxpynrm2(const int n,
+                                  const double alpha,
+                                  const double* x, const int x_inc,
+                                  double* y, const int y_inc);
+
+// Dot products of a vector with two other vectors (non-BLAS function): SDOT2/DDOT2/HDOT2
+void PUBLIC_API cblas_sdot2_sub(const int n,
+                                const float* x, const int x_inc,
+                                const float* y, const int y_inc,
+                                const float* z, const int z_inc,
+                                float* dot);
+void PUBLIC_API cblas_ddot2_sub(const int n,
+                                const double* x, const int x_inc,
+                                const double* y, const int y_inc,
+                                const double* z, const int z_inc,
+                                double* dot);
+
 // =================================================================================================
 // BLAS level-2 (matrix-vector) routines
 // =================================================================================================
@@ -580,6 +660,32 @@ void PUBLIC_API cblas_zgerc(const CLBlastLayout layout,
                             const void* y, const int y_inc,
                             void* a, const int a_ld);
 
+// General rank-k matrix update (non-BLAS function): SGERK/DGERK/CGERK/ZGERK/HGERK
+void PUBLIC_API cblas_sgerk(const CLBlastLayout layout,
+                            const int m, const int n, const int k,
+                            const float alpha,
+                            const float* x, const int x_inc,
+                            const float* y, const int y_inc,
+                            float* a, const int a_ld);
+void PUBLIC_API cblas_dgerk(const CLBlastLayout layout,
+                            const int m, const int n, const int k,
+                            const double alpha,
+                            const double* x, const int x_inc,
+                            const double* y, const int y_inc,
+                            double* a, const int a_ld);
+void PUBLIC_API cblas_cgerk(const CLBlastLayout layout,
+                            const int m, const int n, const int k,
+                            const void* alpha,
+                            const void* x, const int x_inc,
+                            const void* y, const int y_inc,
+                            void* a, const int a_ld);
+void PUBLIC_API cblas_zgerk(const CLBlastLayout layout,
+                            const int m, const int n, const int k,
+                            const void* alpha,
+                            const void* x, const int x_inc,
+                            const void* y, const int y_inc,
+                            void* a, const int a_ld);
+
 // Hermitian rank-1 matrix update: CHER/ZHER
 void PUBLIC_API cblas_cher(const CLBlastLayout layout, const CLBlastTriangle triangle,
                            const int n,
@@ -63,6 +63,32 @@ def remove_mismatched_arguments(database):
         assert len(group_by_arguments) == 1
 
 
+def assign_shape_buckets(section):
+    """Moves tuning results for a problem of a specific shape class (e.g. a small GEMM) to a separate kernel family
+    (e.g. 'xgemm_small'), such that these are merged into the per-shape entries of the database instead of conflicting
+    with the results for the regular shapes. Newer tuners already do this themselves."""
+    if section["kernel_family"] not in clblast.SHAPE_BUCKET_FAMILIES:
+        return section
+    if not all(field in section for field in ["arg_m", "arg_n", "arg_k"]):
+        return section
+    bucket = clblast.shape_bucket(int(section["arg_m"]), int(section["arg_n"]), int(section["arg_k"]))
+    if bucket != "":
+        section["kernel_family"] += "_" + bucket
+    return section
+
+
+def print_missing_includes(database, cpp_database_path):
+    """Reports the generated C++ database files which are not yet included in 'database.cpp', e.g. for the per-shape
+    entries of a kernel family"""
+    database_cpp = os.path.normpath(os.path.join(cpp_database_path, "..", "database.cpp"))
+    with open(database_cpp) as f:
+        database_cpp_contents = f.read()
+    for family_name in sorted(set([s["kernel_family"] for s in database["sections"]])):
+        if "\"database/kernels/" + family_name + ".hpp\"" not in database_cpp_contents:
+            print("[database] NOTE: 'database/kernels/%s.hpp' and its entries still have to be added to '%s'" %
+                  (family_name, database_cpp))
+
+
 def remove_database_entries(database, remove_if_matches_fields):
     assert len(remove_if_matches_fields.keys()) > 0
 
@@ -114,6 +140,7 @@ def main(argv):
         # Loads the newly imported data
         sys.stdout.write("[database] Processing '" + file_json + "' ")  # No newline printed
         imported_data = io.load_tuning_results(file_json)
+        imported_data = assign_shape_buckets(imported_data)
 
         # Fixes the problem that some vendors use multiple different names
         for target in VENDOR_TRANSLATION_TABLE:
@@ -155,6 +182,7 @@ def main(argv):
     # Outputs the database as a C++ database
     print("[database] Producing a C++ database in '" + cpp_database_path + "'...")
     clblast.print_cpp_database(database_best_results, cpp_database_path)
+    print_missing_includes(database_best_results, cpp_database_path)
 
     print("[database] All done")
 
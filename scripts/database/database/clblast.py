@@ -12,6 +12,11 @@ VENDOR_DEFAULT = "default"
 DEVICE_TYPE_DEFAULT = "All"
 DEVICE_NAME_DEFAULT = "default"
 
+# Constants from the C++ code: kernel families with entries per shape class and the shape class thresholds
+SHAPE_BUCKET_FAMILIES = ["xgemm", "xgemm_direct"]
+SHAPE_BUCKET_ASPECT_RATIO = 16
+SHAPE_BUCKET_SMALL_SIZE = 128 * 128 * 128
+
 # List of attributes
 DEVICE_TYPE_ATTRIBUTES = ["device_vendor", "device_type"]
 DEVICE_ATTRIBUTES = ["device", "device_core_clock", "device_compute_units"]
@@ -37,6 +42,17 @@ def precision_to_string(precision):
         raise("Unknown precision: " + precision)
 
 
+def shape_bucket(m, n, k):
+    """Classifies a problem by size and aspect ratio as done by 'Database::ShapeBucket' in the C++ code"""
+    if k >= SHAPE_BUCKET_ASPECT_RATIO * max(m, n):
+        return "deep"
+    if max(m, n) >= SHAPE_BUCKET_ASPECT_RATIO * min(m, n):
+        return "wide"
+    if m * n * k <= SHAPE_BUCKET_SMALL_SIZE:
+        return "small"
+    return ""
+
+
 def get_cpp_separator():
     """Retrieves a C++ comment separator"""
     return "// ================================================================================================="
@@ -79,78 +95,111 @@ def get_cpp_device_vendor(vendor, device_type):
     return "    { // %s %ss\n      kDeviceType%s, \"%s\", {\n" % (vendor, device_type, device_type_caps, vendor)
 
 
+def get_cpp_parameter_sets(family, parameter_names, parameter_sets):
+    """Retrieves the C++ code for the table of unique parameter sets of a kernel family"""
+    camelcase_name = family.title().replace("_", "")
+    names_cpp = ", ".join(["\"%s\"" % parameter_name for parameter_name in parameter_names])
+    result = "\n\n// The unique parameter sets of these kernels, referred to by index below\n"
+    result += "const auto %sParameters = Database::ParameterSets({%s}, {\n" % (camelcase_name, names_cpp)
+    for index, parameter_values in enumerate(parameter_sets):
+        values_cpp = ", ".join([str(parameter_value) for parameter_value in parameter_values])
+        result += "  {%s}, // %d\n" % (values_cpp, index)
+    return result + "});\n\n" + get_cpp_separator()
+
+
+def get_cpp_device(family, device_name, index):
+    """Retrieves the C++ code for a device referring to a set of parameters by its index in the table"""
+    camelcase_name = family.title().replace("_", "")
+    device_name_quoted = "\"%s\"," % device_name.strip()
+    return "        { %-50s %sParameters[%d] },\n" % (device_name_quoted, camelcase_name, index)
+
+
+def get_parameter_index(parameter_names, parameter_sets, parameters):
+    """Retrieves the index of a set of parameters in the table of unique sets, adding it if it is not yet present"""
+    if parameter_names != [name for name, _ in parameters]:
+        raise RuntimeError("Mis-matched parameters within a kernel family: " + str(parameters))
+    parameter_values = [value for _, value in parameters]
+    if parameter_values not in parameter_sets:
+        parameter_sets.append(parameter_values)
+    return parameter_sets.index(parameter_values)
+
+
 def print_cpp_database(database, output_dir):
-    """Outputs the database as C++ code"""
+    """Outputs the database as C++ code. The parameters of a kernel family are stored once per unique set in a table,
+    to which the devices refer by index."""
 
     # Iterates over the kernel families
     kernel_families = sorted(set([s["kernel_family"] for s in database["sections"]]))
     for family_name in kernel_families:
         family_database = [s for s in database["sections"] if s["kernel_family"] == family_name]
 
-        # Opens a new file for each kernel family
+        # The table of unique parameter sets and the C++ code of the entries referring to it
+        parameter_names = None
+        parameter_sets = []
+        entries = ""
+
+        # Loops over the different precision (e.g. 16, 32, 3232, 64, 6464)
+        precisions = sorted(set([s["precision"] for s in database["sections"]]))  # Based on full database
+        for precision in precisions:
+            precision_database = [s for s in family_database if s["precision"] == precision]
+            entries += get_cpp_precision(family_name, precision)
+
+            # In case there is nothing found at all (e.g. 16-bit): continue as if this was a precision of 32 but
+            # with the defaults only
+            if len(precision_database) == 0:
+                print("[database] No results found for %s:%s, retrieving defaults from %s:32" %
+                      (family_name, precision, family_name))
+                precision_database = [s for s in family_database if s["precision"] == "32"
+                                      and s["device_vendor"] == VENDOR_DEFAULT
+                                      and s["device_type"] == DEVICE_TYPE_DEFAULT
+                                      and s["device"] == DEVICE_NAME_DEFAULT]
+
+            # Loops over device vendors (e.g. AMD)
+            device_vendors = sorted(set([s["device_vendor"] for s in precision_database]))
+            for vendor in device_vendors:
+                vendor_database = [s for s in precision_database if s["device_vendor"] == vendor]
+
+                # Loops over device types (e.g. GPU)
+                device_types = sorted(set([s["device_type"] for s in vendor_database]))
+                for device_type in device_types:
+                    type_database = [s for s in vendor_database if s["device_type"] == device_type]
+                    entries += get_cpp_device_vendor(vendor, device_type)
+
+                    # Loops over every device of this vendor-type combination
+                    devices = sorted(set([s["device"] for s in type_database]))
+                    for device_name in devices:
+                        device_database = [s for s in type_database if s["device"] == device_name]
+
+                        # Collects the parameters for this entry
+                        parameters = []
+                        kernels = sorted(set([s["kernel"] for s in device_database]))
+                        for kernel in kernels:
+                            kernel_database = [s for s in device_database if s["kernel"] == kernel]
+
+                            assert len(kernel_database) == 1
+                            results = kernel_database[0]["results"]
+
+                            assert len(results) == 1
+                            new_parameters = results[0]["parameters"]
+                            for parameter_name in sorted(new_parameters):
+                                parameters.append((parameter_name, new_parameters[parameter_name]))
+
+                        # Prints the entry, referring to its parameters in the table
+                        if parameter_names is None:
+                            parameter_names = [name for name, _ in parameters]
+                        index = get_parameter_index(parameter_names, parameter_sets, parameters)
+                        entries += get_cpp_device(family_name, device_name, index)
+
+                    # Prints the vendor-type combination footer
+                    entries += "      }\n    },\n"
+
+            # Prints the precision footer
+            entries += "  }\n};\n\n" + get_cpp_separator()
+
+        # Opens a new file for each kernel family and prints the table followed by the entries
         full_path = os.path.join(output_dir, family_name + ".hpp")
         with open(full_path, 'w+') as f:
             f.write(get_cpp_header(family_name))
-
-            # Loops over the different precision (e.g. 16, 32, 3232, 64, 6464)
-            precisions = sorted(set([s["precision"] for s in database["sections"]]))  # Based on full database
-            for precision in precisions:
-                precision_database = [s for s in family_database if s["precision"] == precision]
-                f.write(get_cpp_precision(family_name, precision))
-
-                # In case there is nothing found at all (e.g. 16-bit): continue as if this was a precision of 32 but
-                # with the defaults only
-                if len(precision_database) == 0:
-                    print("[database] No results found for %s:%s, retrieving defaults from %s:32" %
-                          (family_name, precision, family_name))
-                    precision_database = [s for s in family_database if s["precision"] == "32"
-                                          and s["device_vendor"] == VENDOR_DEFAULT
-                                          and s["device_type"] == DEVICE_TYPE_DEFAULT
-                                          and s["device"] == DEVICE_NAME_DEFAULT]
-
-                # Loops over device vendors (e.g. AMD)
-                device_vendors = sorted(set([s["device_vendor"] for s in precision_database]))
-                for vendor in device_vendors:
-                    vendor_database = [s for s in precision_database if s["device_vendor"] == vendor]
-
-                    # Loops over device types (e.g. GPU)
-                    device_types = sorted(set([s["device_type"] for s in vendor_database]))
-                    for device_type in device_types:
-                        type_database = [s for s in vendor_database if s["device_type"] == device_type]
-                        f.write(get_cpp_device_vendor(vendor, device_type))
-
-                        # Loops over every device of this vendor-type combination
-                        devices = sorted(set([s["device"] for s in type_database]))
-                        for device_name in devices:
-                            device_database = [s for s in type_database if s["device"] == device_name]
-                            device_name_quoted = "\"%s\"," % device_name.strip()
-                            device_name_cpp = "        { %-50s { " % device_name_quoted
-                            f.write(device_name_cpp)
-
-                            # Collects the parameters for this entry
-                            parameters = []
-                            kernels = sorted(set([s["kernel"] for s in device_database]))
-                            for kernel in kernels:
-                                kernel_database = [s for s in device_database if s["kernel"] == kernel]
-
-                                assert len(kernel_database) == 1
-                                results = kernel_database[0]["results"]
-
-                                assert len(results) == 1
-                                new_parameters = results[0]["parameters"]
-                                for parameter_name in sorted(new_parameters):
-                                    parameter_value = new_parameters[parameter_name]
-                                    parameters.append("{\"" + parameter_name + "\"," + str(parameter_value) + "}")
-
-                            # Prints the entry
-                            f.write(", ".join(parameters))
-                            f.write(" } },\n")
-
-                        # Prints the vendor-type combination footer
-                        f.write("      }\n    },\n")
-
-                # Prints the precision footer
-                f.write("  }\n};\n\n" + get_cpp_separator())
-
-            # Prints the file footer
+            f.write(get_cpp_parameter_sets(family_name, parameter_names, parameter_sets))
+            f.write(entries)
             f.write(get_cpp_footer())
@@ -42,10 +42,10 @@ FILES = [
     "/include/clblast_netlib_c.h",
     "/src/clblast_netlib_c.cpp",
 ]
-HEADER_LINES = [122, 78, 126, 24, 29, 41, 29, 65, 32]
-FOOTER_LINES = [25, 139, 27, 38, 6, 6, 6, 9, 2]
+HEADER_LINES = [124, 95, 127, 24, 29, 41, 29, 65, 32]
+FOOTER_LINES = [82, 264, 75, 132, 6, 6, 6, 9, 2]
 HEADER_LINES_DOC = 0
-FOOTER_LINES_DOC = 63
+FOOTER_LINES_DOC = 188
 
 # Different possibilities for requirements
 ald_m = "The value of `a_ld` must be at least `m`."
@@ -78,6 +78,9 @@ def layout_transpose_condition(prefix):
 xn = "n * x_inc"
 xm = "m * x_inc"
 yn = "n * y_inc"
+xmk = "m * k * x_inc"
+ynk = "n * k * y_inc"
+zn = "n * z_inc"
 ym = "m * y_inc"
 an = "n * a_ld"
 apn = "((n*(n+1)) / 2)"
@@ -102,10 +105,10 @@ bmnn = size_helper("layout == CLBlastLayoutRowMajor", "((side == CLBlastSideLeft
 # Populates a list of routines
 ROUTINES = [
 [  # Level 1: vector-vector
-  Routine(False, True,  False, "1", "rotg",  T, [S,D],            [],                  [],                                                     [],         ["sa","sb","sc","ss"],        ["1","1","1","1"], [],       "",    "Generate givens plane rotation", "", []),
-  Routine(False, True,  False, "1", "rotmg", T, [S,D],            [],                  [],                                                     ["sy1"],    ["sd1","sd2","sx1","sparam"], ["1","1","1","1","1"], [],   "",    "Generate modified givens plane rotation", "", []),
-  Routine(False, True,  False, "1", "rot",   T, [S,D],            ["n"],               [],                                                     [],         ["x","y"],                    [xn,yn],       ["cos","sin"],"",    "Apply givens plane rotation", "", []),
-  Routine(False, True,  False, "1", "rotm",  T, [S,D],            ["n"],               [],                                                     [],         ["x","y","sparam"],           [xn,yn,"1"],   [],           "",    "Apply modified givens plane rotation", "", []),
+  Routine(True,  True,  False, "1", "rotg",  T, [S,D],            [],                  [],                                                     [],         ["sa","sb","sc","ss"],        ["1","1","1","1"], [],       "",    "Generate givens plane rotation", "", []),
+  Routine(True,  True,  False, "1", "rotmg", T, [S,D],            [],                  [],                                                     ["sy1"],    ["sd1","sd2","sx1","sparam"], ["1","1","1","1","1"], [],   "",    "Generate modified givens plane rotation", "", []),
+  Routine(True,  True,  False, "1", "rot",   T, [S,D],            ["n"],               [],                                                     [],         ["x","y"],                    [xn,yn],       ["cos","sin"],"",    "Apply givens plane rotation", "", []),
+  Routine(True,  True,  False, "1", "rotm",  T, [S,D],            ["n"],               [],                                                     [],         ["x","y","sparam"],           [xn,yn,"1"],   [],           "",    "Apply modified givens plane rotation", "", []),
   Routine(True,  True,  False, "1", "swap",  T, [S,D,C,Z,H],      ["n"],               [],                                                     [],         ["x","y"],                    [xn,yn],       [],           "",    "Swap two vectors", "Interchanges _n_ elements of vectors _x_ and _y_.", []),
   Routine(True,  True,  False, "1", "scal",  T, [S,D,C,Z,H],      ["n"],               [],                                                     [],         ["x"],                        [xn],          ["alpha"],    "",    "Vector scaling", "Multiplies _n_ elements of vector _x_ by a scalar constant _alpha_.", []),
   Routine(True,  True,  False, "1", "copy",  T, [S,D,C,Z,H],      ["n"],               [],                                                     ["x"],      ["y"],                        [xn,yn],       [],           "",    "Vector copy", "Copies the contents of vector _x_ into vector _y_.", []),
@@ -120,6 +123,11 @@ ROUTINES = [
   Routine(True,  False, False, "1", "amin",  T, [iS,iD,iC,iZ,iH], ["n"],               [],                                                     ["x"],      ["imin"],                     [xn,"1"],      [],           "2*n", "Index of absolute minimum value in a vector (non-BLAS function)", "Finds the index of the minimum of the absolute values in the _x_ vector. The resulting integer index is stored in the _imin_ buffer.", []),
   Routine(True,  False, False, "1", "max",   T, [iS,iD,iC,iZ,iH], ["n"],               [],                                                     ["x"],      ["imax"],                     [xn,"1"],      [],           "2*n", "Index of maximum value in a vector (non-BLAS function)", "Finds the index of the maximum of the values in the _x_ vector. The resulting integer index is stored in the _imax_ buffer. This routine is the non-absolute version of the IxAMAX BLAS routine.", []),
   Routine(True,  False, False, "1", "min",   T, [iS,iD,iC,iZ,iH], ["n"],               [],                                                     ["x"],      ["imin"],                     [xn,"1"],      [],           "2*n", "Index of minimum value in a vector (non-BLAS function)", "Finds the index of the minimum of the values in the _x_ vector. The resulting integer index is stored in the _imin_ buffer. This routine is the non-absolute minimum version of the IxAMAX BLAS routine.", []),
+  Routine(True,  True,  False, "1", "axpby", T, [S,D,C,Z,H],      ["n"],               [],                                                     ["x"],      ["y"],                        [xn,yn],       ["alpha","beta"], "", "Scaled vector addition (non-BLAS function)", "Performs the operation _y = alpha * x + beta * y_, in which _x_ and _y_ are vectors and _alpha_ and _beta_ are scalar constants. This replaces a call to xSCAL followed by a call to xAXPY and reads vector _y_ only once.", []),
+  Routine(True,  True,  False, "1", "waxpby", T, [S,D,C,Z,H],     ["n"],               [],                                                     ["x","y"],  ["z"],                        [xn,yn,zn],    ["alpha","beta"], "", "Scaled vector addition into a third vector (non-BLAS function)", "Performs the operation _z = alpha * x + beta * y_, in which _x_ and _y_ are input vectors, _z_ is the output vector and _alpha_ and _beta_ are scalar constants.", []),
+  Routine(True,  True,  False, "1", "axpydot", T, [S,D,H],        ["n"],               [],                                                     ["x"],      ["y","dot"],                  [xn,yn,"1"],   ["alpha"],    "",    "Vector update followed by its dot product (non-BLAS function)", "Performs the operation _y = alpha * x + y_ and computes the dot product of the updated vector _y_ with itself. The result is stored in the _dot_ buffer. Vector _y_ is read and written only once, as opposed to a call to xAXPY followed by a call to xDOT.", []),
+  Routine(True,  True,  False, "1", "axpynrm2", T, [S,D,H],       ["n"],               [],                                                     ["x"],      ["y","nrm2"],                 [xn,yn,"1"],   ["alpha"],    "",    "Vector update followed by its Euclidian norm (non-BLAS function)", "Performs the operation _y = alpha * x + y_ and computes the L2 norm of the updated vector _y_. The result is stored in the _nrm2_ buffer. Vector _y_ is read and written only once, as opposed to a call to xAXPY followed by a call to xNRM2.", []),
+  Routine(True,  True,  False, "1", "dot2",  T, [S,D,H],          ["n"],               [],                                                     ["x","y","z"], ["dot"],                   [xn,yn,zn,"2"], [],          "",    "Dot products of a vector with two other vectors (non-BLAS function)", "Computes the dot products of vector _x_ with vector _y_ and with vector _z_, reading vector _x_ only once. The two results are stored in consecutive elements of the _dot_ buffer, starting at _dot_offset_.", []),
 ],
 [  # Level 2: matrix-vector
   Routine(True,  True,  False, "2a", "gemv",  T,  [S,D,C,Z,H],    ["m","n"],           ["layout","a_transpose"],                               ["a","x"],  ["y"],                        [amn,xmn,ynm], ["alpha","beta"], "",    "General matrix-vector multiplication", "Performs the operation _y = alpha * A * x + beta * y_, in which _x_ is an input vector, _y_ is an input and output vector, _A_ is an input matrix, and _alpha_ and _beta_ are scalars. The matrix _A_ can optionally be transposed before performing the operation.", [ald_m]),
@@ -134,12 +142,13 @@ ROUTINES = [
   Routine(True,  True,  False, "2a", "tbmv",  T,  [S,D,C,Z,H],    ["n","k"],           ["layout","triangle","a_transpose","diagonal"],         ["a"],      ["x"],                        [an,xn],       [],               "n",   "Triangular banded matrix-vector multiplication", "Same operation as xGEMV, but matrix _A_ is triangular and banded instead.", [ald_k_one]),
   Routine(True,  True,  False, "2a", "tpmv",  T,  [S,D,C,Z,H],    ["n"],               ["layout","triangle","a_transpose","diagonal"],         ["ap"],     ["x"],                        [apn,xn],      [],               "n",   "Triangular packed matrix-vector multiplication", "Same operation as xGEMV, but matrix _A_ is a triangular packed matrix instead and repreented as _AP_.", []),
   Routine(True,  True,  False, "2a", "trsv",  T,  [S,D,C,Z],      ["n"],               ["layout","triangle","a_transpose","diagonal"],         ["a"],      ["x"],                        [an,xn],       [],               "",    "Solves a triangular system of equations", "", []),
-  Routine(False, True,  False, "2a", "tbsv",  T,  [S,D,C,Z],      ["n","k"],           ["layout","triangle","a_transpose","diagonal"],         ["a"],      ["x"],                        [an,xn],       [],               "",    "Solves a banded triangular system of equations", "", [ald_k_one]),
-  Routine(False, True,  False, "2a", "tpsv",  T,  [S,D,C,Z],      ["n"],               ["layout","triangle","a_transpose","diagonal"],         ["ap"],     ["x"],                        [apn,xn],      [],               "",    "Solves a packed triangular system of equations", "", []),
+  Routine(True,  True,  False, "2a", "tbsv",  T,  [S,D,C,Z],      ["n","k"],           ["layout","triangle","a_transpose","diagonal"],         ["a"],      ["x"],                        [an,xn],       [],               "",    "Solves a banded triangular system of equations", "", [ald_k_one]),
+  Routine(True,  True,  False, "2a", "tpsv",  T,  [S,D,C,Z],      ["n"],               ["layout","triangle","a_transpose","diagonal"],         ["ap"],     ["x"],                        [apn,xn],      [],               "",    "Solves a packed triangular system of equations", "", []),
   # Level 2: matrix update
   Routine(True,  True,  False, "2b", "ger",   T,  [S,D,H],        ["m","n"],           ["layout"],                                             ["x","y"],  ["a"],                        [xm,yn,amn],   ["alpha"],        "",    "General rank-1 matrix update", "Performs the operation _A = alpha * x * y^T + A_, in which _x_ is an input vector, _y^T_ is the transpose of the input vector _y_, _A_ is the matrix to be updated, and _alpha_ is a scalar value.", [ald_m]),
   Routine(True,  True,  False, "2b", "geru",  T,  [C,Z],          ["m","n"],           ["layout"],                                             ["x","y"],  ["a"],                        [xm,yn,amn],   ["alpha"],        "",    "General rank-1 complex matrix update", "Same operation as xGER, but with complex data-types.", [ald_m]),
   Routine(True,  True,  False, "2b", "gerc",  T,  [C,Z],          ["m","n"],           ["layout"],                                             ["x","y"],  ["a"],                        [xm,yn,amn],   ["alpha"],        "",    "General rank-1 complex conjugated matrix update", "Same operation as xGERU, but the update is done based on the complex conjugate of the input vectors.", [ald_m]),
+  Routine(True,  True,  False, "2b", "gerk",  T,  [S,D,C,Z,H],    ["m","n","k"],       ["layout"],                                             ["x","y"],  ["a"],                        [xmk,ynk,amn], ["alpha"],        "",    "General rank-k matrix update (non-BLAS function)", "Performs the operation _A = alpha * (x_1 * y_1^T + ... + x_k * y_k^T) + A_, in which the _k_ pairs of vectors _x_j_ and _y_j_ are stored consecutively in the _x_ and _y_ buffers: vector _x_j_ starts at `x_offset + j*m*x_inc` and vector _y_j_ at `y_offset + j*n*y_inc`. As opposed to _k_ calls to xGER, the matrix _A_ is read and written only once. The vectors are not conjugated.", [ald_m]),
   Routine(True,  True,  False, "2b", "her",   Tc, [Css,Zdd],      ["n"],               ["layout","triangle"],                                  ["x"],      ["a"],                        [xn,an],       ["alpha"],        "",    "Hermitian rank-1 matrix update", "Performs the operation _A = alpha * x * x^T + A_, in which x is an input vector, x^T is the transpose of this vector, _A_ is the triangular Hermetian matrix to be updated, and alpha is a scalar value.", [ald_n]),
   Routine(True,  True,  False, "2b", "hpr",   Tc, [Css,Zdd],      ["n"],               ["layout","triangle"],                                  ["x"],      ["ap"],                       [xn,apn],      ["alpha"],        "",    "Hermitian packed rank-1 matrix update", "Same operation as xHER, but matrix _A_ is an Hermitian packed matrix instead and represented as _AP_.", []),
   Routine(True,  True,  False, "2b", "her2",  T,  [C,Z],          ["n"],               ["layout","triangle"],                                  ["x","y"],  ["a"],                        [xn,yn,an],    ["alpha"],        "",    "Hermitian rank-2 matrix update", "Performs the operation _A = alpha * x * y^T + conj(alpha) * y * x^T + A_, in which _x_ is an input vector and _x^T_ its transpose, _y_ is an input vector and _y^T_ its transpose, _A_ is the triangular Hermetian matrix to be updated, _alpha_ is a scalar value and _conj(alpha)_ its complex conjugate.", [ald_n]),
@@ -165,6 +174,9 @@ ROUTINES = [
   Routine(True,  True,  False, "x", "omatcopy", T, [S,D,C,Z,H],   ["m","n"],            ["layout","a_transpose"],                              ["a"],      ["b"],                        [amn,bnma],      ["alpha"],        "",    "Scaling and out-place transpose/copy (non-BLAS function)", "Performs scaling and out-of-place transposition/copying of matrices according to _B = alpha*op(A)_, in which _A_ is an input matrix (_m_ rows by _n_ columns), _B_ an output matrix, and _alpha_ a scalar value. The operation _op_ can be a normal matrix copy, a transposition or a conjugate transposition.", [ald_m, bld_n]),
   # Batched routines:
   Routine(True,  True,  True,  "x", "axpy",     T, [S,D,C,Z,H],   ["n"],                [],                                                    ["x"],      ["y"],                        [xn,yn],         ["alpha"],        "",    "Batched version of AXPY", "As AXPY, but multiple operations are batched together for better performance.", []),
+  Routine(True,  True,  True,  "x", "dot",      T, [S,D,H],       ["n"],                [],                                                    ["x","y"],  ["dot"],                      [xn,yn,"1"],     [],               "",    "Batched version of DOT", "As DOT, but multiple operations are batched together for better performance. Each of the _batch_count_ results is stored at its own offset in the _dot_ buffer.", []),
+  Routine(True,  True,  True,  "x", "nrm2",     T, [S,D,Sc,Dz,H], ["n"],                [],                                                    ["x"],      ["nrm2"],                     [xn,"1"],        [],               "",    "Batched version of NRM2", "As NRM2, but multiple operations are batched together for better performance. Each of the _batch_count_ results is stored at its own offset in the _nrm2_ buffer.", []),
+  Routine(True,  True,  True,  "x", "gemv",     T, [S,D,C,Z,H],   ["m","n"],            ["layout","a_transpose"],                              ["a","x"],  ["y"],                        [amn,xmn,ynm],   ["alpha","beta"], "",    "Batched version of GEMV", "As GEMV, but multiple operations are batched together for better performance.", [ald_m]),
   Routine(True,  True,  True,  "x", "gemm",     T, [S,D,C,Z,H],   ["m","n","k"],        ["layout","a_transpose","b_transpose"],                ["a","b"],  ["c"],                        [amk,bkn,cmn],   ["alpha","beta"], "",    "Batched version of GEMM", "As GEMM, but multiple operations are batched together for better performance.", [ald_transa_m_k, bld_transb_k_n, cld_m]),
 ]]
 
@@ -86,7 +86,7 @@ def clblast_c_cc(routine):
         template = "<" + flavour.template + ">" if routine.no_scalars() else ""
         indent = " " * (16 + routine.length() + len(template))
         result += routine.routine_header_c(flavour, 27, "") + " {" + NL
-        if routine.batched:
+        if routine.batched and not routine.no_scalars():
             result += "  " + (NL + "  ").join(routine.batched_transform_to_complex(flavour)) + NL
         result += "  try {" + NL
         result += "    return static_cast<CLBlastStatusCode>(" + NL
@@ -175,7 +175,7 @@ def clblast_netlib_c_cc(routine):
 def wrapper_clblas(routine):
     """The wrapper to the reference clBLAS routines (for performance/correctness testing)"""
     result = ""
-    if routine.has_tests:
+    if routine.has_reference_wrappers():
         result += NL + "// Forwards the clBLAS calls for %s" % routine.short_names_tested() + NL
         if routine.no_scalars():
             result += routine.routine_header_wrapper_clblas(routine.template, True, 21) + ";" + NL
@@ -223,7 +223,7 @@ def wrapper_clblas(routine):
 def wrapper_cblas(routine):
     """The wrapper to the reference CBLAS routines (for performance/correctness testing)"""
     result = ""
-    if routine.has_tests:
+    if routine.has_reference_wrappers():
         result += NL + "// Forwards the Netlib BLAS calls for %s" % routine.short_names_tested() + NL
         for flavour in routine.flavours:
             result += routine.routine_header_wrapper_cblas(flavour, 12) + " {" + NL
@@ -293,7 +293,7 @@ def wrapper_cblas(routine):
 def wrapper_cublas(routine):
     """The wrapper to the reference cuBLAS routines (for performance/correctness testing)"""
     result = ""
-    if routine.has_tests:
+    if routine.has_reference_wrappers():
         result += NL + "// Forwards the cuBLAS calls for %s" % routine.short_names_tested() + NL
         if routine.no_scalars():
             result += routine.routine_header_wrapper_cublas(routine.template, True, 23) + ";" + NL
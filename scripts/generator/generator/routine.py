@@ -124,12 +124,12 @@ class Routine:
     @staticmethod
     def postfix(name):
         """Retrieves the postfix for a buffer"""
-        return "inc" if (name in ["x", "y"]) else "ld"
+        return "inc" if (name in ["x", "y", "z"]) else "ld"
 
     @staticmethod
     def buffers_vector():
         """Distinguish between vectors and matrices"""
-        return ["x", "y"]
+        return ["x", "y", "z"]
 
     @staticmethod
     def buffers_matrix():
@@ -138,7 +138,16 @@ class Routine:
 
     @staticmethod
     def routines_scalar_no_return():
-        return ["dotu", "dotc"]
+        return ["dotu", "dotc", "dot2"]
+
+    @staticmethod
+    def routines_without_reference():
+        """Non-BLAS routines with tests, but without a clBLAS/CBLAS/cuBLAS reference to wrap"""
+        return ["axpby", "waxpby", "axpydot", "axpynrm2", "dot2", "gerk"]
+
+    def has_reference_wrappers(self):
+        """Whether or not the routine is compared against the clBLAS/CBLAS/cuBLAS references"""
+        return self.has_tests and self.name not in self.routines_without_reference()
 
     @staticmethod
     def set_size(name, size):
@@ -221,7 +230,7 @@ class Routine:
     def buffers_second(self):
         if self.level == "2b":
             return ["ap", "a", "b", "c"]
-        return ["y", "c"]
+        return ["y", "z", "c"]
 
     def buffer(self, name):
         """Retrieves a variable name for a specific input/output vector/matrix (e.g. 'x')"""
@@ -64,6 +64,32 @@ void Cache<Key, Value>::Store(Key &&key, Value &&value) {
 #endif
 }
 
+template <typename Key, typename Value>
+Value Cache<Key, Value>::GetOrCreate(const Key &key,
+                                     const std::function<bool(const Value&)> &is_valid,
+                                     const std::function<Value()> &create) {
+  std::lock_guard<std::mutex> lock(cache_mutex_);
+
+#if __cplusplus >= 201402L
+  auto it = cache_.find(key);
+#else
+  auto it = std::find_if(cache_.begin(), cache_.end(), [&] (const std::pair<Key, Value> &pair) {
+    return pair.first == key;
+  });
+#endif
+  if (it != cache_.end() && is_valid(it->second)) { return it->second; }
+
+  // Replaces an invalid object by erasing it, as the values (e.g. buffers) might not be assignable
+  auto value = create();
+  if (it != cache_.end()) { cache_.erase(it); }
+#if __cplusplus >= 201402L
+  cache_.emplace(key, value);
+#else
+  cache_.emplace_back(key, value);
+#endif
+  return value;
+}
+
 template <typename Key, typename Value>
 void Cache<Key, Value>::Remove(const Key &key) {
   std::lock_guard<std::mutex> lock(cache_mutex_);
@@ -95,6 +121,18 @@ void Cache<Key, Value>::RemoveBySubset(const Key &key) {
   }
 }
 
+template <typename Key, typename Value>
+void Cache<Key, Value>::RemoveIf(const std::function<bool(const Key&)> &condition) {
+  std::lock_guard<std::mutex> lock(cache_mutex_);
+  auto it = cache_.begin();
+  while (it != cache_.end()) {
+    if (condition((*it).first)) {
+      it = cache_.erase(it);
+    }
+    else ++it;
+  }
+}
+
 template <typename Key, typename Value>
 void Cache<Key, Value>::Invalidate() {
   std::lock_guard<std::mutex> lock(cache_mutex_);
@@ -126,5 +164,15 @@ template void ProgramCache::RemoveBySubset<1, 2>(const ProgramKey &); // precisi
 template class Cache<DatabaseKey, Database>;
 template Database DatabaseCache::Get(const DatabaseKeyRef &, bool *) const;
 
+// =================================================================================================
+
+template class Cache<AuxiliaryQueueKey, std::vector<Queue>>;
+template std::vector<Queue> AuxiliaryQueueCache::Get(const AuxiliaryQueueKey &, bool *) const;
+
+// =================================================================================================
+
+template class Cache<ScratchKey, std::vector<Buffer<unsigned int>>>;
+template std::vector<Buffer<unsigned int>> ScratchCache::Get(const ScratchKey &, bool *) const;
+
 // =================================================================================================
 } // namespace clblast
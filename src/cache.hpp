@@ -17,6 +17,8 @@
 #include <string>
 #include <mutex>
 #include <map>
+#include <vector>
+#include <functional>
 
 #include "utilities/utilities.hpp"
 
@@ -42,10 +44,19 @@ public:
   void Store(Key &&key, Value &&value);
   void Invalidate();
 
+  // Returns the cached object if it is accepted by 'is_valid', otherwise replaces it by (or stores)
+  // the result of 'create'. This happens under a single lock, such that concurrent callers can't
+  // both create an object for the same key.
+  Value GetOrCreate(const Key &key, const std::function<bool(const Value&)> &is_valid,
+                    const std::function<Value()> &create);
+
   // Removes all entries with a given key
   void Remove(const Key &key);
   template <int I1, int I2> void RemoveBySubset(const Key &key); // currently supports 2 indices
 
+  // Removes all entries with a key for which 'condition' holds
+  void RemoveIf(const std::function<bool(const Key&)> &condition);
+
   static Cache<Key, Value> &Instance();
 
 private:
@@ -102,6 +113,29 @@ typedef Cache<DatabaseKey, Database> DatabaseCache;
 extern template class Cache<DatabaseKey, Database>;
 extern template Database DatabaseCache::Get(const DatabaseKeyRef &, bool *) const;
 
+// =================================================================================================
+
+// The store of auxiliary command-queues registered for a (main) command-queue. These are used to
+// run independent steps of a routine concurrently. Not cleared by 'ClearCache'.
+typedef cl_command_queue AuxiliaryQueueKey;
+
+typedef Cache<AuxiliaryQueueKey, std::vector<Queue>> AuxiliaryQueueCache;
+
+extern template class Cache<AuxiliaryQueueKey, std::vector<Queue>>;
+extern template std::vector<Queue> AuxiliaryQueueCache::Get(const AuxiliaryQueueKey &, bool *) const;
+
+// =================================================================================================
+
+// The store of scratch buffers of kernels with partial results (e.g. the single-pass reductions),
+// one set per command-queue (and context, as a queue's handle might be re-used after release) and
+// kind of kernel. Sharing a set is safe as long as the queue executes in-order.
+typedef std::tuple<cl_command_queue, cl_context, std::string> ScratchKey;
+
+typedef Cache<ScratchKey, std::vector<Buffer<unsigned int>>> ScratchCache;
+
+extern template class Cache<ScratchKey, std::vector<Buffer<unsigned int>>>;
+extern template std::vector<Buffer<unsigned int>> ScratchCache::Get(const ScratchKey &, bool *) const;
+
 // =================================================================================================
 } // namespace clblast
 
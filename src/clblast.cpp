@@ -17,8 +17,13 @@
 
 #include "cache.hpp"
 #include "clblast.h"
+#include "database/tuning_results.hpp"
 
 // BLAS level-1 includes
+#include "routines/level1/xrotg.hpp"
+#include "routines/level1/xrotmg.hpp"
+#include "routines/level1/xrot.hpp"
+#include "routines/level1/xrotm.hpp"
 #include "routines/level1/xswap.hpp"
 #include "routines/level1/xscal.hpp"
 #include "routines/level1/xcopy.hpp"
@@ -33,6 +38,11 @@
 #include "routines/level1/xamin.hpp" // non-BLAS routine
 #include "routines/level1/xmax.hpp" // non-BLAS routine
 #include "routines/level1/xmin.hpp" // non-BLAS routine
+#include "routines/level1/xaxpby.hpp" // non-BLAS routine
+#include "routines/level1/xwaxpby.hpp" // non-BLAS routine
+#include "routines/level1/xaxpydot.hpp" // non-BLAS routine
+#include "routines/level1/xaxpynrm2.hpp" // non-BLAS routine
+#include "routines/level1/xdot2.hpp" // non-BLAS routine
 
 // BLAS level-2 includes
 #include "routines/level2/xgemv.hpp"
@@ -47,9 +57,12 @@
 #include "routines/level2/xtbmv.hpp"
 #include "routines/level2/xtpmv.hpp"
 #include "routines/level2/xtrsv.hpp"
+#include "routines/level2/xtbsv.hpp"
+#include "routines/level2/xtpsv.hpp"
 #include "routines/level2/xger.hpp"
 #include "routines/level2/xgeru.hpp"
 #include "routines/level2/xgerc.hpp"
+#include "routines/level2/xgerk.hpp" // non-BLAS routine
 #include "routines/level2/xher.hpp"
 #include "routines/level2/xhpr.hpp"
 #include "routines/level2/xher2.hpp"
@@ -73,7 +86,11 @@
 // Level-x includes (non-BLAS)
 #include "routines/levelx/xomatcopy.hpp"
 #include "routines/levelx/xaxpybatched.hpp"
+#include "routines/levelx/xdotbatched.hpp"
+#include "routines/levelx/xnrm2batched.hpp"
+#include "routines/levelx/xgemvbatched.hpp"
 #include "routines/levelx/xgemmbatched.hpp"
+#include "routines/levelx/xfused.hpp" // non-BLAS routine
 
 namespace clblast {
 
@@ -83,12 +100,20 @@ namespace clblast {
 
 // Generate givens plane rotation: SROTG/DROTG
 template <typename T>
-StatusCode Rotg(cl_mem, const size_t,
-                cl_mem, const size_t,
-                cl_mem, const size_t,
-                cl_mem, const size_t,
-                cl_command_queue*, cl_event*) {
-  return StatusCode::kNotImplemented;
+StatusCode Rotg(cl_mem sa_buffer, const size_t sa_offset,
+                cl_mem sb_buffer, const size_t sb_offset,
+                cl_mem sc_buffer, const size_t sc_offset,
+                cl_mem ss_buffer, const size_t ss_offset,
+                cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = Xrotg<T>(queue_cpp, event);
+    routine.DoRotg(Buffer<T>(sa_buffer), sa_offset,
+                   Buffer<T>(sb_buffer), sb_offset,
+                   Buffer<T>(sc_buffer), sc_offset,
+                   Buffer<T>(ss_buffer), ss_offset);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
 }
 template StatusCode PUBLIC_API Rotg<float>(cl_mem, const size_t,
                                            cl_mem, const size_t,
@@ -103,13 +128,22 @@ template StatusCode PUBLIC_API Rotg<double>(cl_mem, const size_t,
 
 // Generate modified givens plane rotation: SROTMG/DROTMG
 template <typename T>
-StatusCode Rotmg(cl_mem, const size_t,
-                 cl_mem, const size_t,
-                 cl_mem, const size_t,
-                 const cl_mem, const size_t,
-                 cl_mem, const size_t,
-                 cl_command_queue*, cl_event*) {
-  return StatusCode::kNotImplemented;
+StatusCode Rotmg(cl_mem sd1_buffer, const size_t sd1_offset,
+                 cl_mem sd2_buffer, const size_t sd2_offset,
+                 cl_mem sx1_buffer, const size_t sx1_offset,
+                 const cl_mem sy1_buffer, const size_t sy1_offset,
+                 cl_mem sparam_buffer, const size_t sparam_offset,
+                 cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = Xrotmg<T>(queue_cpp, event);
+    routine.DoRotmg(Buffer<T>(sd1_buffer), sd1_offset,
+                    Buffer<T>(sd2_buffer), sd2_offset,
+                    Buffer<T>(sx1_buffer), sx1_offset,
+                    Buffer<T>(sy1_buffer), sy1_offset,
+                    Buffer<T>(sparam_buffer), sparam_offset);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
 }
 template StatusCode PUBLIC_API Rotmg<float>(cl_mem, const size_t,
                                             cl_mem, const size_t,
@@ -126,13 +160,22 @@ template StatusCode PUBLIC_API Rotmg<double>(cl_mem, const size_t,
 
 // Apply givens plane rotation: SROT/DROT
 template <typename T>
-StatusCode Rot(const size_t,
-               cl_mem, const size_t, const size_t,
-               cl_mem, const size_t, const size_t,
-               const T,
-               const T,
-               cl_command_queue*, cl_event*) {
-  return StatusCode::kNotImplemented;
+StatusCode Rot(const size_t n,
+               cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+               cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+               const T cos,
+               const T sin,
+               cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = Xrot<T>(queue_cpp, event);
+    routine.DoRot(n,
+                  Buffer<T>(x_buffer), x_offset, x_inc,
+                  Buffer<T>(y_buffer), y_offset, y_inc,
+                  cos,
+                  sin);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
 }
 template StatusCode PUBLIC_API Rot<float>(const size_t,
                                           cl_mem, const size_t, const size_t,
@@ -149,12 +192,20 @@ template StatusCode PUBLIC_API Rot<double>(const size_t,
 
 // Apply modified givens plane rotation: SROTM/DROTM
 template <typename T>
-StatusCode Rotm(const size_t,
-                cl_mem, const size_t, const size_t,
-                cl_mem, const size_t, const size_t,
-                cl_mem, const size_t,
-                cl_command_queue*, cl_event*) {
-  return StatusCode::kNotImplemented;
+StatusCode Rotm(const size_t n,
+                cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                cl_mem sparam_buffer, const size_t sparam_offset,
+                cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = Xrotm<T>(queue_cpp, event);
+    routine.DoRotm(n,
+                   Buffer<T>(x_buffer), x_offset, x_inc,
+                   Buffer<T>(y_buffer), y_offset, y_inc,
+                   Buffer<T>(sparam_buffer), sparam_offset);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
 }
 template StatusCode PUBLIC_API Rotm<float>(const size_t,
                                            cl_mem, const size_t, const size_t,
@@ -659,6 +710,227 @@ template StatusCode PUBLIC_API Min<half>(const size_t,
                                          const cl_mem, const size_t, const size_t,
                                          cl_command_queue*, cl_event*);
 
+// Scaled vector addition (non-BLAS function): SAXPBY/DAXPBY/CAXPBY/ZAXPBY/HAXPBY
+template <typename T>
+StatusCode Axpby(const size_t n,
+                 const T alpha,
+                 const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                 const T beta,
+                 cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                 cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = Xaxpby<T>(queue_cpp, event);
+    routine.DoAxpby(n,
+                    alpha,
+                    Buffer<T>(x_buffer), x_offset, x_inc,
+                    beta,
+                    Buffer<T>(y_buffer), y_offset, y_inc);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API Axpby<float>(const size_t,
+                                            const float,
+                                            const cl_mem, const size_t, const size_t,
+                                            const float,
+                                            cl_mem, const size_t, const size_t,
+                                            cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Axpby<double>(const size_t,
+                                             const double,
+                                             const cl_mem, const size_t, const size_t,
+                                             const double,
+                                             cl_mem, const size_t, const size_t,
+                                             cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Axpby<float2>(const size_t,
+                                             const float2,
+                                             const cl_mem, const size_t, const size_t,
+                                             const float2,
+                                             cl_mem, const size_t, const size_t,
+                                             cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Axpby<double2>(const size_t,
+                                              const double2,
+                                              const cl_mem, const size_t, const size_t,
+                                              const double2,
+                                              cl_mem, const size_t, const size_t,
+                                              cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Axpby<half>(const size_t,
+                                           const half,
+                                           const cl_mem, const size_t, const size_t,
+                                           const half,
+                                           cl_mem, const size_t, const size_t,
+                                           cl_command_queue*, cl_event*);
+
+// Scaled vector addition into a third vector (non-BLAS function): SWAXPBY/DWAXPBY/CWAXPBY/ZWAXPBY/HWAXPBY
+template <typename T>
+StatusCode Waxpby(const size_t n,
+                  const T alpha,
+                  const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                  const T beta,
+                  const cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                  cl_mem z_buffer, const size_t z_offset, const size_t z_inc,
+                  cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = Xwaxpby<T>(queue_cpp, event);
+    routine.DoWaxpby(n,
+                     alpha,
+                     Buffer<T>(x_buffer), x_offset, x_inc,
+                     beta,
+                     Buffer<T>(y_buffer), y_offset, y_inc,
+                     Buffer<T>(z_buffer), z_offset, z_inc);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API Waxpby<float>(const size_t,
+                                             const float,
+                                             const cl_mem, const size_t, const size_t,
+                                             const float,
+                                             const cl_mem, const size_t, const size_t,
+                                             cl_mem, const size_t, const size_t,
+                                             cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Waxpby<double>(const size_t,
+                                              const double,
+                                              const cl_mem, const size_t, const size_t,
+                                              const double,
+                                              const cl_mem, const size_t, const size_t,
+                                              cl_mem, const size_t, const size_t,
+                                              cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Waxpby<float2>(const size_t,
+                                              const float2,
+                                              const cl_mem, const size_t, const size_t,
+                                              const float2,
+                                              const cl_mem, const size_t, const size_t,
+                                              cl_mem, const size_t, const size_t,
+                                              cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Waxpby<double2>(const size_t,
+                                               const double2,
+                                               const cl_mem, const size_t, const size_t,
+                                               const double2,
+                                               const cl_mem, const size_t, const size_t,
+                                               cl_mem, const size_t, const size_t,
+                                               cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Waxpby<half>(const size_t,
+                                            const half,
+                                            const cl_mem, const size_t, const size_t,
+                                            const half,
+                                            const cl_mem, const size_t, const size_t,
+                                            cl_mem, const size_t, const size_t,
+                                            cl_command_queue*, cl_event*);
+
+// Vector update followed by its dot product (non-BLAS function): SAXPYDOT/DAXPYDOT/HAXPYDOT
+template <typename T>
+StatusCode Axpydot(const size_t n,
+                   cl_mem dot_buffer, const size_t dot_offset,
+                   const T alpha,
+                   const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                   cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                   cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = Xaxpydot<T>(queue_cpp, event);
+    routine.DoAxpydot(n,
+                      Buffer<T>(dot_buffer), dot_offset,
+                      alpha,
+                      Buffer<T>(x_buffer), x_offset, x_inc,
+                      Buffer<T>(y_buffer), y_offset, y_inc);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API Axpydot<float>(const size_t,
+                                              cl_mem, const size_t,
+                                              const float,
+                                              const cl_mem, const size_t, const size_t,
+                                              cl_mem, const size_t, const size_t,
+                                              cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Axpydot<double>(const size_t,
+                                               cl_mem, const size_t,
+                                               const double,
+                                               const cl_mem, const size_t, const size_t,
+                                               cl_mem, const size_t, const size_t,
+                                               cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Axpydot<half>(const size_t,
+                                             cl_mem, const size_t,
+                                             const half,
+                                             const cl_mem, const size_t, const size_t,
+                                             cl_mem, const size_t, const size_t,
+                                             cl_command_queue*, cl_event*);
+
+// Vector update followed by its Euclidian norm (non-BLAS function): SAXPYNRM2/DAXPYNRM2/HAXPYNRM2
+template <typename T>
+StatusCode Axpynrm2(const size_t n,
+                    cl_mem nrm2_buffer, const size_t nrm2_offset,
+                    const T alpha,
+                    const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                    cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                    cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = Xaxpynrm2<T>(queue_cpp, event);
+    routine.DoAxpynrm2(n,
+                       Buffer<T>(nrm2_buffer), nrm2_offset,
+                       alpha,
+                       Buffer<T>(x_buffer), x_offset, x_inc,
+                       Buffer<T>(y_buffer), y_offset, y_inc);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API Axpynrm2<float>(const size_t,
+                                               cl_mem, const size_t,
+                                               const float,
+                                               const cl_mem, const size_t, const size_t,
+                                               cl_mem, const size_t, const size_t,
+                                               cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Axpynrm2<double>(const size_t,
+                                                cl_mem, const size_t,
+                                                const double,
+                                                const cl_mem, const size_t, const size_t,
+                                                cl_mem, const size_t, const size_t,
+                                                cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Axpynrm2<half>(const size_t,
+                                              cl_mem, const size_t,
+                                              const half,
+                                              const cl_mem, const size_t, const size_t,
+                                              cl_mem, const size_t, const size_t,
+                                              cl_command_queue*, cl_event*);
+
+// Dot products of a vector with two other vectors (non-BLAS function): SDOT2/DDOT2/HDOT2
+template <typename T>
+StatusCode Dot2(const size_t n,
+                cl_mem dot_buffer, const size_t dot_offset,
+                const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                const cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                const cl_mem z_buffer, const size_t z_offset, const size_t z_inc,
+                cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = Xdot2<T>(queue_cpp, event);
+    routine.DoDot2(n,
+                   Buffer<T>(dot_buffer), dot_offset,
+                   Buffer<T>(x_buffer), x_offset, x_inc,
+                   Buffer<T>(y_buffer), y_offset, y_inc,
+                   Buffer<T>(z_buffer), z_offset, z_inc);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API Dot2<float>(const size_t,
+                                           cl_mem, const size_t,
+                                           const cl_mem, const size_t, const size_t,
+                                           const cl_mem, const size_t, const size_t,
+                                           const cl_mem, const size_t, const size_t,
+                                           cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Dot2<double>(const size_t,
+                                            cl_mem, const size_t,
+                                            const cl_mem, const size_t, const size_t,
+                                            const cl_mem, const size_t, const size_t,
+                                            const cl_mem, const size_t, const size_t,
+                                            cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Dot2<half>(const size_t,
+                                          cl_mem, const size_t,
+                                          const cl_mem, const size_t, const size_t,
+                                          const cl_mem, const size_t, const size_t,
+                                          const cl_mem, const size_t, const size_t,
+                                          cl_command_queue*, cl_event*);
+
 // =================================================================================================
 // BLAS level-2 (matrix-vector) routines
 // =================================================================================================
@@ -1224,12 +1496,20 @@ template StatusCode PUBLIC_API Trsv<double2>(const Layout, const Triangle, const
 
 // Solves a banded triangular system of equations: STBSV/DTBSV/CTBSV/ZTBSV
 template <typename T>
-StatusCode Tbsv(const Layout, const Triangle, const Transpose, const Diagonal,
-                const size_t, const size_t,
-                const cl_mem, const size_t, const size_t,
-                cl_mem, const size_t, const size_t,
-                cl_command_queue*, cl_event*) {
-  return StatusCode::kNotImplemented;
+StatusCode Tbsv(const Layout layout, const Triangle triangle, const Transpose a_transpose, const Diagonal diagonal,
+                const size_t n, const size_t k,
+                const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = Xtbsv<T>(queue_cpp, event);
+    routine.DoTbsv(layout, triangle, a_transpose, diagonal,
+                   n, k,
+                   Buffer<T>(a_buffer), a_offset, a_ld,
+                   Buffer<T>(x_buffer), x_offset, x_inc);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
 }
 template StatusCode PUBLIC_API Tbsv<float>(const Layout, const Triangle, const Transpose, const Diagonal,
                                            const size_t, const size_t,
@@ -1254,12 +1534,20 @@ template StatusCode PUBLIC_API Tbsv<double2>(const Layout, const Triangle, const
 
 // Solves a packed triangular system of equations: STPSV/DTPSV/CTPSV/ZTPSV
 template <typename T>
-StatusCode Tpsv(const Layout, const Triangle, const Transpose, const Diagonal,
-                const size_t,
-                const cl_mem, const size_t,
-                cl_mem, const size_t, const size_t,
-                cl_command_queue*, cl_event*) {
-  return StatusCode::kNotImplemented;
+StatusCode Tpsv(const Layout layout, const Triangle triangle, const Transpose a_transpose, const Diagonal diagonal,
+                const size_t n,
+                const cl_mem ap_buffer, const size_t ap_offset,
+                cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = Xtpsv<T>(queue_cpp, event);
+    routine.DoTpsv(layout, triangle, a_transpose, diagonal,
+                   n,
+                   Buffer<T>(ap_buffer), ap_offset,
+                   Buffer<T>(x_buffer), x_offset, x_inc);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
 }
 template StatusCode PUBLIC_API Tpsv<float>(const Layout, const Triangle, const Transpose, const Diagonal,
                                            const size_t,
@@ -1397,6 +1685,63 @@ template StatusCode PUBLIC_API Gerc<double2>(const Layout,
                                              cl_mem, const size_t, const size_t,
                                              cl_command_queue*, cl_event*);
 
+// General rank-k matrix update (non-BLAS function): SGERK/DGERK/CGERK/ZGERK/HGERK
+template <typename T>
+StatusCode Gerk(const Layout layout,
+                const size_t m, const size_t n, const size_t k,
+                const T alpha,
+                const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                const cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = Xgerk<T>(queue_cpp, event);
+    routine.DoGerk(layout,
+                   m, n, k,
+                   alpha,
+                   Buffer<T>(x_buffer), x_offset, x_inc,
+                   Buffer<T>(y_buffer), y_offset, y_inc,
+                   Buffer<T>(a_buffer), a_offset, a_ld);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API Gerk<float>(const Layout,
+                                           const size_t, const size_t, const size_t,
+                                           const float,
+                                           const cl_mem, const size_t, const size_t,
+                                           const cl_mem, const size_t, const size_t,
+                                           cl_mem, const size_t, const size_t,
+                                           cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Gerk<double>(const Layout,
+                                            const size_t, const size_t, const size_t,
+                                            const double,
+                                            const cl_mem, const size_t, const size_t,
+                                            const cl_mem, const size_t, const size_t,
+                                            cl_mem, const size_t, const size_t,
+                                            cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Gerk<float2>(const Layout,
+                                            const size_t, const size_t, const size_t,
+                                            const float2,
+                                            const cl_mem, const size_t, const size_t,
+                                            const cl_mem, const size_t, const size_t,
+                                            cl_mem, const size_t, const size_t,
+                                            cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Gerk<double2>(const Layout,
+                                             const size_t, const size_t, const size_t,
+                                             const double2,
+                                             const cl_mem, const size_t, const size_t,
+                                             const cl_mem, const size_t, const size_t,
+                                             cl_mem, const size_t, const size_t,
+                                             cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Gerk<half>(const Layout,
+                                          const size_t, const size_t, const size_t,
+                                          const half,
+                                          const cl_mem, const size_t, const size_t,
+                                          const cl_mem, const size_t, const size_t,
+                                          cl_mem, const size_t, const size_t,
+                                          cl_command_queue*, cl_event*);
+
 // Hermitian rank-1 matrix update: CHER/ZHER
 template <typename T>
 StatusCode Her(const Layout layout, const Triangle triangle,
@@ -2270,6 +2615,184 @@ template StatusCode PUBLIC_API AxpyBatched<half>(const size_t,
                                                  const size_t,
                                                  cl_command_queue*, cl_event*);
 
+// Batched version of DOT: SDOTBATCHED/DDOTBATCHED/HDOTBATCHED
+template <typename T>
+StatusCode DotBatched(const size_t n,
+                      cl_mem dot_buffer, const size_t *dot_offsets,
+                      const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                      const cl_mem y_buffer, const size_t *y_offsets, const size_t y_inc,
+                      const size_t batch_count,
+                      cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = XdotBatched<T>(queue_cpp, event);
+    auto x_offsets_cpp = std::vector<size_t>();
+    auto y_offsets_cpp = std::vector<size_t>();
+    auto dot_offsets_cpp = std::vector<size_t>();
+    for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+      x_offsets_cpp.push_back(x_offsets[batch]);
+      y_offsets_cpp.push_back(y_offsets[batch]);
+      dot_offsets_cpp.push_back(dot_offsets[batch]);
+    }
+    routine.DoDotBatched(n,
+                         Buffer<T>(dot_buffer), dot_offsets_cpp,
+                         Buffer<T>(x_buffer), x_offsets_cpp, x_inc,
+                         Buffer<T>(y_buffer), y_offsets_cpp, y_inc,
+                         batch_count);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API DotBatched<float>(const size_t,
+                                                 cl_mem, const size_t*,
+                                                 const cl_mem, const size_t*, const size_t,
+                                                 const cl_mem, const size_t*, const size_t,
+                                                 const size_t,
+                                                 cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API DotBatched<double>(const size_t,
+                                                  cl_mem, const size_t*,
+                                                  const cl_mem, const size_t*, const size_t,
+                                                  const cl_mem, const size_t*, const size_t,
+                                                  const size_t,
+                                                  cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API DotBatched<half>(const size_t,
+                                                cl_mem, const size_t*,
+                                                const cl_mem, const size_t*, const size_t,
+                                                const cl_mem, const size_t*, const size_t,
+                                                const size_t,
+                                                cl_command_queue*, cl_event*);
+
+// Batched version of NRM2: SNRM2BATCHED/DNRM2BATCHED/ScNRM2BATCHED/DzNRM2BATCHED/HNRM2BATCHED
+template <typename T>
+StatusCode Nrm2Batched(const size_t n,
+                       cl_mem nrm2_buffer, const size_t *nrm2_offsets,
+                       const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                       const size_t batch_count,
+                       cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = Xnrm2Batched<T>(queue_cpp, event);
+    auto x_offsets_cpp = std::vector<size_t>();
+    auto nrm2_offsets_cpp = std::vector<size_t>();
+    for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+      x_offsets_cpp.push_back(x_offsets[batch]);
+      nrm2_offsets_cpp.push_back(nrm2_offsets[batch]);
+    }
+    routine.DoNrm2Batched(n,
+                          Buffer<T>(nrm2_buffer), nrm2_offsets_cpp,
+                          Buffer<T>(x_buffer), x_offsets_cpp, x_inc,
+                          batch_count);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API Nrm2Batched<float>(const size_t,
+                                                  cl_mem, const size_t*,
+                                                  const cl_mem, const size_t*, const size_t,
+                                                  const size_t,
+                                                  cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Nrm2Batched<double>(const size_t,
+                                                   cl_mem, const size_t*,
+                                                   const cl_mem, const size_t*, const size_t,
+                                                   const size_t,
+                                                   cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Nrm2Batched<float2>(const size_t,
+                                                   cl_mem, const size_t*,
+                                                   const cl_mem, const size_t*, const size_t,
+                                                   const size_t,
+                                                   cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Nrm2Batched<double2>(const size_t,
+                                                    cl_mem, const size_t*,
+                                                    const cl_mem, const size_t*, const size_t,
+                                                    const size_t,
+                                                    cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Nrm2Batched<half>(const size_t,
+                                                 cl_mem, const size_t*,
+                                                 const cl_mem, const size_t*, const size_t,
+                                                 const size_t,
+                                                 cl_command_queue*, cl_event*);
+
+// Batched version of GEMV: SGEMVBATCHED/DGEMVBATCHED/CGEMVBATCHED/ZGEMVBATCHED/HGEMVBATCHED
+template <typename T>
+StatusCode GemvBatched(const Layout layout, const Transpose a_transpose,
+                       const size_t m, const size_t n,
+                       const T *alphas,
+                       const cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld,
+                       const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                       const T *betas,
+                       cl_mem y_buffer, const size_t *y_offsets, const size_t y_inc,
+                       const size_t batch_count,
+                       cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = XgemvBatched<T>(queue_cpp, event);
+    auto alphas_cpp = std::vector<T>();
+    auto betas_cpp = std::vector<T>();
+    auto a_offsets_cpp = std::vector<size_t>();
+    auto x_offsets_cpp = std::vector<size_t>();
+    auto y_offsets_cpp = std::vector<size_t>();
+    for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+      alphas_cpp.push_back(alphas[batch]);
+      betas_cpp.push_back(betas[batch]);
+      a_offsets_cpp.push_back(a_offsets[batch]);
+      x_offsets_cpp.push_back(x_offsets[batch]);
+      y_offsets_cpp.push_back(y_offsets[batch]);
+    }
+    routine.DoGemvBatched(layout, a_transpose,
+                          m, n,
+                          alphas_cpp,
+                          Buffer<T>(a_buffer), a_offsets_cpp, a_ld,
+                          Buffer<T>(x_buffer), x_offsets_cpp, x_inc,
+                          betas_cpp,
+                          Buffer<T>(y_buffer), y_offsets_cpp, y_inc,
+                          batch_count);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API GemvBatched<float>(const Layout, const Transpose,
+                                                  const size_t, const size_t,
+                                                  const float*,
+                                                  const cl_mem, const size_t*, const size_t,
+                                                  const cl_mem, const size_t*, const size_t,
+                                                  const float*,
+                                                  cl_mem, const size_t*, const size_t,
+                                                  const size_t,
+                                                  cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemvBatched<double>(const Layout, const Transpose,
+                                                   const size_t, const size_t,
+                                                   const double*,
+                                                   const cl_mem, const size_t*, const size_t,
+                                                   const cl_mem, const size_t*, const size_t,
+                                                   const double*,
+                                                   cl_mem, const size_t*, const size_t,
+                                                   const size_t,
+                                                   cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemvBatched<float2>(const Layout, const Transpose,
+                                                   const size_t, const size_t,
+                                                   const float2*,
+                                                   const cl_mem, const size_t*, const size_t,
+                                                   const cl_mem, const size_t*, const size_t,
+                                                   const float2*,
+                                                   cl_mem, const size_t*, const size_t,
+                                                   const size_t,
+                                                   cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemvBatched<double2>(const Layout, const Transpose,
+                                                    const size_t, const size_t,
+                                                    const double2*,
+                                                    const cl_mem, const size_t*, const size_t,
+                                                    const cl_mem, const size_t*, const size_t,
+                                                    const double2*,
+                                                    cl_mem, const size_t*, const size_t,
+                                                    const size_t,
+                                                    cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemvBatched<half>(const Layout, const Transpose,
+                                                 const size_t, const size_t,
+                                                 const half*,
+                                                 const cl_mem, const size_t*, const size_t,
+                                                 const cl_mem, const size_t*, const size_t,
+                                                 const half*,
+                                                 cl_mem, const size_t*, const size_t,
+                                                 const size_t,
+                                                 cl_command_queue*, cl_event*);
+
 // Batched version of GEMM: SGEMMBATCHED/DGEMMBATCHED/CGEMMBATCHED/ZGEMMBATCHED/HGEMMBATCHED
 template <typename T>
 StatusCode GemmBatched(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
@@ -2359,6 +2882,7 @@ StatusCode ClearCache() {
   try {
     ProgramCache::Instance().Invalidate();
     BinaryCache::Instance().Invalidate();
+    ScratchCache::Instance().Invalidate();
   } catch (...) { return DispatchException(); }
   return StatusCode::kSuccess;
 }
@@ -2467,11 +2991,15 @@ StatusCode OverrideParameters(const cl_device_id device, const std::string &kern
       }
     }
 
-    // Clears the existing program & binary cache for routines with the target kernel
+    // Clears the existing program & binary cache for routines with the target kernel, including
+    // their variants (e.g. the programs per shape class or of the chains of fused steps)
     const auto routine_names = Routine::routines_by_kernel.at(kernel_name);
     for (const auto &routine_name : routine_names) {
       ProgramCache::Instance().RemoveBySubset<1, 2>(ProgramKey{nullptr, device, precision, routine_name});
-      BinaryCache::Instance().Remove(BinaryKey{precision, routine_name, device_name});
+      BinaryCache::Instance().RemoveIf([&](const BinaryKey &key) -> bool {
+        return std::get<0>(key) == precision && std::get<2>(key) == device_name &&
+               Routine::IsProgramOfRoutine(std::get<1>(key), routine_name);
+      });
     }
 
     // Creates a small custom database based on the provided parameters
@@ -2481,13 +3009,133 @@ StatusCode OverrideParameters(const cl_device_id device, const std::string &kern
     const auto database_entries = std::vector<Database::DatabaseEntry>{database_entry};
     const auto database = Database(device_cpp, kernel_name, precision, database_entries);
 
-    // Removes the old database entry and stores the new one in the cache
-    DatabaseCache::Instance().Remove(DatabaseKey{ precision, device_name, kernel_name });
-    DatabaseCache::Instance().Store(DatabaseKey{ precision, device_name, kernel_name }, Database(database));
+    // Removes the old database entry and stores the new one in the cache. This is also done for the
+    // entries of the shape classes, such that the new parameters are used for problems of any shape.
+    for (const auto &shape_bucket : {std::string{}, database::kShapeBucketSmall,
+                                     database::kShapeBucketWide, database::kShapeBucketDeep}) {
+      const auto bucket_kernel_name = Database::ShapeBucketKernelName(kernel_name, shape_bucket);
+      DatabaseCache::Instance().Remove(DatabaseKey{ precision, device_name, bucket_kernel_name });
+      DatabaseCache::Instance().Store(DatabaseKey{ precision, device_name, bucket_kernel_name }, Database(database));
+    }
 
   } catch (...) { return DispatchException(); }
   return StatusCode::kSuccess;
 }
 
+// Retrieves the parameters and their origin from the database cache
+StatusCode RetrieveParameters(const cl_device_id device, const std::string &kernel_name,
+                              const Precision precision,
+                              std::unordered_map<std::string,size_t> &parameters,
+                              std::string &database_entry) {
+  try {
+
+    // Retrieves the device name
+    const auto device_cpp = Device(device);
+    const auto device_name = device_cpp.Name();
+
+    // Retrieves the current database values
+    auto in_cache = false;
+    const auto database = DatabaseCache::Instance().Get(DatabaseKeyRef{ precision, device_name, kernel_name }, &in_cache);
+    if (!in_cache) { return StatusCode::kInvalidOverrideKernel; }
+    parameters.clear();
+    for (const auto &name : database.GetParameterNames()) {
+      parameters[name] = database[name];
+    }
+    database_entry = database.GetDatabaseEntry();
+
+  } catch (...) { return DispatchException(); }
+  return StatusCode::kSuccess;
+}
+
+// Loads tuning results into the overlay database
+StatusCode LoadTuningResults(const std::string &path) {
+  try {
+    auto errors = std::vector<TuningResultsError>();
+    const auto kernel_names = LoadTuningResultsOverlay(path, errors);
+
+    // Clears the parameter databases and the compiled programs, such that the new results are used
+    if (!kernel_names.empty()) {
+      DatabaseCache::Instance().Invalidate();
+      ProgramCache::Instance().Invalidate();
+      BinaryCache::Instance().Invalidate();
+    }
+
+    // Reports the first file which was skipped
+    if (!errors.empty()) { return errors.front().second; }
+  } catch (...) { return DispatchException(); }
+  return StatusCode::kSuccess;
+}
+
+// =================================================================================================
+
+// Registers (or removes) the auxiliary queues for this command-queue
+StatusCode SetAuxiliaryQueues(const cl_command_queue queue,
+                              const std::vector<cl_command_queue> &auxiliary_queues) {
+  try {
+    const auto queue_cpp = Queue(queue);
+    const auto context = queue_cpp.GetContext();
+    const auto device = queue_cpp.GetDevice();
+
+    // The auxiliary queues have to use the same context and device as the main queue
+    auto auxiliary_queues_cpp = std::vector<Queue>();
+    for (const auto &auxiliary_queue : auxiliary_queues) {
+      const auto auxiliary_queue_cpp = Queue(auxiliary_queue);
+      if (auxiliary_queue == queue ||
+          auxiliary_queue_cpp.GetContext()() != context() ||
+          auxiliary_queue_cpp.GetDevice()() != device()) {
+        return StatusCode::kInvalidCommandQueue;
+      }
+      auxiliary_queues_cpp.push_back(auxiliary_queue_cpp);
+    }
+
+    // Replaces the existing registration (if any)
+    AuxiliaryQueueCache::Instance().Remove(queue);
+    if (!auxiliary_queues_cpp.empty()) {
+      AuxiliaryQueueCache::Instance().Store(AuxiliaryQueueKey{queue}, std::move(auxiliary_queues_cpp));
+    }
+
+  } catch (...) { return DispatchException(); }
+  return StatusCode::kSuccess;
+}
+
+// =================================================================================================
+
+// Evaluates a chain of level-1 vector operations with a single generated kernel
+template <typename T>
+StatusCode FusedVectorOperations(const size_t n, const std::vector<VectorStep<T>> &steps,
+                                 const std::vector<cl_mem> &buffers,
+                                 const std::vector<size_t> &offsets,
+                                 const std::vector<size_t> &incs,
+                                 cl_mem result_buffer, const size_t result_offset,
+                                 cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = Xfused<T>(queue_cpp, event, steps, buffers.size());
+    auto buffers_cpp = std::vector<Buffer<T>>();
+    for (const auto &buffer : buffers) { buffers_cpp.push_back(Buffer<T>(buffer)); }
+    routine.DoFused(n, buffers_cpp, offsets, incs,
+                    Buffer<T>(result_buffer), result_offset);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API FusedVectorOperations<float>(const size_t, const std::vector<VectorStep<float>>&,
+                                                            const std::vector<cl_mem>&,
+                                                            const std::vector<size_t>&,
+                                                            const std::vector<size_t>&,
+                                                            cl_mem, const size_t,
+                                                            cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API FusedVectorOperations<double>(const size_t, const std::vector<VectorStep<double>>&,
+                                                             const std::vector<cl_mem>&,
+                                                             const std::vector<size_t>&,
+                                                             const std::vector<size_t>&,
+                                                             cl_mem, const size_t,
+                                                             cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API FusedVectorOperations<half>(const size_t, const std::vector<VectorStep<half>>&,
+                                                           const std::vector<cl_mem>&,
+                                                           const std::vector<size_t>&,
+                                                           const std::vector<size_t>&,
+                                                           cl_mem, const size_t,
+                                                           cl_command_queue*, cl_event*);
+
 // =================================================================================================
 } // namespace clblast
@@ -1021,6 +1021,349 @@ CLBlastStatusCode CLBlastiHmin(const size_t n,
   } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
 }
 
+// AXPBY
+CLBlastStatusCode CLBlastSaxpby(const size_t n,
+                                const float alpha,
+                                const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                const float beta,
+                                cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Axpby(n,
+                     alpha,
+                     x_buffer, x_offset, x_inc,
+                     beta,
+                     y_buffer, y_offset, y_inc,
+                     queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastDaxpby(const size_t n,
+                                const double alpha,
+                                const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                const double beta,
+                                cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Axpby(n,
+                     alpha,
+                     x_buffer, x_offset, x_inc,
+                     beta,
+                     y_buffer, y_offset, y_inc,
+                     queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastCaxpby(const size_t n,
+                                const cl_float2 alpha,
+                                const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                const cl_float2 beta,
+                                cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Axpby(n,
+                     float2{alpha.s[0], alpha.s[1]},
+                     x_buffer, x_offset, x_inc,
+                     float2{beta.s[0], beta.s[1]},
+                     y_buffer, y_offset, y_inc,
+                     queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastZaxpby(const size_t n,
+                                const cl_double2 alpha,
+                                const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                const cl_double2 beta,
+                                cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Axpby(n,
+                     double2{alpha.s[0], alpha.s[1]},
+                     x_buffer, x_offset, x_inc,
+                     double2{beta.s[0], beta.s[1]},
+                     y_buffer, y_offset, y_inc,
+                     queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastHaxpby(const size_t n,
+                                const cl_half alpha,
+                                const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                const cl_half beta,
+                                cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Axpby(n,
+                     alpha,
+                     x_buffer, x_offset, x_inc,
+                     beta,
+                     y_buffer, y_offset, y_inc,
+                     queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+
+// WAXPBY
+CLBlastStatusCode CLBlastSwaxpby(const size_t n,
+                                 const float alpha,
+                                 const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                 const float beta,
+                                 const cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                 cl_mem z_buffer, const size_t z_offset, const size_t z_inc,
+                                 cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Waxpby(n,
+                      alpha,
+                      x_buffer, x_offset, x_inc,
+                      beta,
+                      y_buffer, y_offset, y_inc,
+                      z_buffer, z_offset, z_inc,
+                      queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastDwaxpby(const size_t n,
+                                 const double alpha,
+                                 const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                 const double beta,
+                                 const cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                 cl_mem z_buffer, const size_t z_offset, const size_t z_inc,
+                                 cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Waxpby(n,
+                      alpha,
+                      x_buffer, x_offset, x_inc,
+                      beta,
+                      y_buffer, y_offset, y_inc,
+                      z_buffer, z_offset, z_inc,
+                      queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastCwaxpby(const size_t n,
+                                 const cl_float2 alpha,
+                                 const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                 const cl_float2 beta,
+                                 const cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                 cl_mem z_buffer, const size_t z_offset, const size_t z_inc,
+                                 cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Waxpby(n,
+                      float2{alpha.s[0], alpha.s[1]},
+                      x_buffer, x_offset, x_inc,
+                      float2{beta.s[0], beta.s[1]},
+                      y_buffer, y_offset, y_inc,
+                      z_buffer, z_offset, z_inc,
+                      queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastZwaxpby(const size_t n,
+                                 const cl_double2 alpha,
+                                 const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                 const cl_double2 beta,
+                                 const cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                 cl_mem z_buffer, const size_t z_offset, const size_t z_inc,
+                                 cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Waxpby(n,
+                      double2{alpha.s[0], alpha.s[1]},
+                      x_buffer, x_offset, x_inc,
+                      double2{beta.s[0], beta.s[1]},
+                      y_buffer, y_offset, y_inc,
+                      z_buffer, z_offset, z_inc,
+                      queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastHwaxpby(const size_t n,
+                                 const cl_half alpha,
+                                 const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                 const cl_half beta,
+                                 const cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                 cl_mem z_buffer, const size_t z_offset, const size_t z_inc,
+                                 cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Waxpby(n,
+                      alpha,
+                      x_buffer, x_offset, x_inc,
+                      beta,
+                      y_buffer, y_offset, y_inc,
+                      z_buffer, z_offset, z_inc,
+                      queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+
+// AXPYDOT
+CLBlastStatusCode CLBlastSaxpydot(const size_t n,
+                                  cl_mem dot_buffer, const size_t dot_offset,
+                                  const float alpha,
+                                  const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                  cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                  cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Axpydot(n,
+                       dot_buffer, dot_offset,
+                       alpha,
+                       x_buffer, x_offset, x_inc,
+                       y_buffer, y_offset, y_inc,
+                       queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastDaxpydot(const size_t n,
+                                  cl_mem dot_buffer, const size_t dot_offset,
+                                  const double alpha,
+                                  const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                  cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                  cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Axpydot(n,
+                       dot_buffer, dot_offset,
+                       alpha,
+                       x_buffer, x_offset, x_inc,
+                       y_buffer, y_offset, y_inc,
+                       queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastHaxpydot(const size_t n,
+                                  cl_mem dot_buffer, const size_t dot_offset,
+                                  const cl_half alpha,
+                                  const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                  cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                  cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Axpydot(n,
+                       dot_buffer, dot_offset,
+                       alpha,
+                       x_buffer, x_offset, x_inc,
+                       y_buffer, y_offset, y_inc,
+                       queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+
+// AXPYNRM2
+CLBlastStatusCode CLBlastSaxpynrm2(const size_t n,
+                                   cl_mem nrm2_buffer, const size_t nrm2_offset,
+                                   const float alpha,
+                                   const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                   cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                   cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Axpynrm2(n,
+                        nrm2_buffer, nrm2_offset,
+                        alpha,
+                        x_buffer, x_offset, x_inc,
+                        y_buffer, y_offset, y_inc,
+                        queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastDaxpynrm2(const size_t n,
+                                   cl_mem nrm2_buffer, const size_t nrm2_offset,
+                                   const double alpha,
+                                   const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                   cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                   cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Axpynrm2(n,
+                        nrm2_buffer, nrm2_offset,
+                        alpha,
+                        x_buffer, x_offset, x_inc,
+                        y_buffer, y_offset, y_inc,
+                        queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastHaxpynrm2(const size_t n,
+                                   cl_mem nrm2_buffer, const size_t nrm2_offset,
+                                   const cl_half alpha,
+                                   const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                   cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                   cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Axpynrm2(n,
+                        nrm2_buffer, nrm2_offset,
+                        alpha,
+                        x_buffer, x_offset, x_inc,
+                        y_buffer, y_offset, y_inc,
+                        queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+
+// DOT2
+CLBlastStatusCode CLBlastSdot2(const size_t n,
+                               cl_mem dot_buffer, const size_t dot_offset,
+                               const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                               const cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                               const cl_mem z_buffer, const size_t z_offset, const size_t z_inc,
+                               cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Dot2<float>(n,
+                           dot_buffer, dot_offset,
+                           x_buffer, x_offset, x_inc,
+                           y_buffer, y_offset, y_inc,
+                           z_buffer, z_offset, z_inc,
+                           queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastDdot2(const size_t n,
+                               cl_mem dot_buffer, const size_t dot_offset,
+                               const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                               const cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                               const cl_mem z_buffer, const size_t z_offset, const size_t z_inc,
+                               cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Dot2<double>(n,
+                            dot_buffer, dot_offset,
+                            x_buffer, x_offset, x_inc,
+                            y_buffer, y_offset, y_inc,
+                            z_buffer, z_offset, z_inc,
+                            queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastHdot2(const size_t n,
+                               cl_mem dot_buffer, const size_t dot_offset,
+                               const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                               const cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                               const cl_mem z_buffer, const size_t z_offset, const size_t z_inc,
+                               cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Dot2<half>(n,
+                          dot_buffer, dot_offset,
+                          x_buffer, x_offset, x_inc,
+                          y_buffer, y_offset, y_inc,
+                          z_buffer, z_offset, z_inc,
+                          queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+
 // =================================================================================================
 // BLAS level-2 (matrix-vector) routines
 // =================================================================================================
@@ -2228,6 +2571,103 @@ CLBlastStatusCode CLBlastZgerc(const CLBlastLayout layout,
   } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
 }
 
+// GERK
+CLBlastStatusCode CLBlastSgerk(const CLBlastLayout layout,
+                               const size_t m, const size_t n, const size_t k,
+                               const float alpha,
+                               const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                               const cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                               cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                               cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Gerk(static_cast<clblast::Layout>(layout),
+                    m, n, k,
+                    alpha,
+                    x_buffer, x_offset, x_inc,
+                    y_buffer, y_offset, y_inc,
+                    a_buffer, a_offset, a_ld,
+                    queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastDgerk(const CLBlastLayout layout,
+                               const size_t m, const size_t n, const size_t k,
+                               const double alpha,
+                               const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                               const cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                               cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                               cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Gerk(static_cast<clblast::Layout>(layout),
+                    m, n, k,
+                    alpha,
+                    x_buffer, x_offset, x_inc,
+                    y_buffer, y_offset, y_inc,
+                    a_buffer, a_offset, a_ld,
+                    queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastCgerk(const CLBlastLayout layout,
+                               const size_t m, const size_t n, const size_t k,
+                               const cl_float2 alpha,
+                               const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                               const cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                               cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                               cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Gerk(static_cast<clblast::Layout>(layout),
+                    m, n, k,
+                    float2{alpha.s[0], alpha.s[1]},
+                    x_buffer, x_offset, x_inc,
+                    y_buffer, y_offset, y_inc,
+                    a_buffer, a_offset, a_ld,
+                    queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastZgerk(const CLBlastLayout layout,
+                               const size_t m, const size_t n, const size_t k,
+                               const cl_double2 alpha,
+                               const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                               const cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                               cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                               cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Gerk(static_cast<clblast::Layout>(layout),
+                    m, n, k,
+                    double2{alpha.s[0], alpha.s[1]},
+                    x_buffer, x_offset, x_inc,
+                    y_buffer, y_offset, y_inc,
+                    a_buffer, a_offset, a_ld,
+                    queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastHgerk(const CLBlastLayout layout,
+                               const size_t m, const size_t n, const size_t k,
+                               const cl_half alpha,
+                               const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                               const cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                               cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                               cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Gerk(static_cast<clblast::Layout>(layout),
+                    m, n, k,
+                    alpha,
+                    x_buffer, x_offset, x_inc,
+                    y_buffer, y_offset, y_inc,
+                    a_buffer, a_offset, a_ld,
+                    queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+
 // HER
 CLBlastStatusCode CLBlastCher(const CLBlastLayout layout, const CLBlastTriangle triangle,
                               const size_t n,
@@ -3622,6 +4062,288 @@ CLBlastStatusCode CLBlastHaxpyBatched(const size_t n,
   } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
 }
 
+// DOT
+CLBlastStatusCode CLBlastSdotBatched(const size_t n,
+                                     cl_mem dot_buffer, const size_t *dot_offsets,
+                                     const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                                     const cl_mem y_buffer, const size_t *y_offsets, const size_t y_inc,
+                                     const size_t batch_count,
+                                     cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::DotBatched<float>(n,
+                                 dot_buffer, dot_offsets,
+                                 x_buffer, x_offsets, x_inc,
+                                 y_buffer, y_offsets, y_inc,
+                                 batch_count,
+                                 queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastDdotBatched(const size_t n,
+                                     cl_mem dot_buffer, const size_t *dot_offsets,
+                                     const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                                     const cl_mem y_buffer, const size_t *y_offsets, const size_t y_inc,
+                                     const size_t batch_count,
+                                     cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::DotBatched<double>(n,
+                                  dot_buffer, dot_offsets,
+                                  x_buffer, x_offsets, x_inc,
+                                  y_buffer, y_offsets, y_inc,
+                                  batch_count,
+                                  queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastHdotBatched(const size_t n,
+                                     cl_mem dot_buffer, const size_t *dot_offsets,
+                                     const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                                     const cl_mem y_buffer, const size_t *y_offsets, const size_t y_inc,
+                                     const size_t batch_count,
+                                     cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::DotBatched<half>(n,
+                                dot_buffer, dot_offsets,
+                                x_buffer, x_offsets, x_inc,
+                                y_buffer, y_offsets, y_inc,
+                                batch_count,
+                                queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+
+// NRM2
+CLBlastStatusCode CLBlastSnrm2Batched(const size_t n,
+                                      cl_mem nrm2_buffer, const size_t *nrm2_offsets,
+                                      const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                                      const size_t batch_count,
+                                      cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Nrm2Batched<float>(n,
+                                  nrm2_buffer, nrm2_offsets,
+                                  x_buffer, x_offsets, x_inc,
+                                  batch_count,
+                                  queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastDnrm2Batched(const size_t n,
+                                      cl_mem nrm2_buffer, const size_t *nrm2_offsets,
+                                      const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                                      const size_t batch_count,
+                                      cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Nrm2Batched<double>(n,
+                                   nrm2_buffer, nrm2_offsets,
+                                   x_buffer, x_offsets, x_inc,
+                                   batch_count,
+                                   queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastScnrm2Batched(const size_t n,
+                                      cl_mem nrm2_buffer, const size_t *nrm2_offsets,
+                                      const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                                      const size_t batch_count,
+                                      cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Nrm2Batched<float2>(n,
+                                   nrm2_buffer, nrm2_offsets,
+                                   x_buffer, x_offsets, x_inc,
+                                   batch_count,
+                                   queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastDznrm2Batched(const size_t n,
+                                      cl_mem nrm2_buffer, const size_t *nrm2_offsets,
+                                      const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                                      const size_t batch_count,
+                                      cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Nrm2Batched<double2>(n,
+                                    nrm2_buffer, nrm2_offsets,
+                                    x_buffer, x_offsets, x_inc,
+                                    batch_count,
+                                    queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastHnrm2Batched(const size_t n,
+                                      cl_mem nrm2_buffer, const size_t *nrm2_offsets,
+                                      const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                                      const size_t batch_count,
+                                      cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Nrm2Batched<half>(n,
+                                 nrm2_buffer, nrm2_offsets,
+                                 x_buffer, x_offsets, x_inc,
+                                 batch_count,
+                                 queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+
+// GEMV
+CLBlastStatusCode CLBlastSgemvBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                      const size_t m, const size_t n,
+                                      const float *alphas,
+                                      const cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld,
+                                      const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                                      const float *betas,
+                                      cl_mem y_buffer, const size_t *y_offsets, const size_t y_inc,
+                                      const size_t batch_count,
+                                      cl_command_queue* queue, cl_event* event) {
+  auto alphas_cpp = std::vector<float>();
+  auto betas_cpp = std::vector<float>();
+  for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+    alphas_cpp.push_back(alphas[batch]);
+    betas_cpp.push_back(betas[batch]);
+  }
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::GemvBatched(static_cast<clblast::Layout>(layout),
+                           static_cast<clblast::Transpose>(a_transpose),
+                           m, n,
+                           alphas_cpp.data(),
+                           a_buffer, a_offsets, a_ld,
+                           x_buffer, x_offsets, x_inc,
+                           betas_cpp.data(),
+                           y_buffer, y_offsets, y_inc,
+                           batch_count,
+                           queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastDgemvBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                      const size_t m, const size_t n,
+                                      const double *alphas,
+                                      const cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld,
+                                      const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                                      const double *betas,
+                                      cl_mem y_buffer, const size_t *y_offsets, const size_t y_inc,
+                                      const size_t batch_count,
+                                      cl_command_queue* queue, cl_event* event) {
+  auto alphas_cpp = std::vector<double>();
+  auto betas_cpp = std::vector<double>();
+  for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+    alphas_cpp.push_back(alphas[batch]);
+    betas_cpp.push_back(betas[batch]);
+  }
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::GemvBatched(static_cast<clblast::Layout>(layout),
+                           static_cast<clblast::Transpose>(a_transpose),
+                           m, n,
+                           alphas_cpp.data(),
+                           a_buffer, a_offsets, a_ld,
+                           x_buffer, x_offsets, x_inc,
+                           betas_cpp.data(),
+                           y_buffer, y_offsets, y_inc,
+                           batch_count,
+                           queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastCgemvBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                      const size_t m, const size_t n,
+                                      const cl_float2 *alphas,
+                                      const cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld,
+                                      const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                                      const cl_float2 *betas,
+                                      cl_mem y_buffer, const size_t *y_offsets, const size_t y_inc,
+                                      const size_t batch_count,
+                                      cl_command_queue* queue, cl_event* event) {
+  auto alphas_cpp = std::vector<float2>();
+  auto betas_cpp = std::vector<float2>();
+  for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+    alphas_cpp.push_back(float2{alphas[batch].s[0], alphas[batch].s[1]});
+    betas_cpp.push_back(float2{betas[batch].s[0], betas[batch].s[1]});
+  }
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::GemvBatched(static_cast<clblast::Layout>(layout),
+                           static_cast<clblast::Transpose>(a_transpose),
+                           m, n,
+                           alphas_cpp.data(),
+                           a_buffer, a_offsets, a_ld,
+                           x_buffer, x_offsets, x_inc,
+                           betas_cpp.data(),
+                           y_buffer, y_offsets, y_inc,
+                           batch_count,
+                           queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastZgemvBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                      const size_t m, const size_t n,
+                                      const cl_double2 *alphas,
+                                      const cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld,
+                                      const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                                      const cl_double2 *betas,
+                                      cl_mem y_buffer, const size_t *y_offsets, const size_t y_inc,
+                                      const size_t batch_count,
+                                      cl_command_queue* queue, cl_event* event) {
+  auto alphas_cpp = std::vector<double2>();
+  auto betas_cpp = std::vector<double2>();
+  for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+    alphas_cpp.push_back(double2{alphas[batch].s[0], alphas[batch].s[1]});
+    betas_cpp.push_back(double2{betas[batch].s[0], betas[batch].s[1]});
+  }
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::GemvBatched(static_cast<clblast::Layout>(layout),
+                           static_cast<clblast::Transpose>(a_transpose),
+                           m, n,
+                           alphas_cpp.data(),
+                           a_buffer, a_offsets, a_ld,
+                           x_buffer, x_offsets, x_inc,
+                           betas_cpp.data(),
+                           y_buffer, y_offsets, y_inc,
+                           batch_count,
+                           queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastHgemvBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                      const size_t m, const size_t n,
+                                      const cl_half *alphas,
+                                      const cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld,
+                                      const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                                      const cl_half *betas,
+                                      cl_mem y_buffer, const size_t *y_offsets, const size_t y_inc,
+                                      const size_t batch_count,
+                                      cl_command_queue* queue, cl_event* event) {
+  auto alphas_cpp = std::vector<half>();
+  auto betas_cpp = std::vector<half>();
+  for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+    alphas_cpp.push_back(alphas[batch]);
+    betas_cpp.push_back(betas[batch]);
+  }
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::GemvBatched(static_cast<clblast::Layout>(layout),
+                           static_cast<clblast::Transpose>(a_transpose),
+                           m, n,
+                           alphas_cpp.data(),
+                           a_buffer, a_offsets, a_ld,
+                           x_buffer, x_offsets, x_inc,
+                           betas_cpp.data(),
+                           y_buffer, y_offsets, y_inc,
+                           batch_count,
+                           queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+
 // GEMM
 CLBlastStatusCode CLBlastSgemmBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
                                       const size_t m, const size_t n, const size_t k,
@@ -3815,4 +4537,98 @@ CLBlastStatusCode PUBLIC_API CLBlastOverrideParameters(const cl_device_id device
   } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
 }
 
+// Loads tuning results from a JSON file or a directory of JSON files
+CLBlastStatusCode PUBLIC_API CLBlastLoadTuningResults(const char* path) {
+  try {
+    const auto status = clblast::LoadTuningResults(std::string(path));
+    return static_cast<CLBlastStatusCode>(status);
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+
+// =================================================================================================
+
+// Registers (or removes) the auxiliary queues for a command-queue
+CLBlastStatusCode PUBLIC_API CLBlastSetAuxiliaryQueues(const cl_command_queue queue, const size_t num_auxiliary_queues,
+                                                       const cl_command_queue* auxiliary_queues) {
+  try {
+    const auto auxiliary_queues_cpp = std::vector<cl_command_queue>(auxiliary_queues,
+                                                                    auxiliary_queues + num_auxiliary_queues);
+    const auto status = clblast::SetAuxiliaryQueues(queue, auxiliary_queues_cpp);
+    return static_cast<CLBlastStatusCode>(status);
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+
+// =================================================================================================
+
+// Evaluates a chain of level-1 vector operations: converts the steps to the C++ API first
+template <typename T>
+clblast::StatusCode FusedVectorOperationsC(const size_t n, const size_t num_steps,
+                                           const CLBlastVectorOperation* operations,
+                                           const size_t* xs, const size_t* ys, const T* alphas,
+                                           const size_t num_vectors, const cl_mem* buffers,
+                                           const size_t* offsets, const size_t* incs,
+                                           cl_mem result_buffer, const size_t result_offset,
+                                           cl_command_queue* queue, cl_event* event) {
+  auto steps = std::vector<clblast::VectorStep<T>>();
+  for (auto i = size_t{0}; i < num_steps; ++i) {
+    steps.push_back({static_cast<clblast::VectorOperation>(operations[i]), xs[i], ys[i], alphas[i]});
+  }
+  return clblast::FusedVectorOperations<T>(n, steps,
+                                           std::vector<cl_mem>(buffers, buffers + num_vectors),
+                                           std::vector<size_t>(offsets, offsets + num_vectors),
+                                           std::vector<size_t>(incs, incs + num_vectors),
+                                           result_buffer, result_offset, queue, event);
+}
+
+CLBlastStatusCode CLBlastSFusedVectorOperations(const size_t n, const size_t num_steps,
+                                                const CLBlastVectorOperation* operations,
+                                                const size_t* xs, const size_t* ys,
+                                                const float* alphas,
+                                                const size_t num_vectors, const cl_mem* buffers,
+                                                const size_t* offsets, const size_t* incs,
+                                                cl_mem result_buffer, const size_t result_offset,
+                                                cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      FusedVectorOperationsC<float>(n, num_steps, operations, xs, ys, alphas,
+                                 num_vectors, buffers, offsets, incs,
+                                 result_buffer, result_offset, queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+
+CLBlastStatusCode CLBlastDFusedVectorOperations(const size_t n, const size_t num_steps,
+                                                const CLBlastVectorOperation* operations,
+                                                const size_t* xs, const size_t* ys,
+                                                const double* alphas,
+                                                const size_t num_vectors, const cl_mem* buffers,
+                                                const size_t* offsets, const size_t* incs,
+                                                cl_mem result_buffer, const size_t result_offset,
+                                                cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      FusedVectorOperationsC<double>(n, num_steps, operations, xs, ys, alphas,
+                                 num_vectors, buffers, offsets, incs,
+                                 result_buffer, result_offset, queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+
+CLBlastStatusCode CLBlastHFusedVectorOperations(const size_t n, const size_t num_steps,
+                                                const CLBlastVectorOperation* operations,
+                                                const size_t* xs, const size_t* ys,
+                                                const cl_half* alphas,
+                                                const size_t num_vectors, const cl_mem* buffers,
+                                                const size_t* offsets, const size_t* incs,
+                                                cl_mem result_buffer, const size_t result_offset,
+                                                cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      FusedVectorOperationsC<half>(n, num_steps, operations, xs, ys, alphas,
+                                 num_vectors, buffers, offsets, incs,
+                                 result_buffer, result_offset, queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+
 // =================================================================================================
@@ -1461,6 +1461,446 @@ int cblas_izmin(const int n,
   return imin[0];
 }
 
+// AXPBY
+void cblas_saxpby(const int n,
+                  const float alpha,
+                  const float* x, const int x_inc,
+                  const float beta,
+                  float* y, const int y_inc) {
+  auto device = get_device();
+  auto context = clblast::Context(device);
+  auto queue = clblast::Queue(context, device);
+  const auto alpha_cpp = alpha;
+  const auto beta_cpp = beta;
+  const auto x_size = n * x_inc;
+  const auto y_size = n * y_inc;
+  auto x_buffer = clblast::Buffer<float>(context, x_size);
+  auto y_buffer = clblast::Buffer<float>(context, y_size);
+  x_buffer.Write(queue, x_size, reinterpret_cast<const float*>(x));
+  y_buffer.Write(queue, y_size, reinterpret_cast<float*>(y));
+  auto queue_cl = queue();
+  auto s = clblast::Axpby(n,
+                          alpha_cpp,
+                          x_buffer(), 0, x_inc,
+                          beta_cpp,
+                          y_buffer(), 0, y_inc,
+                          &queue_cl);
+  if (s != clblast::StatusCode::kSuccess) {
+    throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
+  }
+  y_buffer.Read(queue, y_size, reinterpret_cast<float*>(y));
+}
+void cblas_daxpby(const int n,
+                  const double alpha,
+                  const double* x, const int x_inc,
+                  const double beta,
+                  double* y, const int y_inc) {
+  auto device = get_device();
+  auto context = clblast::Context(device);
+  auto queue = clblast::Queue(context, device);
+  const auto alpha_cpp = alpha;
+  const auto beta_cpp = beta;
+  const auto x_size = n * x_inc;
+  const auto y_size = n * y_inc;
+  auto x_buffer = clblast::Buffer<double>(context, x_size);
+  auto y_buffer = clblast::Buffer<double>(context, y_size);
+  x_buffer.Write(queue, x_size, reinterpret_cast<const double*>(x));
+  y_buffer.Write(queue, y_size, reinterpret_cast<double*>(y));
+  auto queue_cl = queue();
+  auto s = clblast::Axpby(n,
+                          alpha_cpp,
+                          x_buffer(), 0, x_inc,
+                          beta_cpp,
+                          y_buffer(), 0, y_inc,
+                          &queue_cl);
+  if (s != clblast::StatusCode::kSuccess) {
+    throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
+  }
+  y_buffer.Read(queue, y_size, reinterpret_cast<double*>(y));
+}
+void cblas_caxpby(const int n,
+                  const void* alpha,
+                  const void* x, const int x_inc,
+                  const void* beta,
+                  void* y, const int y_inc) {
+  auto device = get_device();
+  auto context = clblast::Context(device);
+  auto queue = clblast::Queue(context, device);
+  const auto alpha_cpp = float2{reinterpret_cast<const float*>(alpha)[0], reinterpret_cast<const float*>(alpha)[1]};
+  const auto beta_cpp = float2{reinterpret_cast<const float*>(beta)[0], reinterpret_cast<const float*>(beta)[1]};
+  const auto x_size = n * x_inc;
+  const auto y_size = n * y_inc;
+  auto x_buffer = clblast::Buffer<float2>(context, x_size);
+  auto y_buffer = clblast::Buffer<float2>(context, y_size);
+  x_buffer.Write(queue, x_size, reinterpret_cast<const float2*>(x));
+  y_buffer.Write(queue, y_size, reinterpret_cast<float2*>(y));
+  auto queue_cl = queue();
+  auto s = clblast::Axpby(n,
+                          alpha_cpp,
+                          x_buffer(), 0, x_inc,
+                          beta_cpp,
+                          y_buffer(), 0, y_inc,
+                          &queue_cl);
+  if (s != clblast::StatusCode::kSuccess) {
+    throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
+  }
+  y_buffer.Read(queue, y_size, reinterpret_cast<float2*>(y));
+}
+void cblas_zaxpby(const int n,
+                  const void* alpha,
+                  const void* x, const int x_inc,
+                  const void* beta,
+                  void* y, const int y_inc) {
+  auto device = get_device();
+  auto context = clblast::Context(device);
+  auto queue = clblast::Queue(context, device);
+  const auto alpha_cpp = double2{reinterpret_cast<const double*>(alpha)[0], reinterpret_cast<const double*>(alpha)[1]};
+  const auto beta_cpp = double2{reinterpret_cast<const double*>(beta)[0], reinterpret_cast<const double*>(beta)[1]};
+  const auto x_size = n * x_inc;
+  const auto y_size = n * y_inc;
+  auto x_buffer = clblast::Buffer<double2>(context, x_size);
+  auto y_buffer = clblast::Buffer<double2>(context, y_size);
+  x_buffer.Write(queue, x_size, reinterpret_cast<const double2*>(x));
+  y_buffer.Write(queue, y_size, reinterpret_cast<double2*>(y));
+  auto queue_cl = queue();
+  auto s = clblast::Axpby(n,
+                          alpha_cpp,
+                          x_buffer(), 0, x_inc,
+                          beta_cpp,
+                          y_buffer(), 0, y_inc,
+                          &queue_cl);
+  if (s != clblast::StatusCode::kSuccess) {
+    throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
+  }
+  y_buffer.Read(queue, y_size, reinterpret_cast<double2*>(y));
+}
+
+// WAXPBY
+void cblas_swaxpby(const int n,
+                   const float alpha,
+                   const float* x, const int x_inc,
+                   const float beta,
+                   const float* y, const int y_inc,
+                   float* z, const int z_inc) {
+  auto device = get_device();
+  auto context = clblast::Context(device);
+  auto queue = clblast::Queue(context, device);
+  const auto alpha_cpp = alpha;
+  const auto beta_cpp = beta;
+  const auto x_size = n * x_inc;
+  const auto y_size = n * y_inc;
+  const auto z_size = n * z_inc;
+  auto x_buffer = clblast::Buffer<float>(context, x_size);
+  auto y_buffer = clblast::Buffer<float>(context, y_size);
+  auto z_buffer = clblast::Buffer<float>(context, z_size);
+  x_buffer.Write(queue, x_size, reinterpret_cast<const float*>(x));
+  y_buffer.Write(queue, y_size, reinterpret_cast<const float*>(y));
+  z_buffer.Write(queue, z_size, reinterpret_cast<float*>(z));
+  auto queue_cl = queue();
+  auto s = clblast::Waxpby(n,
+                           alpha_cpp,
+                           x_buffer(), 0, x_inc,
+                           beta_cpp,
+                           y_buffer(), 0, y_inc,
+                           z_buffer(), 0, z_inc,
+                           &queue_cl);
+  if (s != clblast::StatusCode::kSuccess) {
+    throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
+  }
+  z_buffer.Read(queue, z_size, reinterpret_cast<float*>(z));
+}
+void cblas_dwaxpby(const int n,
+                   const double alpha,
+                   const double* x, const int x_inc,
+                   const double beta,
+                   const double* y, const int y_inc,
+                   double* z, const int z_inc) {
+  auto device = get_device();
+  auto context = clblast::Context(device);
+  auto queue = clblast::Queue(context, device);
+  const auto alpha_cpp = alpha;
+  const auto beta_cpp = beta;
+  const auto x_size = n * x_inc;
+  const auto y_size = n * y_inc;
+  const auto z_size = n * z_inc;
+  auto x_buffer = clblast::Buffer<double>(context, x_size);
+  auto y_buffer = clblast::Buffer<double>(context, y_size);
+  auto z_buffer = clblast::Buffer<double>(context, z_size);
+  x_buffer.Write(queue, x_size, reinterpret_cast<const double*>(x));
+  y_buffer.Write(queue, y_size, reinterpret_cast<const double*>(y));
+  z_buffer.Write(queue, z_size, reinterpret_cast<double*>(z));
+  auto queue_cl = queue();
+  auto s = clblast::Waxpby(n,
+                           alpha_cpp,
+                           x_buffer(), 0, x_inc,
+                           beta_cpp,
+                           y_buffer(), 0, y_inc,
+                           z_buffer(), 0, z_inc,
+                           &queue_cl);
+  if (s != clblast::StatusCode::kSuccess) {
+    throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
+  }
+  z_buffer.Read(queue, z_size, reinterpret_cast<double*>(z));
+}
+void cblas_cwaxpby(const int n,
+                   const void* alpha,
+                   const void* x, const int x_inc,
+                   const void* beta,
+                   const void* y, const int y_inc,
+                   void* z, const int z_inc) {
+  auto device = get_device();
+  auto context = clblast::Context(device);
+  auto queue = clblast::Queue(context, device);
+  const auto alpha_cpp = float2{reinterpret_cast<const float*>(alpha)[0], reinterpret_cast<const float*>(alpha)[1]};
+  const auto beta_cpp = float2{reinterpret_cast<const float*>(beta)[0], reinterpret_cast<const float*>(beta)[1]};
+  const auto x_size = n * x_inc;
+  const auto y_size = n * y_inc;
+  const auto z_size = n * z_inc;
+  auto x_buffer = clblast::Buffer<float2>(context, x_size);
+  auto y_buffer = clblast::Buffer<float2>(context, y_size);
+  auto z_buffer = clblast::Buffer<float2>(context, z_size);
+  x_buffer.Write(queue, x_size, reinterpret_cast<const float2*>(x));
+  y_buffer.Write(queue, y_size, reinterpret_cast<const float2*>(y));
+  z_buffer.Write(queue, z_size, reinterpret_cast<float2*>(z));
+  auto queue_cl = queue();
+  auto s = clblast::Waxpby(n,
+                           alpha_cpp,
+                           x_buffer(), 0, x_inc,
+                           beta_cpp,
+                           y_buffer(), 0, y_inc,
+                           z_buffer(), 0, z_inc,
+                           &queue_cl);
+  if (s != clblast::StatusCode::kSuccess) {
+    throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
+  }
+  z_buffer.Read(queue, z_size, reinterpret_cast<float2*>(z));
+}
+void cblas_zwaxpby(const int n,
+                   const void* alpha,
+                   const void* x, const int x_inc,
+                   const void* beta,
+                   const void* y, const int y_inc,
+                   void* z, const int z_inc) {
+  auto device = get_device();
+  auto context = clblast::Context(device);
+  auto queue = clblast::Queue(context, device);
+  const auto alpha_cpp = double2{reinterpret_cast<const double*>(alpha)[0], reinterpret_cast<const double*>(alpha)[1]};
+  const auto beta_cpp = double2{reinterpret_cast<const double*>(beta)[0], reinterpret_cast<const double*>(beta)[1]};
+  const auto x_size = n * x_inc;
+  const auto y_size = n * y_inc;
+  const auto z_size = n * z_inc;
+  auto x_buffer = clblast::Buffer<double2>(context, x_size);
+  auto y_buffer = clblast::Buffer<double2>(context, y_size);
+  auto z_buffer = clblast::Buffer<double2>(context, z_size);
+  x_buffer.Write(queue, x_size, reinterpret_cast<const double2*>(x));
+  y_buffer.Write(queue, y_size, reinterpret_cast<const double2*>(y));
+  z_buffer.Write(queue, z_size, reinterpret_cast<double2*>(z));
+  auto queue_cl = queue();
+  auto s = clblast::Waxpby(n,
+                           alpha_cpp,
+                           x_buffer(), 0, x_inc,
+                           beta_cpp,
+                           y_buffer(), 0, y_inc,
+                           z_buffer(), 0, z_inc,
+                           &queue_cl);
+  if (s != clblast::StatusCode::kSuccess) {
+    throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
+  }
+  z_buffer.Read(queue, z_size, reinterpret_cast<double2*>(z));
+}
+
+// AXPYDOT
+float cblas_saxpydot(const int n,
+                     const float alpha,
+                     const float* x, const int x_inc,
+                     float* y, const int y_inc) {
+  auto device = get_device();
+  auto context = clblast::Context(device);
+  auto queue = clblast::Queue(context, device);
+  const auto alpha_cpp = alpha;
+  const auto x_size = n * x_inc;
+  const auto y_size = n * y_inc;
+  const auto dot_size = 1;
+  auto x_buffer = clblast::Buffer<float>(context, x_size);
+  auto y_buffer = clblast::Buffer<float>(context, y_size);
+  auto dot_buffer = clblast::Buffer<float>(context, dot_size);
+  x_buffer.Write(queue, x_size, reinterpret_cast<const float*>(x));
+  y_buffer.Write(queue, y_size, reinterpret_cast<float*>(y));
+  auto queue_cl = queue();
+  auto s = clblast::Axpydot(n,
+                            dot_buffer(), 0,
+                            alpha_cpp,
+                            x_buffer(), 0, x_inc,
+                            y_buffer(), 0, y_inc,
+                            &queue_cl);
+  if (s != clblast::StatusCode::kSuccess) {
+    throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
+  }
+  float dot[dot_size];
+  y_buffer.Read(queue, y_size, reinterpret_cast<float*>(y));
+  dot_buffer.Read(queue, dot_size, reinterpret_cast<float*>(dot));
+  return dot[0];
+}
+double cblas_daxpydot(const int n,
+                      const double alpha,
+                      const double* x, const int x_inc,
+                      double* y, const int y_inc) {
+  auto device = get_device();
+  auto context = clblast::Context(device);
+  auto queue = clblast::Queue(context, device);
+  const auto alpha_cpp = alpha;
+  const auto x_size = n * x_inc;
+  const auto y_size = n * y_inc;
+  const auto dot_size = 1;
+  auto x_buffer = clblast::Buffer<double>(context, x_size);
+  auto y_buffer = clblast::Buffer<double>(context, y_size);
+  auto dot_buffer = clblast::Buffer<double>(context, dot_size);
+  x_buffer.Write(queue, x_size, reinterpret_cast<const double*>(x));
+  y_buffer.Write(queue, y_size, reinterpret_cast<double*>(y));
+  auto queue_cl = queue();
+  auto s = clblast::Axpydot(n,
+                            dot_buffer(), 0,
+                            alpha_cpp,
+                            x_buffer(), 0, x_inc,
+                            y_buffer(), 0, y_inc,
+                            &queue_cl);
+  if (s != clblast::StatusCode::kSuccess) {
+    throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
+  }
+  double dot[dot_size];
+  y_buffer.Read(queue, y_size, reinterpret_cast<double*>(y));
+  dot_buffer.Read(queue, dot_size, reinterpret_cast<double*>(dot));
+  return dot[0];
+}
+
+// AXPYNRM2
+float cblas_saxpynrm2(const int n,
+                      const float alpha,
+                      const float* x, const int x_inc,
+                      float* y, const int y_inc) {
+  auto device = get_device();
+  auto context = clblast::Context(device);
+  auto queue = clblast::Queue(context, device);
+  const auto alpha_cpp = alpha;
+  const auto x_size = n * x_inc;
+  const auto y_size = n * y_inc;
+  const auto nrm2_size = 1;
+  auto x_buffer = clblast::Buffer<float>(context, x_size);
+  auto y_buffer = clblast::Buffer<float>(context, y_size);
+  auto nrm2_buffer = clblast::Buffer<float>(context, nrm2_size);
+  x_buffer.Write(queue, x_size, reinterpret_cast<const float*>(x));
+  y_buffer.Write(queue, y_size, reinterpret_cast<float*>(y));
+  auto queue_cl = queue();
+  auto s = clblast::Axpynrm2(n,
+                             nrm2_buffer(), 0,
+                             alpha_cpp,
+                             x_buffer(), 0, x_inc,
+                             y_buffer(), 0, y_inc,
+                             &queue_cl);
+  if (s != clblast::StatusCode::kSuccess) {
+    throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
+  }
+  float nrm2[nrm2_size];
+  y_buffer.Read(queue, y_size, reinterpret_cast<float*>(y));
+  nrm2_buffer.Read(queue, nrm2_size, reinterpret_cast<float*>(nrm2));
+  return nrm2[0];
+}
+double cblas_daxpynrm2(const int n,
+                       const double alpha,
+                       const double* x, const int x_inc,
+                       double* y, const int y_inc) {
+  auto device = get_device();
+  auto context = clblast::Context(device);
+  auto queue = clblast::Queue(context, device);
+  const auto alpha_cpp = alpha;
+  const auto x_size = n * x_inc;
+  const auto y_size = n * y_inc;
+  const auto nrm2_size = 1;
+  auto x_buffer = clblast::Buffer<double>(context, x_size);
+  auto y_buffer = clblast::Buffer<double>(context, y_size);
+  auto nrm2_buffer = clblast::Buffer<double>(context, nrm2_size);
+  x_buffer.Write(queue, x_size, reinterpret_cast<const double*>(x));
+  y_buffer.Write(queue, y_size, reinterpret_cast<double*>(y));
+  auto queue_cl = queue();
+  auto s = clblast::Axpynrm2(n,
+                             nrm2_buffer(), 0,
+                             alpha_cpp,
+                             x_buffer(), 0, x_inc,
+                             y_buffer(), 0, y_inc,
+                             &queue_cl);
+  if (s != clblast::StatusCode::kSuccess) {
+    throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
+  }
+  double nrm2[nrm2_size];
+  y_buffer.Read(queue, y_size, reinterpret_cast<double*>(y));
+  nrm2_buffer.Read(queue, nrm2_size, reinterpret_cast<double*>(nrm2));
+  return nrm2[0];
+}
+
+// DOT2
+void cblas_sdot2_sub(const int n,
+                     const float* x, const int x_inc,
+                     const float* y, const int y_inc,
+                     const float* z, const int z_inc,
+                     float* dot) {
+  auto device = get_device();
+  auto context = clblast::Context(device);
+  auto queue = clblast::Queue(context, device);
+  const auto x_size = n * x_inc;
+  const auto y_size = n * y_inc;
+  const auto z_size = n * z_inc;
+  const auto dot_size = 2;
+  auto x_buffer = clblast::Buffer<float>(context, x_size);
+  auto y_buffer = clblast::Buffer<float>(context, y_size);
+  auto z_buffer = clblast::Buffer<float>(context, z_size);
+  auto dot_buffer = clblast::Buffer<float>(context, dot_size);
+  x_buffer.Write(queue, x_size, reinterpret_cast<const float*>(x));
+  y_buffer.Write(queue, y_size, reinterpret_cast<const float*>(y));
+  z_buffer.Write(queue, z_size, reinterpret_cast<const float*>(z));
+  auto queue_cl = queue();
+  auto s = clblast::Dot2<float>(n,
+                                dot_buffer(), 0,
+                                x_buffer(), 0, x_inc,
+                                y_buffer(), 0, y_inc,
+                                z_buffer(), 0, z_inc,
+                                &queue_cl);
+  if (s != clblast::StatusCode::kSuccess) {
+    throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
+  }
+  dot_buffer.Read(queue, dot_size, reinterpret_cast<float*>(dot));
+}
+void cblas_ddot2_sub(const int n,
+                     const double* x, const int x_inc,
+                     const double* y, const int y_inc,
+                     const double* z, const int z_inc,
+                     double* dot) {
+  auto device = get_device();
+  auto context = clblast::Context(device);
+  auto queue = clblast::Queue(context, device);
+  const auto x_size = n * x_inc;
+  const auto y_size = n * y_inc;
+  const auto z_size = n * z_inc;
+  const auto dot_size = 2;
+  auto x_buffer = clblast::Buffer<double>(context, x_size);
+  auto y_buffer = clblast::Buffer<double>(context, y_size);
+  auto z_buffer = clblast::Buffer<double>(context, z_size);
+  auto dot_buffer = clblast::Buffer<double>(context, dot_size);
+  x_buffer.Write(queue, x_size, reinterpret_cast<const double*>(x));
+  y_buffer.Write(queue, y_size, reinterpret_cast<const double*>(y));
+  z_buffer.Write(queue, z_size, reinterpret_cast<const double*>(z));
+  auto queue_cl = queue();
+  auto s = clblast::Dot2<double>(n,
+                                 dot_buffer(), 0,
+                                 x_buffer(), 0, x_inc,
+                                 y_buffer(), 0, y_inc,
+                                 z_buffer(), 0, z_inc,
+                                 &queue_cl);
+  if (s != clblast::StatusCode::kSuccess) {
+    throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
+  }
+  dot_buffer.Read(queue, dot_size, reinterpret_cast<double*>(dot));
+}
+
 // =================================================================================================
 // BLAS level-2 (matrix-vector) routines
 // =================================================================================================
@@ -3059,6 +3499,136 @@ void cblas_zgerc(const CLBlastLayout layout,
   a_buffer.Read(queue, a_size, reinterpret_cast<double2*>(a));
 }
 
+// GERK
+void cblas_sgerk(const CLBlastLayout layout,
+                 const int m, const int n, const int k,
+                 const float alpha,
+                 const float* x, const int x_inc,
+                 const float* y, const int y_inc,
+                 float* a, const int a_ld) {
+  auto device = get_device();
+  auto context = clblast::Context(device);
+  auto queue = clblast::Queue(context, device);
+  const auto alpha_cpp = alpha;
+  const auto x_size = m * k * x_inc;
+  const auto y_size = n * k * y_inc;
+  const auto a_size = (layout == CLBlastLayoutRowMajor) ? m * a_ld : n * a_ld;
+  auto x_buffer = clblast::Buffer<float>(context, x_size);
+  auto y_buffer = clblast::Buffer<float>(context, y_size);
+  auto a_buffer = clblast::Buffer<float>(context, a_size);
+  x_buffer.Write(queue, x_size, reinterpret_cast<const float*>(x));
+  y_buffer.Write(queue, y_size, reinterpret_cast<const float*>(y));
+  a_buffer.Write(queue, a_size, reinterpret_cast<float*>(a));
+  auto queue_cl = queue();
+  auto s = clblast::Gerk(static_cast<clblast::Layout>(layout),
+                         m, n, k,
+                         alpha_cpp,
+                         x_buffer(), 0, x_inc,
+                         y_buffer(), 0, y_inc,
+                         a_buffer(), 0, a_ld,
+                         &queue_cl);
+  if (s != clblast::StatusCode::kSuccess) {
+    throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
+  }
+  a_buffer.Read(queue, a_size, reinterpret_cast<float*>(a));
+}
+void cblas_dgerk(const CLBlastLayout layout,
+                 const int m, const int n, const int k,
+                 const double alpha,
+                 const double* x, const int x_inc,
+                 const double* y, const int y_inc,
+                 double* a, const int a_ld) {
+  auto device = get_device();
+  auto context = clblast::Context(device);
+  auto queue = clblast::Queue(context, device);
+  const auto alpha_cpp = alpha;
+  const auto x_size = m * k * x_inc;
+  const auto y_size = n * k * y_inc;
+  const auto a_size = (layout == CLBlastLayoutRowMajor) ? m * a_ld : n * a_ld;
+  auto x_buffer = clblast::Buffer<double>(context, x_size);
+  auto y_buffer = clblast::Buffer<double>(context, y_size);
+  auto a_buffer = clblast::Buffer<double>(context, a_size);
+  x_buffer.Write(queue, x_size, reinterpret_cast<const double*>(x));
+  y_buffer.Write(queue, y_size, reinterpret_cast<const double*>(y));
+  a_buffer.Write(queue, a_size, reinterpret_cast<double*>(a));
+  auto queue_cl = queue();
+  auto s = clblast::Gerk(static_cast<clblast::Layout>(layout),
+                         m, n, k,
+                         alpha_cpp,
+                         x_buffer(), 0, x_inc,
+                         y_buffer(), 0, y_inc,
+                         a_buffer(), 0, a_ld,
+                         &queue_cl);
+  if (s != clblast::StatusCode::kSuccess) {
+    throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
+  }
+  a_buffer.Read(queue, a_size, reinterpret_cast<double*>(a));
+}
+void cblas_cgerk(const CLBlastLayout layout,
+                 const int m, const int n, const int k,
+                 const void* alpha,
+                 const void* x, const int x_inc,
+                 const void* y, const int y_inc,
+                 void* a, const int a_ld) {
+  auto device = get_device();
+  auto context = clblast::Context(device);
+  auto queue = clblast::Queue(context, device);
+  const auto alpha_cpp = float2{reinterpret_cast<const float*>(alpha)[0], reinterpret_cast<const float*>(alpha)[1]};
+  const auto x_size = m * k * x_inc;
+  const auto y_size = n * k * y_inc;
+  const auto a_size = (layout == CLBlastLayoutRowMajor) ? m * a_ld : n * a_ld;
+  auto x_buffer = clblast::Buffer<float2>(context, x_size);
+  auto y_buffer = clblast::Buffer<float2>(context, y_size);
+  auto a_buffer = clblast::Buffer<float2>(context, a_size);
+  x_buffer.Write(queue, x_size, reinterpret_cast<const float2*>(x));
+  y_buffer.Write(queue, y_size, reinterpret_cast<const float2*>(y));
+  a_buffer.Write(queue, a_size, reinterpret_cast<float2*>(a));
+  auto queue_cl = queue();
+  auto s = clblast::Gerk(static_cast<clblast::Layout>(layout),
+                         m, n, k,
+                         alpha_cpp,
+                         x_buffer(), 0, x_inc,
+                         y_buffer(), 0, y_inc,
+                         a_buffer(), 0, a_ld,
+                         &queue_cl);
+  if (s != clblast::StatusCode::kSuccess) {
+    throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
+  }
+  a_buffer.Read(queue, a_size, reinterpret_cast<float2*>(a));
+}
+void cblas_zgerk(const CLBlastLayout layout,
+                 const int m, const int n, const int k,
+                 const void* alpha,
+                 const void* x, const int x_inc,
+                 const void* y, const int y_inc,
+                 void* a, const int a_ld) {
+  auto device = get_device();
+  auto context = clblast::Context(device);
+  auto queue = clblast::Queue(context, device);
+  const auto alpha_cpp = double2{reinterpret_cast<const double*>(alpha)[0], reinterpret_cast<const double*>(alpha)[1]};
+  const auto x_size = m * k * x_inc;
+  const auto y_size = n * k * y_inc;
+  const auto a_size = (layout == CLBlastLayoutRowMajor) ? m * a_ld : n * a_ld;
+  auto x_buffer = clblast::Buffer<double2>(context, x_size);
+  auto y_buffer = clblast::Buffer<double2>(context, y_size);
+  auto a_buffer = clblast::Buffer<double2>(context, a_size);
+  x_buffer.Write(queue, x_size, reinterpret_cast<const double2*>(x));
+  y_buffer.Write(queue, y_size, reinterpret_cast<const double2*>(y));
+  a_buffer.Write(queue, a_size, reinterpret_cast<double2*>(a));
+  auto queue_cl = queue();
+  auto s = clblast::Gerk(static_cast<clblast::Layout>(layout),
+                         m, n, k,
+                         alpha_cpp,
+                         x_buffer(), 0, x_inc,
+                         y_buffer(), 0, y_inc,
+                         a_buffer(), 0, a_ld,
+                         &queue_cl);
+  if (s != clblast::StatusCode::kSuccess) {
+    throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
+  }
+  a_buffer.Read(queue, a_size, reinterpret_cast<double2*>(a));
+}
+
 // HER
 void cblas_cher(const CLBlastLayout layout, const CLBlastTriangle triangle,
                 const int n,
@@ -55,6 +55,14 @@
 // Exception classes
 #include "cxpp11_common.hpp"
 
+// Vendor-specific device queries, in case these are not defined in the OpenCL headers
+#ifndef CL_DEVICE_COMPUTE_CAPABILITY_MAJOR_NV
+  #define CL_DEVICE_COMPUTE_CAPABILITY_MAJOR_NV 0x4000
+#endif
+#ifndef CL_DEVICE_COMPUTE_CAPABILITY_MINOR_NV
+  #define CL_DEVICE_COMPUTE_CAPABILITY_MINOR_NV 0x4001
+#endif
+
 namespace clblast {
 // =================================================================================================
 
@@ -241,6 +249,7 @@ class Device {
   }
   std::string Vendor() const { return GetInfoString(CL_DEVICE_VENDOR); }
   std::string Name() const { return GetInfoString(CL_DEVICE_NAME); }
+  std::string DriverVersion() const { return GetInfoString(CL_DRIVER_VERSION); }
   std::string Type() const {
     auto type = GetInfo<cl_device_type>(CL_DEVICE_TYPE);
     switch(type) {
@@ -301,6 +310,15 @@ class Device {
                                 Vendor() == "GenuineIntel"; }
   bool IsARM() const { return Vendor() == "ARM"; }
 
+  // Retrieves the compute capability of an NVIDIA device (e.g. 'SM6.1') through the corresponding
+  // OpenCL extension. Returns an empty string if the extension is not available.
+  std::string NVIDIAComputeCapability() const {
+    if (Capabilities().find("cl_nv_device_attribute_query") == std::string::npos) { return ""; }
+    const auto major = GetInfo<cl_uint>(CL_DEVICE_COMPUTE_CAPABILITY_MAJOR_NV);
+    const auto minor = GetInfo<cl_uint>(CL_DEVICE_COMPUTE_CAPABILITY_MINOR_NV);
+    return "SM" + std::to_string(major) + "." + std::to_string(minor);
+  }
+
   // Accessor to the private data-member
   const cl_device_id& operator()() const { return device_; }
  private:
@@ -476,6 +494,24 @@ class Queue {
     CheckError(clFinish(*queue_));
   }
 
+  // Enqueues a marker, which completes once all earlier commands in the queue have completed. The
+  // OpenCL 1.1 version is deprecated as of OpenCL 1.2.
+  void EnqueueMarker(EventPointer event) const {
+    #ifdef CL_VERSION_1_2
+      CheckError(clEnqueueMarkerWithWaitList(*queue_, 0, nullptr, event));
+    #else
+      CheckError(clEnqueueMarker(*queue_, event));
+    #endif
+  }
+
+  // Checks whether commands in the queue may be executed out-of-order
+  bool IsOutOfOrder() const {
+    auto properties = cl_command_queue_properties{0};
+    CheckError(clGetCommandQueueInfo(*queue_, CL_QUEUE_PROPERTIES, sizeof(properties),
+                                     &properties, nullptr));
+    return (properties & CL_QUEUE_OUT_OF_ORDER_EXEC_MODE_ENABLE) != 0;
+  }
+
   // Retrieves the corresponding context or device
   Context GetContext() const {
     auto bytes = size_t{0};
@@ -0,0 +1,114 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the on-disk compilation cache (see the header for more information).
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+#include <thread>
+#include <chrono>
+#include <fstream>
+#include <sstream>
+#include <cstdio>
+#include <cstdlib>
+#include <cstdint>
+
+#if defined(_WIN32)
+  #include <direct.h>
+#else
+  #include <sys/stat.h>
+#endif
+
+#include "compilation_cache.hpp"
+
+namespace clblast {
+// =================================================================================================
+namespace {
+
+// Computes the 64-bit FNV-1a hash of a string, continuing from an earlier hash
+uint64_t HashString(const std::string &data, uint64_t hash = 14695981039346656037ULL) {
+  for (const auto character : data) {
+    hash ^= static_cast<uint64_t>(static_cast<unsigned char>(character));
+    hash *= 1099511628211ULL;
+  }
+  return hash;
+}
+
+} // anonymous namespace
+// =================================================================================================
+
+// The file name holds the hash of all inputs of the compilation, separated such that these can't be
+// confused with each other, and the total size of the source code and options
+std::string CompilationCacheFile(const Device &device, const std::string &source,
+                                 const std::vector<std::string> &options) {
+  const auto directory = ConvertArgument(std::getenv(kCompilationCacheVariable.c_str()),
+                                         std::string{""});
+  if (directory.empty()) { return ""; }
+
+  auto hash = HashString(device.Name() + '\n' + device.Version() + '\n' +
+                         device.DriverVersion() + '\n');
+  auto size = source.size();
+  for (const auto &option : options) {
+    hash = HashString(option + '\n', hash);
+    size += option.size();
+  }
+  hash = HashString(source, hash);
+
+  std::ostringstream filename;
+  filename << directory << "/clblast_" << std::hex << hash << "_" << std::dec << size << ".bin";
+  return filename.str();
+}
+
+// Reads the whole file as a binary
+bool LoadCompiledBinary(const std::string &filename, std::string &binary) {
+  if (filename.empty()) { return false; }
+  std::ifstream file(filename, std::ios::binary);
+  if (!file) { return false; }
+  std::ostringstream contents;
+  contents << file.rdbuf();
+  if (!file || contents.str().empty()) { return false; }
+  binary = contents.str();
+  return true;
+}
+
+// Creates the directory if needed and moves a complete temporary file in place
+void StoreCompiledBinary(const std::string &filename, const std::string &binary) {
+  if (filename.empty() || binary.empty()) { return; }
+  const auto directory = filename.substr(0, filename.find_last_of('/'));
+  #if defined(_WIN32)
+    _mkdir(directory.c_str());
+  #else
+    mkdir(directory.c_str(), 0755);
+  #endif
+
+  // The temporary file is unique per thread and moment, such that concurrent writers of the same
+  // binary don't interfere
+  const auto thread_hash = std::hash<std::thread::id>()(std::this_thread::get_id());
+  const auto ticks = std::chrono::steady_clock::now().time_since_epoch().count();
+  const auto temporary_filename = filename + ".tmp" + std::to_string(thread_hash) + "_" +
+                                  std::to_string(static_cast<long long>(ticks));
+  {
+    std::ofstream file(temporary_filename, std::ios::binary);
+    if (!file) { return; }
+    file.write(binary.data(), static_cast<std::streamsize>(binary.size()));
+    if (!file) {
+      file.close();
+      std::remove(temporary_filename.c_str());
+      return;
+    }
+  }
+  if (std::rename(temporary_filename.c_str(), filename.c_str()) != 0) {
+    std::remove(temporary_filename.c_str()); // e.g. written by another process in the meantime
+  }
+}
+
+// =================================================================================================
+} // namespace clblast
@@ -0,0 +1,49 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the opt-in on-disk compilation cache. It is enabled by setting the
+// environmental variable CLBLAST_COMPILATION_CACHE to a directory. Contrary to the in-memory binary
+// cache (see 'cache.hpp'), its entries are content-addressed: a compiled binary is stored under a
+// hash of the complete source code (including the defines with the kernel parameters), the compiler
+// options and the device and driver versions. This makes it valid across runs and processes, and
+// also for programs compiled with user-provided parameters, e.g. by the tuners.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_COMPILATION_CACHE_H_
+#define CLBLAST_COMPILATION_CACHE_H_
+
+#include <string>
+#include <vector>
+
+#include "utilities/utilities.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// The environmental variable enabling the compilation cache (set to the path of its directory)
+const std::string kCompilationCacheVariable = "CLBLAST_COMPILATION_CACHE";
+
+// Retrieves the path of the cache file of a program given its source code and compiler options.
+// This is an empty string if the compilation cache is disabled.
+std::string CompilationCacheFile(const Device &device, const std::string &source,
+                                 const std::vector<std::string> &options);
+
+// Loads a compiled binary from the cache. Returns whether it was found.
+bool LoadCompiledBinary(const std::string &filename, std::string &binary);
+
+// Stores a compiled binary in the cache. This writes to a temporary file first, such that other
+// processes sharing the cache never see partially written binaries. Failures are ignored.
+void StoreCompiledBinary(const std::string &filename, const std::string &binary);
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_COMPILATION_CACHE_H_
+#endif
@@ -28,6 +28,12 @@ const Database::DatabaseEntry XaxpyApple = {
 const Database::DatabaseEntry XdotApple = {
   "Xdot", Precision::kAny, { {  kDeviceTypeAll, "default", { { "default", { {"WGS1",1}, {"WGS2",1} } } } } }
 };
+const Database::DatabaseEntry XdotBatchedApple = {
+  "XdotBatched", Precision::kAny, { {  kDeviceTypeAll, "default", { { "default", { {"WGS1",1}, {"WGS2",1} } } } } }
+};
+const Database::DatabaseEntry XrotApple = {
+  "Xrot", Precision::kAny, { { kDeviceTypeAll, "default", { { "default", { {"VW",8}, {"WGS",1}, {"WPT",4} } } } } }
+};
 const Database::DatabaseEntry XgemvApple = {
   "Xgemv", Precision::kAny, { {  kDeviceTypeAll, "default", { { "default", { {"WGS1",1}, {"WPT1",4}, {"UNROLL1", 1} } } } } }
 };
@@ -37,6 +43,15 @@ const Database::DatabaseEntry XgemvFastApple = {
 const Database::DatabaseEntry XgemvFastRotApple = {
   "XgemvFastRot", Precision::kAny, { {  kDeviceTypeAll, "default", { { "default", { {"VW3",1}, {"WGS3",1}, {"WPT3",1} } } } } }
 };
+const Database::DatabaseEntry XgemvBatchedApple = {
+  "XgemvBatched", Precision::kAny, { {  kDeviceTypeAll, "default", { { "default", { {"WGS1",1}, {"WPT1",4}, {"UNROLL1", 1} } } } } }
+};
+const Database::DatabaseEntry XgemvBandedApple = {
+  "XgemvBanded", Precision::kAny, { {  kDeviceTypeAll, "default", { { "default", { {"WGS4",1}, {"WPT4",4} } } } } }
+};
+const Database::DatabaseEntry XgemvTiledApple = {
+  "XgemvTiled", Precision::kAny, { {  kDeviceTypeAll, "default", { { "default", { {"WGS5",1} } } } } }
+};
 const Database::DatabaseEntry XgerApple = {
   "Xger", Precision::kAny, { {  kDeviceTypeAll, "default", { { "default", { {"WGS1",64}, {"WGS2",1}, {"WPT",2} } } } } }
 };
@@ -49,6 +64,9 @@ const Database::DatabaseEntry XgemmApple = {
 const Database::DatabaseEntry XgemmDirectApple = {
   "XgemmDirect", Precision::kAny, { {  kDeviceTypeAll, "default", { { "default", { {"KWID",1}, {"MDIMAD",1}, {"MDIMCD",1}, {"NDIMBD",1}, {"NDIMCD",1}, {"PADA",0}, {"PADB",0}, {"VWMD",1}, {"VWND",1}, {"WGD",1} } } } } }
 };
+const Database::DatabaseEntry XgemmSkinnyApple = {
+  "XgemmSkinny", Precision::kAny, { {  kDeviceTypeAll, "default", { { "default", { {"SKINNY_NWI",4}, {"SKINNY_WGS",1} } } } } }
+};
 const Database::DatabaseEntry CopyApple = {
   "Copy", Precision::kAny, { {  kDeviceTypeAll, "default", { { "default", { {"COPY_DIMX",1}, {"COPY_DIMY",1}, {"COPY_VW",1}, {"COPY_WPT",1} } } } } }
 };
@@ -64,6 +82,12 @@ const Database::DatabaseEntry PadtransposeApple = {
 const Database::DatabaseEntry InvertApple = {
   "Invert", Precision::kAny, { {  kDeviceTypeAll, "default", { { "default", { {"INTERNAL_BLOCK_SIZE",16} } } } } }
 };
+const Database::DatabaseEntry XtrsmApple = {
+  "Xtrsm", Precision::kAny, { {  kDeviceTypeAll, "default", { { "default", { {"TRSM_BLOCK_SIZE",32} } } } } }
+};
+const Database::DatabaseEntry FillApple = {
+  "Fill", Precision::kAny, { {  kDeviceTypeAll, "default", { { "default", { {"FILL_DIMX",1}, {"FILL_DIMY",1}, {"FILL_WGS",1} } } } } }
+};
 
 // =================================================================================================
 } // namespace database
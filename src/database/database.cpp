@@ -18,18 +18,26 @@
 #include "database/database.hpp"
 #include "database/kernels/xaxpy.hpp"
 #include "database/kernels/xdot.hpp"
+#include "database/kernels/xdot_batched.hpp"
+#include "database/kernels/xrot.hpp"
 #include "database/kernels/xgemv.hpp"
 #include "database/kernels/xgemv_fast.hpp"
 #include "database/kernels/xgemv_fast_rot.hpp"
+#include "database/kernels/xgemv_batched.hpp"
+#include "database/kernels/xgemv_banded.hpp"
+#include "database/kernels/xgemv_tiled.hpp"
 #include "database/kernels/xger.hpp"
 #include "database/kernels/xtrsv.hpp"
+#include "database/kernels/xtrsm.hpp"
 #include "database/kernels/xgemm.hpp"
 #include "database/kernels/xgemm_direct.hpp"
+#include "database/kernels/xgemm_skinny.hpp"
 #include "database/kernels/copy.hpp"
 #include "database/kernels/pad.hpp"
 #include "database/kernels/transpose.hpp"
 #include "database/kernels/padtranspose.hpp"
 #include "database/kernels/invert.hpp"
+#include "database/kernels/fill.hpp"
 #include "database/apple_cpu_fallback.hpp"
 #include "database/kernel_selection.hpp"
 
@@ -40,26 +48,34 @@ namespace clblast {
 const std::vector<Database::DatabaseEntry> Database::database = std::vector<Database::DatabaseEntry>{
   database::XaxpyHalf, database::XaxpySingle, database::XaxpyDouble, database::XaxpyComplexSingle, database::XaxpyComplexDouble,
   database::XdotHalf, database::XdotSingle, database::XdotDouble, database::XdotComplexSingle, database::XdotComplexDouble,
+  database::XdotBatchedHalf, database::XdotBatchedSingle, database::XdotBatchedDouble, database::XdotBatchedComplexSingle, database::XdotBatchedComplexDouble,
+  database::XrotSingle, database::XrotDouble,
   database::XgemvHalf, database::XgemvSingle, database::XgemvDouble, database::XgemvComplexSingle, database::XgemvComplexDouble,
   database::XgemvFastHalf, database::XgemvFastSingle, database::XgemvFastDouble, database::XgemvFastComplexSingle, database::XgemvFastComplexDouble,
   database::XgemvFastRotHalf, database::XgemvFastRotSingle, database::XgemvFastRotDouble, database::XgemvFastRotComplexSingle, database::XgemvFastRotComplexDouble,
+  database::XgemvBatchedHalf, database::XgemvBatchedSingle, database::XgemvBatchedDouble, database::XgemvBatchedComplexSingle, database::XgemvBatchedComplexDouble,
+  database::XgemvBandedHalf, database::XgemvBandedSingle, database::XgemvBandedDouble, database::XgemvBandedComplexSingle, database::XgemvBandedComplexDouble,
+  database::XgemvTiledHalf, database::XgemvTiledSingle, database::XgemvTiledDouble, database::XgemvTiledComplexSingle, database::XgemvTiledComplexDouble,
   database::XgerHalf, database::XgerSingle, database::XgerDouble, database::XgerComplexSingle, database::XgerComplexDouble,
   database::XtrsvHalf, database::XtrsvSingle, database::XtrsvDouble, database::XtrsvComplexSingle, database::XtrsvComplexDouble,
+  database::XtrsmHalf, database::XtrsmSingle, database::XtrsmDouble, database::XtrsmComplexSingle, database::XtrsmComplexDouble,
   database::XgemmHalf, database::XgemmSingle, database::XgemmDouble, database::XgemmComplexSingle, database::XgemmComplexDouble,
   database::XgemmDirectHalf, database::XgemmDirectSingle, database::XgemmDirectDouble, database::XgemmDirectComplexSingle, database::XgemmDirectComplexDouble,
+  database::XgemmSkinnyHalf, database::XgemmSkinnySingle, database::XgemmSkinnyDouble, database::XgemmSkinnyComplexSingle, database::XgemmSkinnyComplexDouble,
   database::CopyHalf, database::CopySingle, database::CopyDouble, database::CopyComplexSingle, database::CopyComplexDouble,
   database::PadHalf, database::PadSingle, database::PadDouble, database::PadComplexSingle, database::PadComplexDouble,
   database::TransposeHalf, database::TransposeSingle, database::TransposeDouble, database::TransposeComplexSingle, database::TransposeComplexDouble,
   database::PadtransposeHalf, database::PadtransposeSingle, database::PadtransposeDouble, database::PadtransposeComplexSingle, database::PadtransposeComplexDouble,
   database::InvertHalf, database::InvertSingle, database::InvertDouble, database::InvertComplexSingle, database::InvertComplexDouble,
+  database::FillHalf, database::FillSingle, database::FillDouble, database::FillComplexSingle, database::FillComplexDouble,
   database::KernelSelectionHalf, database::KernelSelectionSingle, database::KernelSelectionDouble, database::KernelSelectionComplexSingle, database::KernelSelectionComplexDouble
 };
 const std::vector<Database::DatabaseEntry> Database::apple_cpu_fallback = std::vector<Database::DatabaseEntry>{
-  database::XaxpyApple, database::XdotApple,
-  database::XgemvApple, database::XgemvFastApple, database::XgemvFastRotApple, database::XgerApple, database::XtrsvApple,
-  database::XgemmApple, database::XgemmDirectApple,
+  database::XaxpyApple, database::XdotApple, database::XdotBatchedApple, database::XrotApple,
+  database::XgemvApple, database::XgemvFastApple, database::XgemvFastRotApple, database::XgemvBatchedApple, database::XgemvBandedApple, database::XgemvTiledApple, database::XgerApple, database::XtrsvApple,
+  database::XgemmApple, database::XgemmDirectApple, database::XgemmSkinnyApple,
   database::CopyApple, database::PadApple, database::TransposeApple, database::PadtransposeApple,
-  database::InvertApple
+  database::InvertApple, database::XtrsmApple, database::FillApple
 };
 
 // The default values
@@ -79,7 +95,15 @@ const std::unordered_map<std::string, std::string> Database::kVendorNames{
 // This takes an optional overlay database in case of custom tuning or custom kernels.
 Database::Database(const Device &device, const std::string &kernel_name,
                    const Precision precision, const std::vector<DatabaseEntry> &overlay):
-  parameters_(std::make_shared<Parameters>()) {
+  Database(device, kernel_name, precision, overlay, "") {
+}
+
+// As above, but with a shape class for which parameters might be tuned specifically
+Database::Database(const Device &device, const std::string &kernel_name,
+                   const Precision precision, const std::vector<DatabaseEntry> &overlay,
+                   const std::string &shape_bucket):
+  parameters_(nullptr),
+  shape_bucket_() {
 
   // Finds information of the current device
   auto device_type = device.Type();
@@ -87,11 +111,7 @@ Database::Database(const Device &device, const std::string &kernel_name,
   auto device_name = device.Name();
 
   // Set the short vendor name
-  for (auto &combination : kVendorNames) {
-    if (device_vendor == combination.first) {
-      device_vendor = combination.second;
-    }
-  }
+  device_vendor = ShortVendorName(device_vendor);
 
   // Sets the databases to search through
   auto databases = std::list<std::vector<DatabaseEntry>>{overlay, database};
@@ -107,12 +127,42 @@ Database::Database(const Device &device, const std::string &kernel_name,
     }
   #endif
 
+  // Searches for parameters of this shape class first. Only exact device matches are considered:
+  // the regular parameters tuned for this device are preferred over shape-specific defaults.
+  auto search_result = static_cast<const DatabaseDevice*>(nullptr);
+  if (!shape_bucket.empty()) {
+    const auto bucket_kernel_name = ShapeBucketKernelName(kernel_name, shape_bucket);
+    for (auto &db: databases) {
+      search_result = Search(bucket_kernel_name, device_type, device_vendor, device_name,
+                             precision, db, false);
+      if (search_result) {
+        parameters_ = search_result->parameters;
+        shape_bucket_ = shape_bucket;
+        device_specific_ = true;
+        database_entry_ = DescribeEntry(search_result, db) + " (shape class '" + shape_bucket + "')";
+        return;
+      }
+    }
+  }
+
   // Searches potentially multiple databases
-  auto search_result = ParametersPtr{};
   for (auto &db: databases) {
     search_result = Search(kernel_name, device_type, device_vendor, device_name, precision, db);
     if (search_result) {
-      parameters_->insert(search_result->begin(), search_result->end());
+      device_specific_ = (Search(kernel_name, device_type, device_vendor, device_name, precision,
+                                 db, false) == search_result);
+      database_entry_ = DescribeEntry(search_result, db);
+
+      // Without parameters for this exact device, prefers the nearest tuned device over defaults
+      if (!device_specific_) {
+        const auto nearest_result = SearchNearest(kernel_name, GetDeviceProperties(device),
+                                                  precision, db);
+        if (nearest_result) {
+          search_result = nearest_result;
+          database_entry_ = DescribeEntry(search_result, db) + " (nearest device)";
+        }
+      }
+      parameters_ = search_result->parameters;
       break;
     }
   }
@@ -122,6 +172,31 @@ Database::Database(const Device &device, const std::string &kernel_name,
 
 // =================================================================================================
 
+// Translates the vendor name using the list of alternative names above
+std::string Database::ShortVendorName(const std::string &vendor) {
+  for (auto &combination : kVendorNames) {
+    if (vendor == combination.first) {
+      return combination.second;
+    }
+  }
+  return vendor;
+}
+
+// Creates the shared parameter sets from the rows of a table of values
+std::vector<Database::SharedParameters>
+Database::ParameterSets(const std::vector<std::string> &names,
+                        const std::vector<std::vector<size_t>> &rows) {
+  auto parameter_sets = std::vector<SharedParameters>();
+  parameter_sets.reserve(rows.size());
+  for (const auto &row : rows) {
+    if (row.size() != names.size()) { throw RuntimeErrorCode(StatusCode::kDatabaseError); }
+    auto parameters = Parameters();
+    for (auto i = size_t{0}; i < names.size(); ++i) { parameters[names[i]] = row[i]; }
+    parameter_sets.push_back(std::make_shared<const Parameters>(parameters));
+  }
+  return parameter_sets;
+}
+
 // Returns a list of OpenCL pre-processor defines in string form
 std::string Database::GetDefines() const {
   std::string defines{};
@@ -142,13 +217,15 @@ std::vector<std::string> Database::GetParameterNames() const {
 
 // =================================================================================================
 
-// Searches a particular database for the right kernel and precision
-Database::ParametersPtr Database::Search(const std::string &this_kernel,
-                                         const std::string &this_type,
-                                         const std::string &this_vendor,
-                                         const std::string &this_device,
-                                         const Precision this_precision,
-                                         const std::vector<DatabaseEntry> &this_database) const {
+// Searches a particular database for the right kernel and precision. Without defaults, only an
+// entry for this exact device is accepted.
+const Database::DatabaseDevice* Database::Search(const std::string &this_kernel,
+                                                 const std::string &this_type,
+                                                 const std::string &this_vendor,
+                                                 const std::string &this_device,
+                                                 const Precision this_precision,
+                                                 const std::vector<DatabaseEntry> &this_database,
+                                                 const bool allow_defaults) {
 
   // Selects the right kernel
   for (auto &db: this_database) {
@@ -158,17 +235,17 @@ Database::ParametersPtr Database::Search(const std::string &this_kernel,
       // Searches for the right vendor and device type, or selects the default if unavailable. This
       // assumes that the default vendor / device type is last in the database.
       for (auto &vendor: db.vendors) {
-        if ((vendor.name == this_vendor || vendor.name == kDeviceVendorAll) &&
-            (vendor.type == this_type || vendor.type == database::kDeviceTypeAll)) {
+        if ((vendor.name == this_vendor || (allow_defaults && vendor.name == kDeviceVendorAll)) &&
+            (vendor.type == this_type || (allow_defaults && vendor.type == database::kDeviceTypeAll))) {
 
           // Searches for the right device. If the current device is unavailable, selects the vendor
           // default parameters. This assumes the default is last in the database.
           for (auto &device: vendor.devices) {
 
-            if (device.name == this_device || device.name == "default") {
+            if (device.name == this_device || (allow_defaults && device.name == "default")) {
 
               // Sets the parameters accordingly
-              return &device.parameters;
+              return &device;
             }
           }
         }
@@ -180,5 +257,50 @@ Database::ParametersPtr Database::Search(const std::string &this_kernel,
   return nullptr;
 }
 
+// Searches a particular database for the nearest tuned device of the same vendor and type
+const Database::DatabaseDevice* Database::SearchNearest(const std::string &this_kernel,
+                                                        const DeviceProperties &this_device,
+                                                        const Precision this_precision,
+                                                        const std::vector<DatabaseEntry> &this_database) const {
+
+  // Collects the tuned devices of the right kernel, precision, vendor and device type
+  auto candidates = std::vector<DeviceProperties>();
+  auto candidate_devices = std::vector<const DatabaseDevice*>();
+  for (auto &db: this_database) {
+    if ((db.kernel == this_kernel) &&
+        (db.precision == this_precision || db.precision == Precision::kAny)) {
+      for (auto &vendor: db.vendors) {
+        if (vendor.name != this_device.vendor || vendor.type != this_device.type) { continue; }
+        for (auto &device: vendor.devices) {
+          if (device.name == "default") { continue; }
+          candidates.push_back(DatabaseDeviceProperties(vendor.name, vendor.type, device.name));
+          candidate_devices.push_back(&device);
+        }
+      }
+    }
+  }
+
+  // Selects the nearest one, if any is similar enough
+  const auto nearest = NearestDevice(this_device, candidates);
+  if (nearest == candidates.size()) { return nullptr; }
+  return candidate_devices[nearest];
+}
+
+// Describes the database entry of a device, e.g. "NVIDIA GPU 'GeForce GTX 1080'"
+std::string Database::DescribeEntry(const DatabaseDevice* this_device,
+                                    const std::vector<DatabaseEntry> &this_database) {
+  for (auto &db: this_database) {
+    for (auto &vendor: db.vendors) {
+      for (auto &device: vendor.devices) {
+        if (&device != this_device) { continue; }
+        if (vendor.name == kDeviceVendorAll) { return "default"; }
+        if (device.name == "default") { return vendor.name + " " + vendor.type + " default"; }
+        return vendor.name + " " + vendor.type + " '" + device.name + "'";
+      }
+    }
+  }
+  return "unknown";
+}
+
 // =================================================================================================
 } // namespace clblast
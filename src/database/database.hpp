@@ -20,8 +20,12 @@
 #include <string>
 #include <vector>
 #include <unordered_map>
+#include <memory>
+#include <algorithm>
+#include <cctype>
 
 #include "utilities/utilities.hpp"
+#include "database/device_matching.hpp"
 
 namespace clblast {
 // =================================================================================================
@@ -35,6 +39,21 @@ namespace database {
   const std::string kDeviceTypeAccelerator = "accelerator";
   const std::string kDeviceTypeAll = "default";
 
+  // The shape classes of a problem (see 'Database::ShapeBucket' below)
+  const std::string kShapeBucketSmall = "small";
+  const std::string kShapeBucketWide = "wide";
+  const std::string kShapeBucketDeep = "deep";
+
+  // Thresholds for the shape classes: the aspect ratio beyond which a problem is wide (m vs. n) or
+  // deep (k vs. m and n), and the number of multiply-adds up to which it is small
+  const size_t kShapeBucketAspectRatio = 16;
+  const size_t kShapeBucketSmallSize = 128 * 128 * 128;
+
+  // The kernel families (as named by the tuners) which can have entries per shape class. Their
+  // tuning results are stored under e.g. 'xgemm_1_small', becoming 'XgemmSmall' in the database.
+  const std::vector<std::string> kShapeBucketFamilies = {"xgemm_1", "xgemm_2",
+                                                         "xgemm_direct_1", "xgemm_direct_2"};
+
 } // namespace database
 
 // =================================================================================================
@@ -43,14 +62,19 @@ namespace database {
 class Database {
  public:
 
-  // Type alias for the database parameters
+  // Type alias for the database parameters. The parameters of a device are immutable and can be
+  // shared among devices with identical parameters (see 'ParameterSets' below).
   using Parameters = std::unordered_map<std::string,size_t>;
-  using ParametersPtr = const Parameters*;
+  using SharedParameters = std::shared_ptr<const Parameters>;
 
   // Structures for content inside the database
   struct DatabaseDevice {
+    DatabaseDevice(const std::string &device_name, const Parameters &device_parameters):
+      name(device_name), parameters(std::make_shared<const Parameters>(device_parameters)) { }
+    DatabaseDevice(const std::string &device_name, const SharedParameters &device_parameters):
+      name(device_name), parameters(device_parameters) { }
     std::string name;
-    Parameters parameters;
+    SharedParameters parameters;
   };
   struct DatabaseVendor {
     std::string type;
@@ -69,6 +93,12 @@ class Database {
   // Alternative names for some OpenCL vendors
   static const std::unordered_map<std::string, std::string> kVendorNames;
 
+  // Creates the table of unique parameter sets of a kernel as found in the database/kernels/xxxxx.h
+  // files: each row holds the values of the given parameter names. The devices of the kernel refer
+  // to a row by its index, such that identical parameters are stored only once.
+  static std::vector<SharedParameters> ParameterSets(const std::vector<std::string> &names,
+                                                     const std::vector<std::vector<size_t>> &rows);
+
   // The database consists of separate database entries, stored together in a vector
   static const std::vector<DatabaseEntry> database;
 
@@ -81,6 +111,13 @@ class Database {
   explicit Database(const Device &device, const std::string &kernel_name,
                     const Precision precision, const std::vector<DatabaseEntry> &overlay);
 
+  // As above, but first searches for parameters tuned for this device and a specific shape class
+  // of the problem. If there are none, this falls back to the regular parameters and the found
+  // shape bucket (see below) is left empty.
+  explicit Database(const Device &device, const std::string &kernel_name,
+                    const Precision precision, const std::vector<DatabaseEntry> &overlay,
+                    const std::string &shape_bucket);
+
   // Accessor of values by key
   size_t operator[](const std::string &key) const { return parameters_->find(key)->second; }
   bool exists(const std::string &key) const { return (parameters_->count(key) == 1); }
@@ -91,15 +128,90 @@ class Database {
   // Retrieves the names of all the parameters
   std::vector<std::string> GetParameterNames() const;
 
+  // The shape class of the parameters, or an empty string for the regular (shape-agnostic) ones
+  const std::string& GetShapeBucket() const { return shape_bucket_; }
+
+  // Whether the parameters are tuned for this device, as opposed to vendor or general defaults
+  bool IsDeviceSpecific() const { return device_specific_; }
+
+  // Describes the database entry the parameters are taken from, e.g. "NVIDIA GPU 'GeForce GTX 1080'
+  // (nearest device)" in case the parameters of the nearest tuned device are used
+  const std::string& GetDatabaseEntry() const { return database_entry_; }
+
+  // Translates an OpenCL vendor name into the short name as used in the database (e.g. 'AMD')
+  static std::string ShortVendorName(const std::string &vendor);
+
+  // Classifies an m-by-n-by-k problem (e.g. of GEMM) by size and aspect ratio. Returns an empty
+  // string for regular shapes, which are served by the regular parameters of a kernel.
+  static std::string ShapeBucket(const size_t m, const size_t n, const size_t k) {
+    const auto mn_min = std::min(m, n);
+    const auto mn_max = std::max(m, n);
+    if (k >= database::kShapeBucketAspectRatio * mn_max) { return database::kShapeBucketDeep; }
+    if (mn_max >= database::kShapeBucketAspectRatio * mn_min) { return database::kShapeBucketWide; }
+    if (m * n * k <= database::kShapeBucketSmallSize) { return database::kShapeBucketSmall; }
+    return "";
+  }
+
+  // The name of the kernel in the database for a kernel family as named by the tuners, following the
+  // database script: e.g. 'xgemm_direct_1' becomes 'XgemmDirect' and 'xgemm_1_small' 'XgemmSmall'
+  static std::string FamilyKernelName(const std::string &kernel_family) {
+    auto kernel_name = std::string{""};
+    auto previous = '_';
+    for (auto i = size_t{0}; i < kernel_family.size(); ++i) {
+      const auto c = kernel_family[i];
+      if (c == '_' && i + 1 < kernel_family.size() && std::isdigit(kernel_family[i + 1])) {
+        while (i + 1 < kernel_family.size() && std::isdigit(kernel_family[i + 1])) { ++i; }
+        continue; // e.g. the '_1' of 'xgemm_1'
+      }
+      if (c != '_') {
+        const auto first = !std::isalpha(previous);
+        kernel_name += static_cast<char>(first ? std::toupper(c) : std::tolower(c));
+      }
+      previous = c;
+    }
+    return kernel_name;
+  }
+
+  // The name under which the entries of a kernel for a specific shape class are stored in the
+  // database, e.g. 'XgemmSmall' for the 'small' class of the 'Xgemm' kernel
+  static std::string ShapeBucketKernelName(const std::string &kernel_name,
+                                           const std::string &shape_bucket) {
+    if (shape_bucket.empty()) { return kernel_name; }
+    return kernel_name + static_cast<char>(std::toupper(shape_bucket[0])) + shape_bucket.substr(1);
+  }
+
+  // Search method for a specified database, returning a pointer to the device entry (possibly a
+  // nullptr). Optionally disallows the vendor and device defaults, only accepting an exact match.
+  static const DatabaseDevice* Search(const std::string &this_kernel, const std::string &this_type,
+                                      const std::string &this_vendor,
+                                      const std::string &this_device,
+                                      const Precision this_precision,
+                                      const std::vector<DatabaseEntry> &db,
+                                      const bool allow_defaults = true);
+
  private:
-  // Search method for a specified database, returning pointer (possibly a nullptr)
-  ParametersPtr Search(const std::string &this_kernel, const std::string &this_type,
-                       const std::string &this_vendor, const std::string &this_device,
-                       const Precision this_precision,
-                       const std::vector<DatabaseEntry> &db) const;
-
-  // Found parameters suitable for this device/kernel
-  std::shared_ptr<Parameters> parameters_;
+  // Searches a specified database for the nearest tuned device of the same vendor and type (see
+  // 'device_matching.hpp'), returning a pointer to the device entry (possibly a nullptr)
+  const DatabaseDevice* SearchNearest(const std::string &this_kernel,
+                                      const DeviceProperties &this_device,
+                                      const Precision this_precision,
+                                      const std::vector<DatabaseEntry> &db) const;
+
+  // Describes a device entry of a specified database
+  static std::string DescribeEntry(const DatabaseDevice* device,
+                                   const std::vector<DatabaseEntry> &db);
+
+  // Found parameters suitable for this device/kernel, shared with the database entry
+  SharedParameters parameters_;
+
+  // The shape class of the found parameters (empty for the regular parameters)
+  std::string shape_bucket_;
+
+  // Whether the found parameters are an entry for this exact device
+  bool device_specific_ = false;
+
+  // Description of the database entry of the found parameters
+  std::string database_entry_;
 };
 
 // =================================================================================================
@@ -0,0 +1,272 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the matching of devices (see the header for more information).
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+#include <cctype>
+#include <algorithm>
+
+#include "database/database.hpp"
+#include "database/device_matching.hpp"
+
+namespace clblast {
+// =================================================================================================
+namespace {
+
+// Devices in the database of which the architecture cannot be derived from the name, together
+// with their number of compute units
+const std::vector<DeviceProperties> kKnownDevices = {
+  {database::kDeviceTypeGPU, "NVIDIA", "GRID K520", "SM3.0", 8},
+  {database::kDeviceTypeGPU, "NVIDIA", "GeForce GT 650M", "SM3.0", 2},
+  {database::kDeviceTypeGPU, "NVIDIA", "GeForce GTX 1070", "SM6.1", 15},
+  {database::kDeviceTypeGPU, "NVIDIA", "GeForce GTX 1080", "SM6.1", 20},
+  {database::kDeviceTypeGPU, "NVIDIA", "GeForce GTX 480", "SM2.0", 15},
+  {database::kDeviceTypeGPU, "NVIDIA", "GeForce GTX 670", "SM3.0", 7},
+  {database::kDeviceTypeGPU, "NVIDIA", "GeForce GTX 680", "SM3.0", 8},
+  {database::kDeviceTypeGPU, "NVIDIA", "GeForce GTX 750", "SM5.0", 4},
+  {database::kDeviceTypeGPU, "NVIDIA", "GeForce GTX 750 Ti", "SM5.0", 5},
+  {database::kDeviceTypeGPU, "NVIDIA", "GeForce GTX 980", "SM5.2", 16},
+  {database::kDeviceTypeGPU, "NVIDIA", "GeForce GTX TITAN", "SM3.5", 14},
+  {database::kDeviceTypeGPU, "NVIDIA", "GeForce GTX TITAN Black", "SM3.5", 15},
+  {database::kDeviceTypeGPU, "NVIDIA", "GeForce GTX TITAN X", "SM5.2", 24},
+  {database::kDeviceTypeGPU, "NVIDIA", "TITAN X (Pascal)", "SM6.1", 28},
+  {database::kDeviceTypeGPU, "NVIDIA", "Tesla K20m", "SM3.5", 13},
+  {database::kDeviceTypeGPU, "NVIDIA", "Tesla K40m", "SM3.5", 15},
+  {database::kDeviceTypeGPU, "AMD", "AMD Radeon R9 M370X Compute Engine", "GFX6", 10},
+  {database::kDeviceTypeGPU, "AMD", "ATI Radeon HD 6750M", "TeraScale", 6},
+};
+
+// AMD GPU code-names (as reported as device name by the AMD OpenCL drivers) and their architecture
+const std::vector<std::pair<std::string, std::string>> kAMDCodeNames = {
+  {"Cedar", "TeraScale"}, {"Redwood", "TeraScale"}, {"Juniper", "TeraScale"},
+  {"Cypress", "TeraScale"}, {"Caicos", "TeraScale"}, {"Turks", "TeraScale"},
+  {"Barts", "TeraScale"}, {"Cayman", "TeraScale"},
+  {"Tahiti", "GFX6"}, {"Pitcairn", "GFX6"}, {"Capeverde", "GFX6"}, {"Cape Verde", "GFX6"},
+  {"Oland", "GFX6"}, {"Hainan", "GFX6"},
+  {"Hawaii", "GFX7"}, {"Bonaire", "GFX7"}, {"Kaveri", "GFX7"}, {"Kabini", "GFX7"},
+  {"Mullins", "GFX7"}, {"Spectre", "GFX7"}, {"Spooky", "GFX7"},
+  {"Tonga", "GFX8"}, {"Fiji", "GFX8"}, {"Iceland", "GFX8"}, {"Carrizo", "GFX8"},
+  {"Stoney", "GFX8"}, {"Ellesmere", "GFX8"}, {"Baffin", "GFX8"}, {"Lexa", "GFX8"},
+};
+
+// Intel GPU generations: keywords in the device name and the numbers of the 'HD Graphics' models
+const std::vector<std::pair<std::string, std::string>> kIntelGPUKeywords = {
+  {"ivybridge", "Gen7"}, {"ivy bridge", "Gen7"}, {"haswell", "Gen7.5"}, {"broadwell", "Gen8"},
+  {"skylake", "Gen9"}, {"kabylake", "Gen9"}, {"kaby lake", "Gen9"},
+};
+const std::vector<std::pair<std::string, std::string>> kIntelGPUModels = {
+  {"2500", "Gen7"}, {"4000", "Gen7"},
+  {"4200", "Gen7.5"}, {"4400", "Gen7.5"}, {"4600", "Gen7.5"}, {"5000", "Gen7.5"},
+  {"5100", "Gen7.5"}, {"5200", "Gen7.5"},
+  {"5300", "Gen8"}, {"5500", "Gen8"}, {"5600", "Gen8"}, {"6000", "Gen8"}, {"6100", "Gen8"},
+  {"6200", "Gen8"}, {"6300", "Gen8"},
+};
+
+// ARM Mali GPUs of the Bifrost architecture (the older 'Mali-T' ones are Midgard)
+const std::vector<std::string> kMaliBifrost = {"Mali-G31", "Mali-G51", "Mali-G52", "Mali-G71",
+                                               "Mali-G72", "Mali-G76"};
+
+// Parts of device names which are too generic to distinguish devices of the same vendor
+const std::vector<std::string> kGenericNameTokens = {
+  "nvidia", "geforce", "gtx", "gt", "amd", "ati", "radeon", "intel", "tm", "hd",
+  "graphics", "cpu", "core", "compute", "engine", "gpu", "processor", "mobile",
+};
+
+// Character helpers
+bool IsNotDigit(const char c) { return !std::isdigit(static_cast<unsigned char>(c)); }
+std::string ToLower(std::string text) {
+  for (auto &c : text) { c = static_cast<char>(std::tolower(static_cast<unsigned char>(c))); }
+  return text;
+}
+
+// Splits a device name into lower-case alpha-numeric parts, ignoring generic parts and anything
+// after an '@' (e.g. the clock frequency of Intel CPUs)
+std::vector<std::string> NameTokens(const std::string &name) {
+  const auto text = ToLower(name.substr(0, name.find('@')));
+  auto tokens = std::vector<std::string>();
+  auto token = std::string{};
+  for (auto i = size_t{0}; i <= text.size(); ++i) {
+    if (i < text.size() && std::isalnum(static_cast<unsigned char>(text[i]))) {
+      token += text[i];
+      continue;
+    }
+    const auto &generic = kGenericNameTokens;
+    if (token.size() > 1 && std::find(generic.begin(), generic.end(), token) == generic.end()) {
+      tokens.push_back(token);
+    }
+    token.clear();
+  }
+  return tokens;
+}
+
+// Whether two model numbers are of the same series: the same number of digits and the same digits
+// except for the last two (e.g. '970' and '980', or '1070' and '1080')
+bool IsSameSeries(const std::string &token_a, const std::string &token_b) {
+  const auto digits_a = std::find_if(token_a.begin(), token_a.end(), IsNotDigit) - token_a.begin();
+  const auto digits_b = std::find_if(token_b.begin(), token_b.end(), IsNotDigit) - token_b.begin();
+  if (digits_a < 3 || digits_a != digits_b) { return false; }
+  return token_a.compare(0, static_cast<size_t>(digits_a - 2), token_b, 0,
+                         static_cast<size_t>(digits_b - 2)) == 0;
+}
+
+// Returns the architecture family, i.e. without the minor version (e.g. 'SM6' for 'SM6.1')
+std::string ArchitectureFamily(const std::string &architecture) {
+  return architecture.substr(0, architecture.find('.'));
+}
+
+} // anonymous namespace
+// =================================================================================================
+
+// Derives the architecture from the name
+std::string ArchitectureFromName(const std::string &vendor, const std::string &type,
+                                 const std::string &name) {
+  for (const auto &known_device : kKnownDevices) {
+    if (known_device.vendor == vendor && known_device.type == type && known_device.name == name) {
+      return known_device.architecture;
+    }
+  }
+  const auto lower_name = ToLower(name);
+  if (vendor == "AMD" && type == database::kDeviceTypeGPU) {
+    for (const auto &code_name : kAMDCodeNames) {
+      if (ToLower(code_name.first) == lower_name) { return code_name.second; }
+    }
+    if (lower_name.size() >= 4 && lower_name.compare(0, 3, "gfx") == 0 &&
+        std::isdigit(static_cast<unsigned char>(lower_name[3]))) {
+      return "GFX" + lower_name.substr(3, 1); // e.g. 'gfx803' is of the 'GFX8' architecture
+    }
+  }
+  if (vendor == "Intel" && type == database::kDeviceTypeGPU) {
+    for (const auto &keyword : kIntelGPUKeywords) {
+      if (lower_name.find(keyword.first) != std::string::npos) { return keyword.second; }
+    }
+    const auto tokens = NameTokens(name);
+    for (const auto &model : kIntelGPUModels) {
+      if (std::find(tokens.begin(), tokens.end(), model.first) != tokens.end()) {
+        return model.second;
+      }
+    }
+    for (const auto &token : tokens) { // e.g. 'HD Graphics 530' or 'HD Graphics 620'
+      if (token.size() == 3 && (token[0] == '5' || token[0] == '6') &&
+          std::find_if(token.begin(), token.end(), IsNotDigit) == token.end()) {
+        return "Gen9";
+      }
+    }
+  }
+  if (vendor == "Intel" && type == database::kDeviceTypeCPU) {
+    const auto pos = lower_name.find(" i"); // e.g. 'Core(TM) i7-4790K' is of the 4th generation
+    if (pos != std::string::npos && pos + 3 < lower_name.size() && lower_name[pos + 3] == '-') {
+      const auto model = lower_name.substr(pos + 4);
+      const auto digits = std::find_if(model.begin(), model.end(), IsNotDigit) - model.begin();
+      if (digits == 4) { return "Core-" + model.substr(0, 1); }
+      if (digits == 5) { return "Core-" + model.substr(0, 2); }
+    }
+  }
+  if (vendor == "Intel" && type == database::kDeviceTypeAccelerator) {
+    if (lower_name.find("many integrated core") != std::string::npos) { return "MIC"; }
+  }
+  if (vendor == "ARM" && name.compare(0, 6, "Mali-T") == 0) { return "Midgard"; }
+  if (vendor == "ARM" && name.compare(0, 6, "Mali-G") == 0) {
+    for (const auto &model : kMaliBifrost) {
+      if (name.compare(0, model.size(), model) == 0) { return "Bifrost"; }
+    }
+    return "Valhall";
+  }
+  return "";
+}
+
+// Retrieves the properties of a device in the database
+DeviceProperties DatabaseDeviceProperties(const std::string &vendor, const std::string &type,
+                                          const std::string &name) {
+  for (const auto &known_device : kKnownDevices) {
+    if (known_device.vendor == vendor && known_device.type == type && known_device.name == name) {
+      return known_device;
+    }
+  }
+  return DeviceProperties{type, vendor, name, ArchitectureFromName(vendor, type, name), 0};
+}
+
+// Retrieves the properties of an OpenCL device
+DeviceProperties GetDeviceProperties(const Device &device) {
+  auto properties = DeviceProperties{};
+  properties.type = device.Type();
+  properties.vendor = Database::ShortVendorName(device.Vendor());
+  properties.name = device.Name();
+  properties.compute_units = device.ComputeUnits();
+  if (properties.vendor == "NVIDIA") {
+    try {
+      properties.architecture = device.NVIDIAComputeCapability();
+    } catch (const CLError &) { } // falls back to the name below
+  }
+  if (properties.architecture.empty()) {
+    properties.architecture = ArchitectureFromName(properties.vendor, properties.type,
+                                                   properties.name);
+  }
+  return properties;
+}
+
+// =================================================================================================
+
+// Scores the similarity of two devices
+int DeviceMatchScore(const DeviceProperties &device, const DeviceProperties &candidate) {
+  if (device.vendor != candidate.vendor || device.type != candidate.type) { return 0; }
+  auto score = 0;
+
+  // The architecture: the same one, or at least the same family (e.g. 'SM6.0' and 'SM6.1')
+  if (!device.architecture.empty() && !candidate.architecture.empty()) {
+    if (device.architecture == candidate.architecture) { score += 1000; }
+    else if (ArchitectureFamily(device.architecture) ==
+             ArchitectureFamily(candidate.architecture)) {
+      score += 500;
+    }
+  }
+
+  // The model names, e.g. 'GeForce GTX 1080 Ti' and 'GeForce GTX 1080' share '1080', while
+  // 'GeForce GTX 1070' is at least of the same series
+  const auto device_tokens = NameTokens(device.name);
+  for (const auto &token : NameTokens(candidate.name)) {
+    if (std::find(device_tokens.begin(), device_tokens.end(), token) != device_tokens.end()) {
+      score += 200;
+      continue;
+    }
+    for (const auto &device_token : device_tokens) {
+      if (IsSameSeries(device_token, token)) { score += 100; break; }
+    }
+  }
+
+  // The number of compute units: only as a tie-breaker, this is never enough for a match
+  if (device.compute_units > 0 && candidate.compute_units > 0) {
+    const auto min_units = std::min(device.compute_units, candidate.compute_units);
+    const auto max_units = std::max(device.compute_units, candidate.compute_units);
+    const auto ratio = static_cast<double>(min_units) / static_cast<double>(max_units);
+    score += static_cast<int>(50.0 * ratio);
+  }
+  return score;
+}
+
+// Finds the nearest device
+size_t NearestDevice(const DeviceProperties &device,
+                     const std::vector<DeviceProperties> &candidates) {
+  auto best_index = candidates.size();
+  auto best_score = kMinimumMatchScore - 1;
+  for (auto i = size_t{0}; i < candidates.size(); ++i) {
+    const auto score = DeviceMatchScore(device, candidates[i]);
+    if (score > best_score) {
+      best_score = score;
+      best_index = i;
+    }
+  }
+  return best_index;
+}
+
+// =================================================================================================
+} // namespace clblast
@@ -0,0 +1,69 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the matching of a device to the nearest tuned device in the database. This
+// is used when the exact device name is not in the database (e.g. a new board revision or a driver
+// reporting a different name), as a better alternative than the vendor's default parameters. The
+// database only holds the names of the tuned devices, so their properties are derived from their
+// names and from a small table of known devices. The matching itself works on plain properties,
+// such that it can be tested without any OpenCL device.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_DATABASE_DEVICE_MATCHING_H_
+#define CLBLAST_DATABASE_DEVICE_MATCHING_H_
+
+#include <string>
+#include <vector>
+
+#include "utilities/utilities.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// The properties of a device as used for matching
+struct DeviceProperties {
+  std::string type;         // the device type as in the database, e.g. 'GPU'
+  std::string vendor;       // the short vendor name as in the database, e.g. 'NVIDIA'
+  std::string name;         // the device name, e.g. 'GeForce GTX 1080 Ti'
+  std::string architecture; // e.g. 'SM6.1', 'GFX8' or 'Gen9', an empty string if unknown
+  size_t compute_units;     // the number of compute units, zero if unknown
+};
+
+// The minimum score (see below) for a tuned device to be considered similar enough
+constexpr auto kMinimumMatchScore = 100;
+
+// Derives the architecture of a device from its vendor, type and name, e.g. from AMD code-names
+// ('Hawaii' is 'GFX7'), Intel GPU generations or NVIDIA devices in the database. Returns an empty
+// string if unknown.
+std::string ArchitectureFromName(const std::string &vendor, const std::string &type,
+                                 const std::string &name);
+
+// Retrieves the properties of a tuned device from its entry in the database
+DeviceProperties DatabaseDeviceProperties(const std::string &vendor, const std::string &type,
+                                          const std::string &name);
+
+// Retrieves the properties of an OpenCL device, querying the architecture where possible
+DeviceProperties GetDeviceProperties(const Device &device);
+
+// Computes how similar a tuned device is to the target device: a matching architecture weighs
+// most, followed by the model names and the number of compute units. The latter is never enough
+// for a match by itself. Devices of a different vendor or type are never similar (a score of zero).
+int DeviceMatchScore(const DeviceProperties &device, const DeviceProperties &candidate);
+
+// Finds the nearest of a list of tuned devices. Returns the index of the best match, or the number
+// of candidates in case none of them scores at least the minimum score.
+size_t NearestDevice(const DeviceProperties &device,
+                     const std::vector<DeviceProperties> &candidates);
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_DATABASE_DEVICE_MATCHING_H_
+#endif
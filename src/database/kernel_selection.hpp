@@ -12,6 +12,22 @@
 // regular kernel tuning parameters: they can be specific for a certain vendor or device or can use
 // some common default values.
 //
+// The stream-K version of the in-direct GEMM kernel is used for wave-quantisation tails: when the
+// tiles fill more than one wave of work-groups, but the regular kernel would fill less than
+// XGEMM_STREAMK_MAX_EFFICIENCY percent of its work-group slots, assuming that each compute unit
+// holds XGEMM_STREAMK_OCCUPANCY work-groups. Setting the occupancy to zero disables stream-K.
+//
+// The skinny version of the GEMM kernel is used when one of the dimensions m and n is at most
+// XGEMM_SKINNY_MAX_N and the other is at least XGEMM_SKINNY_MIN_M, such that there is enough
+// parallelism. As each thread loops over the full k-dimension, k is at most XGEMM_SKINNY_MAX_K.
+// Setting XGEMM_SKINNY_MAX_N to zero disables the skinny kernel.
+//
+// The reduction routines (DOT, NRM2, ASUM, AMAX and variants) run a single kernel in which the last
+// work-group to finish computes the final result if REDUCTION_SINGLE_PASS is 1, and a main and an
+// epilogue kernel otherwise. The single-pass kernel relies on global-memory fences to make the
+// partial results of all work-groups visible to the last one (see 'LastWorkGroupDone' in the
+// kernels' common code), so it should be disabled for devices on which these are not sufficient.
+//
 // =================================================================================================
 
 namespace clblast {
@@ -22,17 +38,17 @@ const Database::DatabaseEntry KernelSelectionHalf = {
   "KernelSelection", Precision::kHalf, {
     { // Intel GPUs
       kDeviceTypeGPU, "Intel", {
-        { "default",                                         { {"XGEMM_MIN_INDIRECT_SIZE",1*1*1} } },
+        { "default",                                         { {"XGEMM_MIN_INDIRECT_SIZE",1*1*1}, {"XGEMM_STREAMK_MAX_EFFICIENCY",80}, {"XGEMM_STREAMK_OCCUPANCY",2}, {"XGEMM_SKINNY_MAX_N",32}, {"XGEMM_SKINNY_MIN_M",512}, {"XGEMM_SKINNY_MAX_K",4096}, {"REDUCTION_SINGLE_PASS",1} } },
       }
     },
     { // NVIDIA GPUs
       kDeviceTypeGPU, "NVIDIA", {
-        { "default",                                         { {"XGEMM_MIN_INDIRECT_SIZE",1280*1280*1280} } },
+        { "default",                                         { {"XGEMM_MIN_INDIRECT_SIZE",1280*1280*1280}, {"XGEMM_STREAMK_MAX_EFFICIENCY",80}, {"XGEMM_STREAMK_OCCUPANCY",2}, {"XGEMM_SKINNY_MAX_N",32}, {"XGEMM_SKINNY_MIN_M",512}, {"XGEMM_SKINNY_MAX_K",4096}, {"REDUCTION_SINGLE_PASS",1} } },
       }
     },
     { // Default
       kDeviceTypeAll, "default", {
-        { "default",                                         { {"XGEMM_MIN_INDIRECT_SIZE",512*512*512} } },
+        { "default",                                         { {"XGEMM_MIN_INDIRECT_SIZE",512*512*512}, {"XGEMM_STREAMK_MAX_EFFICIENCY",80}, {"XGEMM_STREAMK_OCCUPANCY",2}, {"XGEMM_SKINNY_MAX_N",32}, {"XGEMM_SKINNY_MIN_M",512}, {"XGEMM_SKINNY_MAX_K",4096}, {"REDUCTION_SINGLE_PASS",1} } },
       }
     },
   }
@@ -44,17 +60,17 @@ const Database::DatabaseEntry KernelSelectionSingle = {
   "KernelSelection", Precision::kSingle, {
     { // Intel GPUs
       kDeviceTypeGPU, "Intel", {
-        { "default",                                         { {"XGEMM_MIN_INDIRECT_SIZE",1*1*1} } },
+        { "default",                                         { {"XGEMM_MIN_INDIRECT_SIZE",1*1*1}, {"XGEMM_STREAMK_MAX_EFFICIENCY",80}, {"XGEMM_STREAMK_OCCUPANCY",2}, {"XGEMM_SKINNY_MAX_N",32}, {"XGEMM_SKINNY_MIN_M",512}, {"XGEMM_SKINNY_MAX_K",4096}, {"REDUCTION_SINGLE_PASS",1} } },
       }
     },
     { // NVIDIA GPUs
       kDeviceTypeGPU, "NVIDIA", {
-        { "default",                                         { {"XGEMM_MIN_INDIRECT_SIZE",1280*1280*1280} } },
+        { "default",                                         { {"XGEMM_MIN_INDIRECT_SIZE",1280*1280*1280}, {"XGEMM_STREAMK_MAX_EFFICIENCY",80}, {"XGEMM_STREAMK_OCCUPANCY",2}, {"XGEMM_SKINNY_MAX_N",32}, {"XGEMM_SKINNY_MIN_M",512}, {"XGEMM_SKINNY_MAX_K",4096}, {"REDUCTION_SINGLE_PASS",1} } },
       }
     },
     { // Default
       kDeviceTypeAll, "default", {
-        { "default",                                         { {"XGEMM_MIN_INDIRECT_SIZE",512*512*512} } },
+        { "default",                                         { {"XGEMM_MIN_INDIRECT_SIZE",512*512*512}, {"XGEMM_STREAMK_MAX_EFFICIENCY",80}, {"XGEMM_STREAMK_OCCUPANCY",2}, {"XGEMM_SKINNY_MAX_N",32}, {"XGEMM_SKINNY_MIN_M",512}, {"XGEMM_SKINNY_MAX_K",4096}, {"REDUCTION_SINGLE_PASS",1} } },
       }
     },
   }
@@ -66,17 +82,17 @@ const Database::DatabaseEntry KernelSelectionComplexSingle = {
   "KernelSelection", Precision::kComplexSingle, {
     { // Intel GPUs
       kDeviceTypeGPU, "Intel", {
-        { "default",                                         { {"XGEMM_MIN_INDIRECT_SIZE",1*1*1} } },
+        { "default",                                         { {"XGEMM_MIN_INDIRECT_SIZE",1*1*1}, {"XGEMM_STREAMK_MAX_EFFICIENCY",80}, {"XGEMM_STREAMK_OCCUPANCY",2}, {"XGEMM_SKINNY_MAX_N",32}, {"XGEMM_SKINNY_MIN_M",512}, {"XGEMM_SKINNY_MAX_K",4096}, {"REDUCTION_SINGLE_PASS",1} } },
       }
     },
     { // NVIDIA GPUs
       kDeviceTypeGPU, "NVIDIA", {
-        { "default",                                         { {"XGEMM_MIN_INDIRECT_SIZE",1280*1280*1280} } },
+        { "default",                                         { {"XGEMM_MIN_INDIRECT_SIZE",1280*1280*1280}, {"XGEMM_STREAMK_MAX_EFFICIENCY",80}, {"XGEMM_STREAMK_OCCUPANCY",2}, {"XGEMM_SKINNY_MAX_N",32}, {"XGEMM_SKINNY_MIN_M",512}, {"XGEMM_SKINNY_MAX_K",4096}, {"REDUCTION_SINGLE_PASS",1} } },
       }
     },
     { // Default
       kDeviceTypeAll, "default", {
-        { "default",                                         { {"XGEMM_MIN_INDIRECT_SIZE",512*512*512} } },
+        { "default",                                         { {"XGEMM_MIN_INDIRECT_SIZE",512*512*512}, {"XGEMM_STREAMK_MAX_EFFICIENCY",80}, {"XGEMM_STREAMK_OCCUPANCY",2}, {"XGEMM_SKINNY_MAX_N",32}, {"XGEMM_SKINNY_MIN_M",512}, {"XGEMM_SKINNY_MAX_K",4096}, {"REDUCTION_SINGLE_PASS",1} } },
       }
     },
   }
@@ -88,17 +104,17 @@ const Database::DatabaseEntry KernelSelectionDouble = {
   "KernelSelection", Precision::kDouble, {
     { // Intel GPUs
       kDeviceTypeGPU, "Intel", {
-        { "default",                                         { {"XGEMM_MIN_INDIRECT_SIZE",1*1*1} } },
+        { "default",                                         { {"XGEMM_MIN_INDIRECT_SIZE",1*1*1}, {"XGEMM_STREAMK_MAX_EFFICIENCY",80}, {"XGEMM_STREAMK_OCCUPANCY",2}, {"XGEMM_SKINNY_MAX_N",32}, {"XGEMM_SKINNY_MIN_M",512}, {"XGEMM_SKINNY_MAX_K",4096}, {"REDUCTION_SINGLE_PASS",1} } },
       }
     },
     { // NVIDIA GPUs
       kDeviceTypeGPU, "NVIDIA", {
-        { "default",                                         { {"XGEMM_MIN_INDIRECT_SIZE",1280*1280*1280} } },
+        { "default",                                         { {"XGEMM_MIN_INDIRECT_SIZE",1280*1280*1280}, {"XGEMM_STREAMK_MAX_EFFICIENCY",80}, {"XGEMM_STREAMK_OCCUPANCY",2}, {"XGEMM_SKINNY_MAX_N",32}, {"XGEMM_SKINNY_MIN_M",512}, {"XGEMM_SKINNY_MAX_K",4096}, {"REDUCTION_SINGLE_PASS",1} } },
       }
     },
     { // Default
       kDeviceTypeAll, "default", {
-        { "default",                                         { {"XGEMM_MIN_INDIRECT_SIZE",512*512*512} } },
+        { "default",                                         { {"XGEMM_MIN_INDIRECT_SIZE",512*512*512}, {"XGEMM_STREAMK_MAX_EFFICIENCY",80}, {"XGEMM_STREAMK_OCCUPANCY",2}, {"XGEMM_SKINNY_MAX_N",32}, {"XGEMM_SKINNY_MIN_M",512}, {"XGEMM_SKINNY_MAX_K",4096}, {"REDUCTION_SINGLE_PASS",1} } },
       }
     },
   }
@@ -110,17 +126,17 @@ const Database::DatabaseEntry KernelSelectionComplexDouble = {
   "KernelSelection", Precision::kComplexDouble, {
     { // Intel GPUs
       kDeviceTypeGPU, "Intel", {
-        { "default",                                         { {"XGEMM_MIN_INDIRECT_SIZE",1*1*1} } },
+        { "default",                                         { {"XGEMM_MIN_INDIRECT_SIZE",1*1*1}, {"XGEMM_STREAMK_MAX_EFFICIENCY",80}, {"XGEMM_STREAMK_OCCUPANCY",2}, {"XGEMM_SKINNY_MAX_N",32}, {"XGEMM_SKINNY_MIN_M",512}, {"XGEMM_SKINNY_MAX_K",4096}, {"REDUCTION_SINGLE_PASS",1} } },
       }
     },
     { // NVIDIA GPUs
       kDeviceTypeGPU, "NVIDIA", {
-        { "default",                                         { {"XGEMM_MIN_INDIRECT_SIZE",1280*1280*1280} } },
+        { "default",                                         { {"XGEMM_MIN_INDIRECT_SIZE",1280*1280*1280}, {"XGEMM_STREAMK_MAX_EFFICIENCY",80}, {"XGEMM_STREAMK_OCCUPANCY",2}, {"XGEMM_SKINNY_MAX_N",32}, {"XGEMM_SKINNY_MIN_M",512}, {"XGEMM_SKINNY_MAX_K",4096}, {"REDUCTION_SINGLE_PASS",1} } },
       }
     },
     { // Default
       kDeviceTypeAll, "default", {
-        { "default",                                         { {"XGEMM_MIN_INDIRECT_SIZE",512*512*512} } },
+        { "default",                                         { {"XGEMM_MIN_INDIRECT_SIZE",512*512*512}, {"XGEMM_STREAMK_MAX_EFFICIENCY",80}, {"XGEMM_STREAMK_OCCUPANCY",2}, {"XGEMM_SKINNY_MAX_N",32}, {"XGEMM_SKINNY_MIN_M",512}, {"XGEMM_SKINNY_MAX_K",4096}, {"REDUCTION_SINGLE_PASS",1} } },
       }
     },
   }
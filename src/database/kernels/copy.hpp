@@ -15,24 +15,92 @@ namespace clblast {
 namespace database {
 // =================================================================================================
 
+// The unique parameter sets of these kernels, referred to by index below
+const auto CopyParameters = Database::ParameterSets({"COPY_DIMX", "COPY_DIMY", "COPY_VW", "COPY_WPT"}, {
+  {16, 8, 4, 4}, // 0
+  {8, 16, 8, 4}, // 1
+  {8, 32, 4, 8}, // 2
+  {32, 8, 4, 1}, // 3
+  {16, 8, 2, 1}, // 4
+  {8, 8, 4, 8}, // 5
+  {16, 16, 1, 2}, // 6
+  {32, 8, 2, 2}, // 7
+  {32, 8, 4, 2}, // 8
+  {8, 16, 4, 1}, // 9
+  {32, 8, 4, 4}, // 10
+  {8, 8, 4, 2}, // 11
+  {32, 8, 2, 4}, // 12
+  {32, 16, 8, 1}, // 13
+  {32, 16, 8, 2}, // 14
+  {32, 8, 8, 1}, // 15
+  {8, 8, 2, 1}, // 16
+  {32, 16, 4, 1}, // 17
+  {16, 8, 4, 8}, // 18
+  {16, 8, 1, 2}, // 19
+  {16, 8, 4, 1}, // 20
+  {16, 16, 4, 2}, // 21
+  {8, 32, 4, 1}, // 22
+  {8, 8, 4, 1}, // 23
+  {16, 32, 4, 1}, // 24
+  {16, 32, 2, 2}, // 25
+  {32, 16, 1, 1}, // 26
+  {32, 8, 1, 2}, // 27
+  {8, 8, 4, 4}, // 28
+  {32, 8, 1, 1}, // 29
+  {8, 8, 1, 1}, // 30
+  {16, 16, 1, 4}, // 31
+  {8, 16, 1, 1}, // 32
+  {8, 8, 1, 2}, // 33
+  {8, 8, 2, 2}, // 34
+  {8, 32, 1, 2}, // 35
+  {16, 8, 1, 1}, // 36
+  {32, 16, 4, 2}, // 37
+  {16, 16, 8, 1}, // 38
+  {32, 32, 4, 1}, // 39
+  {16, 8, 8, 1}, // 40
+  {16, 16, 2, 2}, // 41
+  {8, 32, 2, 4}, // 42
+  {32, 16, 1, 4}, // 43
+  {16, 16, 1, 1}, // 44
+  {16, 32, 1, 1}, // 45
+  {8, 16, 2, 1}, // 46
+  {8, 8, 1, 4}, // 47
+  {32, 8, 1, 4}, // 48
+  {32, 8, 2, 8}, // 49
+  {8, 32, 2, 1}, // 50
+  {16, 8, 8, 2}, // 51
+  {16, 32, 8, 1}, // 52
+  {16, 32, 2, 1}, // 53
+  {8, 8, 8, 1}, // 54
+  {32, 16, 2, 1}, // 55
+  {32, 8, 2, 1}, // 56
+  {16, 8, 2, 8}, // 57
+  {32, 32, 2, 1}, // 58
+  {32, 32, 8, 1}, // 59
+  {32, 16, 8, 4}, // 60
+  {8, 32, 1, 4}, // 61
+});
+
+// =================================================================================================
+
 const Database::DatabaseEntry CopyHalf = {
   "Copy", Precision::kHalf, {
     { // AMD GPUs
       kDeviceTypeGPU, "AMD", {
-        { "Ellesmere",                                       { {"COPY_DIMX",16}, {"COPY_DIMY",8}, {"COPY_VW",4}, {"COPY_WPT",4} } },
-        { "default",                                         { {"COPY_DIMX",16}, {"COPY_DIMY",8}, {"COPY_VW",4}, {"COPY_WPT",4} } },
+        { "Ellesmere",                                       CopyParameters[0] },
+        { "default",                                         CopyParameters[0] },
       }
     },
     { // Intel GPUs
       kDeviceTypeGPU, "Intel", {
-        { "Intel(R) HD Graphics 5500 BroadWell U-Processor GT2", { {"COPY_DIMX",8}, {"COPY_DIMY",16}, {"COPY_VW",8}, {"COPY_WPT",4} } },
-        { "Intel(R) HD Graphics Skylake ULT GT2",            { {"COPY_DIMX",8}, {"COPY_DIMY",32}, {"COPY_VW",4}, {"COPY_WPT",8} } },
-        { "default",                                         { {"COPY_DIMX",8}, {"COPY_DIMY",32}, {"COPY_VW",4}, {"COPY_WPT",8} } },
+        { "Intel(R) HD Graphics 5500 BroadWell U-Processor GT2", CopyParameters[1] },
+        { "Intel(R) HD Graphics Skylake ULT GT2",            CopyParameters[2] },
+        { "default",                                         CopyParameters[2] },
       }
     },
     { // Default
       kDeviceTypeAll, "default", {
-        { "default",                                         { {"COPY_DIMX",16}, {"COPY_DIMY",8}, {"COPY_VW",4}, {"COPY_WPT",4} } },
+        { "default",                                         CopyParameters[0] },
       }
     },
   }
@@ -44,77 +112,77 @@ const Database::DatabaseEntry CopySingle = {
   "Copy", Precision::kSingle, {
     { // AMD GPUs
       kDeviceTypeGPU, "AMD", {
-        { "AMD Radeon R9 M370X Compute Engine",              { {"COPY_DIMX",32}, {"COPY_DIMY",8}, {"COPY_VW",4}, {"COPY_WPT",1} } },
-        { "ATI Radeon HD 6750M",                             { {"COPY_DIMX",16}, {"COPY_DIMY",8}, {"COPY_VW",2}, {"COPY_WPT",1} } },
-        { "Ellesmere",                                       { {"COPY_DIMX",8}, {"COPY_DIMY",8}, {"COPY_VW",4}, {"COPY_WPT",8} } },
-        { "Fiji",                                            { {"COPY_DIMX",16}, {"COPY_DIMY",16}, {"COPY_VW",1}, {"COPY_WPT",2} } },
-        { "Hawaii",                                          { {"COPY_DIMX",32}, {"COPY_DIMY",8}, {"COPY_VW",2}, {"COPY_WPT",2} } },
-        { "Oland",                                           { {"COPY_DIMX",32}, {"COPY_DIMY",8}, {"COPY_VW",4}, {"COPY_WPT",2} } },
-        { "Pitcairn",                                        { {"COPY_DIMX",8}, {"COPY_DIMY",16}, {"COPY_VW",4}, {"COPY_WPT",1} } },
-        { "Tahiti",                                          { {"COPY_DIMX",32}, {"COPY_DIMY",8}, {"COPY_VW",2}, {"COPY_WPT",2} } },
-        { "Tonga",                                           { {"COPY_DIMX",32}, {"COPY_DIMY",8}, {"COPY_VW",4}, {"COPY_WPT",4} } },
-        { "Turks",                                           { {"COPY_DIMX",8}, {"COPY_DIMY",8}, {"COPY_VW",4}, {"COPY_WPT",2} } },
-        { "default",                                         { {"COPY_DIMX",8}, {"COPY_DIMY",16}, {"COPY_VW",4}, {"COPY_WPT",1} } },
+        { "AMD Radeon R9 M370X Compute Engine",              CopyParameters[3] },
+        { "ATI Radeon HD 6750M",                             CopyParameters[4] },
+        { "Ellesmere",                                       CopyParameters[5] },
+        { "Fiji",                                            CopyParameters[6] },
+        { "Hawaii",                                          CopyParameters[7] },
+        { "Oland",                                           CopyParameters[8] },
+        { "Pitcairn",                                        CopyParameters[9] },
+        { "Tahiti",                                          CopyParameters[7] },
+        { "Tonga",                                           CopyParameters[10] },
+        { "Turks",                                           CopyParameters[11] },
+        { "default",                                         CopyParameters[9] },
       }
     },
     { // ARM GPUs
       kDeviceTypeGPU, "ARM", {
-        { "Mali-T628",                                       { {"COPY_DIMX",32}, {"COPY_DIMY",8}, {"COPY_VW",2}, {"COPY_WPT",4} } },
-        { "default",                                         { {"COPY_DIMX",32}, {"COPY_DIMY",8}, {"COPY_VW",2}, {"COPY_WPT",4} } },
+        { "Mali-T628",                                       CopyParameters[12] },
+        { "default",                                         CopyParameters[12] },
       }
     },
     { // Intel CPUs
       kDeviceTypeCPU, "Intel", {
-        { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       { {"COPY_DIMX",32}, {"COPY_DIMY",16}, {"COPY_VW",8}, {"COPY_WPT",1} } },
-        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {"COPY_DIMX",32}, {"COPY_DIMY",16}, {"COPY_VW",8}, {"COPY_WPT",2} } },
-        { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         { {"COPY_DIMX",32}, {"COPY_DIMY",16}, {"COPY_VW",8}, {"COPY_WPT",1} } },
-        { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        { {"COPY_DIMX",32}, {"COPY_DIMY",16}, {"COPY_VW",8}, {"COPY_WPT",2} } },
-        { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        { {"COPY_DIMX",32}, {"COPY_DIMY",8}, {"COPY_VW",8}, {"COPY_WPT",1} } },
-        { "default",                                         { {"COPY_DIMX",32}, {"COPY_DIMY",16}, {"COPY_VW",8}, {"COPY_WPT",2} } },
+        { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       CopyParameters[13] },
+        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        CopyParameters[14] },
+        { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         CopyParameters[13] },
+        { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        CopyParameters[14] },
+        { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        CopyParameters[15] },
+        { "default",                                         CopyParameters[14] },
       }
     },
     { // Intel GPUs
       kDeviceTypeGPU, "Intel", {
-        { "Intel(R) HD Graphics 530",                        { {"COPY_DIMX",8}, {"COPY_DIMY",8}, {"COPY_VW",2}, {"COPY_WPT",1} } },
-        { "Intel(R) HD Graphics 5500 BroadWell U-Processor GT2", { {"COPY_DIMX",32}, {"COPY_DIMY",16}, {"COPY_VW",4}, {"COPY_WPT",1} } },
-        { "Intel(R) HD Graphics Haswell Ultrabook GT2 Mobile", { {"COPY_DIMX",32}, {"COPY_DIMY",16}, {"COPY_VW",4}, {"COPY_WPT",1} } },
-        { "Intel(R) HD Graphics IvyBridge M GT2",            { {"COPY_DIMX",16}, {"COPY_DIMY",8}, {"COPY_VW",2}, {"COPY_WPT",1} } },
-        { "Intel(R) HD Graphics Skylake ULT GT2",            { {"COPY_DIMX",16}, {"COPY_DIMY",8}, {"COPY_VW",4}, {"COPY_WPT",8} } },
-        { "Iris",                                            { {"COPY_DIMX",16}, {"COPY_DIMY",8}, {"COPY_VW",1}, {"COPY_WPT",2} } },
-        { "Iris Pro",                                        { {"COPY_DIMX",32}, {"COPY_DIMY",8}, {"COPY_VW",4}, {"COPY_WPT",4} } },
-        { "default",                                         { {"COPY_DIMX",8}, {"COPY_DIMY",8}, {"COPY_VW",2}, {"COPY_WPT",1} } },
+        { "Intel(R) HD Graphics 530",                        CopyParameters[16] },
+        { "Intel(R) HD Graphics 5500 BroadWell U-Processor GT2", CopyParameters[17] },
+        { "Intel(R) HD Graphics Haswell Ultrabook GT2 Mobile", CopyParameters[17] },
+        { "Intel(R) HD Graphics IvyBridge M GT2",            CopyParameters[4] },
+        { "Intel(R) HD Graphics Skylake ULT GT2",            CopyParameters[18] },
+        { "Iris",                                            CopyParameters[19] },
+        { "Iris Pro",                                        CopyParameters[10] },
+        { "default",                                         CopyParameters[16] },
       }
     },
     { // Intel accelerators
       kDeviceTypeAccelerator, "Intel", {
-        { "Intel(R) Many Integrated Core Acceleration Card", { {"COPY_DIMX",32}, {"COPY_DIMY",8}, {"COPY_VW",8}, {"COPY_WPT",1} } },
-        { "default",                                         { {"COPY_DIMX",32}, {"COPY_DIMY",8}, {"COPY_VW",8}, {"COPY_WPT",1} } },
+        { "Intel(R) Many Integrated Core Acceleration Card", CopyParameters[15] },
+        { "default",                                         CopyParameters[15] },
       }
     },
     { // NVIDIA GPUs
       kDeviceTypeGPU, "NVIDIA", {
-        { "GRID K520",                                       { {"COPY_DIMX",16}, {"COPY_DIMY",8}, {"COPY_VW",4}, {"COPY_WPT",1} } },
-        { "GeForce GT 650M",                                 { {"COPY_DIMX",16}, {"COPY_DIMY",16}, {"COPY_VW",4}, {"COPY_WPT",2} } },
-        { "GeForce GTX 1070",                                { {"COPY_DIMX",8}, {"COPY_DIMY",16}, {"COPY_VW",4}, {"COPY_WPT",1} } },
-        { "GeForce GTX 1080",                                { {"COPY_DIMX",8}, {"COPY_DIMY",32}, {"COPY_VW",4}, {"COPY_WPT",1} } },
-        { "GeForce GTX 480",                                 { {"COPY_DIMX",8}, {"COPY_DIMY",8}, {"COPY_VW",4}, {"COPY_WPT",1} } },
-        { "GeForce GTX 670",                                 { {"COPY_DIMX",16}, {"COPY_DIMY",32}, {"COPY_VW",4}, {"COPY_WPT",1} } },
-        { "GeForce GTX 680",                                 { {"COPY_DIMX",32}, {"COPY_DIMY",16}, {"COPY_VW",4}, {"COPY_WPT",1} } },
-        { "GeForce GTX 750",                                 { {"COPY_DIMX",32}, {"COPY_DIMY",8}, {"COPY_VW",2}, {"COPY_WPT",2} } },
-        { "GeForce GTX 750 Ti",                              { {"COPY_DIMX",16}, {"COPY_DIMY",32}, {"COPY_VW",2}, {"COPY_WPT",2} } },
-        { "GeForce GTX 980",                                 { {"COPY_DIMX",32}, {"COPY_DIMY",16}, {"COPY_VW",1}, {"COPY_WPT",1} } },
-        { "GeForce GTX TITAN",                               { {"COPY_DIMX",32}, {"COPY_DIMY",8}, {"COPY_VW",2}, {"COPY_WPT",4} } },
-        { "GeForce GTX TITAN Black",                         { {"COPY_DIMX",8}, {"COPY_DIMY",32}, {"COPY_VW",4}, {"COPY_WPT",8} } },
-        { "GeForce GTX TITAN X",                             { {"COPY_DIMX",32}, {"COPY_DIMY",8}, {"COPY_VW",1}, {"COPY_WPT",2} } },
-        { "TITAN X (Pascal)",                                { {"COPY_DIMX",8}, {"COPY_DIMY",32}, {"COPY_VW",4}, {"COPY_WPT",1} } },
-        { "Tesla K20m",                                      { {"COPY_DIMX",8}, {"COPY_DIMY",8}, {"COPY_VW",4}, {"COPY_WPT",4} } },
-        { "Tesla K40m",                                      { {"COPY_DIMX",8}, {"COPY_DIMY",8}, {"COPY_VW",4}, {"COPY_WPT",2} } },
-        { "default",                                         { {"COPY_DIMX",8}, {"COPY_DIMY",32}, {"COPY_VW",4}, {"COPY_WPT",1} } },
+        { "GRID K520",                                       CopyParameters[20] },
+        { "GeForce GT 650M",                                 CopyParameters[21] },
+        { "GeForce GTX 1070",                                CopyParameters[9] },
+        { "GeForce GTX 1080",                                CopyParameters[22] },
+        { "GeForce GTX 480",                                 CopyParameters[23] },
+        { "GeForce GTX 670",                                 CopyParameters[24] },
+        { "GeForce GTX 680",                                 CopyParameters[17] },
+        { "GeForce GTX 750",                                 CopyParameters[7] },
+        { "GeForce GTX 750 Ti",                              CopyParameters[25] },
+        { "GeForce GTX 980",                                 CopyParameters[26] },
+        { "GeForce GTX TITAN",                               CopyParameters[12] },
+        { "GeForce GTX TITAN Black",                         CopyParameters[2] },
+        { "GeForce GTX TITAN X",                             CopyParameters[27] },
+        { "TITAN X (Pascal)",                                CopyParameters[22] },
+        { "Tesla K20m",                                      CopyParameters[28] },
+        { "Tesla K40m",                                      CopyParameters[11] },
+        { "default",                                         CopyParameters[22] },
       }
     },
     { // Default
       kDeviceTypeAll, "default", {
-        { "default",                                         { {"COPY_DIMX",32}, {"COPY_DIMY",8}, {"COPY_VW",4}, {"COPY_WPT",4} } },
+        { "default",                                         CopyParameters[10] },
       }
     },
   }
@@ -126,68 +194,68 @@ const Database::DatabaseEntry CopyComplexSingle = {
   "Copy", Precision::kComplexSingle, {
     { // AMD GPUs
       kDeviceTypeGPU, "AMD", {
-        { "AMD Radeon R9 M370X Compute Engine",              { {"COPY_DIMX",32}, {"COPY_DIMY",8}, {"COPY_VW",1}, {"COPY_WPT",1} } },
-        { "ATI Radeon HD 6750M",                             { {"COPY_DIMX",8}, {"COPY_DIMY",8}, {"COPY_VW",1}, {"COPY_WPT",1} } },
-        { "Ellesmere",                                       { {"COPY_DIMX",16}, {"COPY_DIMY",16}, {"COPY_VW",1}, {"COPY_WPT",4} } },
-        { "Fiji",                                            { {"COPY_DIMX",16}, {"COPY_DIMY",8}, {"COPY_VW",1}, {"COPY_WPT",2} } },
-        { "Hawaii",                                          { {"COPY_DIMX",32}, {"COPY_DIMY",8}, {"COPY_VW",1}, {"COPY_WPT",2} } },
-        { "Oland",                                           { {"COPY_DIMX",8}, {"COPY_DIMY",16}, {"COPY_VW",1}, {"COPY_WPT",1} } },
-        { "Pitcairn",                                        { {"COPY_DIMX",8}, {"COPY_DIMY",8}, {"COPY_VW",1}, {"COPY_WPT",2} } },
-        { "Tahiti",                                          { {"COPY_DIMX",8}, {"COPY_DIMY",8}, {"COPY_VW",2}, {"COPY_WPT",2} } },
-        { "Tonga",                                           { {"COPY_DIMX",8}, {"COPY_DIMY",32}, {"COPY_VW",1}, {"COPY_WPT",2} } },
-        { "Turks",                                           { {"COPY_DIMX",32}, {"COPY_DIMY",8}, {"COPY_VW",4}, {"COPY_WPT",1} } },
-        { "default",                                         { {"COPY_DIMX",16}, {"COPY_DIMY",8}, {"COPY_VW",1}, {"COPY_WPT",1} } },
+        { "AMD Radeon R9 M370X Compute Engine",              CopyParameters[29] },
+        { "ATI Radeon HD 6750M",                             CopyParameters[30] },
+        { "Ellesmere",                                       CopyParameters[31] },
+        { "Fiji",                                            CopyParameters[19] },
+        { "Hawaii",                                          CopyParameters[27] },
+        { "Oland",                                           CopyParameters[32] },
+        { "Pitcairn",                                        CopyParameters[33] },
+        { "Tahiti",                                          CopyParameters[34] },
+        { "Tonga",                                           CopyParameters[35] },
+        { "Turks",                                           CopyParameters[3] },
+        { "default",                                         CopyParameters[36] },
       }
     },
     { // Intel CPUs
       kDeviceTypeCPU, "Intel", {
-        { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       { {"COPY_DIMX",32}, {"COPY_DIMY",16}, {"COPY_VW",4}, {"COPY_WPT",2} } },
-        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {"COPY_DIMX",16}, {"COPY_DIMY",16}, {"COPY_VW",8}, {"COPY_WPT",1} } },
-        { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         { {"COPY_DIMX",32}, {"COPY_DIMY",8}, {"COPY_VW",2}, {"COPY_WPT",2} } },
-        { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        { {"COPY_DIMX",32}, {"COPY_DIMY",32}, {"COPY_VW",4}, {"COPY_WPT",1} } },
-        { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        { {"COPY_DIMX",16}, {"COPY_DIMY",8}, {"COPY_VW",8}, {"COPY_WPT",1} } },
-        { "default",                                         { {"COPY_DIMX",32}, {"COPY_DIMY",8}, {"COPY_VW",8}, {"COPY_WPT",1} } },
+        { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       CopyParameters[37] },
+        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        CopyParameters[38] },
+        { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         CopyParameters[7] },
+        { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        CopyParameters[39] },
+        { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        CopyParameters[40] },
+        { "default",                                         CopyParameters[15] },
       }
     },
     { // Intel GPUs
       kDeviceTypeGPU, "Intel", {
-        { "Intel(R) HD Graphics 530",                        { {"COPY_DIMX",16}, {"COPY_DIMY",8}, {"COPY_VW",2}, {"COPY_WPT",1} } },
-        { "Intel(R) HD Graphics 5500 BroadWell U-Processor GT2", { {"COPY_DIMX",16}, {"COPY_DIMY",16}, {"COPY_VW",2}, {"COPY_WPT",2} } },
-        { "Intel(R) HD Graphics Haswell Ultrabook GT2 Mobile", { {"COPY_DIMX",8}, {"COPY_DIMY",8}, {"COPY_VW",1}, {"COPY_WPT",1} } },
-        { "Intel(R) HD Graphics IvyBridge M GT2",            { {"COPY_DIMX",8}, {"COPY_DIMY",32}, {"COPY_VW",2}, {"COPY_WPT",4} } },
-        { "Intel(R) HD Graphics Skylake ULT GT2",            { {"COPY_DIMX",8}, {"COPY_DIMY",8}, {"COPY_VW",2}, {"COPY_WPT",1} } },
-        { "Iris",                                            { {"COPY_DIMX",16}, {"COPY_DIMY",8}, {"COPY_VW",1}, {"COPY_WPT",2} } },
-        { "Iris Pro",                                        { {"COPY_DIMX",32}, {"COPY_DIMY",16}, {"COPY_VW",1}, {"COPY_WPT",4} } },
-        { "default",                                         { {"COPY_DIMX",16}, {"COPY_DIMY",8}, {"COPY_VW",1}, {"COPY_WPT",2} } },
+        { "Intel(R) HD Graphics 530",                        CopyParameters[4] },
+        { "Intel(R) HD Graphics 5500 BroadWell U-Processor GT2", CopyParameters[41] },
+        { "Intel(R) HD Graphics Haswell Ultrabook GT2 Mobile", CopyParameters[30] },
+        { "Intel(R) HD Graphics IvyBridge M GT2",            CopyParameters[42] },
+        { "Intel(R) HD Graphics Skylake ULT GT2",            CopyParameters[16] },
+        { "Iris",                                            CopyParameters[19] },
+        { "Iris Pro",                                        CopyParameters[43] },
+        { "default",                                         CopyParameters[19] },
       }
     },
     { // Intel accelerators
       kDeviceTypeAccelerator, "Intel", {
-        { "Intel(R) Many Integrated Core Acceleration Card", { {"COPY_DIMX",32}, {"COPY_DIMY",8}, {"COPY_VW",4}, {"COPY_WPT",1} } },
-        { "default",                                         { {"COPY_DIMX",32}, {"COPY_DIMY",8}, {"COPY_VW",4}, {"COPY_WPT",1} } },
+        { "Intel(R) Many Integrated Core Acceleration Card", CopyParameters[3] },
+        { "default",                                         CopyParameters[3] },
       }
     },
     { // NVIDIA GPUs
       kDeviceTypeGPU, "NVIDIA", {
-        { "GRID K520",                                       { {"COPY_DIMX",16}, {"COPY_DIMY",8}, {"COPY_VW",1}, {"COPY_WPT",1} } },
-        { "GeForce GTX 1070",                                { {"COPY_DIMX",16}, {"COPY_DIMY",8}, {"COPY_VW",1}, {"COPY_WPT",1} } },
-        { "GeForce GTX 1080",                                { {"COPY_DIMX",32}, {"COPY_DIMY",8}, {"COPY_VW",1}, {"COPY_WPT",2} } },
-        { "GeForce GTX 480",                                 { {"COPY_DIMX",16}, {"COPY_DIMY",16}, {"COPY_VW",1}, {"COPY_WPT",1} } },
-        { "GeForce GTX 670",                                 { {"COPY_DIMX",16}, {"COPY_DIMY",8}, {"COPY_VW",1}, {"COPY_WPT",1} } },
-        { "GeForce GTX 750",                                 { {"COPY_DIMX",16}, {"COPY_DIMY",8}, {"COPY_VW",1}, {"COPY_WPT",2} } },
-        { "GeForce GTX 750 Ti",                              { {"COPY_DIMX",16}, {"COPY_DIMY",32}, {"COPY_VW",1}, {"COPY_WPT",1} } },
-        { "GeForce GTX 980",                                 { {"COPY_DIMX",8}, {"COPY_DIMY",8}, {"COPY_VW",1}, {"COPY_WPT",1} } },
-        { "GeForce GTX TITAN Black",                         { {"COPY_DIMX",16}, {"COPY_DIMY",8}, {"COPY_VW",1}, {"COPY_WPT",1} } },
-        { "GeForce GTX TITAN X",                             { {"COPY_DIMX",16}, {"COPY_DIMY",8}, {"COPY_VW",1}, {"COPY_WPT",1} } },
-        { "TITAN X (Pascal)",                                { {"COPY_DIMX",8}, {"COPY_DIMY",16}, {"COPY_VW",2}, {"COPY_WPT",1} } },
-        { "Tesla K20m",                                      { {"COPY_DIMX",8}, {"COPY_DIMY",8}, {"COPY_VW",1}, {"COPY_WPT",4} } },
-        { "Tesla K40m",                                      { {"COPY_DIMX",16}, {"COPY_DIMY",8}, {"COPY_VW",1}, {"COPY_WPT",1} } },
-        { "default",                                         { {"COPY_DIMX",32}, {"COPY_DIMY",8}, {"COPY_VW",1}, {"COPY_WPT",1} } },
+        { "GRID K520",                                       CopyParameters[36] },
+        { "GeForce GTX 1070",                                CopyParameters[36] },
+        { "GeForce GTX 1080",                                CopyParameters[27] },
+        { "GeForce GTX 480",                                 CopyParameters[44] },
+        { "GeForce GTX 670",                                 CopyParameters[36] },
+        { "GeForce GTX 750",                                 CopyParameters[19] },
+        { "GeForce GTX 750 Ti",                              CopyParameters[45] },
+        { "GeForce GTX 980",                                 CopyParameters[30] },
+        { "GeForce GTX TITAN Black",                         CopyParameters[36] },
+        { "GeForce GTX TITAN X",                             CopyParameters[36] },
+        { "TITAN X (Pascal)",                                CopyParameters[46] },
+        { "Tesla K20m",                                      CopyParameters[47] },
+        { "Tesla K40m",                                      CopyParameters[36] },
+        { "default",                                         CopyParameters[29] },
       }
     },
     { // Default
       kDeviceTypeAll, "default", {
-        { "default",                                         { {"COPY_DIMX",16}, {"COPY_DIMY",8}, {"COPY_VW",1}, {"COPY_WPT",2} } },
+        { "default",                                         CopyParameters[19] },
       }
     },
   }
@@ -199,62 +267,62 @@ const Database::DatabaseEntry CopyDouble = {
   "Copy", Precision::kDouble, {
     { // AMD GPUs
       kDeviceTypeGPU, "AMD", {
-        { "AMD Radeon R9 M370X Compute Engine",              { {"COPY_DIMX",32}, {"COPY_DIMY",8}, {"COPY_VW",1}, {"COPY_WPT",1} } },
-        { "Ellesmere",                                       { {"COPY_DIMX",32}, {"COPY_DIMY",8}, {"COPY_VW",1}, {"COPY_WPT",4} } },
-        { "Fiji",                                            { {"COPY_DIMX",16}, {"COPY_DIMY",8}, {"COPY_VW",1}, {"COPY_WPT",2} } },
-        { "Hawaii",                                          { {"COPY_DIMX",32}, {"COPY_DIMY",8}, {"COPY_VW",1}, {"COPY_WPT",2} } },
-        { "Oland",                                           { {"COPY_DIMX",32}, {"COPY_DIMY",8}, {"COPY_VW",2}, {"COPY_WPT",8} } },
-        { "Pitcairn",                                        { {"COPY_DIMX",32}, {"COPY_DIMY",8}, {"COPY_VW",1}, {"COPY_WPT",1} } },
-        { "Tahiti",                                          { {"COPY_DIMX",8}, {"COPY_DIMY",32}, {"COPY_VW",2}, {"COPY_WPT",1} } },
-        { "Tonga",                                           { {"COPY_DIMX",8}, {"COPY_DIMY",32}, {"COPY_VW",2}, {"COPY_WPT",4} } },
-        { "default",                                         { {"COPY_DIMX",16}, {"COPY_DIMY",8}, {"COPY_VW",2}, {"COPY_WPT",1} } },
+        { "AMD Radeon R9 M370X Compute Engine",              CopyParameters[29] },
+        { "Ellesmere",                                       CopyParameters[48] },
+        { "Fiji",                                            CopyParameters[19] },
+        { "Hawaii",                                          CopyParameters[27] },
+        { "Oland",                                           CopyParameters[49] },
+        { "Pitcairn",                                        CopyParameters[29] },
+        { "Tahiti",                                          CopyParameters[50] },
+        { "Tonga",                                           CopyParameters[42] },
+        { "default",                                         CopyParameters[4] },
       }
     },
     { // ARM GPUs
       kDeviceTypeGPU, "ARM", {
-        { "Mali-T628",                                       { {"COPY_DIMX",16}, {"COPY_DIMY",8}, {"COPY_VW",8}, {"COPY_WPT",2} } },
-        { "default",                                         { {"COPY_DIMX",16}, {"COPY_DIMY",8}, {"COPY_VW",8}, {"COPY_WPT",2} } },
+        { "Mali-T628",                                       CopyParameters[51] },
+        { "default",                                         CopyParameters[51] },
       }
     },
     { // Intel CPUs
       kDeviceTypeCPU, "Intel", {
-        { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       { {"COPY_DIMX",16}, {"COPY_DIMY",32}, {"COPY_VW",8}, {"COPY_WPT",1} } },
-        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {"COPY_DIMX",16}, {"COPY_DIMY",8}, {"COPY_VW",8}, {"COPY_WPT",1} } },
-        { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         { {"COPY_DIMX",16}, {"COPY_DIMY",32}, {"COPY_VW",2}, {"COPY_WPT",1} } },
-        { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        { {"COPY_DIMX",16}, {"COPY_DIMY",32}, {"COPY_VW",8}, {"COPY_WPT",1} } },
-        { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        { {"COPY_DIMX",16}, {"COPY_DIMY",16}, {"COPY_VW",8}, {"COPY_WPT",1} } },
-        { "default",                                         { {"COPY_DIMX",16}, {"COPY_DIMY",8}, {"COPY_VW",8}, {"COPY_WPT",1} } },
+        { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       CopyParameters[52] },
+        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        CopyParameters[40] },
+        { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         CopyParameters[53] },
+        { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        CopyParameters[52] },
+        { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        CopyParameters[38] },
+        { "default",                                         CopyParameters[40] },
       }
     },
     { // Intel accelerators
       kDeviceTypeAccelerator, "Intel", {
-        { "Intel(R) Many Integrated Core Acceleration Card", { {"COPY_DIMX",8}, {"COPY_DIMY",8}, {"COPY_VW",8}, {"COPY_WPT",1} } },
-        { "default",                                         { {"COPY_DIMX",8}, {"COPY_DIMY",8}, {"COPY_VW",8}, {"COPY_WPT",1} } },
+        { "Intel(R) Many Integrated Core Acceleration Card", CopyParameters[54] },
+        { "default",                                         CopyParameters[54] },
       }
     },
     { // NVIDIA GPUs
       kDeviceTypeGPU, "NVIDIA", {
-        { "GRID K520",                                       { {"COPY_DIMX",32}, {"COPY_DIMY",16}, {"COPY_VW",2}, {"COPY_WPT",1} } },
-        { "GeForce GTX 1070",                                { {"COPY_DIMX",8}, {"COPY_DIMY",8}, {"COPY_VW",4}, {"COPY_WPT",1} } },
-        { "GeForce GTX 1080",                                { {"COPY_DIMX",8}, {"COPY_DIMY",8}, {"COPY_VW",4}, {"COPY_WPT",1} } },
-        { "GeForce GTX 480",                                 { {"COPY_DIMX",8}, {"COPY_DIMY",8}, {"COPY_VW",2}, {"COPY_WPT",1} } },
-        { "GeForce GTX 670",                                 { {"COPY_DIMX",8}, {"COPY_DIMY",8}, {"COPY_VW",2}, {"COPY_WPT",1} } },
-        { "GeForce GTX 680",                                 { {"COPY_DIMX",16}, {"COPY_DIMY",32}, {"COPY_VW",2}, {"COPY_WPT",1} } },
-        { "GeForce GTX 750",                                 { {"COPY_DIMX",8}, {"COPY_DIMY",16}, {"COPY_VW",2}, {"COPY_WPT",1} } },
-        { "GeForce GTX 750 Ti",                              { {"COPY_DIMX",16}, {"COPY_DIMY",8}, {"COPY_VW",2}, {"COPY_WPT",1} } },
-        { "GeForce GTX 980",                                 { {"COPY_DIMX",32}, {"COPY_DIMY",8}, {"COPY_VW",2}, {"COPY_WPT",1} } },
-        { "GeForce GTX TITAN",                               { {"COPY_DIMX",16}, {"COPY_DIMY",32}, {"COPY_VW",2}, {"COPY_WPT",2} } },
-        { "GeForce GTX TITAN Black",                         { {"COPY_DIMX",16}, {"COPY_DIMY",8}, {"COPY_VW",2}, {"COPY_WPT",8} } },
-        { "GeForce GTX TITAN X",                             { {"COPY_DIMX",32}, {"COPY_DIMY",16}, {"COPY_VW",1}, {"COPY_WPT",1} } },
-        { "TITAN X (Pascal)",                                { {"COPY_DIMX",8}, {"COPY_DIMY",8}, {"COPY_VW",2}, {"COPY_WPT",2} } },
-        { "Tesla K20m",                                      { {"COPY_DIMX",8}, {"COPY_DIMY",8}, {"COPY_VW",2}, {"COPY_WPT",1} } },
-        { "Tesla K40m",                                      { {"COPY_DIMX",8}, {"COPY_DIMY",8}, {"COPY_VW",2}, {"COPY_WPT",2} } },
-        { "default",                                         { {"COPY_DIMX",32}, {"COPY_DIMY",32}, {"COPY_VW",2}, {"COPY_WPT",1} } },
+        { "GRID K520",                                       CopyParameters[55] },
+        { "GeForce GTX 1070",                                CopyParameters[23] },
+        { "GeForce GTX 1080",                                CopyParameters[23] },
+        { "GeForce GTX 480",                                 CopyParameters[16] },
+        { "GeForce GTX 670",                                 CopyParameters[16] },
+        { "GeForce GTX 680",                                 CopyParameters[53] },
+        { "GeForce GTX 750",                                 CopyParameters[46] },
+        { "GeForce GTX 750 Ti",                              CopyParameters[4] },
+        { "GeForce GTX 980",                                 CopyParameters[56] },
+        { "GeForce GTX TITAN",                               CopyParameters[25] },
+        { "GeForce GTX TITAN Black",                         CopyParameters[57] },
+        { "GeForce GTX TITAN X",                             CopyParameters[26] },
+        { "TITAN X (Pascal)",                                CopyParameters[34] },
+        { "Tesla K20m",                                      CopyParameters[16] },
+        { "Tesla K40m",                                      CopyParameters[34] },
+        { "default",                                         CopyParameters[58] },
       }
     },
     { // Default
       kDeviceTypeAll, "default", {
-        { "default",                                         { {"COPY_DIMX",16}, {"COPY_DIMY",8}, {"COPY_VW",2}, {"COPY_WPT",1} } },
+        { "default",                                         CopyParameters[4] },
       }
     },
   }
@@ -266,62 +334,62 @@ const Database::DatabaseEntry CopyComplexDouble = {
   "Copy", Precision::kComplexDouble, {
     { // AMD GPUs
       kDeviceTypeGPU, "AMD", {
-        { "AMD Radeon R9 M370X Compute Engine",              { {"COPY_DIMX",8}, {"COPY_DIMY",16}, {"COPY_VW",1}, {"COPY_WPT",1} } },
-        { "Ellesmere",                                       { {"COPY_DIMX",8}, {"COPY_DIMY",32}, {"COPY_VW",1}, {"COPY_WPT",2} } },
-        { "Fiji",                                            { {"COPY_DIMX",8}, {"COPY_DIMY",16}, {"COPY_VW",1}, {"COPY_WPT",1} } },
-        { "Hawaii",                                          { {"COPY_DIMX",32}, {"COPY_DIMY",8}, {"COPY_VW",2}, {"COPY_WPT",8} } },
-        { "Oland",                                           { {"COPY_DIMX",8}, {"COPY_DIMY",16}, {"COPY_VW",1}, {"COPY_WPT",1} } },
-        { "Pitcairn",                                        { {"COPY_DIMX",16}, {"COPY_DIMY",8}, {"COPY_VW",1}, {"COPY_WPT",1} } },
-        { "Tahiti",                                          { {"COPY_DIMX",8}, {"COPY_DIMY",16}, {"COPY_VW",1}, {"COPY_WPT",1} } },
-        { "Tonga",                                           { {"COPY_DIMX",16}, {"COPY_DIMY",8}, {"COPY_VW",2}, {"COPY_WPT",1} } },
-        { "default",                                         { {"COPY_DIMX",8}, {"COPY_DIMY",16}, {"COPY_VW",1}, {"COPY_WPT",1} } },
+        { "AMD Radeon R9 M370X Compute Engine",              CopyParameters[32] },
+        { "Ellesmere",                                       CopyParameters[35] },
+        { "Fiji",                                            CopyParameters[32] },
+        { "Hawaii",                                          CopyParameters[49] },
+        { "Oland",                                           CopyParameters[32] },
+        { "Pitcairn",                                        CopyParameters[36] },
+        { "Tahiti",                                          CopyParameters[32] },
+        { "Tonga",                                           CopyParameters[4] },
+        { "default",                                         CopyParameters[32] },
       }
     },
     { // ARM GPUs
       kDeviceTypeGPU, "ARM", {
-        { "Mali-T628",                                       { {"COPY_DIMX",32}, {"COPY_DIMY",8}, {"COPY_VW",1}, {"COPY_WPT",2} } },
-        { "default",                                         { {"COPY_DIMX",32}, {"COPY_DIMY",8}, {"COPY_VW",1}, {"COPY_WPT",2} } },
+        { "Mali-T628",                                       CopyParameters[27] },
+        { "default",                                         CopyParameters[27] },
       }
     },
     { // Intel CPUs
       kDeviceTypeCPU, "Intel", {
-        { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       { {"COPY_DIMX",8}, {"COPY_DIMY",8}, {"COPY_VW",8}, {"COPY_WPT",1} } },
-        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {"COPY_DIMX",32}, {"COPY_DIMY",8}, {"COPY_VW",8}, {"COPY_WPT",1} } },
-        { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         { {"COPY_DIMX",32}, {"COPY_DIMY",32}, {"COPY_VW",8}, {"COPY_WPT",1} } },
-        { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        { {"COPY_DIMX",32}, {"COPY_DIMY",16}, {"COPY_VW",8}, {"COPY_WPT",4} } },
-        { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        { {"COPY_DIMX",8}, {"COPY_DIMY",8}, {"COPY_VW",8}, {"COPY_WPT",1} } },
-        { "default",                                         { {"COPY_DIMX",16}, {"COPY_DIMY",8}, {"COPY_VW",8}, {"COPY_WPT",1} } },
+        { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       CopyParameters[54] },
+        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        CopyParameters[15] },
+        { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         CopyParameters[59] },
+        { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        CopyParameters[60] },
+        { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        CopyParameters[54] },
+        { "default",                                         CopyParameters[40] },
       }
     },
     { // Intel accelerators
       kDeviceTypeAccelerator, "Intel", {
-        { "Intel(R) Many Integrated Core Acceleration Card", { {"COPY_DIMX",32}, {"COPY_DIMY",8}, {"COPY_VW",8}, {"COPY_WPT",1} } },
-        { "default",                                         { {"COPY_DIMX",32}, {"COPY_DIMY",8}, {"COPY_VW",8}, {"COPY_WPT",1} } },
+        { "Intel(R) Many Integrated Core Acceleration Card", CopyParameters[15] },
+        { "default",                                         CopyParameters[15] },
       }
     },
     { // NVIDIA GPUs
       kDeviceTypeGPU, "NVIDIA", {
-        { "GRID K520",                                       { {"COPY_DIMX",8}, {"COPY_DIMY",8}, {"COPY_VW",1}, {"COPY_WPT",1} } },
-        { "GeForce GTX 1070",                                { {"COPY_DIMX",8}, {"COPY_DIMY",32}, {"COPY_VW",1}, {"COPY_WPT",4} } },
-        { "GeForce GTX 1080",                                { {"COPY_DIMX",8}, {"COPY_DIMY",8}, {"COPY_VW",1}, {"COPY_WPT",1} } },
-        { "GeForce GTX 480",                                 { {"COPY_DIMX",16}, {"COPY_DIMY",8}, {"COPY_VW",1}, {"COPY_WPT",1} } },
-        { "GeForce GTX 670",                                 { {"COPY_DIMX",16}, {"COPY_DIMY",8}, {"COPY_VW",1}, {"COPY_WPT",1} } },
-        { "GeForce GTX 680",                                 { {"COPY_DIMX",8}, {"COPY_DIMY",8}, {"COPY_VW",1}, {"COPY_WPT",1} } },
-        { "GeForce GTX 750",                                 { {"COPY_DIMX",32}, {"COPY_DIMY",8}, {"COPY_VW",1}, {"COPY_WPT",1} } },
-        { "GeForce GTX 750 Ti",                              { {"COPY_DIMX",16}, {"COPY_DIMY",16}, {"COPY_VW",1}, {"COPY_WPT",1} } },
-        { "GeForce GTX 980",                                 { {"COPY_DIMX",8}, {"COPY_DIMY",8}, {"COPY_VW",1}, {"COPY_WPT",1} } },
-        { "GeForce GTX TITAN",                               { {"COPY_DIMX",16}, {"COPY_DIMY",16}, {"COPY_VW",1}, {"COPY_WPT",1} } },
-        { "GeForce GTX TITAN Black",                         { {"COPY_DIMX",8}, {"COPY_DIMY",8}, {"COPY_VW",1}, {"COPY_WPT",2} } },
-        { "GeForce GTX TITAN X",                             { {"COPY_DIMX",16}, {"COPY_DIMY",8}, {"COPY_VW",1}, {"COPY_WPT",1} } },
-        { "TITAN X (Pascal)",                                { {"COPY_DIMX",8}, {"COPY_DIMY",8}, {"COPY_VW",1}, {"COPY_WPT",2} } },
-        { "Tesla K20m",                                      { {"COPY_DIMX",8}, {"COPY_DIMY",8}, {"COPY_VW",1}, {"COPY_WPT",2} } },
-        { "Tesla K40m",                                      { {"COPY_DIMX",8}, {"COPY_DIMY",8}, {"COPY_VW",1}, {"COPY_WPT",1} } },
-        { "default",                                         { {"COPY_DIMX",8}, {"COPY_DIMY",8}, {"COPY_VW",1}, {"COPY_WPT",1} } },
+        { "GRID K520",                                       CopyParameters[30] },
+        { "GeForce GTX 1070",                                CopyParameters[61] },
+        { "GeForce GTX 1080",                                CopyParameters[30] },
+        { "GeForce GTX 480",                                 CopyParameters[36] },
+        { "GeForce GTX 670",                                 CopyParameters[36] },
+        { "GeForce GTX 680",                                 CopyParameters[30] },
+        { "GeForce GTX 750",                                 CopyParameters[29] },
+        { "GeForce GTX 750 Ti",                              CopyParameters[44] },
+        { "GeForce GTX 980",                                 CopyParameters[30] },
+        { "GeForce GTX TITAN",                               CopyParameters[44] },
+        { "GeForce GTX TITAN Black",                         CopyParameters[33] },
+        { "GeForce GTX TITAN X",                             CopyParameters[36] },
+        { "TITAN X (Pascal)",                                CopyParameters[33] },
+        { "Tesla K20m",                                      CopyParameters[33] },
+        { "Tesla K40m",                                      CopyParameters[30] },
+        { "default",                                         CopyParameters[30] },
       }
     },
     { // Default
       kDeviceTypeAll, "default", {
-        { "default",                                         { {"COPY_DIMX",16}, {"COPY_DIMY",8}, {"COPY_VW",1}, {"COPY_WPT",1} } },
+        { "default",                                         CopyParameters[36] },
       }
     },
   }
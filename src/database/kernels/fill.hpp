@@ -0,0 +1,86 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file populates the database with best-found tuning parameters for the 'Fill' kernels.
+// These are the kernels setting a matrix (FillMatrix) or a vector (FillVector) to a constant value.
+//
+// =================================================================================================
+
+namespace clblast {
+namespace database {
+// =================================================================================================
+
+// The unique parameter sets of these kernels, referred to by index below
+const auto FillParameters = Database::ParameterSets({"FILL_DIMX", "FILL_DIMY", "FILL_WGS"}, {
+  {8, 8, 64}, // 0
+});
+
+// =================================================================================================
+
+const Database::DatabaseEntry FillHalf = {
+  "Fill", Precision::kHalf, {
+    { // Default
+      kDeviceTypeAll, "default", {
+        { "default",                                         FillParameters[0] },
+      }
+    },
+  }
+};
+
+// =================================================================================================
+
+const Database::DatabaseEntry FillSingle = {
+  "Fill", Precision::kSingle, {
+    { // Default
+      kDeviceTypeAll, "default", {
+        { "default",                                         FillParameters[0] },
+      }
+    },
+  }
+};
+
+// =================================================================================================
+
+const Database::DatabaseEntry FillComplexSingle = {
+  "Fill", Precision::kComplexSingle, {
+    { // Default
+      kDeviceTypeAll, "default", {
+        { "default",                                         FillParameters[0] },
+      }
+    },
+  }
+};
+
+// =================================================================================================
+
+const Database::DatabaseEntry FillDouble = {
+  "Fill", Precision::kDouble, {
+    { // Default
+      kDeviceTypeAll, "default", {
+        { "default",                                         FillParameters[0] },
+      }
+    },
+  }
+};
+
+// =================================================================================================
+
+const Database::DatabaseEntry FillComplexDouble = {
+  "Fill", Precision::kComplexDouble, {
+    { // Default
+      kDeviceTypeAll, "default", {
+        { "default",                                         FillParameters[0] },
+      }
+    },
+  }
+};
+
+// =================================================================================================
+} // namespace database
+} // namespace clblast
@@ -15,11 +15,18 @@ namespace clblast {
 namespace database {
 // =================================================================================================
 
+// The unique parameter sets of these kernels, referred to by index below
+const auto InvertParameters = Database::ParameterSets({"INTERNAL_BLOCK_SIZE"}, {
+  {16}, // 0
+});
+
+// =================================================================================================
+
 const Database::DatabaseEntry InvertHalf = {
   "Invert", Precision::kHalf, {
     { // Default
       kDeviceTypeAll, "default", {
-        { "default",                                         { {"INTERNAL_BLOCK_SIZE",16} } },
+        { "default",                                         InvertParameters[0] },
       }
     },
   }
@@ -31,7 +38,7 @@ const Database::DatabaseEntry InvertSingle = {
   "Invert", Precision::kSingle, {
     { // Default
       kDeviceTypeAll, "default", {
-        { "default",                                         { {"INTERNAL_BLOCK_SIZE",16} } },
+        { "default",                                         InvertParameters[0] },
       }
     },
   }
@@ -43,7 +50,7 @@ const Database::DatabaseEntry InvertComplexSingle = {
   "Invert", Precision::kComplexSingle, {
     { // Default
       kDeviceTypeAll, "default", {
-        { "default",                                         { {"INTERNAL_BLOCK_SIZE",16} } },
+        { "default",                                         InvertParameters[0] },
       }
     },
   }
@@ -55,7 +62,7 @@ const Database::DatabaseEntry InvertDouble = {
   "Invert", Precision::kDouble, {
     { // Default
       kDeviceTypeAll, "default", {
-        { "default",                                         { {"INTERNAL_BLOCK_SIZE",16} } },
+        { "default",                                         InvertParameters[0] },
       }
     },
   }
@@ -67,7 +74,7 @@ const Database::DatabaseEntry InvertComplexDouble = {
   "Invert", Precision::kComplexDouble, {
     { // Default
       kDeviceTypeAll, "default", {
-        { "default",                                         { {"INTERNAL_BLOCK_SIZE",16} } },
+        { "default",                                         InvertParameters[0] },
       }
     },
   }
@@ -15,24 +15,46 @@ namespace clblast {
 namespace database {
 // =================================================================================================
 
+// The unique parameter sets of these kernels, referred to by index below
+const auto PadtransposeParameters = Database::ParameterSets({"PADTRA_PAD", "PADTRA_TILE", "PADTRA_WPT"}, {
+  {0, 16, 4}, // 0
+  {0, 8, 1}, // 1
+  {1, 8, 2}, // 2
+  {1, 16, 1}, // 3
+  {1, 8, 4}, // 4
+  {0, 16, 2}, // 5
+  {1, 16, 4}, // 6
+  {0, 8, 2}, // 7
+  {0, 8, 8}, // 8
+  {0, 16, 1}, // 9
+  {0, 32, 1}, // 10
+  {1, 16, 2}, // 11
+  {1, 32, 2}, // 12
+  {1, 32, 1}, // 13
+  {0, 8, 4}, // 14
+  {1, 8, 1}, // 15
+});
+
+// =================================================================================================
+
 const Database::DatabaseEntry PadtransposeHalf = {
   "Padtranspose", Precision::kHalf, {
     { // AMD GPUs
       kDeviceTypeGPU, "AMD", {
-        { "Ellesmere",                                       { {"PADTRA_PAD",0}, {"PADTRA_TILE",16}, {"PADTRA_WPT",4} } },
-        { "default",                                         { {"PADTRA_PAD",0}, {"PADTRA_TILE",16}, {"PADTRA_WPT",4} } },
+        { "Ellesmere",                                       PadtransposeParameters[0] },
+        { "default",                                         PadtransposeParameters[0] },
       }
     },
     { // Intel GPUs
       kDeviceTypeGPU, "Intel", {
-        { "Intel(R) HD Graphics 5500 BroadWell U-Processor GT2", { {"PADTRA_PAD",0}, {"PADTRA_TILE",8}, {"PADTRA_WPT",1} } },
-        { "Intel(R) HD Graphics Skylake ULT GT2",            { {"PADTRA_PAD",1}, {"PADTRA_TILE",8}, {"PADTRA_WPT",2} } },
-        { "default",                                         { {"PADTRA_PAD",0}, {"PADTRA_TILE",8}, {"PADTRA_WPT",1} } },
+        { "Intel(R) HD Graphics 5500 BroadWell U-Processor GT2", PadtransposeParameters[1] },
+        { "Intel(R) HD Graphics Skylake ULT GT2",            PadtransposeParameters[2] },
+        { "default",                                         PadtransposeParameters[1] },
       }
     },
     { // Default
       kDeviceTypeAll, "default", {
-        { "default",                                         { {"PADTRA_PAD",0}, {"PADTRA_TILE",8}, {"PADTRA_WPT",1} } },
+        { "default",                                         PadtransposeParameters[1] },
       }
     },
   }
@@ -44,76 +66,76 @@ const Database::DatabaseEntry PadtransposeSingle = {
   "Padtranspose", Precision::kSingle, {
     { // AMD GPUs
       kDeviceTypeGPU, "AMD", {
-        { "AMD Radeon R9 M370X Compute Engine",              { {"PADTRA_PAD",0}, {"PADTRA_TILE",16}, {"PADTRA_WPT",4} } },
-        { "ATI Radeon HD 6750M",                             { {"PADTRA_PAD",1}, {"PADTRA_TILE",16}, {"PADTRA_WPT",1} } },
-        { "Ellesmere",                                       { {"PADTRA_PAD",1}, {"PADTRA_TILE",8}, {"PADTRA_WPT",4} } },
-        { "Fiji",                                            { {"PADTRA_PAD",0}, {"PADTRA_TILE",16}, {"PADTRA_WPT",2} } },
-        { "Hawaii",                                          { {"PADTRA_PAD",1}, {"PADTRA_TILE",16}, {"PADTRA_WPT",4} } },
-        { "Oland",                                           { {"PADTRA_PAD",0}, {"PADTRA_TILE",16}, {"PADTRA_WPT",4} } },
-        { "Pitcairn",                                        { {"PADTRA_PAD",0}, {"PADTRA_TILE",16}, {"PADTRA_WPT",4} } },
-        { "Tahiti",                                          { {"PADTRA_PAD",0}, {"PADTRA_TILE",16}, {"PADTRA_WPT",4} } },
-        { "Tonga",                                           { {"PADTRA_PAD",0}, {"PADTRA_TILE",16}, {"PADTRA_WPT",2} } },
-        { "Turks",                                           { {"PADTRA_PAD",1}, {"PADTRA_TILE",16}, {"PADTRA_WPT",1} } },
-        { "default",                                         { {"PADTRA_PAD",0}, {"PADTRA_TILE",16}, {"PADTRA_WPT",4} } },
+        { "AMD Radeon R9 M370X Compute Engine",              PadtransposeParameters[0] },
+        { "ATI Radeon HD 6750M",                             PadtransposeParameters[3] },
+        { "Ellesmere",                                       PadtransposeParameters[4] },
+        { "Fiji",                                            PadtransposeParameters[5] },
+        { "Hawaii",                                          PadtransposeParameters[6] },
+        { "Oland",                                           PadtransposeParameters[0] },
+        { "Pitcairn",                                        PadtransposeParameters[0] },
+        { "Tahiti",                                          PadtransposeParameters[0] },
+        { "Tonga",                                           PadtransposeParameters[5] },
+        { "Turks",                                           PadtransposeParameters[3] },
+        { "default",                                         PadtransposeParameters[0] },
       }
     },
     { // ARM GPUs
       kDeviceTypeGPU, "ARM", {
-        { "Mali-T628",                                       { {"PADTRA_PAD",0}, {"PADTRA_TILE",8}, {"PADTRA_WPT",2} } },
-        { "default",                                         { {"PADTRA_PAD",0}, {"PADTRA_TILE",8}, {"PADTRA_WPT",2} } },
+        { "Mali-T628",                                       PadtransposeParameters[7] },
+        { "default",                                         PadtransposeParameters[7] },
       }
     },
     { // Intel CPUs
       kDeviceTypeCPU, "Intel", {
-        { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       { {"PADTRA_PAD",0}, {"PADTRA_TILE",8}, {"PADTRA_WPT",8} } },
-        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {"PADTRA_PAD",0}, {"PADTRA_TILE",16}, {"PADTRA_WPT",1} } },
-        { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         { {"PADTRA_PAD",0}, {"PADTRA_TILE",8}, {"PADTRA_WPT",8} } },
-        { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        { {"PADTRA_PAD",0}, {"PADTRA_TILE",8}, {"PADTRA_WPT",8} } },
-        { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        { {"PADTRA_PAD",0}, {"PADTRA_TILE",32}, {"PADTRA_WPT",1} } },
-        { "default",                                         { {"PADTRA_PAD",0}, {"PADTRA_TILE",8}, {"PADTRA_WPT",8} } },
+        { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       PadtransposeParameters[8] },
+        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        PadtransposeParameters[9] },
+        { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         PadtransposeParameters[8] },
+        { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        PadtransposeParameters[8] },
+        { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        PadtransposeParameters[10] },
+        { "default",                                         PadtransposeParameters[8] },
       }
     },
     { // Intel GPUs
       kDeviceTypeGPU, "Intel", {
-        { "Intel(R) HD Graphics 530",                        { {"PADTRA_PAD",1}, {"PADTRA_TILE",16}, {"PADTRA_WPT",2} } },
-        { "Intel(R) HD Graphics 5500 BroadWell U-Processor GT2", { {"PADTRA_PAD",0}, {"PADTRA_TILE",16}, {"PADTRA_WPT",4} } },
-        { "Intel(R) HD Graphics Haswell Ultrabook GT2 Mobile", { {"PADTRA_PAD",1}, {"PADTRA_TILE",16}, {"PADTRA_WPT",2} } },
-        { "Intel(R) HD Graphics IvyBridge M GT2",            { {"PADTRA_PAD",0}, {"PADTRA_TILE",16}, {"PADTRA_WPT",4} } },
-        { "Intel(R) HD Graphics Skylake ULT GT2",            { {"PADTRA_PAD",1}, {"PADTRA_TILE",16}, {"PADTRA_WPT",2} } },
-        { "Iris",                                            { {"PADTRA_PAD",1}, {"PADTRA_TILE",16}, {"PADTRA_WPT",2} } },
-        { "Iris Pro",                                        { {"PADTRA_PAD",1}, {"PADTRA_TILE",16}, {"PADTRA_WPT",2} } },
-        { "default",                                         { {"PADTRA_PAD",1}, {"PADTRA_TILE",16}, {"PADTRA_WPT",2} } },
+        { "Intel(R) HD Graphics 530",                        PadtransposeParameters[11] },
+        { "Intel(R) HD Graphics 5500 BroadWell U-Processor GT2", PadtransposeParameters[0] },
+        { "Intel(R) HD Graphics Haswell Ultrabook GT2 Mobile", PadtransposeParameters[11] },
+        { "Intel(R) HD Graphics IvyBridge M GT2",            PadtransposeParameters[0] },
+        { "Intel(R) HD Graphics Skylake ULT GT2",            PadtransposeParameters[11] },
+        { "Iris",                                            PadtransposeParameters[11] },
+        { "Iris Pro",                                        PadtransposeParameters[11] },
+        { "default",                                         PadtransposeParameters[11] },
       }
     },
     { // Intel accelerators
       kDeviceTypeAccelerator, "Intel", {
-        { "Intel(R) Many Integrated Core Acceleration Card", { {"PADTRA_PAD",0}, {"PADTRA_TILE",16}, {"PADTRA_WPT",2} } },
-        { "default",                                         { {"PADTRA_PAD",0}, {"PADTRA_TILE",16}, {"PADTRA_WPT",2} } },
+        { "Intel(R) Many Integrated Core Acceleration Card", PadtransposeParameters[5] },
+        { "default",                                         PadtransposeParameters[5] },
       }
     },
     { // NVIDIA GPUs
       kDeviceTypeGPU, "NVIDIA", {
-        { "GRID K520",                                       { {"PADTRA_PAD",1}, {"PADTRA_TILE",32}, {"PADTRA_WPT",2} } },
-        { "GeForce GTX 1070",                                { {"PADTRA_PAD",0}, {"PADTRA_TILE",16}, {"PADTRA_WPT",1} } },
-        { "GeForce GTX 1080",                                { {"PADTRA_PAD",1}, {"PADTRA_TILE",16}, {"PADTRA_WPT",2} } },
-        { "GeForce GTX 480",                                 { {"PADTRA_PAD",1}, {"PADTRA_TILE",16}, {"PADTRA_WPT",2} } },
-        { "GeForce GTX 670",                                 { {"PADTRA_PAD",1}, {"PADTRA_TILE",32}, {"PADTRA_WPT",2} } },
-        { "GeForce GTX 680",                                 { {"PADTRA_PAD",1}, {"PADTRA_TILE",16}, {"PADTRA_WPT",2} } },
-        { "GeForce GTX 750",                                 { {"PADTRA_PAD",1}, {"PADTRA_TILE",32}, {"PADTRA_WPT",2} } },
-        { "GeForce GTX 750 Ti",                              { {"PADTRA_PAD",1}, {"PADTRA_TILE",32}, {"PADTRA_WPT",2} } },
-        { "GeForce GTX 980",                                 { {"PADTRA_PAD",0}, {"PADTRA_TILE",16}, {"PADTRA_WPT",1} } },
-        { "GeForce GTX TITAN",                               { {"PADTRA_PAD",1}, {"PADTRA_TILE",16}, {"PADTRA_WPT",2} } },
-        { "GeForce GTX TITAN Black",                         { {"PADTRA_PAD",1}, {"PADTRA_TILE",32}, {"PADTRA_WPT",2} } },
-        { "GeForce GTX TITAN X",                             { {"PADTRA_PAD",1}, {"PADTRA_TILE",32}, {"PADTRA_WPT",1} } },
-        { "TITAN X (Pascal)",                                { {"PADTRA_PAD",1}, {"PADTRA_TILE",16}, {"PADTRA_WPT",2} } },
-        { "Tesla K20m",                                      { {"PADTRA_PAD",1}, {"PADTRA_TILE",16}, {"PADTRA_WPT",2} } },
-        { "Tesla K40m",                                      { {"PADTRA_PAD",1}, {"PADTRA_TILE",32}, {"PADTRA_WPT",2} } },
-        { "default",                                         { {"PADTRA_PAD",1}, {"PADTRA_TILE",32}, {"PADTRA_WPT",2} } },
+        { "GRID K520",                                       PadtransposeParameters[12] },
+        { "GeForce GTX 1070",                                PadtransposeParameters[9] },
+        { "GeForce GTX 1080",                                PadtransposeParameters[11] },
+        { "GeForce GTX 480",                                 PadtransposeParameters[11] },
+        { "GeForce GTX 670",                                 PadtransposeParameters[12] },
+        { "GeForce GTX 680",                                 PadtransposeParameters[11] },
+        { "GeForce GTX 750",                                 PadtransposeParameters[12] },
+        { "GeForce GTX 750 Ti",                              PadtransposeParameters[12] },
+        { "GeForce GTX 980",                                 PadtransposeParameters[9] },
+        { "GeForce GTX TITAN",                               PadtransposeParameters[11] },
+        { "GeForce GTX TITAN Black",                         PadtransposeParameters[12] },
+        { "GeForce GTX TITAN X",                             PadtransposeParameters[13] },
+        { "TITAN X (Pascal)",                                PadtransposeParameters[11] },
+        { "Tesla K20m",                                      PadtransposeParameters[11] },
+        { "Tesla K40m",                                      PadtransposeParameters[12] },
+        { "default",                                         PadtransposeParameters[12] },
       }
     },
     { // Default
       kDeviceTypeAll, "default", {
-        { "default",                                         { {"PADTRA_PAD",1}, {"PADTRA_TILE",16}, {"PADTRA_WPT",2} } },
+        { "default",                                         PadtransposeParameters[11] },
       }
     },
   }
@@ -125,76 +147,76 @@ const Database::DatabaseEntry PadtransposeComplexSingle = {
   "Padtranspose", Precision::kComplexSingle, {
     { // AMD GPUs
       kDeviceTypeGPU, "AMD", {
-        { "AMD Radeon R9 M370X Compute Engine",              { {"PADTRA_PAD",0}, {"PADTRA_TILE",16}, {"PADTRA_WPT",4} } },
-        { "ATI Radeon HD 6750M",                             { {"PADTRA_PAD",1}, {"PADTRA_TILE",16}, {"PADTRA_WPT",1} } },
-        { "Ellesmere",                                       { {"PADTRA_PAD",0}, {"PADTRA_TILE",8}, {"PADTRA_WPT",4} } },
-        { "Fiji",                                            { {"PADTRA_PAD",1}, {"PADTRA_TILE",16}, {"PADTRA_WPT",2} } },
-        { "Hawaii",                                          { {"PADTRA_PAD",0}, {"PADTRA_TILE",16}, {"PADTRA_WPT",2} } },
-        { "Oland",                                           { {"PADTRA_PAD",0}, {"PADTRA_TILE",8}, {"PADTRA_WPT",4} } },
-        { "Pitcairn",                                        { {"PADTRA_PAD",0}, {"PADTRA_TILE",8}, {"PADTRA_WPT",4} } },
-        { "Tahiti",                                          { {"PADTRA_PAD",0}, {"PADTRA_TILE",16}, {"PADTRA_WPT",2} } },
-        { "Tonga",                                           { {"PADTRA_PAD",0}, {"PADTRA_TILE",16}, {"PADTRA_WPT",2} } },
-        { "Turks",                                           { {"PADTRA_PAD",0}, {"PADTRA_TILE",16}, {"PADTRA_WPT",4} } },
-        { "default",                                         { {"PADTRA_PAD",0}, {"PADTRA_TILE",8}, {"PADTRA_WPT",4} } },
+        { "AMD Radeon R9 M370X Compute Engine",              PadtransposeParameters[0] },
+        { "ATI Radeon HD 6750M",                             PadtransposeParameters[3] },
+        { "Ellesmere",                                       PadtransposeParameters[14] },
+        { "Fiji",                                            PadtransposeParameters[11] },
+        { "Hawaii",                                          PadtransposeParameters[5] },
+        { "Oland",                                           PadtransposeParameters[14] },
+        { "Pitcairn",                                        PadtransposeParameters[14] },
+        { "Tahiti",                                          PadtransposeParameters[5] },
+        { "Tonga",                                           PadtransposeParameters[5] },
+        { "Turks",                                           PadtransposeParameters[0] },
+        { "default",                                         PadtransposeParameters[14] },
       }
     },
     { // ARM GPUs
       kDeviceTypeGPU, "ARM", {
-        { "Mali-T628",                                       { {"PADTRA_PAD",1}, {"PADTRA_TILE",16}, {"PADTRA_WPT",2} } },
-        { "default",                                         { {"PADTRA_PAD",1}, {"PADTRA_TILE",16}, {"PADTRA_WPT",2} } },
+        { "Mali-T628",                                       PadtransposeParameters[11] },
+        { "default",                                         PadtransposeParameters[11] },
       }
     },
     { // Intel CPUs
       kDeviceTypeCPU, "Intel", {
-        { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       { {"PADTRA_PAD",0}, {"PADTRA_TILE",8}, {"PADTRA_WPT",8} } },
-        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {"PADTRA_PAD",1}, {"PADTRA_TILE",8}, {"PADTRA_WPT",4} } },
-        { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         { {"PADTRA_PAD",0}, {"PADTRA_TILE",8}, {"PADTRA_WPT",8} } },
-        { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        { {"PADTRA_PAD",0}, {"PADTRA_TILE",8}, {"PADTRA_WPT",8} } },
-        { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        { {"PADTRA_PAD",0}, {"PADTRA_TILE",8}, {"PADTRA_WPT",4} } },
-        { "default",                                         { {"PADTRA_PAD",0}, {"PADTRA_TILE",8}, {"PADTRA_WPT",8} } },
+        { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       PadtransposeParameters[8] },
+        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        PadtransposeParameters[4] },
+        { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         PadtransposeParameters[8] },
+        { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        PadtransposeParameters[8] },
+        { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        PadtransposeParameters[14] },
+        { "default",                                         PadtransposeParameters[8] },
       }
     },
     { // Intel GPUs
       kDeviceTypeGPU, "Intel", {
-        { "Intel(R) HD Graphics 530",                        { {"PADTRA_PAD",1}, {"PADTRA_TILE",16}, {"PADTRA_WPT",2} } },
-        { "Intel(R) HD Graphics 5500 BroadWell U-Processor GT2", { {"PADTRA_PAD",0}, {"PADTRA_TILE",16}, {"PADTRA_WPT",2} } },
-        { "Intel(R) HD Graphics Haswell Ultrabook GT2 Mobile", { {"PADTRA_PAD",1}, {"PADTRA_TILE",16}, {"PADTRA_WPT",2} } },
-        { "Intel(R) HD Graphics IvyBridge M GT2",            { {"PADTRA_PAD",0}, {"PADTRA_TILE",16}, {"PADTRA_WPT",2} } },
-        { "Intel(R) HD Graphics Skylake ULT GT2",            { {"PADTRA_PAD",0}, {"PADTRA_TILE",16}, {"PADTRA_WPT",4} } },
-        { "Iris",                                            { {"PADTRA_PAD",0}, {"PADTRA_TILE",16}, {"PADTRA_WPT",2} } },
-        { "Iris Pro",                                        { {"PADTRA_PAD",1}, {"PADTRA_TILE",16}, {"PADTRA_WPT",2} } },
-        { "default",                                         { {"PADTRA_PAD",1}, {"PADTRA_TILE",16}, {"PADTRA_WPT",2} } },
+        { "Intel(R) HD Graphics 530",                        PadtransposeParameters[11] },
+        { "Intel(R) HD Graphics 5500 BroadWell U-Processor GT2", PadtransposeParameters[5] },
+        { "Intel(R) HD Graphics Haswell Ultrabook GT2 Mobile", PadtransposeParameters[11] },
+        { "Intel(R) HD Graphics IvyBridge M GT2",            PadtransposeParameters[5] },
+        { "Intel(R) HD Graphics Skylake ULT GT2",            PadtransposeParameters[0] },
+        { "Iris",                                            PadtransposeParameters[5] },
+        { "Iris Pro",                                        PadtransposeParameters[11] },
+        { "default",                                         PadtransposeParameters[11] },
       }
     },
     { // Intel accelerators
       kDeviceTypeAccelerator, "Intel", {
-        { "Intel(R) Many Integrated Core Acceleration Card", { {"PADTRA_PAD",1}, {"PADTRA_TILE",16}, {"PADTRA_WPT",1} } },
-        { "default",                                         { {"PADTRA_PAD",1}, {"PADTRA_TILE",16}, {"PADTRA_WPT",1} } },
+        { "Intel(R) Many Integrated Core Acceleration Card", PadtransposeParameters[3] },
+        { "default",                                         PadtransposeParameters[3] },
       }
     },
     { // NVIDIA GPUs
       kDeviceTypeGPU, "NVIDIA", {
-        { "GRID K520",                                       { {"PADTRA_PAD",1}, {"PADTRA_TILE",16}, {"PADTRA_WPT",1} } },
-        { "GeForce GTX 1070",                                { {"PADTRA_PAD",1}, {"PADTRA_TILE",16}, {"PADTRA_WPT",1} } },
-        { "GeForce GTX 1080",                                { {"PADTRA_PAD",0}, {"PADTRA_TILE",8}, {"PADTRA_WPT",1} } },
-        { "GeForce GTX 480",                                 { {"PADTRA_PAD",1}, {"PADTRA_TILE",16}, {"PADTRA_WPT",1} } },
-        { "GeForce GTX 670",                                 { {"PADTRA_PAD",1}, {"PADTRA_TILE",16}, {"PADTRA_WPT",1} } },
-        { "GeForce GTX 680",                                 { {"PADTRA_PAD",1}, {"PADTRA_TILE",16}, {"PADTRA_WPT",1} } },
-        { "GeForce GTX 750",                                 { {"PADTRA_PAD",1}, {"PADTRA_TILE",16}, {"PADTRA_WPT",2} } },
-        { "GeForce GTX 750 Ti",                              { {"PADTRA_PAD",1}, {"PADTRA_TILE",16}, {"PADTRA_WPT",1} } },
-        { "GeForce GTX 980",                                 { {"PADTRA_PAD",0}, {"PADTRA_TILE",16}, {"PADTRA_WPT",1} } },
-        { "GeForce GTX TITAN",                               { {"PADTRA_PAD",1}, {"PADTRA_TILE",16}, {"PADTRA_WPT",1} } },
-        { "GeForce GTX TITAN Black",                         { {"PADTRA_PAD",0}, {"PADTRA_TILE",16}, {"PADTRA_WPT",1} } },
-        { "GeForce GTX TITAN X",                             { {"PADTRA_PAD",1}, {"PADTRA_TILE",32}, {"PADTRA_WPT",1} } },
-        { "TITAN X (Pascal)",                                { {"PADTRA_PAD",1}, {"PADTRA_TILE",8}, {"PADTRA_WPT",1} } },
-        { "Tesla K20m",                                      { {"PADTRA_PAD",0}, {"PADTRA_TILE",16}, {"PADTRA_WPT",1} } },
-        { "Tesla K40m",                                      { {"PADTRA_PAD",1}, {"PADTRA_TILE",16}, {"PADTRA_WPT",1} } },
-        { "default",                                         { {"PADTRA_PAD",1}, {"PADTRA_TILE",16}, {"PADTRA_WPT",1} } },
+        { "GRID K520",                                       PadtransposeParameters[3] },
+        { "GeForce GTX 1070",                                PadtransposeParameters[3] },
+        { "GeForce GTX 1080",                                PadtransposeParameters[1] },
+        { "GeForce GTX 480",                                 PadtransposeParameters[3] },
+        { "GeForce GTX 670",                                 PadtransposeParameters[3] },
+        { "GeForce GTX 680",                                 PadtransposeParameters[3] },
+        { "GeForce GTX 750",                                 PadtransposeParameters[11] },
+        { "GeForce GTX 750 Ti",                              PadtransposeParameters[3] },
+        { "GeForce GTX 980",                                 PadtransposeParameters[9] },
+        { "GeForce GTX TITAN",                               PadtransposeParameters[3] },
+        { "GeForce GTX TITAN Black",                         PadtransposeParameters[9] },
+        { "GeForce GTX TITAN X",                             PadtransposeParameters[13] },
+        { "TITAN X (Pascal)",                                PadtransposeParameters[15] },
+        { "Tesla K20m",                                      PadtransposeParameters[9] },
+        { "Tesla K40m",                                      PadtransposeParameters[3] },
+        { "default",                                         PadtransposeParameters[3] },
       }
     },
     { // Default
       kDeviceTypeAll, "default", {
-        { "default",                                         { {"PADTRA_PAD",1}, {"PADTRA_TILE",16}, {"PADTRA_WPT",2} } },
+        { "default",                                         PadtransposeParameters[11] },
       }
     },
   }
@@ -206,62 +228,62 @@ const Database::DatabaseEntry PadtransposeDouble = {
   "Padtranspose", Precision::kDouble, {
     { // AMD GPUs
       kDeviceTypeGPU, "AMD", {
-        { "AMD Radeon R9 M370X Compute Engine",              { {"PADTRA_PAD",0}, {"PADTRA_TILE",16}, {"PADTRA_WPT",4} } },
-        { "Ellesmere",                                       { {"PADTRA_PAD",0}, {"PADTRA_TILE",16}, {"PADTRA_WPT",4} } },
-        { "Fiji",                                            { {"PADTRA_PAD",0}, {"PADTRA_TILE",16}, {"PADTRA_WPT",2} } },
-        { "Hawaii",                                          { {"PADTRA_PAD",0}, {"PADTRA_TILE",16}, {"PADTRA_WPT",2} } },
-        { "Oland",                                           { {"PADTRA_PAD",0}, {"PADTRA_TILE",16}, {"PADTRA_WPT",4} } },
-        { "Pitcairn",                                        { {"PADTRA_PAD",0}, {"PADTRA_TILE",8}, {"PADTRA_WPT",4} } },
-        { "Tahiti",                                          { {"PADTRA_PAD",1}, {"PADTRA_TILE",16}, {"PADTRA_WPT",2} } },
-        { "Tonga",                                           { {"PADTRA_PAD",0}, {"PADTRA_TILE",8}, {"PADTRA_WPT",2} } },
-        { "default",                                         { {"PADTRA_PAD",0}, {"PADTRA_TILE",16}, {"PADTRA_WPT",4} } },
+        { "AMD Radeon R9 M370X Compute Engine",              PadtransposeParameters[0] },
+        { "Ellesmere",                                       PadtransposeParameters[0] },
+        { "Fiji",                                            PadtransposeParameters[5] },
+        { "Hawaii",                                          PadtransposeParameters[5] },
+        { "Oland",                                           PadtransposeParameters[0] },
+        { "Pitcairn",                                        PadtransposeParameters[14] },
+        { "Tahiti",                                          PadtransposeParameters[11] },
+        { "Tonga",                                           PadtransposeParameters[7] },
+        { "default",                                         PadtransposeParameters[0] },
       }
     },
     { // ARM GPUs
       kDeviceTypeGPU, "ARM", {
-        { "Mali-T628",                                       { {"PADTRA_PAD",0}, {"PADTRA_TILE",16}, {"PADTRA_WPT",2} } },
-        { "default",                                         { {"PADTRA_PAD",0}, {"PADTRA_TILE",16}, {"PADTRA_WPT",2} } },
+        { "Mali-T628",                                       PadtransposeParameters[5] },
+        { "default",                                         PadtransposeParameters[5] },
       }
     },
     { // Intel CPUs
       kDeviceTypeCPU, "Intel", {
-        { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       { {"PADTRA_PAD",0}, {"PADTRA_TILE",8}, {"PADTRA_WPT",8} } },
-        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {"PADTRA_PAD",1}, {"PADTRA_TILE",8}, {"PADTRA_WPT",4} } },
-        { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         { {"PADTRA_PAD",0}, {"PADTRA_TILE",8}, {"PADTRA_WPT",8} } },
-        { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        { {"PADTRA_PAD",0}, {"PADTRA_TILE",8}, {"PADTRA_WPT",8} } },
-        { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        { {"PADTRA_PAD",1}, {"PADTRA_TILE",32}, {"PADTRA_WPT",1} } },
-        { "default",                                         { {"PADTRA_PAD",1}, {"PADTRA_TILE",8}, {"PADTRA_WPT",4} } },
+        { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       PadtransposeParameters[8] },
+        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        PadtransposeParameters[4] },
+        { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         PadtransposeParameters[8] },
+        { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        PadtransposeParameters[8] },
+        { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        PadtransposeParameters[13] },
+        { "default",                                         PadtransposeParameters[4] },
       }
     },
     { // Intel accelerators
       kDeviceTypeAccelerator, "Intel", {
-        { "Intel(R) Many Integrated Core Acceleration Card", { {"PADTRA_PAD",0}, {"PADTRA_TILE",16}, {"PADTRA_WPT",1} } },
-        { "default",                                         { {"PADTRA_PAD",0}, {"PADTRA_TILE",16}, {"PADTRA_WPT",1} } },
+        { "Intel(R) Many Integrated Core Acceleration Card", PadtransposeParameters[9] },
+        { "default",                                         PadtransposeParameters[9] },
       }
     },
     { // NVIDIA GPUs
       kDeviceTypeGPU, "NVIDIA", {
-        { "GRID K520",                                       { {"PADTRA_PAD",1}, {"PADTRA_TILE",16}, {"PADTRA_WPT",1} } },
-        { "GeForce GTX 1070",                                { {"PADTRA_PAD",1}, {"PADTRA_TILE",16}, {"PADTRA_WPT",1} } },
-        { "GeForce GTX 1080",                                { {"PADTRA_PAD",0}, {"PADTRA_TILE",8}, {"PADTRA_WPT",1} } },
-        { "GeForce GTX 480",                                 { {"PADTRA_PAD",1}, {"PADTRA_TILE",16}, {"PADTRA_WPT",1} } },
-        { "GeForce GTX 670",                                 { {"PADTRA_PAD",1}, {"PADTRA_TILE",16}, {"PADTRA_WPT",1} } },
-        { "GeForce GTX 680",                                 { {"PADTRA_PAD",1}, {"PADTRA_TILE",16}, {"PADTRA_WPT",1} } },
-        { "GeForce GTX 750",                                 { {"PADTRA_PAD",1}, {"PADTRA_TILE",16}, {"PADTRA_WPT",2} } },
-        { "GeForce GTX 750 Ti",                              { {"PADTRA_PAD",1}, {"PADTRA_TILE",32}, {"PADTRA_WPT",2} } },
-        { "GeForce GTX 980",                                 { {"PADTRA_PAD",1}, {"PADTRA_TILE",32}, {"PADTRA_WPT",1} } },
-        { "GeForce GTX TITAN",                               { {"PADTRA_PAD",0}, {"PADTRA_TILE",16}, {"PADTRA_WPT",1} } },
-        { "GeForce GTX TITAN Black",                         { {"PADTRA_PAD",0}, {"PADTRA_TILE",16}, {"PADTRA_WPT",1} } },
-        { "GeForce GTX TITAN X",                             { {"PADTRA_PAD",1}, {"PADTRA_TILE",32}, {"PADTRA_WPT",1} } },
-        { "TITAN X (Pascal)",                                { {"PADTRA_PAD",0}, {"PADTRA_TILE",8}, {"PADTRA_WPT",1} } },
-        { "Tesla K20m",                                      { {"PADTRA_PAD",0}, {"PADTRA_TILE",16}, {"PADTRA_WPT",1} } },
-        { "Tesla K40m",                                      { {"PADTRA_PAD",1}, {"PADTRA_TILE",16}, {"PADTRA_WPT",1} } },
-        { "default",                                         { {"PADTRA_PAD",1}, {"PADTRA_TILE",16}, {"PADTRA_WPT",1} } },
+        { "GRID K520",                                       PadtransposeParameters[3] },
+        { "GeForce GTX 1070",                                PadtransposeParameters[3] },
+        { "GeForce GTX 1080",                                PadtransposeParameters[1] },
+        { "GeForce GTX 480",                                 PadtransposeParameters[3] },
+        { "GeForce GTX 670",                                 PadtransposeParameters[3] },
+        { "GeForce GTX 680",                                 PadtransposeParameters[3] },
+        { "GeForce GTX 750",                                 PadtransposeParameters[11] },
+        { "GeForce GTX 750 Ti",                              PadtransposeParameters[12] },
+        { "GeForce GTX 980",                                 PadtransposeParameters[13] },
+        { "GeForce GTX TITAN",                               PadtransposeParameters[9] },
+        { "GeForce GTX TITAN Black",                         PadtransposeParameters[9] },
+        { "GeForce GTX TITAN X",                             PadtransposeParameters[13] },
+        { "TITAN X (Pascal)",                                PadtransposeParameters[1] },
+        { "Tesla K20m",                                      PadtransposeParameters[9] },
+        { "Tesla K40m",                                      PadtransposeParameters[3] },
+        { "default",                                         PadtransposeParameters[3] },
       }
     },
     { // Default
       kDeviceTypeAll, "default", {
-        { "default",                                         { {"PADTRA_PAD",1}, {"PADTRA_TILE",16}, {"PADTRA_WPT",2} } },
+        { "default",                                         PadtransposeParameters[11] },
       }
     },
   }
@@ -273,62 +295,62 @@ const Database::DatabaseEntry PadtransposeComplexDouble = {
   "Padtranspose", Precision::kComplexDouble, {
     { // AMD GPUs
       kDeviceTypeGPU, "AMD", {
-        { "AMD Radeon R9 M370X Compute Engine",              { {"PADTRA_PAD",0}, {"PADTRA_TILE",8}, {"PADTRA_WPT",4} } },
-        { "Ellesmere",                                       { {"PADTRA_PAD",0}, {"PADTRA_TILE",8}, {"PADTRA_WPT",4} } },
-        { "Fiji",                                            { {"PADTRA_PAD",0}, {"PADTRA_TILE",8}, {"PADTRA_WPT",2} } },
-        { "Hawaii",                                          { {"PADTRA_PAD",0}, {"PADTRA_TILE",8}, {"PADTRA_WPT",4} } },
-        { "Oland",                                           { {"PADTRA_PAD",0}, {"PADTRA_TILE",8}, {"PADTRA_WPT",4} } },
-        { "Pitcairn",                                        { {"PADTRA_PAD",0}, {"PADTRA_TILE",8}, {"PADTRA_WPT",4} } },
-        { "Tahiti",                                          { {"PADTRA_PAD",0}, {"PADTRA_TILE",8}, {"PADTRA_WPT",2} } },
-        { "Tonga",                                           { {"PADTRA_PAD",0}, {"PADTRA_TILE",8}, {"PADTRA_WPT",2} } },
-        { "default",                                         { {"PADTRA_PAD",0}, {"PADTRA_TILE",8}, {"PADTRA_WPT",4} } },
+        { "AMD Radeon R9 M370X Compute Engine",              PadtransposeParameters[14] },
+        { "Ellesmere",                                       PadtransposeParameters[14] },
+        { "Fiji",                                            PadtransposeParameters[7] },
+        { "Hawaii",                                          PadtransposeParameters[14] },
+        { "Oland",                                           PadtransposeParameters[14] },
+        { "Pitcairn",                                        PadtransposeParameters[14] },
+        { "Tahiti",                                          PadtransposeParameters[7] },
+        { "Tonga",                                           PadtransposeParameters[7] },
+        { "default",                                         PadtransposeParameters[14] },
       }
     },
     { // ARM GPUs
       kDeviceTypeGPU, "ARM", {
-        { "Mali-T628",                                       { {"PADTRA_PAD",0}, {"PADTRA_TILE",8}, {"PADTRA_WPT",1} } },
-        { "default",                                         { {"PADTRA_PAD",0}, {"PADTRA_TILE",8}, {"PADTRA_WPT",1} } },
+        { "Mali-T628",                                       PadtransposeParameters[1] },
+        { "default",                                         PadtransposeParameters[1] },
       }
     },
     { // Intel CPUs
       kDeviceTypeCPU, "Intel", {
-        { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       { {"PADTRA_PAD",0}, {"PADTRA_TILE",8}, {"PADTRA_WPT",4} } },
-        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {"PADTRA_PAD",1}, {"PADTRA_TILE",8}, {"PADTRA_WPT",2} } },
-        { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         { {"PADTRA_PAD",1}, {"PADTRA_TILE",8}, {"PADTRA_WPT",4} } },
-        { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        { {"PADTRA_PAD",0}, {"PADTRA_TILE",8}, {"PADTRA_WPT",4} } },
-        { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        { {"PADTRA_PAD",1}, {"PADTRA_TILE",8}, {"PADTRA_WPT",4} } },
-        { "default",                                         { {"PADTRA_PAD",0}, {"PADTRA_TILE",8}, {"PADTRA_WPT",4} } },
+        { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       PadtransposeParameters[14] },
+        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        PadtransposeParameters[2] },
+        { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         PadtransposeParameters[4] },
+        { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        PadtransposeParameters[14] },
+        { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        PadtransposeParameters[4] },
+        { "default",                                         PadtransposeParameters[14] },
       }
     },
     { // Intel accelerators
       kDeviceTypeAccelerator, "Intel", {
-        { "Intel(R) Many Integrated Core Acceleration Card", { {"PADTRA_PAD",0}, {"PADTRA_TILE",16}, {"PADTRA_WPT",1} } },
-        { "default",                                         { {"PADTRA_PAD",0}, {"PADTRA_TILE",16}, {"PADTRA_WPT",1} } },
+        { "Intel(R) Many Integrated Core Acceleration Card", PadtransposeParameters[9] },
+        { "default",                                         PadtransposeParameters[9] },
       }
     },
     { // NVIDIA GPUs
       kDeviceTypeGPU, "NVIDIA", {
-        { "GRID K520",                                       { {"PADTRA_PAD",1}, {"PADTRA_TILE",16}, {"PADTRA_WPT",1} } },
-        { "GeForce GTX 1070",                                { {"PADTRA_PAD",1}, {"PADTRA_TILE",16}, {"PADTRA_WPT",1} } },
-        { "GeForce GTX 1080",                                { {"PADTRA_PAD",1}, {"PADTRA_TILE",8}, {"PADTRA_WPT",1} } },
-        { "GeForce GTX 480",                                 { {"PADTRA_PAD",1}, {"PADTRA_TILE",16}, {"PADTRA_WPT",1} } },
-        { "GeForce GTX 670",                                 { {"PADTRA_PAD",1}, {"PADTRA_TILE",16}, {"PADTRA_WPT",1} } },
-        { "GeForce GTX 680",                                 { {"PADTRA_PAD",1}, {"PADTRA_TILE",32}, {"PADTRA_WPT",1} } },
-        { "GeForce GTX 750",                                 { {"PADTRA_PAD",1}, {"PADTRA_TILE",16}, {"PADTRA_WPT",1} } },
-        { "GeForce GTX 750 Ti",                              { {"PADTRA_PAD",1}, {"PADTRA_TILE",8}, {"PADTRA_WPT",2} } },
-        { "GeForce GTX 980",                                 { {"PADTRA_PAD",0}, {"PADTRA_TILE",16}, {"PADTRA_WPT",1} } },
-        { "GeForce GTX TITAN",                               { {"PADTRA_PAD",1}, {"PADTRA_TILE",16}, {"PADTRA_WPT",1} } },
-        { "GeForce GTX TITAN Black",                         { {"PADTRA_PAD",0}, {"PADTRA_TILE",16}, {"PADTRA_WPT",1} } },
-        { "GeForce GTX TITAN X",                             { {"PADTRA_PAD",1}, {"PADTRA_TILE",32}, {"PADTRA_WPT",1} } },
-        { "TITAN X (Pascal)",                                { {"PADTRA_PAD",1}, {"PADTRA_TILE",8}, {"PADTRA_WPT",1} } },
-        { "Tesla K20m",                                      { {"PADTRA_PAD",1}, {"PADTRA_TILE",16}, {"PADTRA_WPT",1} } },
-        { "Tesla K40m",                                      { {"PADTRA_PAD",1}, {"PADTRA_TILE",16}, {"PADTRA_WPT",1} } },
-        { "default",                                         { {"PADTRA_PAD",1}, {"PADTRA_TILE",16}, {"PADTRA_WPT",1} } },
+        { "GRID K520",                                       PadtransposeParameters[3] },
+        { "GeForce GTX 1070",                                PadtransposeParameters[3] },
+        { "GeForce GTX 1080",                                PadtransposeParameters[15] },
+        { "GeForce GTX 480",                                 PadtransposeParameters[3] },
+        { "GeForce GTX 670",                                 PadtransposeParameters[3] },
+        { "GeForce GTX 680",                                 PadtransposeParameters[13] },
+        { "GeForce GTX 750",                                 PadtransposeParameters[3] },
+        { "GeForce GTX 750 Ti",                              PadtransposeParameters[2] },
+        { "GeForce GTX 980",                                 PadtransposeParameters[9] },
+        { "GeForce GTX TITAN",                               PadtransposeParameters[3] },
+        { "GeForce GTX TITAN Black",                         PadtransposeParameters[9] },
+        { "GeForce GTX TITAN X",                             PadtransposeParameters[13] },
+        { "TITAN X (Pascal)",                                PadtransposeParameters[15] },
+        { "Tesla K20m",                                      PadtransposeParameters[3] },
+        { "Tesla K40m",                                      PadtransposeParameters[3] },
+        { "default",                                         PadtransposeParameters[3] },
       }
     },
     { // Default
       kDeviceTypeAll, "default", {
-        { "default",                                         { {"PADTRA_PAD",0}, {"PADTRA_TILE",8}, {"PADTRA_WPT",2} } },
+        { "default",                                         PadtransposeParameters[7] },
       }
     },
   }
@@ -15,24 +15,69 @@ namespace clblast {
 namespace database {
 // =================================================================================================
 
+// The unique parameter sets of these kernels, referred to by index below
+const auto TransposeParameters = Database::ParameterSets({"TRA_DIM", "TRA_PAD", "TRA_SHUFFLE", "TRA_WPT"}, {
+  {4, 0, 1, 8}, // 0
+  {8, 1, 1, 8}, // 1
+  {16, 0, 0, 4}, // 2
+  {8, 1, 0, 8}, // 3
+  {16, 0, 1, 4}, // 4
+  {8, 0, 1, 2}, // 5
+  {16, 0, 1, 2}, // 6
+  {8, 0, 1, 4}, // 7
+  {16, 0, 1, 1}, // 8
+  {4, 0, 1, 4}, // 9
+  {8, 1, 1, 2}, // 10
+  {4, 1, 0, 16}, // 11
+  {4, 0, 0, 8}, // 12
+  {8, 1, 0, 4}, // 13
+  {16, 1, 0, 4}, // 14
+  {16, 1, 1, 1}, // 15
+  {32, 1, 1, 2}, // 16
+  {4, 0, 0, 4}, // 17
+  {16, 1, 0, 2}, // 18
+  {16, 1, 1, 2}, // 19
+  {32, 1, 0, 2}, // 20
+  {16, 0, 0, 1}, // 21
+  {8, 0, 0, 4}, // 22
+  {4, 1, 1, 4}, // 23
+  {4, 0, 1, 2}, // 24
+  {8, 0, 1, 1}, // 25
+  {8, 1, 1, 4}, // 26
+  {16, 0, 0, 2}, // 27
+  {8, 0, 0, 2}, // 28
+  {4, 1, 0, 8}, // 29
+  {16, 1, 0, 1}, // 30
+  {32, 1, 0, 1}, // 31
+  {8, 1, 0, 2}, // 32
+  {8, 0, 0, 1}, // 33
+  {4, 0, 0, 16}, // 34
+  {4, 1, 1, 2}, // 35
+  {4, 0, 1, 1}, // 36
+  {4, 1, 0, 4}, // 37
+  {8, 1, 0, 1}, // 38
+});
+
+// =================================================================================================
+
 const Database::DatabaseEntry TransposeHalf = {
   "Transpose", Precision::kHalf, {
     { // AMD GPUs
       kDeviceTypeGPU, "AMD", {
-        { "Ellesmere",                                       { {"TRA_DIM",4}, {"TRA_PAD",0}, {"TRA_SHUFFLE",1}, {"TRA_WPT",8} } },
-        { "default",                                         { {"TRA_DIM",4}, {"TRA_PAD",0}, {"TRA_SHUFFLE",1}, {"TRA_WPT",8} } },
+        { "Ellesmere",                                       TransposeParameters[0] },
+        { "default",                                         TransposeParameters[0] },
       }
     },
     { // Intel GPUs
       kDeviceTypeGPU, "Intel", {
-        { "Intel(R) HD Graphics 5500 BroadWell U-Processor GT2", { {"TRA_DIM",8}, {"TRA_PAD",1}, {"TRA_SHUFFLE",1}, {"TRA_WPT",8} } },
-        { "Intel(R) HD Graphics Skylake ULT GT2",            { {"TRA_DIM",16}, {"TRA_PAD",0}, {"TRA_SHUFFLE",0}, {"TRA_WPT",4} } },
-        { "default",                                         { {"TRA_DIM",8}, {"TRA_PAD",1}, {"TRA_SHUFFLE",0}, {"TRA_WPT",8} } },
+        { "Intel(R) HD Graphics 5500 BroadWell U-Processor GT2", TransposeParameters[1] },
+        { "Intel(R) HD Graphics Skylake ULT GT2",            TransposeParameters[2] },
+        { "default",                                         TransposeParameters[3] },
       }
     },
     { // Default
       kDeviceTypeAll, "default", {
-        { "default",                                         { {"TRA_DIM",16}, {"TRA_PAD",0}, {"TRA_SHUFFLE",1}, {"TRA_WPT",4} } },
+        { "default",                                         TransposeParameters[4] },
       }
     },
   }
@@ -44,77 +89,77 @@ const Database::DatabaseEntry TransposeSingle = {
   "Transpose", Precision::kSingle, {
     { // AMD GPUs
       kDeviceTypeGPU, "AMD", {
-        { "AMD Radeon R9 M370X Compute Engine",              { {"TRA_DIM",4}, {"TRA_PAD",0}, {"TRA_SHUFFLE",1}, {"TRA_WPT",8} } },
-        { "ATI Radeon HD 6750M",                             { {"TRA_DIM",8}, {"TRA_PAD",0}, {"TRA_SHUFFLE",1}, {"TRA_WPT",2} } },
-        { "Ellesmere",                                       { {"TRA_DIM",16}, {"TRA_PAD",0}, {"TRA_SHUFFLE",1}, {"TRA_WPT",4} } },
-        { "Fiji",                                            { {"TRA_DIM",16}, {"TRA_PAD",0}, {"TRA_SHUFFLE",1}, {"TRA_WPT",2} } },
-        { "Hawaii",                                          { {"TRA_DIM",4}, {"TRA_PAD",0}, {"TRA_SHUFFLE",1}, {"TRA_WPT",8} } },
-        { "Oland",                                           { {"TRA_DIM",8}, {"TRA_PAD",0}, {"TRA_SHUFFLE",1}, {"TRA_WPT",4} } },
-        { "Pitcairn",                                        { {"TRA_DIM",16}, {"TRA_PAD",0}, {"TRA_SHUFFLE",1}, {"TRA_WPT",1} } },
-        { "Tahiti",                                          { {"TRA_DIM",4}, {"TRA_PAD",0}, {"TRA_SHUFFLE",1}, {"TRA_WPT",4} } },
-        { "Tonga",                                           { {"TRA_DIM",8}, {"TRA_PAD",1}, {"TRA_SHUFFLE",1}, {"TRA_WPT",2} } },
-        { "Turks",                                           { {"TRA_DIM",8}, {"TRA_PAD",0}, {"TRA_SHUFFLE",1}, {"TRA_WPT",2} } },
-        { "default",                                         { {"TRA_DIM",8}, {"TRA_PAD",0}, {"TRA_SHUFFLE",1}, {"TRA_WPT",2} } },
+        { "AMD Radeon R9 M370X Compute Engine",              TransposeParameters[0] },
+        { "ATI Radeon HD 6750M",                             TransposeParameters[5] },
+        { "Ellesmere",                                       TransposeParameters[4] },
+        { "Fiji",                                            TransposeParameters[6] },
+        { "Hawaii",                                          TransposeParameters[0] },
+        { "Oland",                                           TransposeParameters[7] },
+        { "Pitcairn",                                        TransposeParameters[8] },
+        { "Tahiti",                                          TransposeParameters[9] },
+        { "Tonga",                                           TransposeParameters[10] },
+        { "Turks",                                           TransposeParameters[5] },
+        { "default",                                         TransposeParameters[5] },
       }
     },
     { // ARM GPUs
       kDeviceTypeGPU, "ARM", {
-        { "Mali-T628",                                       { {"TRA_DIM",8}, {"TRA_PAD",0}, {"TRA_SHUFFLE",1}, {"TRA_WPT",4} } },
-        { "default",                                         { {"TRA_DIM",8}, {"TRA_PAD",0}, {"TRA_SHUFFLE",1}, {"TRA_WPT",4} } },
+        { "Mali-T628",                                       TransposeParameters[7] },
+        { "default",                                         TransposeParameters[7] },
       }
     },
     { // Intel CPUs
       kDeviceTypeCPU, "Intel", {
-        { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       { {"TRA_DIM",4}, {"TRA_PAD",1}, {"TRA_SHUFFLE",0}, {"TRA_WPT",16} } },
-        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {"TRA_DIM",4}, {"TRA_PAD",0}, {"TRA_SHUFFLE",0}, {"TRA_WPT",8} } },
-        { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         { {"TRA_DIM",4}, {"TRA_PAD",0}, {"TRA_SHUFFLE",0}, {"TRA_WPT",8} } },
-        { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        { {"TRA_DIM",4}, {"TRA_PAD",1}, {"TRA_SHUFFLE",0}, {"TRA_WPT",16} } },
-        { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        { {"TRA_DIM",4}, {"TRA_PAD",0}, {"TRA_SHUFFLE",0}, {"TRA_WPT",8} } },
-        { "default",                                         { {"TRA_DIM",4}, {"TRA_PAD",0}, {"TRA_SHUFFLE",0}, {"TRA_WPT",8} } },
+        { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       TransposeParameters[11] },
+        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        TransposeParameters[12] },
+        { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         TransposeParameters[12] },
+        { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        TransposeParameters[11] },
+        { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        TransposeParameters[12] },
+        { "default",                                         TransposeParameters[12] },
       }
     },
     { // Intel GPUs
       kDeviceTypeGPU, "Intel", {
-        { "Intel(R) HD Graphics 530",                        { {"TRA_DIM",16}, {"TRA_PAD",0}, {"TRA_SHUFFLE",1}, {"TRA_WPT",4} } },
-        { "Intel(R) HD Graphics 5500 BroadWell U-Processor GT2", { {"TRA_DIM",16}, {"TRA_PAD",0}, {"TRA_SHUFFLE",0}, {"TRA_WPT",4} } },
-        { "Intel(R) HD Graphics Haswell Ultrabook GT2 Mobile", { {"TRA_DIM",16}, {"TRA_PAD",0}, {"TRA_SHUFFLE",0}, {"TRA_WPT",4} } },
-        { "Intel(R) HD Graphics IvyBridge M GT2",            { {"TRA_DIM",8}, {"TRA_PAD",0}, {"TRA_SHUFFLE",1}, {"TRA_WPT",4} } },
-        { "Intel(R) HD Graphics Skylake ULT GT2",            { {"TRA_DIM",16}, {"TRA_PAD",0}, {"TRA_SHUFFLE",1}, {"TRA_WPT",2} } },
-        { "Iris",                                            { {"TRA_DIM",8}, {"TRA_PAD",1}, {"TRA_SHUFFLE",0}, {"TRA_WPT",4} } },
-        { "Iris Pro",                                        { {"TRA_DIM",16}, {"TRA_PAD",1}, {"TRA_SHUFFLE",0}, {"TRA_WPT",4} } },
-        { "default",                                         { {"TRA_DIM",16}, {"TRA_PAD",0}, {"TRA_SHUFFLE",0}, {"TRA_WPT",4} } },
+        { "Intel(R) HD Graphics 530",                        TransposeParameters[4] },
+        { "Intel(R) HD Graphics 5500 BroadWell U-Processor GT2", TransposeParameters[2] },
+        { "Intel(R) HD Graphics Haswell Ultrabook GT2 Mobile", TransposeParameters[2] },
+        { "Intel(R) HD Graphics IvyBridge M GT2",            TransposeParameters[7] },
+        { "Intel(R) HD Graphics Skylake ULT GT2",            TransposeParameters[6] },
+        { "Iris",                                            TransposeParameters[13] },
+        { "Iris Pro",                                        TransposeParameters[14] },
+        { "default",                                         TransposeParameters[2] },
       }
     },
     { // Intel accelerators
       kDeviceTypeAccelerator, "Intel", {
-        { "Intel(R) Many Integrated Core Acceleration Card", { {"TRA_DIM",16}, {"TRA_PAD",1}, {"TRA_SHUFFLE",1}, {"TRA_WPT",1} } },
-        { "default",                                         { {"TRA_DIM",16}, {"TRA_PAD",1}, {"TRA_SHUFFLE",1}, {"TRA_WPT",1} } },
+        { "Intel(R) Many Integrated Core Acceleration Card", TransposeParameters[15] },
+        { "default",                                         TransposeParameters[15] },
       }
     },
     { // NVIDIA GPUs
       kDeviceTypeGPU, "NVIDIA", {
-        { "GRID K520",                                       { {"TRA_DIM",32}, {"TRA_PAD",1}, {"TRA_SHUFFLE",1}, {"TRA_WPT",2} } },
-        { "GeForce GT 650M",                                 { {"TRA_DIM",8}, {"TRA_PAD",1}, {"TRA_SHUFFLE",0}, {"TRA_WPT",4} } },
-        { "GeForce GTX 1070",                                { {"TRA_DIM",8}, {"TRA_PAD",0}, {"TRA_SHUFFLE",1}, {"TRA_WPT",4} } },
-        { "GeForce GTX 1080",                                { {"TRA_DIM",4}, {"TRA_PAD",0}, {"TRA_SHUFFLE",0}, {"TRA_WPT",4} } },
-        { "GeForce GTX 480",                                 { {"TRA_DIM",16}, {"TRA_PAD",1}, {"TRA_SHUFFLE",0}, {"TRA_WPT",2} } },
-        { "GeForce GTX 670",                                 { {"TRA_DIM",16}, {"TRA_PAD",1}, {"TRA_SHUFFLE",1}, {"TRA_WPT",2} } },
-        { "GeForce GTX 680",                                 { {"TRA_DIM",16}, {"TRA_PAD",1}, {"TRA_SHUFFLE",1}, {"TRA_WPT",2} } },
-        { "GeForce GTX 750",                                 { {"TRA_DIM",4}, {"TRA_PAD",0}, {"TRA_SHUFFLE",0}, {"TRA_WPT",8} } },
-        { "GeForce GTX 750 Ti",                              { {"TRA_DIM",32}, {"TRA_PAD",1}, {"TRA_SHUFFLE",0}, {"TRA_WPT",2} } },
-        { "GeForce GTX 980",                                 { {"TRA_DIM",16}, {"TRA_PAD",0}, {"TRA_SHUFFLE",0}, {"TRA_WPT",1} } },
-        { "GeForce GTX TITAN",                               { {"TRA_DIM",8}, {"TRA_PAD",1}, {"TRA_SHUFFLE",0}, {"TRA_WPT",4} } },
-        { "GeForce GTX TITAN Black",                         { {"TRA_DIM",8}, {"TRA_PAD",1}, {"TRA_SHUFFLE",0}, {"TRA_WPT",4} } },
-        { "GeForce GTX TITAN X",                             { {"TRA_DIM",16}, {"TRA_PAD",0}, {"TRA_SHUFFLE",0}, {"TRA_WPT",4} } },
-        { "TITAN X (Pascal)",                                { {"TRA_DIM",8}, {"TRA_PAD",0}, {"TRA_SHUFFLE",0}, {"TRA_WPT",4} } },
-        { "Tesla K20m",                                      { {"TRA_DIM",8}, {"TRA_PAD",0}, {"TRA_SHUFFLE",0}, {"TRA_WPT",4} } },
-        { "Tesla K40m",                                      { {"TRA_DIM",8}, {"TRA_PAD",1}, {"TRA_SHUFFLE",0}, {"TRA_WPT",4} } },
-        { "default",                                         { {"TRA_DIM",8}, {"TRA_PAD",1}, {"TRA_SHUFFLE",0}, {"TRA_WPT",4} } },
+        { "GRID K520",                                       TransposeParameters[16] },
+        { "GeForce GT 650M",                                 TransposeParameters[13] },
+        { "GeForce GTX 1070",                                TransposeParameters[7] },
+        { "GeForce GTX 1080",                                TransposeParameters[17] },
+        { "GeForce GTX 480",                                 TransposeParameters[18] },
+        { "GeForce GTX 670",                                 TransposeParameters[19] },
+        { "GeForce GTX 680",                                 TransposeParameters[19] },
+        { "GeForce GTX 750",                                 TransposeParameters[12] },
+        { "GeForce GTX 750 Ti",                              TransposeParameters[20] },
+        { "GeForce GTX 980",                                 TransposeParameters[21] },
+        { "GeForce GTX TITAN",                               TransposeParameters[13] },
+        { "GeForce GTX TITAN Black",                         TransposeParameters[13] },
+        { "GeForce GTX TITAN X",                             TransposeParameters[2] },
+        { "TITAN X (Pascal)",                                TransposeParameters[22] },
+        { "Tesla K20m",                                      TransposeParameters[22] },
+        { "Tesla K40m",                                      TransposeParameters[13] },
+        { "default",                                         TransposeParameters[13] },
       }
     },
     { // Default
       kDeviceTypeAll, "default", {
-        { "default",                                         { {"TRA_DIM",8}, {"TRA_PAD",0}, {"TRA_SHUFFLE",1}, {"TRA_WPT",4} } },
+        { "default",                                         TransposeParameters[7] },
       }
     },
   }
@@ -126,70 +171,70 @@ const Database::DatabaseEntry TransposeComplexSingle = {
   "Transpose", Precision::kComplexSingle, {
     { // AMD GPUs
       kDeviceTypeGPU, "AMD", {
-        { "AMD Radeon R9 M370X Compute Engine",              { {"TRA_DIM",4}, {"TRA_PAD",1}, {"TRA_SHUFFLE",1}, {"TRA_WPT",4} } },
-        { "ATI Radeon HD 6750M",                             { {"TRA_DIM",16}, {"TRA_PAD",1}, {"TRA_SHUFFLE",1}, {"TRA_WPT",1} } },
-        { "Ellesmere",                                       { {"TRA_DIM",4}, {"TRA_PAD",0}, {"TRA_SHUFFLE",1}, {"TRA_WPT",4} } },
-        { "Fiji",                                            { {"TRA_DIM",8}, {"TRA_PAD",1}, {"TRA_SHUFFLE",1}, {"TRA_WPT",2} } },
-        { "Hawaii",                                          { {"TRA_DIM",16}, {"TRA_PAD",0}, {"TRA_SHUFFLE",1}, {"TRA_WPT",1} } },
-        { "Oland",                                           { {"TRA_DIM",4}, {"TRA_PAD",0}, {"TRA_SHUFFLE",1}, {"TRA_WPT",2} } },
-        { "Pitcairn",                                        { {"TRA_DIM",8}, {"TRA_PAD",0}, {"TRA_SHUFFLE",1}, {"TRA_WPT",1} } },
-        { "Tahiti",                                          { {"TRA_DIM",16}, {"TRA_PAD",0}, {"TRA_SHUFFLE",1}, {"TRA_WPT",1} } },
-        { "Tonga",                                           { {"TRA_DIM",16}, {"TRA_PAD",0}, {"TRA_SHUFFLE",1}, {"TRA_WPT",1} } },
-        { "Turks",                                           { {"TRA_DIM",8}, {"TRA_PAD",1}, {"TRA_SHUFFLE",1}, {"TRA_WPT",4} } },
-        { "default",                                         { {"TRA_DIM",8}, {"TRA_PAD",0}, {"TRA_SHUFFLE",1}, {"TRA_WPT",1} } },
+        { "AMD Radeon R9 M370X Compute Engine",              TransposeParameters[23] },
+        { "ATI Radeon HD 6750M",                             TransposeParameters[15] },
+        { "Ellesmere",                                       TransposeParameters[9] },
+        { "Fiji",                                            TransposeParameters[10] },
+        { "Hawaii",                                          TransposeParameters[8] },
+        { "Oland",                                           TransposeParameters[24] },
+        { "Pitcairn",                                        TransposeParameters[25] },
+        { "Tahiti",                                          TransposeParameters[8] },
+        { "Tonga",                                           TransposeParameters[8] },
+        { "Turks",                                           TransposeParameters[26] },
+        { "default",                                         TransposeParameters[25] },
       }
     },
     { // ARM GPUs
       kDeviceTypeGPU, "ARM", {
-        { "Mali-T628",                                       { {"TRA_DIM",16}, {"TRA_PAD",0}, {"TRA_SHUFFLE",0}, {"TRA_WPT",2} } },
-        { "default",                                         { {"TRA_DIM",16}, {"TRA_PAD",0}, {"TRA_SHUFFLE",0}, {"TRA_WPT",2} } },
+        { "Mali-T628",                                       TransposeParameters[27] },
+        { "default",                                         TransposeParameters[27] },
       }
     },
     { // Intel CPUs
       kDeviceTypeCPU, "Intel", {
-        { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       { {"TRA_DIM",4}, {"TRA_PAD",0}, {"TRA_SHUFFLE",1}, {"TRA_WPT",8} } },
-        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {"TRA_DIM",8}, {"TRA_PAD",0}, {"TRA_SHUFFLE",0}, {"TRA_WPT",2} } },
-        { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         { {"TRA_DIM",4}, {"TRA_PAD",1}, {"TRA_SHUFFLE",0}, {"TRA_WPT",8} } },
-        { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        { {"TRA_DIM",4}, {"TRA_PAD",1}, {"TRA_SHUFFLE",0}, {"TRA_WPT",8} } },
-        { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        { {"TRA_DIM",16}, {"TRA_PAD",0}, {"TRA_SHUFFLE",0}, {"TRA_WPT",4} } },
-        { "default",                                         { {"TRA_DIM",4}, {"TRA_PAD",1}, {"TRA_SHUFFLE",0}, {"TRA_WPT",8} } },
+        { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       TransposeParameters[0] },
+        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        TransposeParameters[28] },
+        { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         TransposeParameters[29] },
+        { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        TransposeParameters[29] },
+        { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        TransposeParameters[2] },
+        { "default",                                         TransposeParameters[29] },
       }
     },
     { // Intel GPUs
       kDeviceTypeGPU, "Intel", {
-        { "Intel(R) HD Graphics 530",                        { {"TRA_DIM",16}, {"TRA_PAD",1}, {"TRA_SHUFFLE",1}, {"TRA_WPT",2} } },
-        { "Intel(R) HD Graphics 5500 BroadWell U-Processor GT2", { {"TRA_DIM",8}, {"TRA_PAD",0}, {"TRA_SHUFFLE",0}, {"TRA_WPT",2} } },
-        { "Intel(R) HD Graphics Haswell Ultrabook GT2 Mobile", { {"TRA_DIM",8}, {"TRA_PAD",0}, {"TRA_SHUFFLE",0}, {"TRA_WPT",2} } },
-        { "Intel(R) HD Graphics IvyBridge M GT2",            { {"TRA_DIM",16}, {"TRA_PAD",1}, {"TRA_SHUFFLE",1}, {"TRA_WPT",2} } },
-        { "Intel(R) HD Graphics Skylake ULT GT2",            { {"TRA_DIM",16}, {"TRA_PAD",1}, {"TRA_SHUFFLE",0}, {"TRA_WPT",2} } },
-        { "Iris",                                            { {"TRA_DIM",8}, {"TRA_PAD",0}, {"TRA_SHUFFLE",0}, {"TRA_WPT",2} } },
-        { "Iris Pro",                                        { {"TRA_DIM",16}, {"TRA_PAD",1}, {"TRA_SHUFFLE",0}, {"TRA_WPT",2} } },
-        { "default",                                         { {"TRA_DIM",16}, {"TRA_PAD",1}, {"TRA_SHUFFLE",0}, {"TRA_WPT",2} } },
+        { "Intel(R) HD Graphics 530",                        TransposeParameters[19] },
+        { "Intel(R) HD Graphics 5500 BroadWell U-Processor GT2", TransposeParameters[28] },
+        { "Intel(R) HD Graphics Haswell Ultrabook GT2 Mobile", TransposeParameters[28] },
+        { "Intel(R) HD Graphics IvyBridge M GT2",            TransposeParameters[19] },
+        { "Intel(R) HD Graphics Skylake ULT GT2",            TransposeParameters[18] },
+        { "Iris",                                            TransposeParameters[28] },
+        { "Iris Pro",                                        TransposeParameters[18] },
+        { "default",                                         TransposeParameters[18] },
       }
     },
     { // NVIDIA GPUs
       kDeviceTypeGPU, "NVIDIA", {
-        { "GRID K520",                                       { {"TRA_DIM",16}, {"TRA_PAD",1}, {"TRA_SHUFFLE",1}, {"TRA_WPT",1} } },
-        { "GeForce GTX 1070",                                { {"TRA_DIM",16}, {"TRA_PAD",1}, {"TRA_SHUFFLE",1}, {"TRA_WPT",1} } },
-        { "GeForce GTX 1080",                                { {"TRA_DIM",16}, {"TRA_PAD",1}, {"TRA_SHUFFLE",0}, {"TRA_WPT",1} } },
-        { "GeForce GTX 480",                                 { {"TRA_DIM",16}, {"TRA_PAD",1}, {"TRA_SHUFFLE",0}, {"TRA_WPT",1} } },
-        { "GeForce GTX 670",                                 { {"TRA_DIM",16}, {"TRA_PAD",1}, {"TRA_SHUFFLE",1}, {"TRA_WPT",1} } },
-        { "GeForce GTX 680",                                 { {"TRA_DIM",16}, {"TRA_PAD",1}, {"TRA_SHUFFLE",1}, {"TRA_WPT",1} } },
-        { "GeForce GTX 750",                                 { {"TRA_DIM",16}, {"TRA_PAD",1}, {"TRA_SHUFFLE",0}, {"TRA_WPT",1} } },
-        { "GeForce GTX 750 Ti",                              { {"TRA_DIM",16}, {"TRA_PAD",1}, {"TRA_SHUFFLE",0}, {"TRA_WPT",1} } },
-        { "GeForce GTX 980",                                 { {"TRA_DIM",16}, {"TRA_PAD",1}, {"TRA_SHUFFLE",0}, {"TRA_WPT",1} } },
-        { "GeForce GTX TITAN",                               { {"TRA_DIM",16}, {"TRA_PAD",0}, {"TRA_SHUFFLE",0}, {"TRA_WPT",1} } },
-        { "GeForce GTX TITAN Black",                         { {"TRA_DIM",16}, {"TRA_PAD",1}, {"TRA_SHUFFLE",0}, {"TRA_WPT",1} } },
-        { "GeForce GTX TITAN X",                             { {"TRA_DIM",32}, {"TRA_PAD",1}, {"TRA_SHUFFLE",0}, {"TRA_WPT",1} } },
-        { "TITAN X (Pascal)",                                { {"TRA_DIM",8}, {"TRA_PAD",1}, {"TRA_SHUFFLE",0}, {"TRA_WPT",2} } },
-        { "Tesla K20m",                                      { {"TRA_DIM",16}, {"TRA_PAD",0}, {"TRA_SHUFFLE",0}, {"TRA_WPT",1} } },
-        { "Tesla K40m",                                      { {"TRA_DIM",16}, {"TRA_PAD",1}, {"TRA_SHUFFLE",0}, {"TRA_WPT",1} } },
-        { "default",                                         { {"TRA_DIM",16}, {"TRA_PAD",1}, {"TRA_SHUFFLE",0}, {"TRA_WPT",1} } },
+        { "GRID K520",                                       TransposeParameters[15] },
+        { "GeForce GTX 1070",                                TransposeParameters[15] },
+        { "GeForce GTX 1080",                                TransposeParameters[30] },
+        { "GeForce GTX 480",                                 TransposeParameters[30] },
+        { "GeForce GTX 670",                                 TransposeParameters[15] },
+        { "GeForce GTX 680",                                 TransposeParameters[15] },
+        { "GeForce GTX 750",                                 TransposeParameters[30] },
+        { "GeForce GTX 750 Ti",                              TransposeParameters[30] },
+        { "GeForce GTX 980",                                 TransposeParameters[30] },
+        { "GeForce GTX TITAN",                               TransposeParameters[21] },
+        { "GeForce GTX TITAN Black",                         TransposeParameters[30] },
+        { "GeForce GTX TITAN X",                             TransposeParameters[31] },
+        { "TITAN X (Pascal)",                                TransposeParameters[32] },
+        { "Tesla K20m",                                      TransposeParameters[21] },
+        { "Tesla K40m",                                      TransposeParameters[30] },
+        { "default",                                         TransposeParameters[30] },
       }
     },
     { // Default
       kDeviceTypeAll, "default", {
-        { "default",                                         { {"TRA_DIM",8}, {"TRA_PAD",1}, {"TRA_SHUFFLE",1}, {"TRA_WPT",2} } },
+        { "default",                                         TransposeParameters[10] },
       }
     },
   }
@@ -201,62 +246,62 @@ const Database::DatabaseEntry TransposeDouble = {
   "Transpose", Precision::kDouble, {
     { // AMD GPUs
       kDeviceTypeGPU, "AMD", {
-        { "AMD Radeon R9 M370X Compute Engine",              { {"TRA_DIM",4}, {"TRA_PAD",0}, {"TRA_SHUFFLE",1}, {"TRA_WPT",4} } },
-        { "Ellesmere",                                       { {"TRA_DIM",4}, {"TRA_PAD",0}, {"TRA_SHUFFLE",1}, {"TRA_WPT",4} } },
-        { "Fiji",                                            { {"TRA_DIM",8}, {"TRA_PAD",1}, {"TRA_SHUFFLE",1}, {"TRA_WPT",2} } },
-        { "Hawaii",                                          { {"TRA_DIM",16}, {"TRA_PAD",0}, {"TRA_SHUFFLE",1}, {"TRA_WPT",1} } },
-        { "Oland",                                           { {"TRA_DIM",8}, {"TRA_PAD",1}, {"TRA_SHUFFLE",1}, {"TRA_WPT",2} } },
-        { "Pitcairn",                                        { {"TRA_DIM",4}, {"TRA_PAD",0}, {"TRA_SHUFFLE",1}, {"TRA_WPT",2} } },
-        { "Tahiti",                                          { {"TRA_DIM",4}, {"TRA_PAD",1}, {"TRA_SHUFFLE",1}, {"TRA_WPT",4} } },
-        { "Tonga",                                           { {"TRA_DIM",4}, {"TRA_PAD",0}, {"TRA_SHUFFLE",1}, {"TRA_WPT",4} } },
-        { "default",                                         { {"TRA_DIM",4}, {"TRA_PAD",0}, {"TRA_SHUFFLE",1}, {"TRA_WPT",4} } },
+        { "AMD Radeon R9 M370X Compute Engine",              TransposeParameters[9] },
+        { "Ellesmere",                                       TransposeParameters[9] },
+        { "Fiji",                                            TransposeParameters[10] },
+        { "Hawaii",                                          TransposeParameters[8] },
+        { "Oland",                                           TransposeParameters[10] },
+        { "Pitcairn",                                        TransposeParameters[24] },
+        { "Tahiti",                                          TransposeParameters[23] },
+        { "Tonga",                                           TransposeParameters[9] },
+        { "default",                                         TransposeParameters[9] },
       }
     },
     { // ARM GPUs
       kDeviceTypeGPU, "ARM", {
-        { "Mali-T628",                                       { {"TRA_DIM",8}, {"TRA_PAD",0}, {"TRA_SHUFFLE",0}, {"TRA_WPT",1} } },
-        { "default",                                         { {"TRA_DIM",8}, {"TRA_PAD",0}, {"TRA_SHUFFLE",0}, {"TRA_WPT",1} } },
+        { "Mali-T628",                                       TransposeParameters[33] },
+        { "default",                                         TransposeParameters[33] },
       }
     },
     { // Intel CPUs
       kDeviceTypeCPU, "Intel", {
-        { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       { {"TRA_DIM",4}, {"TRA_PAD",1}, {"TRA_SHUFFLE",0}, {"TRA_WPT",8} } },
-        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {"TRA_DIM",4}, {"TRA_PAD",0}, {"TRA_SHUFFLE",0}, {"TRA_WPT",4} } },
-        { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         { {"TRA_DIM",4}, {"TRA_PAD",1}, {"TRA_SHUFFLE",0}, {"TRA_WPT",8} } },
-        { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        { {"TRA_DIM",4}, {"TRA_PAD",0}, {"TRA_SHUFFLE",0}, {"TRA_WPT",16} } },
-        { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        { {"TRA_DIM",4}, {"TRA_PAD",0}, {"TRA_SHUFFLE",0}, {"TRA_WPT",8} } },
-        { "default",                                         { {"TRA_DIM",4}, {"TRA_PAD",1}, {"TRA_SHUFFLE",0}, {"TRA_WPT",8} } },
+        { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       TransposeParameters[29] },
+        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        TransposeParameters[17] },
+        { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         TransposeParameters[29] },
+        { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        TransposeParameters[34] },
+        { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        TransposeParameters[12] },
+        { "default",                                         TransposeParameters[29] },
       }
     },
     { // Intel accelerators
       kDeviceTypeAccelerator, "Intel", {
-        { "Intel(R) Many Integrated Core Acceleration Card", { {"TRA_DIM",32}, {"TRA_PAD",1}, {"TRA_SHUFFLE",0}, {"TRA_WPT",1} } },
-        { "default",                                         { {"TRA_DIM",32}, {"TRA_PAD",1}, {"TRA_SHUFFLE",0}, {"TRA_WPT",1} } },
+        { "Intel(R) Many Integrated Core Acceleration Card", TransposeParameters[31] },
+        { "default",                                         TransposeParameters[31] },
       }
     },
     { // NVIDIA GPUs
       kDeviceTypeGPU, "NVIDIA", {
-        { "GRID K520",                                       { {"TRA_DIM",16}, {"TRA_PAD",1}, {"TRA_SHUFFLE",1}, {"TRA_WPT",2} } },
-        { "GeForce GTX 1070",                                { {"TRA_DIM",8}, {"TRA_PAD",0}, {"TRA_SHUFFLE",1}, {"TRA_WPT",2} } },
-        { "GeForce GTX 1080",                                { {"TRA_DIM",8}, {"TRA_PAD",0}, {"TRA_SHUFFLE",0}, {"TRA_WPT",2} } },
-        { "GeForce GTX 480",                                 { {"TRA_DIM",8}, {"TRA_PAD",1}, {"TRA_SHUFFLE",0}, {"TRA_WPT",2} } },
-        { "GeForce GTX 670",                                 { {"TRA_DIM",16}, {"TRA_PAD",1}, {"TRA_SHUFFLE",1}, {"TRA_WPT",2} } },
-        { "GeForce GTX 680",                                 { {"TRA_DIM",16}, {"TRA_PAD",1}, {"TRA_SHUFFLE",1}, {"TRA_WPT",2} } },
-        { "GeForce GTX 750",                                 { {"TRA_DIM",16}, {"TRA_PAD",1}, {"TRA_SHUFFLE",0}, {"TRA_WPT",1} } },
-        { "GeForce GTX 750 Ti",                              { {"TRA_DIM",32}, {"TRA_PAD",1}, {"TRA_SHUFFLE",0}, {"TRA_WPT",2} } },
-        { "GeForce GTX 980",                                 { {"TRA_DIM",16}, {"TRA_PAD",0}, {"TRA_SHUFFLE",0}, {"TRA_WPT",2} } },
-        { "GeForce GTX TITAN",                               { {"TRA_DIM",8}, {"TRA_PAD",0}, {"TRA_SHUFFLE",0}, {"TRA_WPT",2} } },
-        { "GeForce GTX TITAN Black",                         { {"TRA_DIM",16}, {"TRA_PAD",1}, {"TRA_SHUFFLE",0}, {"TRA_WPT",2} } },
-        { "GeForce GTX TITAN X",                             { {"TRA_DIM",32}, {"TRA_PAD",1}, {"TRA_SHUFFLE",0}, {"TRA_WPT",1} } },
-        { "TITAN X (Pascal)",                                { {"TRA_DIM",16}, {"TRA_PAD",1}, {"TRA_SHUFFLE",0}, {"TRA_WPT",2} } },
-        { "Tesla K20m",                                      { {"TRA_DIM",16}, {"TRA_PAD",1}, {"TRA_SHUFFLE",0}, {"TRA_WPT",2} } },
-        { "Tesla K40m",                                      { {"TRA_DIM",16}, {"TRA_PAD",1}, {"TRA_SHUFFLE",1}, {"TRA_WPT",2} } },
-        { "default",                                         { {"TRA_DIM",16}, {"TRA_PAD",1}, {"TRA_SHUFFLE",1}, {"TRA_WPT",2} } },
+        { "GRID K520",                                       TransposeParameters[19] },
+        { "GeForce GTX 1070",                                TransposeParameters[5] },
+        { "GeForce GTX 1080",                                TransposeParameters[28] },
+        { "GeForce GTX 480",                                 TransposeParameters[32] },
+        { "GeForce GTX 670",                                 TransposeParameters[19] },
+        { "GeForce GTX 680",                                 TransposeParameters[19] },
+        { "GeForce GTX 750",                                 TransposeParameters[30] },
+        { "GeForce GTX 750 Ti",                              TransposeParameters[20] },
+        { "GeForce GTX 980",                                 TransposeParameters[27] },
+        { "GeForce GTX TITAN",                               TransposeParameters[28] },
+        { "GeForce GTX TITAN Black",                         TransposeParameters[18] },
+        { "GeForce GTX TITAN X",                             TransposeParameters[31] },
+        { "TITAN X (Pascal)",                                TransposeParameters[18] },
+        { "Tesla K20m",                                      TransposeParameters[18] },
+        { "Tesla K40m",                                      TransposeParameters[19] },
+        { "default",                                         TransposeParameters[19] },
       }
     },
     { // Default
       kDeviceTypeAll, "default", {
-        { "default",                                         { {"TRA_DIM",16}, {"TRA_PAD",1}, {"TRA_SHUFFLE",1}, {"TRA_WPT",2} } },
+        { "default",                                         TransposeParameters[19] },
       }
     },
   }
@@ -268,56 +313,56 @@ const Database::DatabaseEntry TransposeComplexDouble = {
   "Transpose", Precision::kComplexDouble, {
     { // AMD GPUs
       kDeviceTypeGPU, "AMD", {
-        { "AMD Radeon R9 M370X Compute Engine",              { {"TRA_DIM",4}, {"TRA_PAD",1}, {"TRA_SHUFFLE",1}, {"TRA_WPT",2} } },
-        { "Ellesmere",                                       { {"TRA_DIM",16}, {"TRA_PAD",0}, {"TRA_SHUFFLE",1}, {"TRA_WPT",1} } },
-        { "Fiji",                                            { {"TRA_DIM",16}, {"TRA_PAD",0}, {"TRA_SHUFFLE",1}, {"TRA_WPT",1} } },
-        { "Hawaii",                                          { {"TRA_DIM",4}, {"TRA_PAD",0}, {"TRA_SHUFFLE",1}, {"TRA_WPT",2} } },
-        { "Oland",                                           { {"TRA_DIM",16}, {"TRA_PAD",0}, {"TRA_SHUFFLE",1}, {"TRA_WPT",1} } },
-        { "Pitcairn",                                        { {"TRA_DIM",4}, {"TRA_PAD",0}, {"TRA_SHUFFLE",1}, {"TRA_WPT",1} } },
-        { "Tahiti",                                          { {"TRA_DIM",16}, {"TRA_PAD",0}, {"TRA_SHUFFLE",1}, {"TRA_WPT",1} } },
-        { "Tonga",                                           { {"TRA_DIM",8}, {"TRA_PAD",1}, {"TRA_SHUFFLE",1}, {"TRA_WPT",2} } },
-        { "default",                                         { {"TRA_DIM",16}, {"TRA_PAD",0}, {"TRA_SHUFFLE",1}, {"TRA_WPT",1} } },
+        { "AMD Radeon R9 M370X Compute Engine",              TransposeParameters[35] },
+        { "Ellesmere",                                       TransposeParameters[8] },
+        { "Fiji",                                            TransposeParameters[8] },
+        { "Hawaii",                                          TransposeParameters[24] },
+        { "Oland",                                           TransposeParameters[8] },
+        { "Pitcairn",                                        TransposeParameters[36] },
+        { "Tahiti",                                          TransposeParameters[8] },
+        { "Tonga",                                           TransposeParameters[10] },
+        { "default",                                         TransposeParameters[8] },
       }
     },
     { // ARM GPUs
       kDeviceTypeGPU, "ARM", {
-        { "Mali-T628",                                       { {"TRA_DIM",8}, {"TRA_PAD",0}, {"TRA_SHUFFLE",0}, {"TRA_WPT",1} } },
-        { "default",                                         { {"TRA_DIM",8}, {"TRA_PAD",0}, {"TRA_SHUFFLE",0}, {"TRA_WPT",1} } },
+        { "Mali-T628",                                       TransposeParameters[33] },
+        { "default",                                         TransposeParameters[33] },
       }
     },
     { // Intel CPUs
       kDeviceTypeCPU, "Intel", {
-        { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       { {"TRA_DIM",4}, {"TRA_PAD",0}, {"TRA_SHUFFLE",1}, {"TRA_WPT",8} } },
-        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {"TRA_DIM",4}, {"TRA_PAD",0}, {"TRA_SHUFFLE",0}, {"TRA_WPT",4} } },
-        { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         { {"TRA_DIM",4}, {"TRA_PAD",1}, {"TRA_SHUFFLE",0}, {"TRA_WPT",4} } },
-        { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        { {"TRA_DIM",4}, {"TRA_PAD",0}, {"TRA_SHUFFLE",1}, {"TRA_WPT",8} } },
-        { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        { {"TRA_DIM",16}, {"TRA_PAD",1}, {"TRA_SHUFFLE",0}, {"TRA_WPT",2} } },
-        { "default",                                         { {"TRA_DIM",4}, {"TRA_PAD",0}, {"TRA_SHUFFLE",0}, {"TRA_WPT",8} } },
+        { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       TransposeParameters[0] },
+        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        TransposeParameters[17] },
+        { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         TransposeParameters[37] },
+        { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        TransposeParameters[0] },
+        { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        TransposeParameters[18] },
+        { "default",                                         TransposeParameters[12] },
       }
     },
     { // NVIDIA GPUs
       kDeviceTypeGPU, "NVIDIA", {
-        { "GRID K520",                                       { {"TRA_DIM",16}, {"TRA_PAD",1}, {"TRA_SHUFFLE",1}, {"TRA_WPT",1} } },
-        { "GeForce GTX 1070",                                { {"TRA_DIM",8}, {"TRA_PAD",0}, {"TRA_SHUFFLE",0}, {"TRA_WPT",1} } },
-        { "GeForce GTX 1080",                                { {"TRA_DIM",8}, {"TRA_PAD",0}, {"TRA_SHUFFLE",0}, {"TRA_WPT",1} } },
-        { "GeForce GTX 480",                                 { {"TRA_DIM",8}, {"TRA_PAD",1}, {"TRA_SHUFFLE",0}, {"TRA_WPT",1} } },
-        { "GeForce GTX 670",                                 { {"TRA_DIM",16}, {"TRA_PAD",1}, {"TRA_SHUFFLE",1}, {"TRA_WPT",1} } },
-        { "GeForce GTX 680",                                 { {"TRA_DIM",16}, {"TRA_PAD",1}, {"TRA_SHUFFLE",1}, {"TRA_WPT",1} } },
-        { "GeForce GTX 750",                                 { {"TRA_DIM",16}, {"TRA_PAD",1}, {"TRA_SHUFFLE",0}, {"TRA_WPT",1} } },
-        { "GeForce GTX 750 Ti",                              { {"TRA_DIM",16}, {"TRA_PAD",1}, {"TRA_SHUFFLE",0}, {"TRA_WPT",1} } },
-        { "GeForce GTX 980",                                 { {"TRA_DIM",32}, {"TRA_PAD",1}, {"TRA_SHUFFLE",0}, {"TRA_WPT",1} } },
-        { "GeForce GTX TITAN",                               { {"TRA_DIM",16}, {"TRA_PAD",1}, {"TRA_SHUFFLE",0}, {"TRA_WPT",1} } },
-        { "GeForce GTX TITAN Black",                         { {"TRA_DIM",16}, {"TRA_PAD",0}, {"TRA_SHUFFLE",0}, {"TRA_WPT",1} } },
-        { "GeForce GTX TITAN X",                             { {"TRA_DIM",32}, {"TRA_PAD",1}, {"TRA_SHUFFLE",0}, {"TRA_WPT",1} } },
-        { "TITAN X (Pascal)",                                { {"TRA_DIM",8}, {"TRA_PAD",0}, {"TRA_SHUFFLE",0}, {"TRA_WPT",1} } },
-        { "Tesla K20m",                                      { {"TRA_DIM",16}, {"TRA_PAD",1}, {"TRA_SHUFFLE",0}, {"TRA_WPT",1} } },
-        { "Tesla K40m",                                      { {"TRA_DIM",16}, {"TRA_PAD",1}, {"TRA_SHUFFLE",0}, {"TRA_WPT",1} } },
-        { "default",                                         { {"TRA_DIM",16}, {"TRA_PAD",1}, {"TRA_SHUFFLE",0}, {"TRA_WPT",1} } },
+        { "GRID K520",                                       TransposeParameters[15] },
+        { "GeForce GTX 1070",                                TransposeParameters[33] },
+        { "GeForce GTX 1080",                                TransposeParameters[33] },
+        { "GeForce GTX 480",                                 TransposeParameters[38] },
+        { "GeForce GTX 670",                                 TransposeParameters[15] },
+        { "GeForce GTX 680",                                 TransposeParameters[15] },
+        { "GeForce GTX 750",                                 TransposeParameters[30] },
+        { "GeForce GTX 750 Ti",                              TransposeParameters[30] },
+        { "GeForce GTX 980",                                 TransposeParameters[31] },
+        { "GeForce GTX TITAN",                               TransposeParameters[30] },
+        { "GeForce GTX TITAN Black",                         TransposeParameters[21] },
+        { "GeForce GTX TITAN X",                             TransposeParameters[31] },
+        { "TITAN X (Pascal)",                                TransposeParameters[33] },
+        { "Tesla K20m",                                      TransposeParameters[30] },
+        { "Tesla K40m",                                      TransposeParameters[30] },
+        { "default",                                         TransposeParameters[30] },
       }
     },
     { // Default
       kDeviceTypeAll, "default", {
-        { "default",                                         { {"TRA_DIM",16}, {"TRA_PAD",1}, {"TRA_SHUFFLE",1}, {"TRA_WPT",1} } },
+        { "default",                                         TransposeParameters[15] },
       }
     },
   }
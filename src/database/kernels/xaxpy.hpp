@@ -15,24 +15,66 @@ namespace clblast {
 namespace database {
 // =================================================================================================
 
+// The unique parameter sets of these kernels, referred to by index below
+const auto XaxpyParameters = Database::ParameterSets({"VW", "WGS", "WPT"}, {
+  {4, 128, 4}, // 0
+  {1, 64, 1}, // 1
+  {8, 64, 1}, // 2
+  {8, 256, 4}, // 3
+  {1, 128, 1}, // 4
+  {1, 256, 2}, // 5
+  {1, 64, 4}, // 6
+  {4, 64, 1}, // 7
+  {2, 64, 2}, // 8
+  {2, 128, 1}, // 9
+  {2, 64, 1}, // 10
+  {1, 256, 8}, // 11
+  {2, 256, 1}, // 12
+  {4, 256, 1}, // 13
+  {8, 512, 1}, // 14
+  {1, 512, 1}, // 15
+  {2, 1024, 1}, // 16
+  {1, 256, 1}, // 17
+  {1, 128, 2}, // 18
+  {2, 1024, 2}, // 19
+  {1, 1024, 1}, // 20
+  {4, 128, 1}, // 21
+  {4, 1024, 1}, // 22
+  {2, 64, 8}, // 23
+  {1, 1024, 2}, // 24
+  {8, 1024, 1}, // 25
+  {4, 64, 2}, // 26
+  {1, 64, 2}, // 27
+  {2, 512, 1}, // 28
+  {2, 64, 4}, // 29
+  {1, 128, 4}, // 30
+  {2, 128, 2}, // 31
+  {8, 256, 1}, // 32
+  {8, 2048, 1}, // 33
+  {1, 64, 8}, // 34
+  {8, 128, 1}, // 35
+});
+
+// =================================================================================================
+
 const Database::DatabaseEntry XaxpyHalf = {
   "Xaxpy", Precision::kHalf, {
     { // AMD GPUs
       kDeviceTypeGPU, "AMD", {
-        { "Ellesmere",                                       { {"VW",4}, {"WGS",128}, {"WPT",4} } },
-        { "default",                                         { {"VW",4}, {"WGS",128}, {"WPT",4} } },
+        { "Ellesmere",                                       XaxpyParameters[0] },
+        { "default",                                         XaxpyParameters[0] },
       }
     },
     { // Intel GPUs
       kDeviceTypeGPU, "Intel", {
-        { "Intel(R) HD Graphics 5500 BroadWell U-Processor GT2", { {"VW",1}, {"WGS",64}, {"WPT",1} } },
-        { "Intel(R) HD Graphics Skylake ULT GT2",            { {"VW",8}, {"WGS",64}, {"WPT",1} } },
-        { "default",                                         { {"VW",8}, {"WGS",64}, {"WPT",1} } },
+        { "Intel(R) HD Graphics 5500 BroadWell U-Processor GT2", XaxpyParameters[1] },
+        { "Intel(R) HD Graphics Skylake ULT GT2",            XaxpyParameters[2] },
+        { "default",                                         XaxpyParameters[2] },
       }
     },
     { // Default
       kDeviceTypeAll, "default", {
-        { "default",                                         { {"VW",8}, {"WGS",256}, {"WPT",4} } },
+        { "default",                                         XaxpyParameters[3] },
       }
     },
   }
@@ -44,77 +86,77 @@ const Database::DatabaseEntry XaxpySingle = {
   "Xaxpy", Precision::kSingle, {
     { // AMD GPUs
       kDeviceTypeGPU, "AMD", {
-        { "AMD Radeon R9 M370X Compute Engine",              { {"VW",1}, {"WGS",128}, {"WPT",1} } },
-        { "ATI Radeon HD 6750M",                             { {"VW",1}, {"WGS",256}, {"WPT",2} } },
-        { "Ellesmere",                                       { {"VW",1}, {"WGS",64}, {"WPT",4} } },
-        { "Fiji",                                            { {"VW",4}, {"WGS",64}, {"WPT",1} } },
-        { "Hawaii",                                          { {"VW",2}, {"WGS",64}, {"WPT",2} } },
-        { "Oland",                                           { {"VW",1}, {"WGS",128}, {"WPT",1} } },
-        { "Pitcairn",                                        { {"VW",2}, {"WGS",128}, {"WPT",1} } },
-        { "Tahiti",                                          { {"VW",2}, {"WGS",64}, {"WPT",1} } },
-        { "Tonga",                                           { {"VW",1}, {"WGS",256}, {"WPT",8} } },
-        { "Turks",                                           { {"VW",2}, {"WGS",256}, {"WPT",1} } },
-        { "default",                                         { {"VW",2}, {"WGS",256}, {"WPT",1} } },
+        { "AMD Radeon R9 M370X Compute Engine",              XaxpyParameters[4] },
+        { "ATI Radeon HD 6750M",                             XaxpyParameters[5] },
+        { "Ellesmere",                                       XaxpyParameters[6] },
+        { "Fiji",                                            XaxpyParameters[7] },
+        { "Hawaii",                                          XaxpyParameters[8] },
+        { "Oland",                                           XaxpyParameters[4] },
+        { "Pitcairn",                                        XaxpyParameters[9] },
+        { "Tahiti",                                          XaxpyParameters[10] },
+        { "Tonga",                                           XaxpyParameters[11] },
+        { "Turks",                                           XaxpyParameters[12] },
+        { "default",                                         XaxpyParameters[12] },
       }
     },
     { // ARM GPUs
       kDeviceTypeGPU, "ARM", {
-        { "Mali-T628",                                       { {"VW",4}, {"WGS",256}, {"WPT",1} } },
-        { "default",                                         { {"VW",4}, {"WGS",256}, {"WPT",1} } },
+        { "Mali-T628",                                       XaxpyParameters[13] },
+        { "default",                                         XaxpyParameters[13] },
       }
     },
     { // Intel CPUs
       kDeviceTypeCPU, "Intel", {
-        { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       { {"VW",8}, {"WGS",512}, {"WPT",1} } },
-        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {"VW",1}, {"WGS",512}, {"WPT",1} } },
-        { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         { {"VW",4}, {"WGS",256}, {"WPT",1} } },
-        { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        { {"VW",2}, {"WGS",1024}, {"WPT",1} } },
-        { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        { {"VW",1}, {"WGS",128}, {"WPT",1} } },
-        { "default",                                         { {"VW",8}, {"WGS",512}, {"WPT",1} } },
+        { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       XaxpyParameters[14] },
+        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        XaxpyParameters[15] },
+        { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         XaxpyParameters[13] },
+        { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        XaxpyParameters[16] },
+        { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        XaxpyParameters[4] },
+        { "default",                                         XaxpyParameters[14] },
       }
     },
     { // Intel GPUs
       kDeviceTypeGPU, "Intel", {
-        { "Intel(R) HD Graphics 530",                        { {"VW",1}, {"WGS",128}, {"WPT",1} } },
-        { "Intel(R) HD Graphics 5500 BroadWell U-Processor GT2", { {"VW",1}, {"WGS",256}, {"WPT",1} } },
-        { "Intel(R) HD Graphics Haswell Ultrabook GT2 Mobile", { {"VW",1}, {"WGS",64}, {"WPT",1} } },
-        { "Intel(R) HD Graphics IvyBridge M GT2",            { {"VW",1}, {"WGS",64}, {"WPT",1} } },
-        { "Intel(R) HD Graphics Skylake ULT GT2",            { {"VW",8}, {"WGS",512}, {"WPT",1} } },
-        { "Iris",                                            { {"VW",1}, {"WGS",64}, {"WPT",1} } },
-        { "Iris Pro",                                        { {"VW",1}, {"WGS",128}, {"WPT",2} } },
-        { "default",                                         { {"VW",4}, {"WGS",256}, {"WPT",1} } },
+        { "Intel(R) HD Graphics 530",                        XaxpyParameters[4] },
+        { "Intel(R) HD Graphics 5500 BroadWell U-Processor GT2", XaxpyParameters[17] },
+        { "Intel(R) HD Graphics Haswell Ultrabook GT2 Mobile", XaxpyParameters[1] },
+        { "Intel(R) HD Graphics IvyBridge M GT2",            XaxpyParameters[1] },
+        { "Intel(R) HD Graphics Skylake ULT GT2",            XaxpyParameters[14] },
+        { "Iris",                                            XaxpyParameters[1] },
+        { "Iris Pro",                                        XaxpyParameters[18] },
+        { "default",                                         XaxpyParameters[13] },
       }
     },
     { // Intel accelerators
       kDeviceTypeAccelerator, "Intel", {
-        { "Intel(R) Many Integrated Core Acceleration Card", { {"VW",2}, {"WGS",1024}, {"WPT",2} } },
-        { "default",                                         { {"VW",2}, {"WGS",1024}, {"WPT",2} } },
+        { "Intel(R) Many Integrated Core Acceleration Card", XaxpyParameters[19] },
+        { "default",                                         XaxpyParameters[19] },
       }
     },
     { // NVIDIA GPUs
       kDeviceTypeGPU, "NVIDIA", {
-        { "GRID K520",                                       { {"VW",2}, {"WGS",64}, {"WPT",1} } },
-        { "GeForce GT 650M",                                 { {"VW",2}, {"WGS",1024}, {"WPT",1} } },
-        { "GeForce GTX 1070",                                { {"VW",1}, {"WGS",64}, {"WPT",4} } },
-        { "GeForce GTX 1080",                                { {"VW",1}, {"WGS",256}, {"WPT",1} } },
-        { "GeForce GTX 480",                                 { {"VW",2}, {"WGS",128}, {"WPT",1} } },
-        { "GeForce GTX 670",                                 { {"VW",2}, {"WGS",64}, {"WPT",1} } },
-        { "GeForce GTX 680",                                 { {"VW",1}, {"WGS",128}, {"WPT",1} } },
-        { "GeForce GTX 750",                                 { {"VW",1}, {"WGS",64}, {"WPT",1} } },
-        { "GeForce GTX 750 Ti",                              { {"VW",2}, {"WGS",64}, {"WPT",1} } },
-        { "GeForce GTX 980",                                 { {"VW",1}, {"WGS",1024}, {"WPT",1} } },
-        { "GeForce GTX TITAN",                               { {"VW",4}, {"WGS",256}, {"WPT",1} } },
-        { "GeForce GTX TITAN Black",                         { {"VW",4}, {"WGS",128}, {"WPT",4} } },
-        { "GeForce GTX TITAN X",                             { {"VW",1}, {"WGS",64}, {"WPT",1} } },
-        { "TITAN X (Pascal)",                                { {"VW",4}, {"WGS",128}, {"WPT",1} } },
-        { "Tesla K20m",                                      { {"VW",4}, {"WGS",128}, {"WPT",1} } },
-        { "Tesla K40m",                                      { {"VW",4}, {"WGS",128}, {"WPT",1} } },
-        { "default",                                         { {"VW",4}, {"WGS",1024}, {"WPT",1} } },
+        { "GRID K520",                                       XaxpyParameters[10] },
+        { "GeForce GT 650M",                                 XaxpyParameters[16] },
+        { "GeForce GTX 1070",                                XaxpyParameters[6] },
+        { "GeForce GTX 1080",                                XaxpyParameters[17] },
+        { "GeForce GTX 480",                                 XaxpyParameters[9] },
+        { "GeForce GTX 670",                                 XaxpyParameters[10] },
+        { "GeForce GTX 680",                                 XaxpyParameters[4] },
+        { "GeForce GTX 750",                                 XaxpyParameters[1] },
+        { "GeForce GTX 750 Ti",                              XaxpyParameters[10] },
+        { "GeForce GTX 980",                                 XaxpyParameters[20] },
+        { "GeForce GTX TITAN",                               XaxpyParameters[13] },
+        { "GeForce GTX TITAN Black",                         XaxpyParameters[0] },
+        { "GeForce GTX TITAN X",                             XaxpyParameters[1] },
+        { "TITAN X (Pascal)",                                XaxpyParameters[21] },
+        { "Tesla K20m",                                      XaxpyParameters[21] },
+        { "Tesla K40m",                                      XaxpyParameters[21] },
+        { "default",                                         XaxpyParameters[22] },
       }
     },
     { // Default
       kDeviceTypeAll, "default", {
-        { "default",                                         { {"VW",4}, {"WGS",256}, {"WPT",1} } },
+        { "default",                                         XaxpyParameters[13] },
       }
     },
   }
@@ -126,76 +168,76 @@ const Database::DatabaseEntry XaxpyComplexSingle = {
   "Xaxpy", Precision::kComplexSingle, {
     { // AMD GPUs
       kDeviceTypeGPU, "AMD", {
-        { "AMD Radeon R9 M370X Compute Engine",              { {"VW",2}, {"WGS",64}, {"WPT",8} } },
-        { "ATI Radeon HD 6750M",                             { {"VW",1}, {"WGS",64}, {"WPT",1} } },
-        { "Ellesmere",                                       { {"VW",2}, {"WGS",256}, {"WPT",1} } },
-        { "Fiji",                                            { {"VW",1}, {"WGS",128}, {"WPT",2} } },
-        { "Hawaii",                                          { {"VW",1}, {"WGS",128}, {"WPT",2} } },
-        { "Oland",                                           { {"VW",1}, {"WGS",128}, {"WPT",1} } },
-        { "Pitcairn",                                        { {"VW",1}, {"WGS",64}, {"WPT",1} } },
-        { "Tahiti",                                          { {"VW",1}, {"WGS",64}, {"WPT",1} } },
-        { "Tonga",                                           { {"VW",1}, {"WGS",256}, {"WPT",8} } },
-        { "Turks",                                           { {"VW",2}, {"WGS",256}, {"WPT",1} } },
-        { "default",                                         { {"VW",1}, {"WGS",128}, {"WPT",1} } },
+        { "AMD Radeon R9 M370X Compute Engine",              XaxpyParameters[23] },
+        { "ATI Radeon HD 6750M",                             XaxpyParameters[1] },
+        { "Ellesmere",                                       XaxpyParameters[12] },
+        { "Fiji",                                            XaxpyParameters[18] },
+        { "Hawaii",                                          XaxpyParameters[18] },
+        { "Oland",                                           XaxpyParameters[4] },
+        { "Pitcairn",                                        XaxpyParameters[1] },
+        { "Tahiti",                                          XaxpyParameters[1] },
+        { "Tonga",                                           XaxpyParameters[11] },
+        { "Turks",                                           XaxpyParameters[12] },
+        { "default",                                         XaxpyParameters[4] },
       }
     },
     { // ARM GPUs
       kDeviceTypeGPU, "ARM", {
-        { "Mali-T628",                                       { {"VW",1}, {"WGS",256}, {"WPT",1} } },
-        { "default",                                         { {"VW",1}, {"WGS",256}, {"WPT",1} } },
+        { "Mali-T628",                                       XaxpyParameters[17] },
+        { "default",                                         XaxpyParameters[17] },
       }
     },
     { // Intel CPUs
       kDeviceTypeCPU, "Intel", {
-        { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       { {"VW",4}, {"WGS",1024}, {"WPT",1} } },
-        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {"VW",4}, {"WGS",256}, {"WPT",1} } },
-        { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         { {"VW",1}, {"WGS",1024}, {"WPT",2} } },
-        { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        { {"VW",4}, {"WGS",1024}, {"WPT",1} } },
-        { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        { {"VW",2}, {"WGS",1024}, {"WPT",1} } },
-        { "default",                                         { {"VW",8}, {"WGS",1024}, {"WPT",1} } },
+        { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       XaxpyParameters[22] },
+        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        XaxpyParameters[13] },
+        { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         XaxpyParameters[24] },
+        { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        XaxpyParameters[22] },
+        { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        XaxpyParameters[16] },
+        { "default",                                         XaxpyParameters[25] },
       }
     },
     { // Intel GPUs
       kDeviceTypeGPU, "Intel", {
-        { "Intel(R) HD Graphics 530",                        { {"VW",4}, {"WGS",64}, {"WPT",2} } },
-        { "Intel(R) HD Graphics 5500 BroadWell U-Processor GT2", { {"VW",1}, {"WGS",64}, {"WPT",1} } },
-        { "Intel(R) HD Graphics Haswell Ultrabook GT2 Mobile", { {"VW",1}, {"WGS",64}, {"WPT",1} } },
-        { "Intel(R) HD Graphics IvyBridge M GT2",            { {"VW",1}, {"WGS",64}, {"WPT",1} } },
-        { "Intel(R) HD Graphics Skylake ULT GT2",            { {"VW",4}, {"WGS",64}, {"WPT",1} } },
-        { "Iris",                                            { {"VW",2}, {"WGS",128}, {"WPT",1} } },
-        { "Iris Pro",                                        { {"VW",1}, {"WGS",256}, {"WPT",8} } },
-        { "default",                                         { {"VW",4}, {"WGS",64}, {"WPT",1} } },
+        { "Intel(R) HD Graphics 530",                        XaxpyParameters[26] },
+        { "Intel(R) HD Graphics 5500 BroadWell U-Processor GT2", XaxpyParameters[1] },
+        { "Intel(R) HD Graphics Haswell Ultrabook GT2 Mobile", XaxpyParameters[1] },
+        { "Intel(R) HD Graphics IvyBridge M GT2",            XaxpyParameters[1] },
+        { "Intel(R) HD Graphics Skylake ULT GT2",            XaxpyParameters[7] },
+        { "Iris",                                            XaxpyParameters[9] },
+        { "Iris Pro",                                        XaxpyParameters[11] },
+        { "default",                                         XaxpyParameters[7] },
       }
     },
     { // Intel accelerators
       kDeviceTypeAccelerator, "Intel", {
-        { "Intel(R) Many Integrated Core Acceleration Card", { {"VW",1}, {"WGS",1024}, {"WPT",1} } },
-        { "default",                                         { {"VW",1}, {"WGS",1024}, {"WPT",1} } },
+        { "Intel(R) Many Integrated Core Acceleration Card", XaxpyParameters[20] },
+        { "default",                                         XaxpyParameters[20] },
       }
     },
     { // NVIDIA GPUs
       kDeviceTypeGPU, "NVIDIA", {
-        { "GRID K520",                                       { {"VW",1}, {"WGS",512}, {"WPT",1} } },
-        { "GeForce GTX 1070",                                { {"VW",1}, {"WGS",64}, {"WPT",2} } },
-        { "GeForce GTX 1080",                                { {"VW",2}, {"WGS",64}, {"WPT",1} } },
-        { "GeForce GTX 480",                                 { {"VW",1}, {"WGS",256}, {"WPT",1} } },
-        { "GeForce GTX 670",                                 { {"VW",1}, {"WGS",256}, {"WPT",1} } },
-        { "GeForce GTX 680",                                 { {"VW",1}, {"WGS",256}, {"WPT",1} } },
-        { "GeForce GTX 750",                                 { {"VW",1}, {"WGS",512}, {"WPT",1} } },
-        { "GeForce GTX 750 Ti",                              { {"VW",1}, {"WGS",512}, {"WPT",1} } },
-        { "GeForce GTX 980",                                 { {"VW",1}, {"WGS",64}, {"WPT",1} } },
-        { "GeForce GTX TITAN",                               { {"VW",1}, {"WGS",256}, {"WPT",1} } },
-        { "GeForce GTX TITAN Black",                         { {"VW",1}, {"WGS",128}, {"WPT",2} } },
-        { "GeForce GTX TITAN X",                             { {"VW",1}, {"WGS",512}, {"WPT",1} } },
-        { "TITAN X (Pascal)",                                { {"VW",2}, {"WGS",512}, {"WPT",1} } },
-        { "Tesla K20m",                                      { {"VW",1}, {"WGS",128}, {"WPT",1} } },
-        { "Tesla K40m",                                      { {"VW",1}, {"WGS",128}, {"WPT",1} } },
-        { "default",                                         { {"VW",1}, {"WGS",256}, {"WPT",1} } },
+        { "GRID K520",                                       XaxpyParameters[15] },
+        { "GeForce GTX 1070",                                XaxpyParameters[27] },
+        { "GeForce GTX 1080",                                XaxpyParameters[10] },
+        { "GeForce GTX 480",                                 XaxpyParameters[17] },
+        { "GeForce GTX 670",                                 XaxpyParameters[17] },
+        { "GeForce GTX 680",                                 XaxpyParameters[17] },
+        { "GeForce GTX 750",                                 XaxpyParameters[15] },
+        { "GeForce GTX 750 Ti",                              XaxpyParameters[15] },
+        { "GeForce GTX 980",                                 XaxpyParameters[1] },
+        { "GeForce GTX TITAN",                               XaxpyParameters[17] },
+        { "GeForce GTX TITAN Black",                         XaxpyParameters[18] },
+        { "GeForce GTX TITAN X",                             XaxpyParameters[15] },
+        { "TITAN X (Pascal)",                                XaxpyParameters[28] },
+        { "Tesla K20m",                                      XaxpyParameters[4] },
+        { "Tesla K40m",                                      XaxpyParameters[4] },
+        { "default",                                         XaxpyParameters[17] },
       }
     },
     { // Default
       kDeviceTypeAll, "default", {
-        { "default",                                         { {"VW",1}, {"WGS",128}, {"WPT",1} } },
+        { "default",                                         XaxpyParameters[4] },
       }
     },
   }
@@ -207,62 +249,62 @@ const Database::DatabaseEntry XaxpyDouble = {
   "Xaxpy", Precision::kDouble, {
     { // AMD GPUs
       kDeviceTypeGPU, "AMD", {
-        { "AMD Radeon R9 M370X Compute Engine",              { {"VW",1}, {"WGS",256}, {"WPT",1} } },
-        { "Ellesmere",                                       { {"VW",2}, {"WGS",64}, {"WPT",4} } },
-        { "Fiji",                                            { {"VW",2}, {"WGS",64}, {"WPT",4} } },
-        { "Hawaii",                                          { {"VW",1}, {"WGS",64}, {"WPT",2} } },
-        { "Oland",                                           { {"VW",1}, {"WGS",64}, {"WPT",1} } },
-        { "Pitcairn",                                        { {"VW",1}, {"WGS",128}, {"WPT",1} } },
-        { "Tahiti",                                          { {"VW",1}, {"WGS",64}, {"WPT",1} } },
-        { "Tonga",                                           { {"VW",1}, {"WGS",128}, {"WPT",4} } },
-        { "default",                                         { {"VW",2}, {"WGS",64}, {"WPT",1} } },
+        { "AMD Radeon R9 M370X Compute Engine",              XaxpyParameters[17] },
+        { "Ellesmere",                                       XaxpyParameters[29] },
+        { "Fiji",                                            XaxpyParameters[29] },
+        { "Hawaii",                                          XaxpyParameters[27] },
+        { "Oland",                                           XaxpyParameters[1] },
+        { "Pitcairn",                                        XaxpyParameters[4] },
+        { "Tahiti",                                          XaxpyParameters[1] },
+        { "Tonga",                                           XaxpyParameters[30] },
+        { "default",                                         XaxpyParameters[10] },
       }
     },
     { // ARM GPUs
       kDeviceTypeGPU, "ARM", {
-        { "Mali-T628",                                       { {"VW",2}, {"WGS",128}, {"WPT",2} } },
-        { "default",                                         { {"VW",2}, {"WGS",128}, {"WPT",2} } },
+        { "Mali-T628",                                       XaxpyParameters[31] },
+        { "default",                                         XaxpyParameters[31] },
       }
     },
     { // Intel CPUs
       kDeviceTypeCPU, "Intel", {
-        { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       { {"VW",4}, {"WGS",64}, {"WPT",1} } },
-        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {"VW",1}, {"WGS",1024}, {"WPT",1} } },
-        { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         { {"VW",8}, {"WGS",64}, {"WPT",1} } },
-        { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        { {"VW",8}, {"WGS",256}, {"WPT",1} } },
-        { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        { {"VW",8}, {"WGS",2048}, {"WPT",1} } },
-        { "default",                                         { {"VW",8}, {"WGS",64}, {"WPT",1} } },
+        { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       XaxpyParameters[7] },
+        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        XaxpyParameters[20] },
+        { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         XaxpyParameters[2] },
+        { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        XaxpyParameters[32] },
+        { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        XaxpyParameters[33] },
+        { "default",                                         XaxpyParameters[2] },
       }
     },
     { // Intel accelerators
       kDeviceTypeAccelerator, "Intel", {
-        { "Intel(R) Many Integrated Core Acceleration Card", { {"VW",2}, {"WGS",512}, {"WPT",1} } },
-        { "default",                                         { {"VW",2}, {"WGS",512}, {"WPT",1} } },
+        { "Intel(R) Many Integrated Core Acceleration Card", XaxpyParameters[28] },
+        { "default",                                         XaxpyParameters[28] },
       }
     },
     { // NVIDIA GPUs
       kDeviceTypeGPU, "NVIDIA", {
-        { "GRID K520",                                       { {"VW",1}, {"WGS",64}, {"WPT",1} } },
-        { "GeForce GTX 1070",                                { {"VW",1}, {"WGS",64}, {"WPT",8} } },
-        { "GeForce GTX 1080",                                { {"VW",1}, {"WGS",128}, {"WPT",1} } },
-        { "GeForce GTX 480",                                 { {"VW",1}, {"WGS",128}, {"WPT",1} } },
-        { "GeForce GTX 670",                                 { {"VW",1}, {"WGS",64}, {"WPT",1} } },
-        { "GeForce GTX 680",                                 { {"VW",1}, {"WGS",64}, {"WPT",1} } },
-        { "GeForce GTX 750",                                 { {"VW",1}, {"WGS",128}, {"WPT",1} } },
-        { "GeForce GTX 750 Ti",                              { {"VW",1}, {"WGS",256}, {"WPT",2} } },
-        { "GeForce GTX 980",                                 { {"VW",1}, {"WGS",256}, {"WPT",1} } },
-        { "GeForce GTX TITAN",                               { {"VW",2}, {"WGS",1024}, {"WPT",1} } },
-        { "GeForce GTX TITAN Black",                         { {"VW",2}, {"WGS",128}, {"WPT",1} } },
-        { "GeForce GTX TITAN X",                             { {"VW",1}, {"WGS",512}, {"WPT",1} } },
-        { "TITAN X (Pascal)",                                { {"VW",2}, {"WGS",512}, {"WPT",1} } },
-        { "Tesla K20m",                                      { {"VW",2}, {"WGS",128}, {"WPT",1} } },
-        { "Tesla K40m",                                      { {"VW",2}, {"WGS",128}, {"WPT",1} } },
-        { "default",                                         { {"VW",1}, {"WGS",128}, {"WPT",1} } },
+        { "GRID K520",                                       XaxpyParameters[1] },
+        { "GeForce GTX 1070",                                XaxpyParameters[34] },
+        { "GeForce GTX 1080",                                XaxpyParameters[4] },
+        { "GeForce GTX 480",                                 XaxpyParameters[4] },
+        { "GeForce GTX 670",                                 XaxpyParameters[1] },
+        { "GeForce GTX 680",                                 XaxpyParameters[1] },
+        { "GeForce GTX 750",                                 XaxpyParameters[4] },
+        { "GeForce GTX 750 Ti",                              XaxpyParameters[5] },
+        { "GeForce GTX 980",                                 XaxpyParameters[17] },
+        { "GeForce GTX TITAN",                               XaxpyParameters[16] },
+        { "GeForce GTX TITAN Black",                         XaxpyParameters[9] },
+        { "GeForce GTX TITAN X",                             XaxpyParameters[15] },
+        { "TITAN X (Pascal)",                                XaxpyParameters[28] },
+        { "Tesla K20m",                                      XaxpyParameters[9] },
+        { "Tesla K40m",                                      XaxpyParameters[9] },
+        { "default",                                         XaxpyParameters[4] },
       }
     },
     { // Default
       kDeviceTypeAll, "default", {
-        { "default",                                         { {"VW",2}, {"WGS",256}, {"WPT",1} } },
+        { "default",                                         XaxpyParameters[12] },
       }
     },
   }
@@ -274,62 +316,62 @@ const Database::DatabaseEntry XaxpyComplexDouble = {
   "Xaxpy", Precision::kComplexDouble, {
     { // AMD GPUs
       kDeviceTypeGPU, "AMD", {
-        { "AMD Radeon R9 M370X Compute Engine",              { {"VW",1}, {"WGS",128}, {"WPT",1} } },
-        { "Ellesmere",                                       { {"VW",1}, {"WGS",128}, {"WPT",1} } },
-        { "Fiji",                                            { {"VW",1}, {"WGS",64}, {"WPT",1} } },
-        { "Hawaii",                                          { {"VW",2}, {"WGS",64}, {"WPT",1} } },
-        { "Oland",                                           { {"VW",1}, {"WGS",256}, {"WPT",1} } },
-        { "Pitcairn",                                        { {"VW",1}, {"WGS",128}, {"WPT",1} } },
-        { "Tahiti",                                          { {"VW",1}, {"WGS",128}, {"WPT",1} } },
-        { "Tonga",                                           { {"VW",1}, {"WGS",64}, {"WPT",1} } },
-        { "default",                                         { {"VW",1}, {"WGS",128}, {"WPT",1} } },
+        { "AMD Radeon R9 M370X Compute Engine",              XaxpyParameters[4] },
+        { "Ellesmere",                                       XaxpyParameters[4] },
+        { "Fiji",                                            XaxpyParameters[1] },
+        { "Hawaii",                                          XaxpyParameters[10] },
+        { "Oland",                                           XaxpyParameters[17] },
+        { "Pitcairn",                                        XaxpyParameters[4] },
+        { "Tahiti",                                          XaxpyParameters[4] },
+        { "Tonga",                                           XaxpyParameters[1] },
+        { "default",                                         XaxpyParameters[4] },
       }
     },
     { // ARM GPUs
       kDeviceTypeGPU, "ARM", {
-        { "Mali-T628",                                       { {"VW",1}, {"WGS",64}, {"WPT",8} } },
-        { "default",                                         { {"VW",1}, {"WGS",64}, {"WPT",8} } },
+        { "Mali-T628",                                       XaxpyParameters[34] },
+        { "default",                                         XaxpyParameters[34] },
       }
     },
     { // Intel CPUs
       kDeviceTypeCPU, "Intel", {
-        { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       { {"VW",4}, {"WGS",1024}, {"WPT",1} } },
-        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {"VW",8}, {"WGS",128}, {"WPT",1} } },
-        { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         { {"VW",8}, {"WGS",512}, {"WPT",1} } },
-        { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        { {"VW",8}, {"WGS",1024}, {"WPT",1} } },
-        { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        { {"VW",1}, {"WGS",256}, {"WPT",1} } },
-        { "default",                                         { {"VW",4}, {"WGS",1024}, {"WPT",1} } },
+        { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       XaxpyParameters[22] },
+        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        XaxpyParameters[35] },
+        { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         XaxpyParameters[14] },
+        { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        XaxpyParameters[25] },
+        { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        XaxpyParameters[17] },
+        { "default",                                         XaxpyParameters[22] },
       }
     },
     { // Intel accelerators
       kDeviceTypeAccelerator, "Intel", {
-        { "Intel(R) Many Integrated Core Acceleration Card", { {"VW",1}, {"WGS",1024}, {"WPT",1} } },
-        { "default",                                         { {"VW",1}, {"WGS",1024}, {"WPT",1} } },
+        { "Intel(R) Many Integrated Core Acceleration Card", XaxpyParameters[20] },
+        { "default",                                         XaxpyParameters[20] },
       }
     },
     { // NVIDIA GPUs
       kDeviceTypeGPU, "NVIDIA", {
-        { "GRID K520",                                       { {"VW",1}, {"WGS",64}, {"WPT",1} } },
-        { "GeForce GTX 1070",                                { {"VW",1}, {"WGS",64}, {"WPT",2} } },
-        { "GeForce GTX 1080",                                { {"VW",1}, {"WGS",256}, {"WPT",1} } },
-        { "GeForce GTX 480",                                 { {"VW",1}, {"WGS",128}, {"WPT",1} } },
-        { "GeForce GTX 670",                                 { {"VW",1}, {"WGS",256}, {"WPT",1} } },
-        { "GeForce GTX 680",                                 { {"VW",1}, {"WGS",64}, {"WPT",1} } },
-        { "GeForce GTX 750",                                 { {"VW",1}, {"WGS",1024}, {"WPT",1} } },
-        { "GeForce GTX 750 Ti",                              { {"VW",1}, {"WGS",64}, {"WPT",2} } },
-        { "GeForce GTX 980",                                 { {"VW",1}, {"WGS",1024}, {"WPT",1} } },
-        { "GeForce GTX TITAN",                               { {"VW",1}, {"WGS",64}, {"WPT",4} } },
-        { "GeForce GTX TITAN Black",                         { {"VW",1}, {"WGS",128}, {"WPT",4} } },
-        { "GeForce GTX TITAN X",                             { {"VW",1}, {"WGS",1024}, {"WPT",1} } },
-        { "TITAN X (Pascal)",                                { {"VW",1}, {"WGS",256}, {"WPT",2} } },
-        { "Tesla K20m",                                      { {"VW",1}, {"WGS",64}, {"WPT",1} } },
-        { "Tesla K40m",                                      { {"VW",1}, {"WGS",64}, {"WPT",1} } },
-        { "default",                                         { {"VW",1}, {"WGS",64}, {"WPT",1} } },
+        { "GRID K520",                                       XaxpyParameters[1] },
+        { "GeForce GTX 1070",                                XaxpyParameters[27] },
+        { "GeForce GTX 1080",                                XaxpyParameters[17] },
+        { "GeForce GTX 480",                                 XaxpyParameters[4] },
+        { "GeForce GTX 670",                                 XaxpyParameters[17] },
+        { "GeForce GTX 680",                                 XaxpyParameters[1] },
+        { "GeForce GTX 750",                                 XaxpyParameters[20] },
+        { "GeForce GTX 750 Ti",                              XaxpyParameters[27] },
+        { "GeForce GTX 980",                                 XaxpyParameters[20] },
+        { "GeForce GTX TITAN",                               XaxpyParameters[6] },
+        { "GeForce GTX TITAN Black",                         XaxpyParameters[30] },
+        { "GeForce GTX TITAN X",                             XaxpyParameters[20] },
+        { "TITAN X (Pascal)",                                XaxpyParameters[5] },
+        { "Tesla K20m",                                      XaxpyParameters[1] },
+        { "Tesla K40m",                                      XaxpyParameters[1] },
+        { "default",                                         XaxpyParameters[1] },
       }
     },
     { // Default
       kDeviceTypeAll, "default", {
-        { "default",                                         { {"VW",1}, {"WGS",256}, {"WPT",1} } },
+        { "default",                                         XaxpyParameters[17] },
       }
     },
   }
@@ -15,24 +15,49 @@ namespace clblast {
 namespace database {
 // =================================================================================================
 
+// The unique parameter sets of these kernels, referred to by index below
+const auto XdotParameters = Database::ParameterSets({"WGS1", "WGS2"}, {
+  {256, 64}, // 0
+  {256, 32}, // 1
+  {128, 32}, // 2
+  {64, 32}, // 3
+  {128, 64}, // 4
+  {32, 32}, // 5
+  {1024, 32}, // 6
+  {512, 128}, // 7
+  {512, 64}, // 8
+  {128, 1024}, // 9
+  {512, 32}, // 10
+  {512, 1024}, // 11
+  {128, 128}, // 12
+  {256, 256}, // 13
+  {32, 256}, // 14
+  {64, 128}, // 15
+  {128, 512}, // 16
+  {64, 256}, // 17
+  {32, 128}, // 18
+});
+
+// =================================================================================================
+
 const Database::DatabaseEntry XdotHalf = {
   "Xdot", Precision::kHalf, {
     { // AMD GPUs
       kDeviceTypeGPU, "AMD", {
-        { "Ellesmere",                                       { {"WGS1",256}, {"WGS2",64} } },
-        { "default",                                         { {"WGS1",256}, {"WGS2",64} } },
+        { "Ellesmere",                                       XdotParameters[0] },
+        { "default",                                         XdotParameters[0] },
       }
     },
     { // Intel GPUs
       kDeviceTypeGPU, "Intel", {
-        { "Intel(R) HD Graphics 5500 BroadWell U-Processor GT2", { {"WGS1",256}, {"WGS2",32} } },
-        { "Intel(R) HD Graphics Skylake ULT GT2",            { {"WGS1",128}, {"WGS2",32} } },
-        { "default",                                         { {"WGS1",128}, {"WGS2",32} } },
+        { "Intel(R) HD Graphics 5500 BroadWell U-Processor GT2", XdotParameters[1] },
+        { "Intel(R) HD Graphics Skylake ULT GT2",            XdotParameters[2] },
+        { "default",                                         XdotParameters[2] },
       }
     },
     { // Default
       kDeviceTypeAll, "default", {
-        { "default",                                         { {"WGS1",128}, {"WGS2",32} } },
+        { "default",                                         XdotParameters[2] },
       }
     },
   }
@@ -44,59 +69,59 @@ const Database::DatabaseEntry XdotSingle = {
   "Xdot", Precision::kSingle, {
     { // AMD GPUs
       kDeviceTypeGPU, "AMD", {
-        { "AMD Radeon R9 M370X Compute Engine",              { {"WGS1",128}, {"WGS2",32} } },
-        { "ATI Radeon HD 6750M",                             { {"WGS1",256}, {"WGS2",32} } },
-        { "Ellesmere",                                       { {"WGS1",128}, {"WGS2",32} } },
-        { "Fiji",                                            { {"WGS1",256}, {"WGS2",32} } },
-        { "Oland",                                           { {"WGS1",256}, {"WGS2",32} } },
-        { "Pitcairn",                                        { {"WGS1",128}, {"WGS2",32} } },
-        { "Tahiti",                                          { {"WGS1",128}, {"WGS2",32} } },
-        { "Tonga",                                           { {"WGS1",64}, {"WGS2",32} } },
-        { "Turks",                                           { {"WGS1",128}, {"WGS2",64} } },
-        { "default",                                         { {"WGS1",256}, {"WGS2",32} } },
+        { "AMD Radeon R9 M370X Compute Engine",              XdotParameters[2] },
+        { "ATI Radeon HD 6750M",                             XdotParameters[1] },
+        { "Ellesmere",                                       XdotParameters[2] },
+        { "Fiji",                                            XdotParameters[1] },
+        { "Oland",                                           XdotParameters[1] },
+        { "Pitcairn",                                        XdotParameters[2] },
+        { "Tahiti",                                          XdotParameters[2] },
+        { "Tonga",                                           XdotParameters[3] },
+        { "Turks",                                           XdotParameters[4] },
+        { "default",                                         XdotParameters[1] },
       }
     },
     { // Intel CPUs
       kDeviceTypeCPU, "Intel", {
-        { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       { {"WGS1",32}, {"WGS2",32} } },
-        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {"WGS1",1024}, {"WGS2",32} } },
-        { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        { {"WGS1",64}, {"WGS2",32} } },
-        { "default",                                         { {"WGS1",64}, {"WGS2",32} } },
+        { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       XdotParameters[5] },
+        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        XdotParameters[6] },
+        { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        XdotParameters[3] },
+        { "default",                                         XdotParameters[3] },
       }
     },
     { // Intel GPUs
       kDeviceTypeGPU, "Intel", {
-        { "Intel(R) HD Graphics 530",                        { {"WGS1",64}, {"WGS2",32} } },
-        { "Intel(R) HD Graphics 5500 BroadWell U-Processor GT2", { {"WGS1",256}, {"WGS2",32} } },
-        { "Intel(R) HD Graphics Haswell Ultrabook GT2 Mobile", { {"WGS1",64}, {"WGS2",32} } },
-        { "Intel(R) HD Graphics IvyBridge M GT2",            { {"WGS1",512}, {"WGS2",128} } },
-        { "Intel(R) HD Graphics Skylake ULT GT2",            { {"WGS1",32}, {"WGS2",32} } },
-        { "Iris Pro",                                        { {"WGS1",512}, {"WGS2",64} } },
-        { "default",                                         { {"WGS1",64}, {"WGS2",32} } },
+        { "Intel(R) HD Graphics 530",                        XdotParameters[3] },
+        { "Intel(R) HD Graphics 5500 BroadWell U-Processor GT2", XdotParameters[1] },
+        { "Intel(R) HD Graphics Haswell Ultrabook GT2 Mobile", XdotParameters[3] },
+        { "Intel(R) HD Graphics IvyBridge M GT2",            XdotParameters[7] },
+        { "Intel(R) HD Graphics Skylake ULT GT2",            XdotParameters[5] },
+        { "Iris Pro",                                        XdotParameters[8] },
+        { "default",                                         XdotParameters[3] },
       }
     },
     { // NVIDIA GPUs
       kDeviceTypeGPU, "NVIDIA", {
-        { "GRID K520",                                       { {"WGS1",128}, {"WGS2",32} } },
-        { "GeForce GT 650M",                                 { {"WGS1",128}, {"WGS2",64} } },
-        { "GeForce GTX 1070",                                { {"WGS1",128}, {"WGS2",1024} } },
-        { "GeForce GTX 1080",                                { {"WGS1",512}, {"WGS2",64} } },
-        { "GeForce GTX 480",                                 { {"WGS1",512}, {"WGS2",32} } },
-        { "GeForce GTX 670",                                 { {"WGS1",512}, {"WGS2",1024} } },
-        { "GeForce GTX 680",                                 { {"WGS1",128}, {"WGS2",128} } },
-        { "GeForce GTX 750",                                 { {"WGS1",128}, {"WGS2",32} } },
-        { "GeForce GTX 750 Ti",                              { {"WGS1",64}, {"WGS2",32} } },
-        { "GeForce GTX 980",                                 { {"WGS1",256}, {"WGS2",32} } },
-        { "GeForce GTX TITAN Black",                         { {"WGS1",512}, {"WGS2",64} } },
-        { "GeForce GTX TITAN X",                             { {"WGS1",256}, {"WGS2",32} } },
-        { "TITAN X (Pascal)",                                { {"WGS1",1024}, {"WGS2",32} } },
-        { "Tesla K20m",                                      { {"WGS1",1024}, {"WGS2",32} } },
-        { "default",                                         { {"WGS1",256}, {"WGS2",64} } },
+        { "GRID K520",                                       XdotParameters[2] },
+        { "GeForce GT 650M",                                 XdotParameters[4] },
+        { "GeForce GTX 1070",                                XdotParameters[9] },
+        { "GeForce GTX 1080",                                XdotParameters[8] },
+        { "GeForce GTX 480",                                 XdotParameters[10] },
+        { "GeForce GTX 670",                                 XdotParameters[11] },
+        { "GeForce GTX 680",                                 XdotParameters[12] },
+        { "GeForce GTX 750",                                 XdotParameters[2] },
+        { "GeForce GTX 750 Ti",                              XdotParameters[3] },
+        { "GeForce GTX 980",                                 XdotParameters[1] },
+        { "GeForce GTX TITAN Black",                         XdotParameters[8] },
+        { "GeForce GTX TITAN X",                             XdotParameters[1] },
+        { "TITAN X (Pascal)",                                XdotParameters[6] },
+        { "Tesla K20m",                                      XdotParameters[6] },
+        { "default",                                         XdotParameters[0] },
       }
     },
     { // Default
       kDeviceTypeAll, "default", {
-        { "default",                                         { {"WGS1",128}, {"WGS2",32} } },
+        { "default",                                         XdotParameters[2] },
       }
     },
   }
@@ -108,58 +133,58 @@ const Database::DatabaseEntry XdotComplexSingle = {
   "Xdot", Precision::kComplexSingle, {
     { // AMD GPUs
       kDeviceTypeGPU, "AMD", {
-        { "AMD Radeon R9 M370X Compute Engine",              { {"WGS1",64}, {"WGS2",32} } },
-        { "ATI Radeon HD 6750M",                             { {"WGS1",256}, {"WGS2",256} } },
-        { "Ellesmere",                                       { {"WGS1",256}, {"WGS2",32} } },
-        { "Fiji",                                            { {"WGS1",256}, {"WGS2",64} } },
-        { "Oland",                                           { {"WGS1",128}, {"WGS2",32} } },
-        { "Pitcairn",                                        { {"WGS1",256}, {"WGS2",32} } },
-        { "Tahiti",                                          { {"WGS1",64}, {"WGS2",32} } },
-        { "Tonga",                                           { {"WGS1",256}, {"WGS2",64} } },
-        { "Turks",                                           { {"WGS1",128}, {"WGS2",32} } },
-        { "default",                                         { {"WGS1",256}, {"WGS2",32} } },
+        { "AMD Radeon R9 M370X Compute Engine",              XdotParameters[3] },
+        { "ATI Radeon HD 6750M",                             XdotParameters[13] },
+        { "Ellesmere",                                       XdotParameters[1] },
+        { "Fiji",                                            XdotParameters[0] },
+        { "Oland",                                           XdotParameters[2] },
+        { "Pitcairn",                                        XdotParameters[1] },
+        { "Tahiti",                                          XdotParameters[3] },
+        { "Tonga",                                           XdotParameters[0] },
+        { "Turks",                                           XdotParameters[2] },
+        { "default",                                         XdotParameters[1] },
       }
     },
     { // Intel CPUs
       kDeviceTypeCPU, "Intel", {
-        { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       { {"WGS1",128}, {"WGS2",64} } },
-        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {"WGS1",1024}, {"WGS2",32} } },
-        { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        { {"WGS1",256}, {"WGS2",32} } },
-        { "default",                                         { {"WGS1",256}, {"WGS2",32} } },
+        { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       XdotParameters[4] },
+        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        XdotParameters[6] },
+        { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        XdotParameters[1] },
+        { "default",                                         XdotParameters[1] },
       }
     },
     { // Intel GPUs
       kDeviceTypeGPU, "Intel", {
-        { "Intel(R) HD Graphics 530",                        { {"WGS1",256}, {"WGS2",32} } },
-        { "Intel(R) HD Graphics 5500 BroadWell U-Processor GT2", { {"WGS1",256}, {"WGS2",32} } },
-        { "Intel(R) HD Graphics Haswell Ultrabook GT2 Mobile", { {"WGS1",32}, {"WGS2",32} } },
-        { "Intel(R) HD Graphics IvyBridge M GT2",            { {"WGS1",512}, {"WGS2",32} } },
-        { "Intel(R) HD Graphics Skylake ULT GT2",            { {"WGS1",32}, {"WGS2",256} } },
-        { "Iris Pro",                                        { {"WGS1",32}, {"WGS2",32} } },
-        { "default",                                         { {"WGS1",32}, {"WGS2",32} } },
+        { "Intel(R) HD Graphics 530",                        XdotParameters[1] },
+        { "Intel(R) HD Graphics 5500 BroadWell U-Processor GT2", XdotParameters[1] },
+        { "Intel(R) HD Graphics Haswell Ultrabook GT2 Mobile", XdotParameters[5] },
+        { "Intel(R) HD Graphics IvyBridge M GT2",            XdotParameters[10] },
+        { "Intel(R) HD Graphics Skylake ULT GT2",            XdotParameters[14] },
+        { "Iris Pro",                                        XdotParameters[5] },
+        { "default",                                         XdotParameters[5] },
       }
     },
     { // NVIDIA GPUs
       kDeviceTypeGPU, "NVIDIA", {
-        { "GRID K520",                                       { {"WGS1",64}, {"WGS2",32} } },
-        { "GeForce GTX 1070",                                { {"WGS1",128}, {"WGS2",32} } },
-        { "GeForce GTX 1080",                                { {"WGS1",128}, {"WGS2",64} } },
-        { "GeForce GTX 480",                                 { {"WGS1",512}, {"WGS2",32} } },
-        { "GeForce GTX 670",                                 { {"WGS1",256}, {"WGS2",32} } },
-        { "GeForce GTX 680",                                 { {"WGS1",128}, {"WGS2",64} } },
-        { "GeForce GTX 750",                                 { {"WGS1",64}, {"WGS2",32} } },
-        { "GeForce GTX 750 Ti",                              { {"WGS1",64}, {"WGS2",32} } },
-        { "GeForce GTX 980",                                 { {"WGS1",256}, {"WGS2",64} } },
-        { "GeForce GTX TITAN Black",                         { {"WGS1",128}, {"WGS2",64} } },
-        { "GeForce GTX TITAN X",                             { {"WGS1",256}, {"WGS2",32} } },
-        { "TITAN X (Pascal)",                                { {"WGS1",256}, {"WGS2",32} } },
-        { "Tesla K20m",                                      { {"WGS1",512}, {"WGS2",32} } },
-        { "default",                                         { {"WGS1",512}, {"WGS2",64} } },
+        { "GRID K520",                                       XdotParameters[3] },
+        { "GeForce GTX 1070",                                XdotParameters[2] },
+        { "GeForce GTX 1080",                                XdotParameters[4] },
+        { "GeForce GTX 480",                                 XdotParameters[10] },
+        { "GeForce GTX 670",                                 XdotParameters[1] },
+        { "GeForce GTX 680",                                 XdotParameters[4] },
+        { "GeForce GTX 750",                                 XdotParameters[3] },
+        { "GeForce GTX 750 Ti",                              XdotParameters[3] },
+        { "GeForce GTX 980",                                 XdotParameters[0] },
+        { "GeForce GTX TITAN Black",                         XdotParameters[4] },
+        { "GeForce GTX TITAN X",                             XdotParameters[1] },
+        { "TITAN X (Pascal)",                                XdotParameters[1] },
+        { "Tesla K20m",                                      XdotParameters[10] },
+        { "default",                                         XdotParameters[8] },
       }
     },
     { // Default
       kDeviceTypeAll, "default", {
-        { "default",                                         { {"WGS1",256}, {"WGS2",32} } },
+        { "default",                                         XdotParameters[1] },
       }
     },
   }
@@ -171,45 +196,45 @@ const Database::DatabaseEntry XdotDouble = {
   "Xdot", Precision::kDouble, {
     { // AMD GPUs
       kDeviceTypeGPU, "AMD", {
-        { "AMD Radeon R9 M370X Compute Engine",              { {"WGS1",64}, {"WGS2",128} } },
-        { "Ellesmere",                                       { {"WGS1",128}, {"WGS2",64} } },
-        { "Fiji",                                            { {"WGS1",256}, {"WGS2",32} } },
-        { "Oland",                                           { {"WGS1",256}, {"WGS2",32} } },
-        { "Pitcairn",                                        { {"WGS1",128}, {"WGS2",32} } },
-        { "Tahiti",                                          { {"WGS1",256}, {"WGS2",32} } },
-        { "Tonga",                                           { {"WGS1",128}, {"WGS2",64} } },
-        { "default",                                         { {"WGS1",128}, {"WGS2",64} } },
+        { "AMD Radeon R9 M370X Compute Engine",              XdotParameters[15] },
+        { "Ellesmere",                                       XdotParameters[4] },
+        { "Fiji",                                            XdotParameters[1] },
+        { "Oland",                                           XdotParameters[1] },
+        { "Pitcairn",                                        XdotParameters[2] },
+        { "Tahiti",                                          XdotParameters[1] },
+        { "Tonga",                                           XdotParameters[4] },
+        { "default",                                         XdotParameters[4] },
       }
     },
     { // Intel CPUs
       kDeviceTypeCPU, "Intel", {
-        { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       { {"WGS1",64}, {"WGS2",128} } },
-        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {"WGS1",512}, {"WGS2",64} } },
-        { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        { {"WGS1",256}, {"WGS2",32} } },
-        { "default",                                         { {"WGS1",256}, {"WGS2",64} } },
+        { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       XdotParameters[15] },
+        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        XdotParameters[8] },
+        { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        XdotParameters[1] },
+        { "default",                                         XdotParameters[0] },
       }
     },
     { // NVIDIA GPUs
       kDeviceTypeGPU, "NVIDIA", {
-        { "GRID K520",                                       { {"WGS1",128}, {"WGS2",32} } },
-        { "GeForce GTX 1070",                                { {"WGS1",128}, {"WGS2",512} } },
-        { "GeForce GTX 1080",                                { {"WGS1",128}, {"WGS2",128} } },
-        { "GeForce GTX 480",                                 { {"WGS1",512}, {"WGS2",32} } },
-        { "GeForce GTX 670",                                 { {"WGS1",256}, {"WGS2",32} } },
-        { "GeForce GTX 680",                                 { {"WGS1",128}, {"WGS2",64} } },
-        { "GeForce GTX 750",                                 { {"WGS1",64}, {"WGS2",256} } },
-        { "GeForce GTX 750 Ti",                              { {"WGS1",128}, {"WGS2",64} } },
-        { "GeForce GTX 980",                                 { {"WGS1",128}, {"WGS2",32} } },
-        { "GeForce GTX TITAN Black",                         { {"WGS1",128}, {"WGS2",64} } },
-        { "GeForce GTX TITAN X",                             { {"WGS1",256}, {"WGS2",32} } },
-        { "TITAN X (Pascal)",                                { {"WGS1",128}, {"WGS2",32} } },
-        { "Tesla K20m",                                      { {"WGS1",512}, {"WGS2",32} } },
-        { "default",                                         { {"WGS1",128}, {"WGS2",128} } },
+        { "GRID K520",                                       XdotParameters[2] },
+        { "GeForce GTX 1070",                                XdotParameters[16] },
+        { "GeForce GTX 1080",                                XdotParameters[12] },
+        { "GeForce GTX 480",                                 XdotParameters[10] },
+        { "GeForce GTX 670",                                 XdotParameters[1] },
+        { "GeForce GTX 680",                                 XdotParameters[4] },
+        { "GeForce GTX 750",                                 XdotParameters[17] },
+        { "GeForce GTX 750 Ti",                              XdotParameters[4] },
+        { "GeForce GTX 980",                                 XdotParameters[2] },
+        { "GeForce GTX TITAN Black",                         XdotParameters[4] },
+        { "GeForce GTX TITAN X",                             XdotParameters[1] },
+        { "TITAN X (Pascal)",                                XdotParameters[2] },
+        { "Tesla K20m",                                      XdotParameters[10] },
+        { "default",                                         XdotParameters[12] },
       }
     },
     { // Default
       kDeviceTypeAll, "default", {
-        { "default",                                         { {"WGS1",256}, {"WGS2",64} } },
+        { "default",                                         XdotParameters[0] },
       }
     },
   }
@@ -221,45 +246,45 @@ const Database::DatabaseEntry XdotComplexDouble = {
   "Xdot", Precision::kComplexDouble, {
     { // AMD GPUs
       kDeviceTypeGPU, "AMD", {
-        { "AMD Radeon R9 M370X Compute Engine",              { {"WGS1",64}, {"WGS2",32} } },
-        { "Ellesmere",                                       { {"WGS1",256}, {"WGS2",32} } },
-        { "Fiji",                                            { {"WGS1",256}, {"WGS2",32} } },
-        { "Oland",                                           { {"WGS1",256}, {"WGS2",32} } },
-        { "Pitcairn",                                        { {"WGS1",256}, {"WGS2",32} } },
-        { "Tahiti",                                          { {"WGS1",256}, {"WGS2",32} } },
-        { "Tonga",                                           { {"WGS1",128}, {"WGS2",64} } },
-        { "default",                                         { {"WGS1",256}, {"WGS2",32} } },
+        { "AMD Radeon R9 M370X Compute Engine",              XdotParameters[3] },
+        { "Ellesmere",                                       XdotParameters[1] },
+        { "Fiji",                                            XdotParameters[1] },
+        { "Oland",                                           XdotParameters[1] },
+        { "Pitcairn",                                        XdotParameters[1] },
+        { "Tahiti",                                          XdotParameters[1] },
+        { "Tonga",                                           XdotParameters[4] },
+        { "default",                                         XdotParameters[1] },
       }
     },
     { // Intel CPUs
       kDeviceTypeCPU, "Intel", {
-        { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       { {"WGS1",32}, {"WGS2",128} } },
-        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {"WGS1",1024}, {"WGS2",32} } },
-        { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        { {"WGS1",32}, {"WGS2",32} } },
-        { "default",                                         { {"WGS1",128}, {"WGS2",32} } },
+        { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       XdotParameters[18] },
+        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        XdotParameters[6] },
+        { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        XdotParameters[5] },
+        { "default",                                         XdotParameters[2] },
       }
     },
     { // NVIDIA GPUs
       kDeviceTypeGPU, "NVIDIA", {
-        { "GRID K520",                                       { {"WGS1",64}, {"WGS2",32} } },
-        { "GeForce GTX 1070",                                { {"WGS1",128}, {"WGS2",64} } },
-        { "GeForce GTX 1080",                                { {"WGS1",128}, {"WGS2",32} } },
-        { "GeForce GTX 480",                                 { {"WGS1",512}, {"WGS2",32} } },
-        { "GeForce GTX 670",                                 { {"WGS1",512}, {"WGS2",128} } },
-        { "GeForce GTX 680",                                 { {"WGS1",256}, {"WGS2",64} } },
-        { "GeForce GTX 750",                                 { {"WGS1",256}, {"WGS2",32} } },
-        { "GeForce GTX 750 Ti",                              { {"WGS1",64}, {"WGS2",32} } },
-        { "GeForce GTX 980",                                 { {"WGS1",64}, {"WGS2",32} } },
-        { "GeForce GTX TITAN Black",                         { {"WGS1",128}, {"WGS2",32} } },
-        { "GeForce GTX TITAN X",                             { {"WGS1",128}, {"WGS2",32} } },
-        { "TITAN X (Pascal)",                                { {"WGS1",128}, {"WGS2",64} } },
-        { "Tesla K20m",                                      { {"WGS1",128}, {"WGS2",32} } },
-        { "default",                                         { {"WGS1",128}, {"WGS2",64} } },
+        { "GRID K520",                                       XdotParameters[3] },
+        { "GeForce GTX 1070",                                XdotParameters[4] },
+        { "GeForce GTX 1080",                                XdotParameters[2] },
+        { "GeForce GTX 480",                                 XdotParameters[10] },
+        { "GeForce GTX 670",                                 XdotParameters[7] },
+        { "GeForce GTX 680",                                 XdotParameters[0] },
+        { "GeForce GTX 750",                                 XdotParameters[1] },
+        { "GeForce GTX 750 Ti",                              XdotParameters[3] },
+        { "GeForce GTX 980",                                 XdotParameters[3] },
+        { "GeForce GTX TITAN Black",                         XdotParameters[2] },
+        { "GeForce GTX TITAN X",                             XdotParameters[2] },
+        { "TITAN X (Pascal)",                                XdotParameters[4] },
+        { "Tesla K20m",                                      XdotParameters[2] },
+        { "default",                                         XdotParameters[4] },
       }
     },
     { // Default
       kDeviceTypeAll, "default", {
-        { "default",                                         { {"WGS1",256}, {"WGS2",32} } },
+        { "default",                                         XdotParameters[1] },
       }
     },
   }
@@ -0,0 +1,86 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file populates the database with best-found tuning parameters for the 'XdotBatched' kernels.
+// These are used by both the batched DOT and the batched NRM2 routines.
+//
+// =================================================================================================
+
+namespace clblast {
+namespace database {
+// =================================================================================================
+
+// The unique parameter sets of these kernels, referred to by index below
+const auto XdotBatchedParameters = Database::ParameterSets({"WGS1", "WGS2"}, {
+  {64, 32}, // 0
+});
+
+// =================================================================================================
+
+const Database::DatabaseEntry XdotBatchedHalf = {
+  "XdotBatched", Precision::kHalf, {
+    { // Default
+      kDeviceTypeAll, "default", {
+        { "default",                                         XdotBatchedParameters[0] },
+      }
+    },
+  }
+};
+
+// =================================================================================================
+
+const Database::DatabaseEntry XdotBatchedSingle = {
+  "XdotBatched", Precision::kSingle, {
+    { // Default
+      kDeviceTypeAll, "default", {
+        { "default",                                         XdotBatchedParameters[0] },
+      }
+    },
+  }
+};
+
+// =================================================================================================
+
+const Database::DatabaseEntry XdotBatchedComplexSingle = {
+  "XdotBatched", Precision::kComplexSingle, {
+    { // Default
+      kDeviceTypeAll, "default", {
+        { "default",                                         XdotBatchedParameters[0] },
+      }
+    },
+  }
+};
+
+// =================================================================================================
+
+const Database::DatabaseEntry XdotBatchedDouble = {
+  "XdotBatched", Precision::kDouble, {
+    { // Default
+      kDeviceTypeAll, "default", {
+        { "default",                                         XdotBatchedParameters[0] },
+      }
+    },
+  }
+};
+
+// =================================================================================================
+
+const Database::DatabaseEntry XdotBatchedComplexDouble = {
+  "XdotBatched", Precision::kComplexDouble, {
+    { // Default
+      kDeviceTypeAll, "default", {
+        { "default",                                         XdotBatchedParameters[0] },
+      }
+    },
+  }
+};
+
+// =================================================================================================
+} // namespace database
+} // namespace clblast
@@ -15,23 +15,176 @@ namespace clblast {
 namespace database {
 // =================================================================================================
 
+// The unique parameter sets of these kernels, referred to by index below
+const auto XgemmParameters = Database::ParameterSets({"KWG", "KWI", "MDIMA", "MDIMC", "MWG", "NDIMB", "NDIMC", "NWG", "SA", "SB", "STRM", "STRN", "VWM", "VWN"}, {
+  {32, 2, 8, 8, 64, 16, 16, 64, 1, 1, 0, 0, 4, 4}, // 0
+  {32, 2, 16, 16, 64, 8, 16, 128, 0, 0, 0, 0, 2, 8}, // 1
+  {32, 2, 8, 16, 128, 8, 8, 128, 0, 0, 1, 1, 8, 8}, // 2
+  {32, 2, 8, 8, 16, 16, 16, 64, 1, 1, 0, 0, 1, 2}, // 3
+  {32, 2, 16, 16, 64, 16, 16, 64, 1, 1, 0, 0, 4, 4}, // 4
+  {16, 2, 16, 32, 128, 32, 8, 64, 1, 1, 1, 1, 4, 2}, // 5
+  {16, 2, 32, 16, 64, 32, 16, 128, 1, 1, 1, 0, 2, 4}, // 6
+  {16, 2, 16, 8, 32, 16, 16, 128, 0, 0, 1, 0, 1, 1}, // 7
+  {32, 2, 16, 32, 128, 16, 8, 64, 0, 0, 0, 0, 4, 1}, // 8
+  {16, 2, 16, 32, 64, 16, 8, 128, 1, 1, 0, 0, 2, 8}, // 9
+  {32, 2, 8, 8, 64, 8, 8, 64, 0, 0, 0, 0, 4, 4}, // 10
+  {32, 2, 8, 8, 32, 8, 8, 64, 0, 0, 0, 0, 4, 4}, // 11
+  {16, 2, 8, 8, 64, 8, 16, 16, 0, 0, 1, 1, 8, 1}, // 12
+  {16, 2, 8, 8, 128, 16, 8, 128, 0, 1, 1, 1, 1, 8}, // 13
+  {32, 8, 32, 32, 64, 32, 16, 64, 1, 1, 1, 0, 2, 2}, // 14
+  {32, 2, 32, 8, 128, 8, 8, 128, 1, 1, 1, 1, 2, 8}, // 15
+  {16, 2, 8, 8, 128, 8, 8, 128, 1, 1, 1, 0, 1, 8}, // 16
+  {32, 8, 16, 16, 64, 32, 32, 64, 0, 1, 1, 0, 1, 2}, // 17
+  {32, 2, 8, 8, 32, 8, 8, 64, 1, 1, 0, 0, 4, 4}, // 18
+  {32, 2, 8, 8, 128, 32, 16, 64, 0, 0, 1, 0, 4, 2}, // 19
+  {32, 8, 8, 8, 64, 32, 16, 64, 1, 1, 1, 1, 4, 2}, // 20
+  {16, 2, 16, 8, 32, 8, 16, 128, 1, 1, 1, 1, 2, 4}, // 21
+  {32, 2, 16, 16, 64, 16, 8, 64, 1, 1, 1, 0, 2, 4}, // 22
+  {32, 2, 16, 16, 64, 8, 8, 64, 1, 1, 0, 0, 4, 4}, // 23
+  {16, 8, 16, 8, 128, 32, 16, 64, 1, 1, 1, 1, 4, 1}, // 24
+  {16, 2, 16, 8, 64, 32, 32, 128, 1, 1, 1, 0, 4, 4}, // 25
+  {32, 2, 32, 32, 32, 32, 8, 128, 0, 0, 1, 0, 1, 4}, // 26
+  {16, 2, 16, 8, 32, 8, 16, 64, 1, 1, 1, 1, 2, 4}, // 27
+  {32, 2, 8, 8, 32, 32, 32, 64, 1, 1, 0, 0, 4, 2}, // 28
+  {16, 2, 32, 16, 128, 32, 8, 128, 1, 1, 1, 0, 4, 1}, // 29
+  {32, 2, 16, 8, 64, 8, 8, 64, 1, 1, 1, 1, 4, 8}, // 30
+  {16, 2, 16, 8, 64, 32, 16, 64, 1, 1, 1, 1, 2, 2}, // 31
+  {16, 2, 8, 8, 64, 16, 16, 64, 1, 1, 1, 0, 2, 4}, // 32
+  {32, 8, 8, 16, 64, 32, 16, 128, 1, 1, 0, 0, 4, 2}, // 33
+  {16, 2, 16, 16, 64, 32, 8, 128, 1, 1, 1, 1, 1, 2}, // 34
+  {16, 2, 16, 16, 128, 32, 8, 64, 1, 1, 0, 1, 8, 2}, // 35
+  {16, 2, 16, 16, 64, 16, 8, 128, 1, 1, 1, 0, 4, 8}, // 36
+  {16, 8, 32, 16, 64, 8, 8, 64, 1, 1, 1, 0, 2, 2}, // 37
+  {16, 2, 16, 8, 64, 16, 16, 64, 1, 1, 1, 0, 4, 1}, // 38
+  {16, 2, 8, 16, 128, 8, 8, 128, 1, 1, 1, 1, 4, 8}, // 39
+  {32, 2, 16, 16, 64, 8, 8, 64, 1, 1, 0, 0, 4, 1}, // 40
+  {16, 2, 32, 16, 64, 16, 8, 64, 1, 1, 1, 0, 2, 4}, // 41
+  {16, 8, 16, 8, 64, 16, 16, 128, 1, 1, 1, 0, 2, 4}, // 42
+  {32, 2, 16, 16, 64, 8, 8, 64, 1, 1, 0, 0, 4, 2}, // 43
+  {32, 2, 32, 32, 64, 8, 8, 64, 0, 0, 1, 1, 2, 8}, // 44
+  {32, 2, 8, 8, 32, 16, 16, 64, 1, 1, 0, 0, 4, 4}, // 45
+  {32, 2, 16, 16, 32, 8, 8, 32, 1, 1, 0, 0, 1, 4}, // 46
+  {32, 2, 16, 16, 32, 16, 16, 32, 1, 1, 0, 0, 1, 2}, // 47
+  {32, 2, 32, 8, 32, 8, 16, 32, 1, 0, 1, 0, 1, 1}, // 48
+  {32, 2, 16, 8, 32, 32, 32, 128, 1, 0, 0, 1, 2, 4}, // 49
+  {16, 2, 8, 8, 32, 8, 8, 32, 0, 1, 1, 1, 4, 2}, // 50
+  {16, 2, 8, 8, 32, 8, 16, 32, 1, 0, 0, 1, 2, 1}, // 51
+  {16, 2, 32, 8, 64, 16, 32, 64, 1, 1, 1, 0, 2, 1}, // 52
+  {16, 2, 8, 8, 32, 32, 8, 32, 0, 1, 0, 0, 2, 1}, // 53
+  {16, 2, 8, 16, 128, 16, 8, 128, 0, 0, 0, 1, 8, 1}, // 54
+  {16, 2, 32, 8, 128, 16, 16, 128, 1, 1, 0, 1, 1, 2}, // 55
+  {32, 2, 32, 16, 32, 16, 16, 64, 0, 1, 1, 0, 1, 2}, // 56
+  {32, 2, 8, 8, 128, 16, 32, 128, 0, 0, 0, 0, 1, 4}, // 57
+  {32, 2, 8, 8, 128, 32, 8, 128, 0, 0, 0, 0, 1, 4}, // 58
+  {32, 2, 8, 16, 16, 16, 16, 128, 0, 0, 1, 1, 1, 4}, // 59
+  {32, 2, 8, 8, 64, 8, 8, 64, 1, 1, 0, 0, 1, 4}, // 60
+  {16, 8, 8, 16, 64, 32, 8, 32, 0, 0, 0, 0, 2, 1}, // 61
+  {16, 8, 8, 8, 32, 16, 16, 64, 1, 0, 0, 0, 4, 4}, // 62
+  {32, 8, 16, 16, 64, 16, 16, 64, 1, 1, 1, 1, 2, 1}, // 63
+  {32, 2, 16, 16, 64, 16, 16, 64, 0, 0, 0, 0, 4, 2}, // 64
+  {32, 8, 32, 16, 64, 8, 16, 64, 1, 0, 1, 0, 1, 1}, // 65
+  {16, 2, 8, 8, 32, 32, 8, 32, 1, 1, 1, 1, 1, 1}, // 66
+  {32, 2, 8, 8, 32, 8, 8, 32, 1, 1, 0, 0, 4, 2}, // 67
+  {32, 2, 32, 32, 32, 32, 16, 128, 1, 0, 0, 0, 1, 4}, // 68
+  {16, 8, 32, 32, 64, 32, 16, 128, 1, 0, 1, 0, 1, 4}, // 69
+  {16, 2, 16, 16, 128, 16, 16, 64, 1, 1, 1, 1, 2, 4}, // 70
+  {16, 2, 32, 16, 64, 32, 8, 64, 1, 1, 0, 0, 1, 2}, // 71
+  {16, 2, 16, 16, 32, 32, 16, 128, 0, 1, 1, 1, 2, 2}, // 72
+  {16, 2, 32, 32, 64, 32, 8, 32, 1, 1, 1, 1, 1, 1}, // 73
+  {16, 2, 32, 16, 64, 32, 32, 128, 1, 0, 0, 0, 2, 2}, // 74
+  {16, 8, 16, 16, 64, 16, 16, 64, 1, 1, 1, 0, 2, 2}, // 75
+  {16, 2, 16, 8, 32, 32, 16, 64, 1, 1, 1, 0, 1, 2}, // 76
+  {32, 8, 32, 32, 64, 16, 16, 64, 1, 1, 1, 0, 2, 1}, // 77
+  {16, 8, 16, 16, 64, 32, 16, 64, 1, 1, 1, 0, 1, 1}, // 78
+  {16, 2, 8, 16, 64, 8, 8, 32, 0, 1, 1, 0, 1, 2}, // 79
+  {16, 2, 8, 8, 64, 8, 8, 32, 1, 0, 1, 1, 1, 4}, // 80
+  {32, 2, 32, 32, 64, 8, 8, 32, 1, 1, 0, 0, 2, 4}, // 81
+  {32, 2, 8, 16, 64, 8, 16, 64, 1, 0, 0, 0, 1, 4}, // 82
+  {16, 2, 32, 32, 32, 32, 8, 64, 0, 1, 0, 0, 1, 1}, // 83
+  {32, 2, 8, 8, 16, 32, 32, 64, 1, 1, 0, 0, 1, 1}, // 84
+  {32, 2, 16, 16, 32, 8, 8, 32, 1, 1, 0, 0, 2, 1}, // 85
+  {32, 2, 16, 16, 64, 8, 8, 32, 0, 0, 0, 0, 4, 4}, // 86
+  {32, 2, 16, 16, 32, 16, 16, 64, 1, 1, 0, 0, 2, 2}, // 87
+  {32, 2, 16, 16, 32, 16, 16, 32, 1, 1, 0, 0, 2, 2}, // 88
+  {16, 8, 32, 8, 128, 8, 8, 32, 0, 1, 0, 0, 1, 4}, // 89
+  {16, 2, 8, 16, 64, 16, 8, 16, 0, 0, 1, 1, 1, 1}, // 90
+  {32, 2, 32, 16, 64, 8, 16, 32, 0, 0, 0, 0, 1, 2}, // 91
+  {32, 2, 16, 8, 16, 8, 8, 32, 0, 0, 0, 1, 1, 4}, // 92
+  {32, 2, 8, 8, 64, 8, 8, 16, 0, 1, 1, 0, 8, 2}, // 93
+  {16, 2, 32, 8, 128, 16, 16, 128, 1, 1, 1, 1, 2, 8}, // 94
+  {32, 2, 32, 16, 128, 16, 16, 64, 0, 1, 1, 0, 1, 2}, // 95
+  {32, 2, 16, 8, 128, 8, 8, 64, 1, 0, 0, 1, 2, 8}, // 96
+  {32, 2, 16, 8, 128, 8, 8, 128, 1, 0, 0, 0, 2, 8}, // 97
+  {32, 2, 8, 16, 128, 16, 8, 128, 0, 0, 1, 1, 1, 8}, // 98
+  {32, 2, 8, 8, 64, 8, 8, 64, 1, 1, 0, 0, 2, 4}, // 99
+  {32, 8, 8, 16, 16, 16, 16, 128, 0, 0, 1, 0, 1, 4}, // 100
+  {16, 2, 8, 8, 16, 8, 8, 32, 1, 0, 0, 1, 2, 2}, // 101
+  {16, 2, 8, 16, 32, 8, 8, 64, 0, 0, 1, 1, 2, 8}, // 102
+  {32, 2, 16, 16, 32, 16, 16, 64, 0, 0, 0, 0, 2, 4}, // 103
+  {16, 2, 8, 16, 32, 32, 8, 64, 1, 1, 1, 0, 1, 2}, // 104
+  {32, 8, 16, 32, 128, 16, 8, 32, 0, 1, 1, 0, 1, 1}, // 105
+  {32, 8, 8, 8, 32, 16, 32, 128, 1, 0, 0, 1, 2, 4}, // 106
+  {32, 8, 16, 32, 64, 16, 8, 128, 0, 0, 0, 1, 2, 1}, // 107
+  {32, 2, 8, 8, 32, 16, 16, 32, 0, 0, 0, 0, 4, 2}, // 108
+  {32, 8, 16, 8, 64, 32, 32, 128, 0, 0, 1, 0, 2, 4}, // 109
+  {16, 8, 16, 8, 32, 16, 32, 128, 1, 1, 1, 1, 2, 2}, // 110
+  {16, 2, 16, 8, 16, 16, 8, 16, 1, 1, 1, 0, 1, 1}, // 111
+  {16, 8, 16, 16, 16, 16, 16, 16, 0, 0, 0, 0, 1, 1}, // 112
+  {32, 2, 32, 32, 32, 16, 16, 32, 0, 0, 0, 0, 1, 2}, // 113
+  {16, 2, 32, 8, 32, 16, 16, 64, 1, 0, 0, 0, 1, 1}, // 114
+  {32, 2, 16, 8, 64, 16, 32, 128, 1, 0, 1, 1, 2, 4}, // 115
+  {32, 2, 8, 8, 64, 8, 8, 32, 0, 0, 0, 0, 4, 4}, // 116
+  {32, 8, 8, 16, 32, 16, 16, 32, 0, 0, 1, 1, 2, 2}, // 117
+  {32, 2, 16, 16, 16, 16, 16, 16, 1, 1, 0, 0, 1, 1}, // 118
+  {16, 2, 16, 16, 16, 16, 16, 32, 1, 0, 0, 0, 1, 2}, // 119
+  {16, 2, 16, 8, 16, 16, 32, 128, 0, 0, 0, 0, 1, 4}, // 120
+  {32, 2, 16, 8, 32, 8, 32, 32, 0, 1, 1, 0, 1, 1}, // 121
+  {16, 2, 16, 8, 16, 8, 8, 16, 0, 0, 1, 0, 1, 1}, // 122
+  {16, 2, 32, 16, 32, 16, 16, 16, 1, 1, 1, 1, 1, 1}, // 123
+  {16, 2, 8, 8, 64, 32, 8, 64, 0, 0, 1, 0, 8, 1}, // 124
+  {16, 2, 32, 8, 64, 16, 8, 128, 0, 1, 0, 1, 2, 1}, // 125
+  {32, 2, 16, 32, 128, 16, 16, 64, 0, 1, 0, 0, 2, 4}, // 126
+  {32, 2, 8, 8, 128, 8, 16, 128, 0, 0, 0, 1, 1, 8}, // 127
+  {32, 8, 8, 32, 32, 8, 8, 32, 0, 1, 0, 0, 1, 2}, // 128
+  {32, 2, 8, 8, 16, 8, 8, 32, 1, 1, 0, 0, 1, 2}, // 129
+  {32, 2, 16, 16, 16, 16, 8, 32, 0, 0, 1, 0, 1, 1}, // 130
+  {32, 8, 16, 16, 16, 8, 16, 64, 1, 0, 1, 1, 1, 1}, // 131
+  {32, 8, 32, 16, 32, 8, 8, 32, 0, 0, 0, 1, 1, 4}, // 132
+  {32, 2, 16, 16, 16, 8, 8, 16, 0, 0, 0, 0, 1, 2}, // 133
+  {16, 2, 32, 32, 32, 32, 8, 32, 0, 0, 1, 0, 1, 1}, // 134
+  {32, 8, 16, 8, 16, 16, 32, 64, 1, 0, 0, 1, 1, 2}, // 135
+  {16, 8, 16, 8, 64, 16, 32, 32, 0, 1, 1, 0, 1, 1}, // 136
+  {32, 2, 8, 32, 32, 8, 8, 64, 0, 0, 1, 0, 1, 4}, // 137
+  {32, 2, 8, 8, 16, 8, 8, 32, 0, 0, 0, 0, 1, 1}, // 138
+  {16, 2, 16, 8, 32, 8, 16, 128, 0, 0, 1, 1, 2, 2}, // 139
+  {16, 2, 16, 16, 32, 16, 8, 32, 0, 1, 1, 1, 1, 1}, // 140
+  {32, 8, 16, 16, 128, 16, 16, 32, 0, 0, 1, 0, 1, 1}, // 141
+  {32, 2, 16, 16, 16, 16, 16, 16, 0, 0, 0, 0, 1, 1}, // 142
+  {32, 2, 32, 8, 32, 16, 16, 64, 0, 0, 1, 0, 1, 1}, // 143
+  {16, 8, 8, 8, 32, 32, 16, 32, 0, 0, 1, 0, 1, 1}, // 144
+  {32, 2, 16, 16, 32, 16, 16, 32, 0, 0, 0, 0, 1, 1}, // 145
+  {32, 2, 32, 32, 32, 8, 8, 32, 1, 1, 0, 0, 1, 1}, // 146
+});
+
+// =================================================================================================
+
 const Database::DatabaseEntry XgemmHalf = {
   "Xgemm", Precision::kHalf, {
     { // AMD GPUs
       kDeviceTypeGPU, "AMD", {
-        { "Ellesmere",                                       { {"KWG",32}, {"KWI",2}, {"MDIMA",8}, {"MDIMC",8}, {"MWG",64}, {"NDIMB",16}, {"NDIMC",16}, {"NWG",64}, {"SA",1}, {"SB",1}, {"STRM",0}, {"STRN",0}, {"VWM",4}, {"VWN",4} } },
-        { "default",                                         { {"KWG",32}, {"KWI",2}, {"MDIMA",8}, {"MDIMC",8}, {"MWG",64}, {"NDIMB",16}, {"NDIMC",16}, {"NWG",64}, {"SA",1}, {"SB",1}, {"STRM",0}, {"STRN",0}, {"VWM",4}, {"VWN",4} } },
+        { "Ellesmere",                                       XgemmParameters[0] },
+        { "default",                                         XgemmParameters[0] },
       }
     },
     { // Intel GPUs
       kDeviceTypeGPU, "Intel", {
-        { "Intel(R) HD Graphics Skylake ULT GT2",            { {"KWG",32}, {"KWI",2}, {"MDIMA",8}, {"MDIMC",8}, {"MWG",64}, {"NDIMB",16}, {"NDIMC",16}, {"NWG",64}, {"SA",1}, {"SB",1}, {"STRM",0}, {"STRN",0}, {"VWM",4}, {"VWN",4} } },
-        { "default",                                         { {"KWG",32}, {"KWI",2}, {"MDIMA",8}, {"MDIMC",8}, {"MWG",64}, {"NDIMB",16}, {"NDIMC",16}, {"NWG",64}, {"SA",1}, {"SB",1}, {"STRM",0}, {"STRN",0}, {"VWM",4}, {"VWN",4} } },
+        { "Intel(R) HD Graphics Skylake ULT GT2",            XgemmParameters[0] },
+        { "default",                                         XgemmParameters[0] },
       }
     },
     { // Default
       kDeviceTypeAll, "default", {
-        { "default",                                         { {"KWG",32}, {"KWI",2}, {"MDIMA",8}, {"MDIMC",8}, {"MWG",64}, {"NDIMB",16}, {"NDIMC",16}, {"NWG",64}, {"SA",1}, {"SB",1}, {"STRM",0}, {"STRN",0}, {"VWM",4}, {"VWN",4} } },
+        { "default",                                         XgemmParameters[0] },
       }
     },
   }
@@ -43,77 +196,77 @@ const Database::DatabaseEntry XgemmSingle = {
   "Xgemm", Precision::kSingle, {
     { // AMD GPUs
       kDeviceTypeGPU, "AMD", {
-        { "AMD Radeon R9 M370X Compute Engine",              { {"KWG",32}, {"KWI",2}, {"MDIMA",16}, {"MDIMC",16}, {"MWG",64}, {"NDIMB",8}, {"NDIMC",16}, {"NWG",128}, {"SA",0}, {"SB",0}, {"STRM",0}, {"STRN",0}, {"VWM",2}, {"VWN",8} } },
-        { "ATI Radeon HD 6750M",                             { {"KWG",32}, {"KWI",2}, {"MDIMA",8}, {"MDIMC",16}, {"MWG",128}, {"NDIMB",8}, {"NDIMC",8}, {"NWG",128}, {"SA",0}, {"SB",0}, {"STRM",1}, {"STRN",1}, {"VWM",8}, {"VWN",8} } },
-        { "Ellesmere",                                       { {"KWG",32}, {"KWI",2}, {"MDIMA",8}, {"MDIMC",8}, {"MWG",16}, {"NDIMB",16}, {"NDIMC",16}, {"NWG",64}, {"SA",1}, {"SB",1}, {"STRM",0}, {"STRN",0}, {"VWM",1}, {"VWN",2} } },
-        { "Fiji",                                            { {"KWG",32}, {"KWI",2}, {"MDIMA",16}, {"MDIMC",16}, {"MWG",64}, {"NDIMB",16}, {"NDIMC",16}, {"NWG",64}, {"SA",1}, {"SB",1}, {"STRM",0}, {"STRN",0}, {"VWM",4}, {"VWN",4} } },
-        { "Hawaii",                                          { {"KWG",16}, {"KWI",2}, {"MDIMA",16}, {"MDIMC",32}, {"MWG",128}, {"NDIMB",32}, {"NDIMC",8}, {"NWG",64}, {"SA",1}, {"SB",1}, {"STRM",1}, {"STRN",1}, {"VWM",4}, {"VWN",2} } },
-        { "Oland",                                           { {"KWG",16}, {"KWI",2}, {"MDIMA",32}, {"MDIMC",16}, {"MWG",64}, {"NDIMB",32}, {"NDIMC",16}, {"NWG",128}, {"SA",1}, {"SB",1}, {"STRM",1}, {"STRN",0}, {"VWM",2}, {"VWN",4} } },
-        { "Pitcairn",                                        { {"KWG",16}, {"KWI",2}, {"MDIMA",16}, {"MDIMC",8}, {"MWG",32}, {"NDIMB",16}, {"NDIMC",16}, {"NWG",128}, {"SA",0}, {"SB",0}, {"STRM",1}, {"STRN",0}, {"VWM",1}, {"VWN",1} } },
-        { "Tahiti",                                          { {"KWG",32}, {"KWI",2}, {"MDIMA",16}, {"MDIMC",32}, {"MWG",128}, {"NDIMB",16}, {"NDIMC",8}, {"NWG",64}, {"SA",0}, {"SB",0}, {"STRM",0}, {"STRN",0}, {"VWM",4}, {"VWN",1} } },
-        { "Tonga",                                           { {"KWG",16}, {"KWI",2}, {"MDIMA",16}, {"MDIMC",32}, {"MWG",64}, {"NDIMB",16}, {"NDIMC",8}, {"NWG",128}, {"SA",1}, {"SB",1}, {"STRM",0}, {"STRN",0}, {"VWM",2}, {"VWN",8} } },
-        { "Turks",                                           { {"KWG",32}, {"KWI",2}, {"MDIMA",8}, {"MDIMC",8}, {"MWG",64}, {"NDIMB",8}, {"NDIMC",8}, {"NWG",64}, {"SA",0}, {"SB",0}, {"STRM",0}, {"STRN",0}, {"VWM",4}, {"VWN",4} } },
-        { "default",                                         { {"KWG",32}, {"KWI",2}, {"MDIMA",8}, {"MDIMC",8}, {"MWG",32}, {"NDIMB",8}, {"NDIMC",8}, {"NWG",64}, {"SA",0}, {"SB",0}, {"STRM",0}, {"STRN",0}, {"VWM",4}, {"VWN",4} } },
+        { "AMD Radeon R9 M370X Compute Engine",              XgemmParameters[1] },
+        { "ATI Radeon HD 6750M",                             XgemmParameters[2] },
+        { "Ellesmere",                                       XgemmParameters[3] },
+        { "Fiji",                                            XgemmParameters[4] },
+        { "Hawaii",                                          XgemmParameters[5] },
+        { "Oland",                                           XgemmParameters[6] },
+        { "Pitcairn",                                        XgemmParameters[7] },
+        { "Tahiti",                                          XgemmParameters[8] },
+        { "Tonga",                                           XgemmParameters[9] },
+        { "Turks",                                           XgemmParameters[10] },
+        { "default",                                         XgemmParameters[11] },
       }
     },
     { // ARM GPUs
       kDeviceTypeGPU, "ARM", {
-        { "Mali-T628",                                       { {"KWG",16}, {"KWI",2}, {"MDIMA",8}, {"MDIMC",8}, {"MWG",64}, {"NDIMB",8}, {"NDIMC",16}, {"NWG",16}, {"SA",0}, {"SB",0}, {"STRM",1}, {"STRN",1}, {"VWM",8}, {"VWN",1} } },
-        { "default",                                         { {"KWG",16}, {"KWI",2}, {"MDIMA",8}, {"MDIMC",8}, {"MWG",64}, {"NDIMB",8}, {"NDIMC",16}, {"NWG",16}, {"SA",0}, {"SB",0}, {"STRM",1}, {"STRN",1}, {"VWM",8}, {"VWN",1} } },
+        { "Mali-T628",                                       XgemmParameters[12] },
+        { "default",                                         XgemmParameters[12] },
       }
     },
     { // Intel CPUs
       kDeviceTypeCPU, "Intel", {
-        { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       { {"KWG",16}, {"KWI",2}, {"MDIMA",8}, {"MDIMC",8}, {"MWG",128}, {"NDIMB",16}, {"NDIMC",8}, {"NWG",128}, {"SA",0}, {"SB",1}, {"STRM",1}, {"STRN",1}, {"VWM",1}, {"VWN",8} } },
-        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {"KWG",32}, {"KWI",8}, {"MDIMA",32}, {"MDIMC",32}, {"MWG",64}, {"NDIMB",32}, {"NDIMC",16}, {"NWG",64}, {"SA",1}, {"SB",1}, {"STRM",1}, {"STRN",0}, {"VWM",2}, {"VWN",2} } },
-        { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         { {"KWG",32}, {"KWI",2}, {"MDIMA",32}, {"MDIMC",8}, {"MWG",128}, {"NDIMB",8}, {"NDIMC",8}, {"NWG",128}, {"SA",1}, {"SB",1}, {"STRM",1}, {"STRN",1}, {"VWM",2}, {"VWN",8} } },
-        { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        { {"KWG",16}, {"KWI",2}, {"MDIMA",8}, {"MDIMC",8}, {"MWG",128}, {"NDIMB",8}, {"NDIMC",8}, {"NWG",128}, {"SA",1}, {"SB",1}, {"STRM",1}, {"STRN",0}, {"VWM",1}, {"VWN",8} } },
-        { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        { {"KWG",32}, {"KWI",8}, {"MDIMA",16}, {"MDIMC",16}, {"MWG",64}, {"NDIMB",32}, {"NDIMC",32}, {"NWG",64}, {"SA",0}, {"SB",1}, {"STRM",1}, {"STRN",0}, {"VWM",1}, {"VWN",2} } },
-        { "default",                                         { {"KWG",32}, {"KWI",2}, {"MDIMA",8}, {"MDIMC",8}, {"MWG",32}, {"NDIMB",8}, {"NDIMC",8}, {"NWG",64}, {"SA",1}, {"SB",1}, {"STRM",0}, {"STRN",0}, {"VWM",4}, {"VWN",4} } },
+        { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       XgemmParameters[13] },
+        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        XgemmParameters[14] },
+        { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         XgemmParameters[15] },
+        { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        XgemmParameters[16] },
+        { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        XgemmParameters[17] },
+        { "default",                                         XgemmParameters[18] },
       }
     },
     { // Intel GPUs
       kDeviceTypeGPU, "Intel", {
-        { "Intel(R) HD Graphics 530",                        { {"KWG",32}, {"KWI",2}, {"MDIMA",8}, {"MDIMC",8}, {"MWG",128}, {"NDIMB",32}, {"NDIMC",16}, {"NWG",64}, {"SA",0}, {"SB",0}, {"STRM",1}, {"STRN",0}, {"VWM",4}, {"VWN",2} } },
-        { "Intel(R) HD Graphics 5500 BroadWell U-Processor GT2", { {"KWG",32}, {"KWI",8}, {"MDIMA",8}, {"MDIMC",8}, {"MWG",64}, {"NDIMB",32}, {"NDIMC",16}, {"NWG",64}, {"SA",1}, {"SB",1}, {"STRM",1}, {"STRN",1}, {"VWM",4}, {"VWN",2} } },
-        { "Intel(R) HD Graphics Haswell Ultrabook GT2 Mobile", { {"KWG",16}, {"KWI",2}, {"MDIMA",16}, {"MDIMC",8}, {"MWG",32}, {"NDIMB",8}, {"NDIMC",16}, {"NWG",128}, {"SA",1}, {"SB",1}, {"STRM",1}, {"STRN",1}, {"VWM",2}, {"VWN",4} } },
-        { "Intel(R) HD Graphics IvyBridge M GT2",            { {"KWG",32}, {"KWI",2}, {"MDIMA",16}, {"MDIMC",16}, {"MWG",64}, {"NDIMB",16}, {"NDIMC",8}, {"NWG",64}, {"SA",1}, {"SB",1}, {"STRM",1}, {"STRN",0}, {"VWM",2}, {"VWN",4} } },
-        { "Intel(R) HD Graphics Skylake ULT GT2",            { {"KWG",32}, {"KWI",2}, {"MDIMA",16}, {"MDIMC",16}, {"MWG",64}, {"NDIMB",8}, {"NDIMC",8}, {"NWG",64}, {"SA",1}, {"SB",1}, {"STRM",0}, {"STRN",0}, {"VWM",4}, {"VWN",4} } },
-        { "Iris",                                            { {"KWG",16}, {"KWI",8}, {"MDIMA",16}, {"MDIMC",8}, {"MWG",128}, {"NDIMB",32}, {"NDIMC",16}, {"NWG",64}, {"SA",1}, {"SB",1}, {"STRM",1}, {"STRN",1}, {"VWM",4}, {"VWN",1} } },
-        { "Iris Pro",                                        { {"KWG",16}, {"KWI",2}, {"MDIMA",16}, {"MDIMC",8}, {"MWG",64}, {"NDIMB",32}, {"NDIMC",32}, {"NWG",128}, {"SA",1}, {"SB",1}, {"STRM",1}, {"STRN",0}, {"VWM",4}, {"VWN",4} } },
-        { "default",                                         { {"KWG",32}, {"KWI",2}, {"MDIMA",16}, {"MDIMC",16}, {"MWG",64}, {"NDIMB",8}, {"NDIMC",8}, {"NWG",64}, {"SA",1}, {"SB",1}, {"STRM",0}, {"STRN",0}, {"VWM",4}, {"VWN",4} } },
+        { "Intel(R) HD Graphics 530",                        XgemmParameters[19] },
+        { "Intel(R) HD Graphics 5500 BroadWell U-Processor GT2", XgemmParameters[20] },
+        { "Intel(R) HD Graphics Haswell Ultrabook GT2 Mobile", XgemmParameters[21] },
+        { "Intel(R) HD Graphics IvyBridge M GT2",            XgemmParameters[22] },
+        { "Intel(R) HD Graphics Skylake ULT GT2",            XgemmParameters[23] },
+        { "Iris",                                            XgemmParameters[24] },
+        { "Iris Pro",                                        XgemmParameters[25] },
+        { "default",                                         XgemmParameters[23] },
       }
     },
     { // Intel accelerators
       kDeviceTypeAccelerator, "Intel", {
-        { "Intel(R) Many Integrated Core Acceleration Card", { {"KWG",32}, {"KWI",2}, {"MDIMA",32}, {"MDIMC",32}, {"MWG",32}, {"NDIMB",32}, {"NDIMC",8}, {"NWG",128}, {"SA",0}, {"SB",0}, {"STRM",1}, {"STRN",0}, {"VWM",1}, {"VWN",4} } },
-        { "default",                                         { {"KWG",32}, {"KWI",2}, {"MDIMA",32}, {"MDIMC",32}, {"MWG",32}, {"NDIMB",32}, {"NDIMC",8}, {"NWG",128}, {"SA",0}, {"SB",0}, {"STRM",1}, {"STRN",0}, {"VWM",1}, {"VWN",4} } },
+        { "Intel(R) Many Integrated Core Acceleration Card", XgemmParameters[26] },
+        { "default",                                         XgemmParameters[26] },
       }
     },
     { // NVIDIA GPUs
       kDeviceTypeGPU, "NVIDIA", {
-        { "GRID K520",                                       { {"KWG",16}, {"KWI",2}, {"MDIMA",16}, {"MDIMC",8}, {"MWG",32}, {"NDIMB",8}, {"NDIMC",16}, {"NWG",64}, {"SA",1}, {"SB",1}, {"STRM",1}, {"STRN",1}, {"VWM",2}, {"VWN",4} } },
-        { "GeForce GT 650M",                                 { {"KWG",32}, {"KWI",2}, {"MDIMA",8}, {"MDIMC",8}, {"MWG",32}, {"NDIMB",32}, {"NDIMC",32}, {"NWG",64}, {"SA",1}, {"SB",1}, {"STRM",0}, {"STRN",0}, {"VWM",4}, {"VWN",2} } },
-        { "GeForce GTX 1070",                                { {"KWG",16}, {"KWI",2}, {"MDIMA",32}, {"MDIMC",16}, {"MWG",128}, {"NDIMB",32}, {"NDIMC",8}, {"NWG",128}, {"SA",1}, {"SB",1}, {"STRM",1}, {"STRN",0}, {"VWM",4}, {"VWN",1} } },
-        { "GeForce GTX 1080",                                { {"KWG",32}, {"KWI",2}, {"MDIMA",16}, {"MDIMC",8}, {"MWG",64}, {"NDIMB",8}, {"NDIMC",8}, {"NWG",64}, {"SA",1}, {"SB",1}, {"STRM",1}, {"STRN",1}, {"VWM",4}, {"VWN",8} } },
-        { "GeForce GTX 480",                                 { {"KWG",16}, {"KWI",2}, {"MDIMA",16}, {"MDIMC",8}, {"MWG",64}, {"NDIMB",32}, {"NDIMC",16}, {"NWG",64}, {"SA",1}, {"SB",1}, {"STRM",1}, {"STRN",1}, {"VWM",2}, {"VWN",2} } },
-        { "GeForce GTX 670",                                 { {"KWG",16}, {"KWI",2}, {"MDIMA",8}, {"MDIMC",8}, {"MWG",64}, {"NDIMB",16}, {"NDIMC",16}, {"NWG",64}, {"SA",1}, {"SB",1}, {"STRM",1}, {"STRN",0}, {"VWM",2}, {"VWN",4} } },
-        { "GeForce GTX 680",                                 { {"KWG",32}, {"KWI",8}, {"MDIMA",8}, {"MDIMC",16}, {"MWG",64}, {"NDIMB",32}, {"NDIMC",16}, {"NWG",128}, {"SA",1}, {"SB",1}, {"STRM",0}, {"STRN",0}, {"VWM",4}, {"VWN",2} } },
-        { "GeForce GTX 750",                                 { {"KWG",16}, {"KWI",2}, {"MDIMA",16}, {"MDIMC",16}, {"MWG",64}, {"NDIMB",32}, {"NDIMC",8}, {"NWG",128}, {"SA",1}, {"SB",1}, {"STRM",1}, {"STRN",1}, {"VWM",1}, {"VWN",2} } },
-        { "GeForce GTX 750 Ti",                              { {"KWG",16}, {"KWI",2}, {"MDIMA",16}, {"MDIMC",16}, {"MWG",128}, {"NDIMB",32}, {"NDIMC",8}, {"NWG",64}, {"SA",1}, {"SB",1}, {"STRM",0}, {"STRN",1}, {"VWM",8}, {"VWN",2} } },
-        { "GeForce GTX 980",                                 { {"KWG",16}, {"KWI",2}, {"MDIMA",16}, {"MDIMC",16}, {"MWG",64}, {"NDIMB",16}, {"NDIMC",8}, {"NWG",128}, {"SA",1}, {"SB",1}, {"STRM",1}, {"STRN",0}, {"VWM",4}, {"VWN",8} } },
-        { "GeForce GTX TITAN",                               { {"KWG",16}, {"KWI",8}, {"MDIMA",32}, {"MDIMC",16}, {"MWG",64}, {"NDIMB",8}, {"NDIMC",8}, {"NWG",64}, {"SA",1}, {"SB",1}, {"STRM",1}, {"STRN",0}, {"VWM",2}, {"VWN",2} } },
-        { "GeForce GTX TITAN Black",                         { {"KWG",16}, {"KWI",2}, {"MDIMA",16}, {"MDIMC",8}, {"MWG",64}, {"NDIMB",16}, {"NDIMC",16}, {"NWG",64}, {"SA",1}, {"SB",1}, {"STRM",1}, {"STRN",0}, {"VWM",4}, {"VWN",1} } },
-        { "GeForce GTX TITAN X",                             { {"KWG",16}, {"KWI",2}, {"MDIMA",8}, {"MDIMC",16}, {"MWG",128}, {"NDIMB",8}, {"NDIMC",8}, {"NWG",128}, {"SA",1}, {"SB",1}, {"STRM",1}, {"STRN",1}, {"VWM",4}, {"VWN",8} } },
-        { "TITAN X (Pascal)",                                { {"KWG",32}, {"KWI",2}, {"MDIMA",16}, {"MDIMC",16}, {"MWG",64}, {"NDIMB",8}, {"NDIMC",8}, {"NWG",64}, {"SA",1}, {"SB",1}, {"STRM",0}, {"STRN",0}, {"VWM",4}, {"VWN",1} } },
-        { "Tesla K20m",                                      { {"KWG",16}, {"KWI",2}, {"MDIMA",32}, {"MDIMC",16}, {"MWG",64}, {"NDIMB",16}, {"NDIMC",8}, {"NWG",64}, {"SA",1}, {"SB",1}, {"STRM",1}, {"STRN",0}, {"VWM",2}, {"VWN",4} } },
-        { "Tesla K40m",                                      { {"KWG",16}, {"KWI",8}, {"MDIMA",16}, {"MDIMC",8}, {"MWG",64}, {"NDIMB",16}, {"NDIMC",16}, {"NWG",128}, {"SA",1}, {"SB",1}, {"STRM",1}, {"STRN",0}, {"VWM",2}, {"VWN",4} } },
-        { "default",                                         { {"KWG",32}, {"KWI",2}, {"MDIMA",16}, {"MDIMC",16}, {"MWG",64}, {"NDIMB",8}, {"NDIMC",8}, {"NWG",64}, {"SA",1}, {"SB",1}, {"STRM",0}, {"STRN",0}, {"VWM",4}, {"VWN",2} } },
+        { "GRID K520",                                       XgemmParameters[27] },
+        { "GeForce GT 650M",                                 XgemmParameters[28] },
+        { "GeForce GTX 1070",                                XgemmParameters[29] },
+        { "GeForce GTX 1080",                                XgemmParameters[30] },
+        { "GeForce GTX 480",                                 XgemmParameters[31] },
+        { "GeForce GTX 670",                                 XgemmParameters[32] },
+        { "GeForce GTX 680",                                 XgemmParameters[33] },
+        { "GeForce GTX 750",                                 XgemmParameters[34] },
+        { "GeForce GTX 750 Ti",                              XgemmParameters[35] },
+        { "GeForce GTX 980",                                 XgemmParameters[36] },
+        { "GeForce GTX TITAN",                               XgemmParameters[37] },
+        { "GeForce GTX TITAN Black",                         XgemmParameters[38] },
+        { "GeForce GTX TITAN X",                             XgemmParameters[39] },
+        { "TITAN X (Pascal)",                                XgemmParameters[40] },
+        { "Tesla K20m",                                      XgemmParameters[41] },
+        { "Tesla K40m",                                      XgemmParameters[42] },
+        { "default",                                         XgemmParameters[43] },
       }
     },
     { // Default
       kDeviceTypeAll, "default", {
-        { "default",                                         { {"KWG",32}, {"KWI",2}, {"MDIMA",16}, {"MDIMC",16}, {"MWG",64}, {"NDIMB",8}, {"NDIMC",8}, {"NWG",64}, {"SA",1}, {"SB",1}, {"STRM",0}, {"STRN",0}, {"VWM",4}, {"VWN",4} } },
+        { "default",                                         XgemmParameters[23] },
       }
     },
   }
@@ -125,76 +278,76 @@ const Database::DatabaseEntry XgemmComplexSingle = {
   "Xgemm", Precision::kComplexSingle, {
     { // AMD GPUs
       kDeviceTypeGPU, "AMD", {
-        { "AMD Radeon R9 M370X Compute Engine",              { {"KWG",32}, {"KWI",2}, {"MDIMA",32}, {"MDIMC",32}, {"MWG",64}, {"NDIMB",8}, {"NDIMC",8}, {"NWG",64}, {"SA",0}, {"SB",0}, {"STRM",1}, {"STRN",1}, {"VWM",2}, {"VWN",8} } },
-        { "ATI Radeon HD 6750M",                             { {"KWG",32}, {"KWI",2}, {"MDIMA",8}, {"MDIMC",8}, {"MWG",32}, {"NDIMB",16}, {"NDIMC",16}, {"NWG",64}, {"SA",1}, {"SB",1}, {"STRM",0}, {"STRN",0}, {"VWM",4}, {"VWN",4} } },
-        { "Ellesmere",                                       { {"KWG",32}, {"KWI",2}, {"MDIMA",16}, {"MDIMC",16}, {"MWG",32}, {"NDIMB",8}, {"NDIMC",8}, {"NWG",32}, {"SA",1}, {"SB",1}, {"STRM",0}, {"STRN",0}, {"VWM",1}, {"VWN",4} } },
-        { "Fiji",                                            { {"KWG",32}, {"KWI",2}, {"MDIMA",16}, {"MDIMC",16}, {"MWG",32}, {"NDIMB",16}, {"NDIMC",16}, {"NWG",32}, {"SA",1}, {"SB",1}, {"STRM",0}, {"STRN",0}, {"VWM",1}, {"VWN",2} } },
-        { "Hawaii",                                          { {"KWG",32}, {"KWI",2}, {"MDIMA",32}, {"MDIMC",8}, {"MWG",32}, {"NDIMB",8}, {"NDIMC",16}, {"NWG",32}, {"SA",1}, {"SB",0}, {"STRM",1}, {"STRN",0}, {"VWM",1}, {"VWN",1} } },
-        { "Oland",                                           { {"KWG",32}, {"KWI",2}, {"MDIMA",16}, {"MDIMC",8}, {"MWG",32}, {"NDIMB",32}, {"NDIMC",32}, {"NWG",128}, {"SA",1}, {"SB",0}, {"STRM",0}, {"STRN",1}, {"VWM",2}, {"VWN",4} } },
-        { "Pitcairn",                                        { {"KWG",16}, {"KWI",2}, {"MDIMA",8}, {"MDIMC",8}, {"MWG",32}, {"NDIMB",8}, {"NDIMC",8}, {"NWG",32}, {"SA",0}, {"SB",1}, {"STRM",1}, {"STRN",1}, {"VWM",4}, {"VWN",2} } },
-        { "Tahiti",                                          { {"KWG",16}, {"KWI",2}, {"MDIMA",8}, {"MDIMC",8}, {"MWG",32}, {"NDIMB",8}, {"NDIMC",16}, {"NWG",32}, {"SA",1}, {"SB",0}, {"STRM",0}, {"STRN",1}, {"VWM",2}, {"VWN",1} } },
-        { "Tonga",                                           { {"KWG",16}, {"KWI",2}, {"MDIMA",32}, {"MDIMC",8}, {"MWG",64}, {"NDIMB",16}, {"NDIMC",32}, {"NWG",64}, {"SA",1}, {"SB",1}, {"STRM",1}, {"STRN",0}, {"VWM",2}, {"VWN",1} } },
-        { "Turks",                                           { {"KWG",16}, {"KWI",2}, {"MDIMA",8}, {"MDIMC",8}, {"MWG",32}, {"NDIMB",32}, {"NDIMC",8}, {"NWG",32}, {"SA",0}, {"SB",1}, {"STRM",0}, {"STRN",0}, {"VWM",2}, {"VWN",1} } },
-        { "default",                                         { {"KWG",32}, {"KWI",2}, {"MDIMA",16}, {"MDIMC",16}, {"MWG",32}, {"NDIMB",16}, {"NDIMC",16}, {"NWG",32}, {"SA",1}, {"SB",1}, {"STRM",0}, {"STRN",0}, {"VWM",1}, {"VWN",2} } },
+        { "AMD Radeon R9 M370X Compute Engine",              XgemmParameters[44] },
+        { "ATI Radeon HD 6750M",                             XgemmParameters[45] },
+        { "Ellesmere",                                       XgemmParameters[46] },
+        { "Fiji",                                            XgemmParameters[47] },
+        { "Hawaii",                                          XgemmParameters[48] },
+        { "Oland",                                           XgemmParameters[49] },
+        { "Pitcairn",                                        XgemmParameters[50] },
+        { "Tahiti",                                          XgemmParameters[51] },
+        { "Tonga",                                           XgemmParameters[52] },
+        { "Turks",                                           XgemmParameters[53] },
+        { "default",                                         XgemmParameters[47] },
       }
     },
     { // ARM GPUs
       kDeviceTypeGPU, "ARM", {
-        { "Mali-T628",                                       { {"KWG",16}, {"KWI",2}, {"MDIMA",8}, {"MDIMC",16}, {"MWG",128}, {"NDIMB",16}, {"NDIMC",8}, {"NWG",128}, {"SA",0}, {"SB",0}, {"STRM",0}, {"STRN",1}, {"VWM",8}, {"VWN",1} } },
-        { "default",                                         { {"KWG",16}, {"KWI",2}, {"MDIMA",8}, {"MDIMC",16}, {"MWG",128}, {"NDIMB",16}, {"NDIMC",8}, {"NWG",128}, {"SA",0}, {"SB",0}, {"STRM",0}, {"STRN",1}, {"VWM",8}, {"VWN",1} } },
+        { "Mali-T628",                                       XgemmParameters[54] },
+        { "default",                                         XgemmParameters[54] },
       }
     },
     { // Intel CPUs
       kDeviceTypeCPU, "Intel", {
-        { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       { {"KWG",16}, {"KWI",2}, {"MDIMA",32}, {"MDIMC",8}, {"MWG",128}, {"NDIMB",16}, {"NDIMC",16}, {"NWG",128}, {"SA",1}, {"SB",1}, {"STRM",0}, {"STRN",1}, {"VWM",1}, {"VWN",2} } },
-        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {"KWG",32}, {"KWI",2}, {"MDIMA",32}, {"MDIMC",16}, {"MWG",32}, {"NDIMB",16}, {"NDIMC",16}, {"NWG",64}, {"SA",0}, {"SB",1}, {"STRM",1}, {"STRN",0}, {"VWM",1}, {"VWN",2} } },
-        { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         { {"KWG",32}, {"KWI",2}, {"MDIMA",8}, {"MDIMC",8}, {"MWG",128}, {"NDIMB",16}, {"NDIMC",32}, {"NWG",128}, {"SA",0}, {"SB",0}, {"STRM",0}, {"STRN",0}, {"VWM",1}, {"VWN",4} } },
-        { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        { {"KWG",32}, {"KWI",2}, {"MDIMA",8}, {"MDIMC",8}, {"MWG",128}, {"NDIMB",32}, {"NDIMC",8}, {"NWG",128}, {"SA",0}, {"SB",0}, {"STRM",0}, {"STRN",0}, {"VWM",1}, {"VWN",4} } },
-        { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        { {"KWG",32}, {"KWI",2}, {"MDIMA",8}, {"MDIMC",16}, {"MWG",16}, {"NDIMB",16}, {"NDIMC",16}, {"NWG",128}, {"SA",0}, {"SB",0}, {"STRM",1}, {"STRN",1}, {"VWM",1}, {"VWN",4} } },
-        { "default",                                         { {"KWG",32}, {"KWI",2}, {"MDIMA",8}, {"MDIMC",8}, {"MWG",64}, {"NDIMB",8}, {"NDIMC",8}, {"NWG",64}, {"SA",1}, {"SB",1}, {"STRM",0}, {"STRN",0}, {"VWM",1}, {"VWN",4} } },
+        { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       XgemmParameters[55] },
+        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        XgemmParameters[56] },
+        { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         XgemmParameters[57] },
+        { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        XgemmParameters[58] },
+        { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        XgemmParameters[59] },
+        { "default",                                         XgemmParameters[60] },
       }
     },
     { // Intel GPUs
       kDeviceTypeGPU, "Intel", {
-        { "Intel(R) HD Graphics 530",                        { {"KWG",16}, {"KWI",8}, {"MDIMA",8}, {"MDIMC",16}, {"MWG",64}, {"NDIMB",32}, {"NDIMC",8}, {"NWG",32}, {"SA",0}, {"SB",0}, {"STRM",0}, {"STRN",0}, {"VWM",2}, {"VWN",1} } },
-        { "Intel(R) HD Graphics 5500 BroadWell U-Processor GT2", { {"KWG",16}, {"KWI",8}, {"MDIMA",8}, {"MDIMC",8}, {"MWG",32}, {"NDIMB",16}, {"NDIMC",16}, {"NWG",64}, {"SA",1}, {"SB",0}, {"STRM",0}, {"STRN",0}, {"VWM",4}, {"VWN",4} } },
-        { "Intel(R) HD Graphics Haswell Ultrabook GT2 Mobile", { {"KWG",32}, {"KWI",8}, {"MDIMA",16}, {"MDIMC",16}, {"MWG",64}, {"NDIMB",16}, {"NDIMC",16}, {"NWG",64}, {"SA",1}, {"SB",1}, {"STRM",1}, {"STRN",1}, {"VWM",2}, {"VWN",1} } },
-        { "Intel(R) HD Graphics IvyBridge M GT2",            { {"KWG",32}, {"KWI",2}, {"MDIMA",16}, {"MDIMC",16}, {"MWG",64}, {"NDIMB",16}, {"NDIMC",16}, {"NWG",64}, {"SA",1}, {"SB",1}, {"STRM",0}, {"STRN",0}, {"VWM",4}, {"VWN",4} } },
-        { "Intel(R) HD Graphics Skylake ULT GT2",            { {"KWG",32}, {"KWI",2}, {"MDIMA",16}, {"MDIMC",16}, {"MWG",64}, {"NDIMB",16}, {"NDIMC",16}, {"NWG",64}, {"SA",0}, {"SB",0}, {"STRM",0}, {"STRN",0}, {"VWM",4}, {"VWN",2} } },
-        { "Iris",                                            { {"KWG",32}, {"KWI",8}, {"MDIMA",32}, {"MDIMC",16}, {"MWG",64}, {"NDIMB",8}, {"NDIMC",16}, {"NWG",64}, {"SA",1}, {"SB",0}, {"STRM",1}, {"STRN",0}, {"VWM",1}, {"VWN",1} } },
-        { "Iris Pro",                                        { {"KWG",16}, {"KWI",2}, {"MDIMA",8}, {"MDIMC",8}, {"MWG",32}, {"NDIMB",32}, {"NDIMC",8}, {"NWG",32}, {"SA",1}, {"SB",1}, {"STRM",1}, {"STRN",1}, {"VWM",1}, {"VWN",1} } },
-        { "default",                                         { {"KWG",32}, {"KWI",2}, {"MDIMA",8}, {"MDIMC",8}, {"MWG",32}, {"NDIMB",8}, {"NDIMC",8}, {"NWG",32}, {"SA",1}, {"SB",1}, {"STRM",0}, {"STRN",0}, {"VWM",4}, {"VWN",2} } },
+        { "Intel(R) HD Graphics 530",                        XgemmParameters[61] },
+        { "Intel(R) HD Graphics 5500 BroadWell U-Processor GT2", XgemmParameters[62] },
+        { "Intel(R) HD Graphics Haswell Ultrabook GT2 Mobile", XgemmParameters[63] },
+        { "Intel(R) HD Graphics IvyBridge M GT2",            XgemmParameters[4] },
+        { "Intel(R) HD Graphics Skylake ULT GT2",            XgemmParameters[64] },
+        { "Iris",                                            XgemmParameters[65] },
+        { "Iris Pro",                                        XgemmParameters[66] },
+        { "default",                                         XgemmParameters[67] },
       }
     },
     { // Intel accelerators
       kDeviceTypeAccelerator, "Intel", {
-        { "Intel(R) Many Integrated Core Acceleration Card", { {"KWG",32}, {"KWI",2}, {"MDIMA",32}, {"MDIMC",32}, {"MWG",32}, {"NDIMB",32}, {"NDIMC",16}, {"NWG",128}, {"SA",1}, {"SB",0}, {"STRM",0}, {"STRN",0}, {"VWM",1}, {"VWN",4} } },
-        { "default",                                         { {"KWG",32}, {"KWI",2}, {"MDIMA",32}, {"MDIMC",32}, {"MWG",32}, {"NDIMB",32}, {"NDIMC",16}, {"NWG",128}, {"SA",1}, {"SB",0}, {"STRM",0}, {"STRN",0}, {"VWM",1}, {"VWN",4} } },
+        { "Intel(R) Many Integrated Core Acceleration Card", XgemmParameters[68] },
+        { "default",                                         XgemmParameters[68] },
       }
     },
     { // NVIDIA GPUs
       kDeviceTypeGPU, "NVIDIA", {
-        { "GRID K520",                                       { {"KWG",16}, {"KWI",8}, {"MDIMA",32}, {"MDIMC",32}, {"MWG",64}, {"NDIMB",32}, {"NDIMC",16}, {"NWG",128}, {"SA",1}, {"SB",0}, {"STRM",1}, {"STRN",0}, {"VWM",1}, {"VWN",4} } },
-        { "GeForce GTX 1070",                                { {"KWG",16}, {"KWI",2}, {"MDIMA",16}, {"MDIMC",16}, {"MWG",128}, {"NDIMB",16}, {"NDIMC",16}, {"NWG",64}, {"SA",1}, {"SB",1}, {"STRM",1}, {"STRN",1}, {"VWM",2}, {"VWN",4} } },
-        { "GeForce GTX 1080",                                { {"KWG",16}, {"KWI",2}, {"MDIMA",32}, {"MDIMC",16}, {"MWG",64}, {"NDIMB",32}, {"NDIMC",8}, {"NWG",64}, {"SA",1}, {"SB",1}, {"STRM",0}, {"STRN",0}, {"VWM",1}, {"VWN",2} } },
-        { "GeForce GTX 480",                                 { {"KWG",16}, {"KWI",2}, {"MDIMA",16}, {"MDIMC",16}, {"MWG",32}, {"NDIMB",32}, {"NDIMC",16}, {"NWG",128}, {"SA",0}, {"SB",1}, {"STRM",1}, {"STRN",1}, {"VWM",2}, {"VWN",2} } },
-        { "GeForce GTX 670",                                 { {"KWG",16}, {"KWI",2}, {"MDIMA",32}, {"MDIMC",32}, {"MWG",64}, {"NDIMB",32}, {"NDIMC",8}, {"NWG",32}, {"SA",1}, {"SB",1}, {"STRM",1}, {"STRN",1}, {"VWM",1}, {"VWN",1} } },
-        { "GeForce GTX 680",                                 { {"KWG",16}, {"KWI",2}, {"MDIMA",32}, {"MDIMC",16}, {"MWG",64}, {"NDIMB",32}, {"NDIMC",32}, {"NWG",128}, {"SA",1}, {"SB",0}, {"STRM",0}, {"STRN",0}, {"VWM",2}, {"VWN",2} } },
-        { "GeForce GTX 750",                                 { {"KWG",16}, {"KWI",8}, {"MDIMA",16}, {"MDIMC",16}, {"MWG",64}, {"NDIMB",16}, {"NDIMC",16}, {"NWG",64}, {"SA",1}, {"SB",1}, {"STRM",1}, {"STRN",0}, {"VWM",2}, {"VWN",2} } },
-        { "GeForce GTX 750 Ti",                              { {"KWG",16}, {"KWI",2}, {"MDIMA",16}, {"MDIMC",8}, {"MWG",32}, {"NDIMB",32}, {"NDIMC",16}, {"NWG",64}, {"SA",1}, {"SB",1}, {"STRM",1}, {"STRN",0}, {"VWM",1}, {"VWN",2} } },
-        { "GeForce GTX 980",                                 { {"KWG",32}, {"KWI",8}, {"MDIMA",32}, {"MDIMC",32}, {"MWG",64}, {"NDIMB",16}, {"NDIMC",16}, {"NWG",64}, {"SA",1}, {"SB",1}, {"STRM",1}, {"STRN",0}, {"VWM",2}, {"VWN",1} } },
-        { "GeForce GTX TITAN",                               { {"KWG",16}, {"KWI",8}, {"MDIMA",16}, {"MDIMC",16}, {"MWG",64}, {"NDIMB",32}, {"NDIMC",16}, {"NWG",64}, {"SA",1}, {"SB",1}, {"STRM",1}, {"STRN",0}, {"VWM",1}, {"VWN",1} } },
-        { "GeForce GTX TITAN Black",                         { {"KWG",16}, {"KWI",2}, {"MDIMA",8}, {"MDIMC",16}, {"MWG",64}, {"NDIMB",8}, {"NDIMC",8}, {"NWG",32}, {"SA",0}, {"SB",1}, {"STRM",1}, {"STRN",0}, {"VWM",1}, {"VWN",2} } },
-        { "GeForce GTX TITAN X",                             { {"KWG",16}, {"KWI",2}, {"MDIMA",8}, {"MDIMC",8}, {"MWG",64}, {"NDIMB",8}, {"NDIMC",8}, {"NWG",32}, {"SA",1}, {"SB",0}, {"STRM",1}, {"STRN",1}, {"VWM",1}, {"VWN",4} } },
-        { "TITAN X (Pascal)",                                { {"KWG",32}, {"KWI",2}, {"MDIMA",32}, {"MDIMC",32}, {"MWG",64}, {"NDIMB",8}, {"NDIMC",8}, {"NWG",32}, {"SA",1}, {"SB",1}, {"STRM",0}, {"STRN",0}, {"VWM",2}, {"VWN",4} } },
-        { "Tesla K20m",                                      { {"KWG",32}, {"KWI",2}, {"MDIMA",8}, {"MDIMC",16}, {"MWG",64}, {"NDIMB",8}, {"NDIMC",16}, {"NWG",64}, {"SA",1}, {"SB",0}, {"STRM",0}, {"STRN",0}, {"VWM",1}, {"VWN",4} } },
-        { "Tesla K40m",                                      { {"KWG",16}, {"KWI",2}, {"MDIMA",32}, {"MDIMC",32}, {"MWG",32}, {"NDIMB",32}, {"NDIMC",8}, {"NWG",64}, {"SA",0}, {"SB",1}, {"STRM",0}, {"STRN",0}, {"VWM",1}, {"VWN",1} } },
-        { "default",                                         { {"KWG",32}, {"KWI",2}, {"MDIMA",8}, {"MDIMC",8}, {"MWG",16}, {"NDIMB",32}, {"NDIMC",32}, {"NWG",64}, {"SA",1}, {"SB",1}, {"STRM",0}, {"STRN",0}, {"VWM",1}, {"VWN",1} } },
+        { "GRID K520",                                       XgemmParameters[69] },
+        { "GeForce GTX 1070",                                XgemmParameters[70] },
+        { "GeForce GTX 1080",                                XgemmParameters[71] },
+        { "GeForce GTX 480",                                 XgemmParameters[72] },
+        { "GeForce GTX 670",                                 XgemmParameters[73] },
+        { "GeForce GTX 680",                                 XgemmParameters[74] },
+        { "GeForce GTX 750",                                 XgemmParameters[75] },
+        { "GeForce GTX 750 Ti",                              XgemmParameters[76] },
+        { "GeForce GTX 980",                                 XgemmParameters[77] },
+        { "GeForce GTX TITAN",                               XgemmParameters[78] },
+        { "GeForce GTX TITAN Black",                         XgemmParameters[79] },
+        { "GeForce GTX TITAN X",                             XgemmParameters[80] },
+        { "TITAN X (Pascal)",                                XgemmParameters[81] },
+        { "Tesla K20m",                                      XgemmParameters[82] },
+        { "Tesla K40m",                                      XgemmParameters[83] },
+        { "default",                                         XgemmParameters[84] },
       }
     },
     { // Default
       kDeviceTypeAll, "default", {
-        { "default",                                         { {"KWG",32}, {"KWI",2}, {"MDIMA",16}, {"MDIMC",16}, {"MWG",32}, {"NDIMB",8}, {"NDIMC",8}, {"NWG",32}, {"SA",1}, {"SB",1}, {"STRM",0}, {"STRN",0}, {"VWM",2}, {"VWN",1} } },
+        { "default",                                         XgemmParameters[85] },
       }
     },
   }
@@ -206,62 +359,62 @@ const Database::DatabaseEntry XgemmDouble = {
   "Xgemm", Precision::kDouble, {
     { // AMD GPUs
       kDeviceTypeGPU, "AMD", {
-        { "AMD Radeon R9 M370X Compute Engine",              { {"KWG",32}, {"KWI",2}, {"MDIMA",16}, {"MDIMC",16}, {"MWG",64}, {"NDIMB",8}, {"NDIMC",8}, {"NWG",32}, {"SA",0}, {"SB",0}, {"STRM",0}, {"STRN",0}, {"VWM",4}, {"VWN",4} } },
-        { "Ellesmere",                                       { {"KWG",32}, {"KWI",2}, {"MDIMA",16}, {"MDIMC",16}, {"MWG",32}, {"NDIMB",16}, {"NDIMC",16}, {"NWG",64}, {"SA",1}, {"SB",1}, {"STRM",0}, {"STRN",0}, {"VWM",2}, {"VWN",2} } },
-        { "Fiji",                                            { {"KWG",32}, {"KWI",2}, {"MDIMA",16}, {"MDIMC",16}, {"MWG",32}, {"NDIMB",16}, {"NDIMC",16}, {"NWG",32}, {"SA",1}, {"SB",1}, {"STRM",0}, {"STRN",0}, {"VWM",2}, {"VWN",2} } },
-        { "Hawaii",                                          { {"KWG",16}, {"KWI",8}, {"MDIMA",32}, {"MDIMC",8}, {"MWG",128}, {"NDIMB",8}, {"NDIMC",8}, {"NWG",32}, {"SA",0}, {"SB",1}, {"STRM",0}, {"STRN",0}, {"VWM",1}, {"VWN",4} } },
-        { "Oland",                                           { {"KWG",16}, {"KWI",2}, {"MDIMA",8}, {"MDIMC",16}, {"MWG",64}, {"NDIMB",16}, {"NDIMC",8}, {"NWG",16}, {"SA",0}, {"SB",0}, {"STRM",1}, {"STRN",1}, {"VWM",1}, {"VWN",1} } },
-        { "Pitcairn",                                        { {"KWG",32}, {"KWI",2}, {"MDIMA",32}, {"MDIMC",16}, {"MWG",64}, {"NDIMB",8}, {"NDIMC",16}, {"NWG",32}, {"SA",0}, {"SB",0}, {"STRM",0}, {"STRN",0}, {"VWM",1}, {"VWN",2} } },
-        { "Tahiti",                                          { {"KWG",32}, {"KWI",2}, {"MDIMA",16}, {"MDIMC",8}, {"MWG",16}, {"NDIMB",8}, {"NDIMC",8}, {"NWG",32}, {"SA",0}, {"SB",0}, {"STRM",0}, {"STRN",1}, {"VWM",1}, {"VWN",4} } },
-        { "Tonga",                                           { {"KWG",32}, {"KWI",2}, {"MDIMA",16}, {"MDIMC",16}, {"MWG",32}, {"NDIMB",16}, {"NDIMC",16}, {"NWG",32}, {"SA",1}, {"SB",1}, {"STRM",0}, {"STRN",0}, {"VWM",2}, {"VWN",2} } },
-        { "default",                                         { {"KWG",32}, {"KWI",2}, {"MDIMA",16}, {"MDIMC",16}, {"MWG",32}, {"NDIMB",16}, {"NDIMC",16}, {"NWG",32}, {"SA",1}, {"SB",1}, {"STRM",0}, {"STRN",0}, {"VWM",2}, {"VWN",2} } },
+        { "AMD Radeon R9 M370X Compute Engine",              XgemmParameters[86] },
+        { "Ellesmere",                                       XgemmParameters[87] },
+        { "Fiji",                                            XgemmParameters[88] },
+        { "Hawaii",                                          XgemmParameters[89] },
+        { "Oland",                                           XgemmParameters[90] },
+        { "Pitcairn",                                        XgemmParameters[91] },
+        { "Tahiti",                                          XgemmParameters[92] },
+        { "Tonga",                                           XgemmParameters[88] },
+        { "default",                                         XgemmParameters[88] },
       }
     },
     { // ARM GPUs
       kDeviceTypeGPU, "ARM", {
-        { "Mali-T628",                                       { {"KWG",32}, {"KWI",2}, {"MDIMA",8}, {"MDIMC",8}, {"MWG",64}, {"NDIMB",8}, {"NDIMC",8}, {"NWG",16}, {"SA",0}, {"SB",1}, {"STRM",1}, {"STRN",0}, {"VWM",8}, {"VWN",2} } },
-        { "default",                                         { {"KWG",32}, {"KWI",2}, {"MDIMA",8}, {"MDIMC",8}, {"MWG",64}, {"NDIMB",8}, {"NDIMC",8}, {"NWG",16}, {"SA",0}, {"SB",1}, {"STRM",1}, {"STRN",0}, {"VWM",8}, {"VWN",2} } },
+        { "Mali-T628",                                       XgemmParameters[93] },
+        { "default",                                         XgemmParameters[93] },
       }
     },
     { // Intel CPUs
       kDeviceTypeCPU, "Intel", {
-        { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       { {"KWG",16}, {"KWI",2}, {"MDIMA",32}, {"MDIMC",8}, {"MWG",128}, {"NDIMB",16}, {"NDIMC",16}, {"NWG",128}, {"SA",1}, {"SB",1}, {"STRM",1}, {"STRN",1}, {"VWM",2}, {"VWN",8} } },
-        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {"KWG",32}, {"KWI",2}, {"MDIMA",32}, {"MDIMC",16}, {"MWG",128}, {"NDIMB",16}, {"NDIMC",16}, {"NWG",64}, {"SA",0}, {"SB",1}, {"STRM",1}, {"STRN",0}, {"VWM",1}, {"VWN",2} } },
-        { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         { {"KWG",32}, {"KWI",2}, {"MDIMA",16}, {"MDIMC",8}, {"MWG",128}, {"NDIMB",8}, {"NDIMC",8}, {"NWG",64}, {"SA",1}, {"SB",0}, {"STRM",0}, {"STRN",1}, {"VWM",2}, {"VWN",8} } },
-        { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        { {"KWG",32}, {"KWI",2}, {"MDIMA",16}, {"MDIMC",8}, {"MWG",128}, {"NDIMB",8}, {"NDIMC",8}, {"NWG",128}, {"SA",1}, {"SB",0}, {"STRM",0}, {"STRN",0}, {"VWM",2}, {"VWN",8} } },
-        { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        { {"KWG",32}, {"KWI",2}, {"MDIMA",8}, {"MDIMC",16}, {"MWG",128}, {"NDIMB",16}, {"NDIMC",8}, {"NWG",128}, {"SA",0}, {"SB",0}, {"STRM",1}, {"STRN",1}, {"VWM",1}, {"VWN",8} } },
-        { "default",                                         { {"KWG",32}, {"KWI",2}, {"MDIMA",8}, {"MDIMC",8}, {"MWG",64}, {"NDIMB",8}, {"NDIMC",8}, {"NWG",64}, {"SA",1}, {"SB",1}, {"STRM",0}, {"STRN",0}, {"VWM",2}, {"VWN",4} } },
+        { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       XgemmParameters[94] },
+        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        XgemmParameters[95] },
+        { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         XgemmParameters[96] },
+        { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        XgemmParameters[97] },
+        { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        XgemmParameters[98] },
+        { "default",                                         XgemmParameters[99] },
       }
     },
     { // Intel accelerators
       kDeviceTypeAccelerator, "Intel", {
-        { "Intel(R) Many Integrated Core Acceleration Card", { {"KWG",32}, {"KWI",8}, {"MDIMA",8}, {"MDIMC",16}, {"MWG",16}, {"NDIMB",16}, {"NDIMC",16}, {"NWG",128}, {"SA",0}, {"SB",0}, {"STRM",1}, {"STRN",0}, {"VWM",1}, {"VWN",4} } },
-        { "default",                                         { {"KWG",32}, {"KWI",8}, {"MDIMA",8}, {"MDIMC",16}, {"MWG",16}, {"NDIMB",16}, {"NDIMC",16}, {"NWG",128}, {"SA",0}, {"SB",0}, {"STRM",1}, {"STRN",0}, {"VWM",1}, {"VWN",4} } },
+        { "Intel(R) Many Integrated Core Acceleration Card", XgemmParameters[100] },
+        { "default",                                         XgemmParameters[100] },
       }
     },
     { // NVIDIA GPUs
       kDeviceTypeGPU, "NVIDIA", {
-        { "GRID K520",                                       { {"KWG",16}, {"KWI",2}, {"MDIMA",8}, {"MDIMC",8}, {"MWG",16}, {"NDIMB",8}, {"NDIMC",8}, {"NWG",32}, {"SA",1}, {"SB",0}, {"STRM",0}, {"STRN",1}, {"VWM",2}, {"VWN",2} } },
-        { "GeForce GTX 1070",                                { {"KWG",16}, {"KWI",2}, {"MDIMA",8}, {"MDIMC",16}, {"MWG",32}, {"NDIMB",8}, {"NDIMC",8}, {"NWG",64}, {"SA",0}, {"SB",0}, {"STRM",1}, {"STRN",1}, {"VWM",2}, {"VWN",8} } },
-        { "GeForce GTX 1080",                                { {"KWG",32}, {"KWI",2}, {"MDIMA",16}, {"MDIMC",16}, {"MWG",32}, {"NDIMB",16}, {"NDIMC",16}, {"NWG",64}, {"SA",0}, {"SB",0}, {"STRM",0}, {"STRN",0}, {"VWM",2}, {"VWN",4} } },
-        { "GeForce GTX 480",                                 { {"KWG",16}, {"KWI",2}, {"MDIMA",8}, {"MDIMC",16}, {"MWG",32}, {"NDIMB",32}, {"NDIMC",8}, {"NWG",64}, {"SA",1}, {"SB",1}, {"STRM",1}, {"STRN",0}, {"VWM",1}, {"VWN",2} } },
-        { "GeForce GTX 670",                                 { {"KWG",32}, {"KWI",8}, {"MDIMA",16}, {"MDIMC",32}, {"MWG",128}, {"NDIMB",16}, {"NDIMC",8}, {"NWG",32}, {"SA",0}, {"SB",1}, {"STRM",1}, {"STRN",0}, {"VWM",1}, {"VWN",1} } },
-        { "GeForce GTX 680",                                 { {"KWG",32}, {"KWI",8}, {"MDIMA",8}, {"MDIMC",8}, {"MWG",32}, {"NDIMB",16}, {"NDIMC",32}, {"NWG",128}, {"SA",1}, {"SB",0}, {"STRM",0}, {"STRN",1}, {"VWM",2}, {"VWN",4} } },
-        { "GeForce GTX 750",                                 { {"KWG",32}, {"KWI",8}, {"MDIMA",16}, {"MDIMC",32}, {"MWG",64}, {"NDIMB",16}, {"NDIMC",8}, {"NWG",128}, {"SA",0}, {"SB",0}, {"STRM",0}, {"STRN",1}, {"VWM",2}, {"VWN",1} } },
-        { "GeForce GTX 750 Ti",                              { {"KWG",32}, {"KWI",2}, {"MDIMA",8}, {"MDIMC",8}, {"MWG",32}, {"NDIMB",16}, {"NDIMC",16}, {"NWG",32}, {"SA",0}, {"SB",0}, {"STRM",0}, {"STRN",0}, {"VWM",4}, {"VWN",2} } },
-        { "GeForce GTX 980",                                 { {"KWG",32}, {"KWI",8}, {"MDIMA",16}, {"MDIMC",8}, {"MWG",64}, {"NDIMB",32}, {"NDIMC",32}, {"NWG",128}, {"SA",0}, {"SB",0}, {"STRM",1}, {"STRN",0}, {"VWM",2}, {"VWN",4} } },
-        { "GeForce GTX TITAN",                               { {"KWG",16}, {"KWI",8}, {"MDIMA",16}, {"MDIMC",8}, {"MWG",32}, {"NDIMB",16}, {"NDIMC",32}, {"NWG",128}, {"SA",1}, {"SB",1}, {"STRM",1}, {"STRN",1}, {"VWM",2}, {"VWN",2} } },
-        { "GeForce GTX TITAN Black",                         { {"KWG",16}, {"KWI",2}, {"MDIMA",16}, {"MDIMC",8}, {"MWG",16}, {"NDIMB",16}, {"NDIMC",8}, {"NWG",16}, {"SA",1}, {"SB",1}, {"STRM",1}, {"STRN",0}, {"VWM",1}, {"VWN",1} } },
-        { "GeForce GTX TITAN X",                             { {"KWG",16}, {"KWI",8}, {"MDIMA",16}, {"MDIMC",16}, {"MWG",16}, {"NDIMB",16}, {"NDIMC",16}, {"NWG",16}, {"SA",0}, {"SB",0}, {"STRM",0}, {"STRN",0}, {"VWM",1}, {"VWN",1} } },
-        { "TITAN X (Pascal)",                                { {"KWG",32}, {"KWI",2}, {"MDIMA",32}, {"MDIMC",32}, {"MWG",32}, {"NDIMB",16}, {"NDIMC",16}, {"NWG",32}, {"SA",0}, {"SB",0}, {"STRM",0}, {"STRN",0}, {"VWM",1}, {"VWN",2} } },
-        { "Tesla K20m",                                      { {"KWG",16}, {"KWI",2}, {"MDIMA",32}, {"MDIMC",8}, {"MWG",32}, {"NDIMB",16}, {"NDIMC",16}, {"NWG",64}, {"SA",1}, {"SB",0}, {"STRM",0}, {"STRN",0}, {"VWM",1}, {"VWN",1} } },
-        { "Tesla K40m",                                      { {"KWG",32}, {"KWI",2}, {"MDIMA",16}, {"MDIMC",8}, {"MWG",64}, {"NDIMB",16}, {"NDIMC",32}, {"NWG",128}, {"SA",1}, {"SB",0}, {"STRM",1}, {"STRN",1}, {"VWM",2}, {"VWN",4} } },
-        { "default",                                         { {"KWG",32}, {"KWI",2}, {"MDIMA",16}, {"MDIMC",16}, {"MWG",32}, {"NDIMB",16}, {"NDIMC",16}, {"NWG",64}, {"SA",0}, {"SB",0}, {"STRM",0}, {"STRN",0}, {"VWM",2}, {"VWN",4} } },
+        { "GRID K520",                                       XgemmParameters[101] },
+        { "GeForce GTX 1070",                                XgemmParameters[102] },
+        { "GeForce GTX 1080",                                XgemmParameters[103] },
+        { "GeForce GTX 480",                                 XgemmParameters[104] },
+        { "GeForce GTX 670",                                 XgemmParameters[105] },
+        { "GeForce GTX 680",                                 XgemmParameters[106] },
+        { "GeForce GTX 750",                                 XgemmParameters[107] },
+        { "GeForce GTX 750 Ti",                              XgemmParameters[108] },
+        { "GeForce GTX 980",                                 XgemmParameters[109] },
+        { "GeForce GTX TITAN",                               XgemmParameters[110] },
+        { "GeForce GTX TITAN Black",                         XgemmParameters[111] },
+        { "GeForce GTX TITAN X",                             XgemmParameters[112] },
+        { "TITAN X (Pascal)",                                XgemmParameters[113] },
+        { "Tesla K20m",                                      XgemmParameters[114] },
+        { "Tesla K40m",                                      XgemmParameters[115] },
+        { "default",                                         XgemmParameters[103] },
       }
     },
     { // Default
       kDeviceTypeAll, "default", {
-        { "default",                                         { {"KWG",32}, {"KWI",2}, {"MDIMA",8}, {"MDIMC",8}, {"MWG",64}, {"NDIMB",8}, {"NDIMC",8}, {"NWG",32}, {"SA",0}, {"SB",0}, {"STRM",0}, {"STRN",0}, {"VWM",4}, {"VWN",4} } },
+        { "default",                                         XgemmParameters[116] },
       }
     },
   }
@@ -273,61 +426,61 @@ const Database::DatabaseEntry XgemmComplexDouble = {
   "Xgemm", Precision::kComplexDouble, {
     { // AMD GPUs
       kDeviceTypeGPU, "AMD", {
-        { "AMD Radeon R9 M370X Compute Engine",              { {"KWG",32}, {"KWI",8}, {"MDIMA",8}, {"MDIMC",16}, {"MWG",32}, {"NDIMB",16}, {"NDIMC",16}, {"NWG",32}, {"SA",0}, {"SB",0}, {"STRM",1}, {"STRN",1}, {"VWM",2}, {"VWN",2} } },
-        { "Ellesmere",                                       { {"KWG",32}, {"KWI",2}, {"MDIMA",16}, {"MDIMC",16}, {"MWG",16}, {"NDIMB",16}, {"NDIMC",16}, {"NWG",16}, {"SA",1}, {"SB",1}, {"STRM",0}, {"STRN",0}, {"VWM",1}, {"VWN",1} } },
-        { "Fiji",                                            { {"KWG",32}, {"KWI",2}, {"MDIMA",16}, {"MDIMC",16}, {"MWG",16}, {"NDIMB",16}, {"NDIMC",16}, {"NWG",16}, {"SA",1}, {"SB",1}, {"STRM",0}, {"STRN",0}, {"VWM",1}, {"VWN",1} } },
-        { "Hawaii",                                          { {"KWG",16}, {"KWI",2}, {"MDIMA",16}, {"MDIMC",16}, {"MWG",16}, {"NDIMB",16}, {"NDIMC",16}, {"NWG",32}, {"SA",1}, {"SB",0}, {"STRM",0}, {"STRN",0}, {"VWM",1}, {"VWN",2} } },
-        { "Oland",                                           { {"KWG",16}, {"KWI",2}, {"MDIMA",16}, {"MDIMC",8}, {"MWG",16}, {"NDIMB",16}, {"NDIMC",32}, {"NWG",128}, {"SA",0}, {"SB",0}, {"STRM",0}, {"STRN",0}, {"VWM",1}, {"VWN",4} } },
-        { "Pitcairn",                                        { {"KWG",32}, {"KWI",2}, {"MDIMA",16}, {"MDIMC",8}, {"MWG",32}, {"NDIMB",8}, {"NDIMC",32}, {"NWG",32}, {"SA",0}, {"SB",1}, {"STRM",1}, {"STRN",0}, {"VWM",1}, {"VWN",1} } },
-        { "Tahiti",                                          { {"KWG",16}, {"KWI",2}, {"MDIMA",16}, {"MDIMC",8}, {"MWG",16}, {"NDIMB",8}, {"NDIMC",8}, {"NWG",16}, {"SA",0}, {"SB",0}, {"STRM",1}, {"STRN",0}, {"VWM",1}, {"VWN",1} } },
-        { "Tonga",                                           { {"KWG",16}, {"KWI",2}, {"MDIMA",32}, {"MDIMC",16}, {"MWG",32}, {"NDIMB",16}, {"NDIMC",16}, {"NWG",16}, {"SA",1}, {"SB",1}, {"STRM",1}, {"STRN",1}, {"VWM",1}, {"VWN",1} } },
-        { "default",                                         { {"KWG",32}, {"KWI",2}, {"MDIMA",16}, {"MDIMC",16}, {"MWG",16}, {"NDIMB",16}, {"NDIMC",16}, {"NWG",16}, {"SA",1}, {"SB",1}, {"STRM",0}, {"STRN",0}, {"VWM",1}, {"VWN",1} } },
+        { "AMD Radeon R9 M370X Compute Engine",              XgemmParameters[117] },
+        { "Ellesmere",                                       XgemmParameters[118] },
+        { "Fiji",                                            XgemmParameters[118] },
+        { "Hawaii",                                          XgemmParameters[119] },
+        { "Oland",                                           XgemmParameters[120] },
+        { "Pitcairn",                                        XgemmParameters[121] },
+        { "Tahiti",                                          XgemmParameters[122] },
+        { "Tonga",                                           XgemmParameters[123] },
+        { "default",                                         XgemmParameters[118] },
       }
     },
     { // ARM GPUs
       kDeviceTypeGPU, "ARM", {
-        { "Mali-T628",                                       { {"KWG",16}, {"KWI",2}, {"MDIMA",8}, {"MDIMC",8}, {"MWG",64}, {"NDIMB",32}, {"NDIMC",8}, {"NWG",64}, {"SA",0}, {"SB",0}, {"STRM",1}, {"STRN",0}, {"VWM",8}, {"VWN",1} } },
-        { "default",                                         { {"KWG",16}, {"KWI",2}, {"MDIMA",8}, {"MDIMC",8}, {"MWG",64}, {"NDIMB",32}, {"NDIMC",8}, {"NWG",64}, {"SA",0}, {"SB",0}, {"STRM",1}, {"STRN",0}, {"VWM",8}, {"VWN",1} } },
+        { "Mali-T628",                                       XgemmParameters[124] },
+        { "default",                                         XgemmParameters[124] },
       }
     },
     { // Intel CPUs
       kDeviceTypeCPU, "Intel", {
-        { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       { {"KWG",16}, {"KWI",2}, {"MDIMA",32}, {"MDIMC",8}, {"MWG",64}, {"NDIMB",16}, {"NDIMC",8}, {"NWG",128}, {"SA",0}, {"SB",1}, {"STRM",0}, {"STRN",1}, {"VWM",2}, {"VWN",1} } },
-        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {"KWG",32}, {"KWI",2}, {"MDIMA",16}, {"MDIMC",32}, {"MWG",128}, {"NDIMB",16}, {"NDIMC",16}, {"NWG",64}, {"SA",0}, {"SB",1}, {"STRM",0}, {"STRN",0}, {"VWM",2}, {"VWN",4} } },
-        { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         { {"KWG",32}, {"KWI",2}, {"MDIMA",8}, {"MDIMC",8}, {"MWG",128}, {"NDIMB",8}, {"NDIMC",16}, {"NWG",128}, {"SA",0}, {"SB",0}, {"STRM",0}, {"STRN",1}, {"VWM",1}, {"VWN",8} } },
-        { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        { {"KWG",32}, {"KWI",2}, {"MDIMA",8}, {"MDIMC",8}, {"MWG",128}, {"NDIMB",32}, {"NDIMC",8}, {"NWG",128}, {"SA",0}, {"SB",0}, {"STRM",0}, {"STRN",0}, {"VWM",1}, {"VWN",4} } },
-        { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        { {"KWG",32}, {"KWI",8}, {"MDIMA",8}, {"MDIMC",32}, {"MWG",32}, {"NDIMB",8}, {"NDIMC",8}, {"NWG",32}, {"SA",0}, {"SB",1}, {"STRM",0}, {"STRN",0}, {"VWM",1}, {"VWN",2} } },
-        { "default",                                         { {"KWG",32}, {"KWI",2}, {"MDIMA",8}, {"MDIMC",8}, {"MWG",16}, {"NDIMB",8}, {"NDIMC",8}, {"NWG",32}, {"SA",1}, {"SB",1}, {"STRM",0}, {"STRN",0}, {"VWM",1}, {"VWN",2} } },
+        { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       XgemmParameters[125] },
+        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        XgemmParameters[126] },
+        { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         XgemmParameters[127] },
+        { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        XgemmParameters[58] },
+        { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        XgemmParameters[128] },
+        { "default",                                         XgemmParameters[129] },
       }
     },
     { // Intel accelerators
       kDeviceTypeAccelerator, "Intel", {
-        { "Intel(R) Many Integrated Core Acceleration Card", { {"KWG",32}, {"KWI",2}, {"MDIMA",16}, {"MDIMC",16}, {"MWG",16}, {"NDIMB",16}, {"NDIMC",8}, {"NWG",32}, {"SA",0}, {"SB",0}, {"STRM",1}, {"STRN",0}, {"VWM",1}, {"VWN",1} } },
-        { "default",                                         { {"KWG",32}, {"KWI",2}, {"MDIMA",16}, {"MDIMC",16}, {"MWG",16}, {"NDIMB",16}, {"NDIMC",8}, {"NWG",32}, {"SA",0}, {"SB",0}, {"STRM",1}, {"STRN",0}, {"VWM",1}, {"VWN",1} } },
+        { "Intel(R) Many Integrated Core Acceleration Card", XgemmParameters[130] },
+        { "default",                                         XgemmParameters[130] },
       }
     },
     { // NVIDIA GPUs
       kDeviceTypeGPU, "NVIDIA", {
-        { "GRID K520",                                       { {"KWG",32}, {"KWI",8}, {"MDIMA",16}, {"MDIMC",16}, {"MWG",16}, {"NDIMB",8}, {"NDIMC",16}, {"NWG",64}, {"SA",1}, {"SB",0}, {"STRM",1}, {"STRN",1}, {"VWM",1}, {"VWN",1} } },
-        { "GeForce GTX 1070",                                { {"KWG",32}, {"KWI",8}, {"MDIMA",32}, {"MDIMC",16}, {"MWG",32}, {"NDIMB",8}, {"NDIMC",8}, {"NWG",32}, {"SA",0}, {"SB",0}, {"STRM",0}, {"STRN",1}, {"VWM",1}, {"VWN",4} } },
-        { "GeForce GTX 1080",                                { {"KWG",32}, {"KWI",2}, {"MDIMA",16}, {"MDIMC",16}, {"MWG",16}, {"NDIMB",8}, {"NDIMC",8}, {"NWG",16}, {"SA",0}, {"SB",0}, {"STRM",0}, {"STRN",0}, {"VWM",1}, {"VWN",2} } },
-        { "GeForce GTX 480",                                 { {"KWG",16}, {"KWI",2}, {"MDIMA",32}, {"MDIMC",32}, {"MWG",32}, {"NDIMB",32}, {"NDIMC",8}, {"NWG",32}, {"SA",0}, {"SB",0}, {"STRM",1}, {"STRN",0}, {"VWM",1}, {"VWN",1} } },
-        { "GeForce GTX 670",                                 { {"KWG",32}, {"KWI",8}, {"MDIMA",16}, {"MDIMC",8}, {"MWG",16}, {"NDIMB",16}, {"NDIMC",32}, {"NWG",64}, {"SA",1}, {"SB",0}, {"STRM",0}, {"STRN",1}, {"VWM",1}, {"VWN",2} } },
-        { "GeForce GTX 680",                                 { {"KWG",16}, {"KWI",8}, {"MDIMA",16}, {"MDIMC",8}, {"MWG",64}, {"NDIMB",16}, {"NDIMC",32}, {"NWG",32}, {"SA",0}, {"SB",1}, {"STRM",1}, {"STRN",0}, {"VWM",1}, {"VWN",1} } },
-        { "GeForce GTX 750",                                 { {"KWG",32}, {"KWI",2}, {"MDIMA",8}, {"MDIMC",32}, {"MWG",32}, {"NDIMB",8}, {"NDIMC",8}, {"NWG",64}, {"SA",0}, {"SB",0}, {"STRM",1}, {"STRN",0}, {"VWM",1}, {"VWN",4} } },
-        { "GeForce GTX 750 Ti",                              { {"KWG",32}, {"KWI",2}, {"MDIMA",8}, {"MDIMC",8}, {"MWG",16}, {"NDIMB",8}, {"NDIMC",8}, {"NWG",32}, {"SA",0}, {"SB",0}, {"STRM",0}, {"STRN",0}, {"VWM",1}, {"VWN",1} } },
-        { "GeForce GTX 980",                                 { {"KWG",16}, {"KWI",2}, {"MDIMA",16}, {"MDIMC",8}, {"MWG",32}, {"NDIMB",8}, {"NDIMC",16}, {"NWG",128}, {"SA",0}, {"SB",0}, {"STRM",1}, {"STRN",1}, {"VWM",2}, {"VWN",2} } },
-        { "GeForce GTX TITAN Black",                         { {"KWG",16}, {"KWI",2}, {"MDIMA",16}, {"MDIMC",16}, {"MWG",32}, {"NDIMB",16}, {"NDIMC",8}, {"NWG",32}, {"SA",0}, {"SB",1}, {"STRM",1}, {"STRN",1}, {"VWM",1}, {"VWN",1} } },
-        { "GeForce GTX TITAN X",                             { {"KWG",32}, {"KWI",8}, {"MDIMA",16}, {"MDIMC",16}, {"MWG",128}, {"NDIMB",16}, {"NDIMC",16}, {"NWG",32}, {"SA",0}, {"SB",0}, {"STRM",1}, {"STRN",0}, {"VWM",1}, {"VWN",1} } },
-        { "TITAN X (Pascal)",                                { {"KWG",32}, {"KWI",2}, {"MDIMA",16}, {"MDIMC",16}, {"MWG",16}, {"NDIMB",16}, {"NDIMC",16}, {"NWG",16}, {"SA",0}, {"SB",0}, {"STRM",0}, {"STRN",0}, {"VWM",1}, {"VWN",1} } },
-        { "Tesla K20m",                                      { {"KWG",32}, {"KWI",2}, {"MDIMA",32}, {"MDIMC",8}, {"MWG",32}, {"NDIMB",16}, {"NDIMC",16}, {"NWG",64}, {"SA",0}, {"SB",0}, {"STRM",1}, {"STRN",0}, {"VWM",1}, {"VWN",1} } },
-        { "Tesla K40m",                                      { {"KWG",16}, {"KWI",8}, {"MDIMA",8}, {"MDIMC",8}, {"MWG",32}, {"NDIMB",32}, {"NDIMC",16}, {"NWG",32}, {"SA",0}, {"SB",0}, {"STRM",1}, {"STRN",0}, {"VWM",1}, {"VWN",1} } },
-        { "default",                                         { {"KWG",32}, {"KWI",2}, {"MDIMA",16}, {"MDIMC",16}, {"MWG",32}, {"NDIMB",16}, {"NDIMC",16}, {"NWG",32}, {"SA",0}, {"SB",0}, {"STRM",0}, {"STRN",0}, {"VWM",1}, {"VWN",1} } },
+        { "GRID K520",                                       XgemmParameters[131] },
+        { "GeForce GTX 1070",                                XgemmParameters[132] },
+        { "GeForce GTX 1080",                                XgemmParameters[133] },
+        { "GeForce GTX 480",                                 XgemmParameters[134] },
+        { "GeForce GTX 670",                                 XgemmParameters[135] },
+        { "GeForce GTX 680",                                 XgemmParameters[136] },
+        { "GeForce GTX 750",                                 XgemmParameters[137] },
+        { "GeForce GTX 750 Ti",                              XgemmParameters[138] },
+        { "GeForce GTX 980",                                 XgemmParameters[139] },
+        { "GeForce GTX TITAN Black",                         XgemmParameters[140] },
+        { "GeForce GTX TITAN X",                             XgemmParameters[141] },
+        { "TITAN X (Pascal)",                                XgemmParameters[142] },
+        { "Tesla K20m",                                      XgemmParameters[143] },
+        { "Tesla K40m",                                      XgemmParameters[144] },
+        { "default",                                         XgemmParameters[145] },
       }
     },
     { // Default
       kDeviceTypeAll, "default", {
-        { "default",                                         { {"KWG",32}, {"KWI",2}, {"MDIMA",32}, {"MDIMC",32}, {"MWG",32}, {"NDIMB",8}, {"NDIMC",8}, {"NWG",32}, {"SA",1}, {"SB",1}, {"STRM",0}, {"STRN",0}, {"VWM",1}, {"VWN",1} } },
+        { "default",                                         XgemmParameters[146] },
       }
     },
   }
@@ -15,23 +15,66 @@ namespace clblast {
 namespace database {
 // =================================================================================================
 
+// The unique parameter sets of these kernels, referred to by index below
+const auto XgemmDirectParameters = Database::ParameterSets({"KWID", "MDIMAD", "MDIMCD", "NDIMBD", "NDIMCD", "PADA", "PADB", "VWMD", "VWND", "WGD"}, {
+  {8, 32, 8, 8, 32, 1, 1, 1, 1, 32}, // 0
+  {2, 8, 8, 8, 8, 1, 1, 1, 1, 8}, // 1
+  {2, 16, 16, 16, 16, 1, 1, 1, 1, 16}, // 2
+  {2, 8, 8, 8, 8, 1, 1, 2, 2, 32}, // 3
+  {8, 8, 16, 8, 8, 1, 0, 2, 2, 32}, // 4
+  {2, 8, 8, 32, 32, 1, 1, 2, 1, 32}, // 5
+  {2, 16, 16, 8, 8, 1, 1, 1, 1, 16}, // 6
+  {16, 16, 16, 32, 8, 0, 1, 1, 1, 32}, // 7
+  {2, 8, 8, 8, 8, 1, 1, 1, 1, 16}, // 8
+  {2, 8, 8, 8, 8, 0, 0, 1, 8, 64}, // 9
+  {2, 8, 8, 8, 8, 0, 0, 2, 2, 64}, // 10
+  {2, 8, 8, 8, 8, 1, 1, 2, 4, 32}, // 11
+  {2, 16, 16, 8, 8, 1, 1, 2, 4, 32}, // 12
+  {16, 16, 16, 8, 16, 1, 0, 2, 2, 32}, // 13
+  {16, 16, 8, 16, 8, 1, 1, 1, 1, 32}, // 14
+  {2, 8, 8, 8, 8, 1, 1, 4, 2, 32}, // 15
+  {2, 8, 8, 16, 16, 1, 1, 4, 2, 32}, // 16
+  {8, 32, 8, 8, 16, 1, 1, 1, 1, 32}, // 17
+  {2, 16, 16, 16, 16, 1, 1, 2, 2, 32}, // 18
+  {2, 8, 8, 8, 8, 1, 1, 2, 2, 16}, // 19
+  {2, 8, 8, 8, 8, 0, 0, 4, 4, 32}, // 20
+  {2, 8, 8, 16, 8, 1, 1, 2, 1, 32}, // 21
+  {2, 8, 8, 8, 8, 1, 1, 4, 4, 32}, // 22
+  {2, 16, 16, 8, 8, 1, 1, 2, 2, 32}, // 23
+  {8, 8, 16, 16, 8, 1, 1, 2, 2, 32}, // 24
+  {16, 8, 8, 16, 8, 1, 1, 2, 1, 16}, // 25
+  {2, 8, 8, 16, 16, 1, 1, 1, 1, 16}, // 26
+  {2, 8, 8, 8, 8, 1, 1, 1, 2, 16}, // 27
+  {8, 16, 16, 8, 16, 1, 1, 2, 1, 32}, // 28
+  {16, 8, 8, 8, 16, 1, 1, 1, 1, 16}, // 29
+  {2, 16, 16, 16, 16, 1, 1, 1, 1, 32}, // 30
+  {2, 16, 16, 8, 8, 1, 1, 1, 2, 16}, // 31
+  {8, 16, 16, 16, 8, 1, 0, 1, 1, 16}, // 32
+  {16, 32, 32, 16, 8, 0, 0, 1, 1, 32}, // 33
+  {2, 8, 8, 32, 8, 0, 0, 1, 1, 32}, // 34
+  {8, 16, 8, 8, 8, 0, 0, 2, 2, 32}, // 35
+  {2, 32, 32, 8, 8, 1, 1, 1, 1, 32}, // 36
+});
+
+// =================================================================================================
+
 const Database::DatabaseEntry XgemmDirectHalf = {
   "XgemmDirect", Precision::kHalf, {
     { // AMD GPUs
       kDeviceTypeGPU, "AMD", {
-        { "Ellesmere",                                       { {"KWID",8}, {"MDIMAD",32}, {"MDIMCD",8}, {"NDIMBD",8}, {"NDIMCD",32}, {"PADA",1}, {"PADB",1}, {"VWMD",1}, {"VWND",1}, {"WGD",32} } },
-        { "default",                                         { {"KWID",8}, {"MDIMAD",32}, {"MDIMCD",8}, {"NDIMBD",8}, {"NDIMCD",32}, {"PADA",1}, {"PADB",1}, {"VWMD",1}, {"VWND",1}, {"WGD",32} } },
+        { "Ellesmere",                                       XgemmDirectParameters[0] },
+        { "default",                                         XgemmDirectParameters[0] },
       }
     },
     { // Intel GPUs
       kDeviceTypeGPU, "Intel", {
-        { "Intel(R) HD Graphics Skylake ULT GT2",            { {"KWID",2}, {"MDIMAD",8}, {"MDIMCD",8}, {"NDIMBD",8}, {"NDIMCD",8}, {"PADA",1}, {"PADB",1}, {"VWMD",1}, {"VWND",1}, {"WGD",8} } },
-        { "default",                                         { {"KWID",2}, {"MDIMAD",8}, {"MDIMCD",8}, {"NDIMBD",8}, {"NDIMCD",8}, {"PADA",1}, {"PADB",1}, {"VWMD",1}, {"VWND",1}, {"WGD",8} } },
+        { "Intel(R) HD Graphics Skylake ULT GT2",            XgemmDirectParameters[1] },
+        { "default",                                         XgemmDirectParameters[1] },
       }
     },
     { // Default
       kDeviceTypeAll, "default", {
-        { "default",                                         { {"KWID",2}, {"MDIMAD",16}, {"MDIMCD",16}, {"NDIMBD",16}, {"NDIMCD",16}, {"PADA",1}, {"PADB",1}, {"VWMD",1}, {"VWND",1}, {"WGD",16} } },
+        { "default",                                         XgemmDirectParameters[2] },
       }
     },
   }
@@ -43,42 +86,42 @@ const Database::DatabaseEntry XgemmDirectSingle = {
   "XgemmDirect", Precision::kSingle, {
     { // AMD GPUs
       kDeviceTypeGPU, "AMD", {
-        { "AMD Radeon R9 M370X Compute Engine",              { {"KWID",2}, {"MDIMAD",8}, {"MDIMCD",8}, {"NDIMBD",8}, {"NDIMCD",8}, {"PADA",1}, {"PADB",1}, {"VWMD",2}, {"VWND",2}, {"WGD",32} } },
-        { "ATI Radeon HD 6750M",                             { {"KWID",8}, {"MDIMAD",8}, {"MDIMCD",16}, {"NDIMBD",8}, {"NDIMCD",8}, {"PADA",1}, {"PADB",0}, {"VWMD",2}, {"VWND",2}, {"WGD",32} } },
-        { "Ellesmere",                                       { {"KWID",2}, {"MDIMAD",8}, {"MDIMCD",8}, {"NDIMBD",32}, {"NDIMCD",32}, {"PADA",1}, {"PADB",1}, {"VWMD",2}, {"VWND",1}, {"WGD",32} } },
-        { "Fiji",                                            { {"KWID",2}, {"MDIMAD",16}, {"MDIMCD",16}, {"NDIMBD",8}, {"NDIMCD",8}, {"PADA",1}, {"PADB",1}, {"VWMD",1}, {"VWND",1}, {"WGD",16} } },
-        { "Tonga",                                           { {"KWID",16}, {"MDIMAD",16}, {"MDIMCD",16}, {"NDIMBD",32}, {"NDIMCD",8}, {"PADA",0}, {"PADB",1}, {"VWMD",1}, {"VWND",1}, {"WGD",32} } },
-        { "Turks",                                           { {"KWID",2}, {"MDIMAD",8}, {"MDIMCD",8}, {"NDIMBD",8}, {"NDIMCD",8}, {"PADA",1}, {"PADB",1}, {"VWMD",1}, {"VWND",1}, {"WGD",16} } },
-        { "default",                                         { {"KWID",2}, {"MDIMAD",16}, {"MDIMCD",16}, {"NDIMBD",8}, {"NDIMCD",8}, {"PADA",1}, {"PADB",1}, {"VWMD",1}, {"VWND",1}, {"WGD",16} } },
+        { "AMD Radeon R9 M370X Compute Engine",              XgemmDirectParameters[3] },
+        { "ATI Radeon HD 6750M",                             XgemmDirectParameters[4] },
+        { "Ellesmere",                                       XgemmDirectParameters[5] },
+        { "Fiji",                                            XgemmDirectParameters[6] },
+        { "Tonga",                                           XgemmDirectParameters[7] },
+        { "Turks",                                           XgemmDirectParameters[8] },
+        { "default",                                         XgemmDirectParameters[6] },
       }
     },
     { // Intel CPUs
       kDeviceTypeCPU, "Intel", {
-        { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       { {"KWID",2}, {"MDIMAD",8}, {"MDIMCD",8}, {"NDIMBD",8}, {"NDIMCD",8}, {"PADA",0}, {"PADB",0}, {"VWMD",1}, {"VWND",8}, {"WGD",64} } },
-        { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        { {"KWID",2}, {"MDIMAD",8}, {"MDIMCD",8}, {"NDIMBD",8}, {"NDIMCD",8}, {"PADA",0}, {"PADB",0}, {"VWMD",2}, {"VWND",2}, {"WGD",64} } },
-        { "default",                                         { {"KWID",2}, {"MDIMAD",8}, {"MDIMCD",8}, {"NDIMBD",8}, {"NDIMCD",8}, {"PADA",1}, {"PADB",1}, {"VWMD",2}, {"VWND",4}, {"WGD",32} } },
+        { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       XgemmDirectParameters[9] },
+        { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        XgemmDirectParameters[10] },
+        { "default",                                         XgemmDirectParameters[11] },
       }
     },
     { // Intel GPUs
       kDeviceTypeGPU, "Intel", {
-        { "Intel(R) HD Graphics Skylake ULT GT2",            { {"KWID",2}, {"MDIMAD",8}, {"MDIMCD",8}, {"NDIMBD",8}, {"NDIMCD",8}, {"PADA",1}, {"PADB",1}, {"VWMD",1}, {"VWND",1}, {"WGD",8} } },
-        { "Iris Pro",                                        { {"KWID",2}, {"MDIMAD",16}, {"MDIMCD",16}, {"NDIMBD",8}, {"NDIMCD",8}, {"PADA",1}, {"PADB",1}, {"VWMD",2}, {"VWND",4}, {"WGD",32} } },
-        { "default",                                         { {"KWID",2}, {"MDIMAD",8}, {"MDIMCD",8}, {"NDIMBD",8}, {"NDIMCD",8}, {"PADA",1}, {"PADB",1}, {"VWMD",1}, {"VWND",1}, {"WGD",8} } },
+        { "Intel(R) HD Graphics Skylake ULT GT2",            XgemmDirectParameters[1] },
+        { "Iris Pro",                                        XgemmDirectParameters[12] },
+        { "default",                                         XgemmDirectParameters[1] },
       }
     },
     { // NVIDIA GPUs
       kDeviceTypeGPU, "NVIDIA", {
-        { "GeForce GT 650M",                                 { {"KWID",16}, {"MDIMAD",16}, {"MDIMCD",16}, {"NDIMBD",8}, {"NDIMCD",16}, {"PADA",1}, {"PADB",0}, {"VWMD",2}, {"VWND",2}, {"WGD",32} } },
-        { "GeForce GTX 1080",                                { {"KWID",16}, {"MDIMAD",16}, {"MDIMCD",8}, {"NDIMBD",16}, {"NDIMCD",8}, {"PADA",1}, {"PADB",1}, {"VWMD",1}, {"VWND",1}, {"WGD",32} } },
-        { "GeForce GTX 750 Ti",                              { {"KWID",2}, {"MDIMAD",8}, {"MDIMCD",8}, {"NDIMBD",8}, {"NDIMCD",8}, {"PADA",1}, {"PADB",1}, {"VWMD",4}, {"VWND",2}, {"WGD",32} } },
-        { "GeForce GTX TITAN Black",                         { {"KWID",2}, {"MDIMAD",8}, {"MDIMCD",8}, {"NDIMBD",16}, {"NDIMCD",16}, {"PADA",1}, {"PADB",1}, {"VWMD",4}, {"VWND",2}, {"WGD",32} } },
-        { "TITAN X (Pascal)",                                { {"KWID",8}, {"MDIMAD",32}, {"MDIMCD",8}, {"NDIMBD",8}, {"NDIMCD",16}, {"PADA",1}, {"PADB",1}, {"VWMD",1}, {"VWND",1}, {"WGD",32} } },
-        { "default",                                         { {"KWID",2}, {"MDIMAD",8}, {"MDIMCD",8}, {"NDIMBD",16}, {"NDIMCD",16}, {"PADA",1}, {"PADB",1}, {"VWMD",4}, {"VWND",2}, {"WGD",32} } },
+        { "GeForce GT 650M",                                 XgemmDirectParameters[13] },
+        { "GeForce GTX 1080",                                XgemmDirectParameters[14] },
+        { "GeForce GTX 750 Ti",                              XgemmDirectParameters[15] },
+        { "GeForce GTX TITAN Black",                         XgemmDirectParameters[16] },
+        { "TITAN X (Pascal)",                                XgemmDirectParameters[17] },
+        { "default",                                         XgemmDirectParameters[16] },
       }
     },
     { // Default
       kDeviceTypeAll, "default", {
-        { "default",                                         { {"KWID",2}, {"MDIMAD",8}, {"MDIMCD",8}, {"NDIMBD",8}, {"NDIMCD",8}, {"PADA",1}, {"PADB",1}, {"VWMD",4}, {"VWND",2}, {"WGD",32} } },
+        { "default",                                         XgemmDirectParameters[15] },
       }
     },
   }
@@ -90,40 +133,40 @@ const Database::DatabaseEntry XgemmDirectComplexSingle = {
   "XgemmDirect", Precision::kComplexSingle, {
     { // AMD GPUs
       kDeviceTypeGPU, "AMD", {
-        { "AMD Radeon R9 M370X Compute Engine",              { {"KWID",2}, {"MDIMAD",16}, {"MDIMCD",16}, {"NDIMBD",16}, {"NDIMCD",16}, {"PADA",1}, {"PADB",1}, {"VWMD",1}, {"VWND",1}, {"WGD",16} } },
-        { "ATI Radeon HD 6750M",                             { {"KWID",2}, {"MDIMAD",8}, {"MDIMCD",8}, {"NDIMBD",8}, {"NDIMCD",8}, {"PADA",1}, {"PADB",1}, {"VWMD",1}, {"VWND",1}, {"WGD",8} } },
-        { "Fiji",                                            { {"KWID",2}, {"MDIMAD",16}, {"MDIMCD",16}, {"NDIMBD",16}, {"NDIMCD",16}, {"PADA",1}, {"PADB",1}, {"VWMD",1}, {"VWND",1}, {"WGD",16} } },
-        { "Tonga",                                           { {"KWID",2}, {"MDIMAD",16}, {"MDIMCD",16}, {"NDIMBD",16}, {"NDIMCD",16}, {"PADA",1}, {"PADB",1}, {"VWMD",2}, {"VWND",2}, {"WGD",32} } },
-        { "Turks",                                           { {"KWID",2}, {"MDIMAD",8}, {"MDIMCD",8}, {"NDIMBD",8}, {"NDIMCD",8}, {"PADA",1}, {"PADB",1}, {"VWMD",2}, {"VWND",2}, {"WGD",16} } },
-        { "default",                                         { {"KWID",2}, {"MDIMAD",16}, {"MDIMCD",16}, {"NDIMBD",16}, {"NDIMCD",16}, {"PADA",1}, {"PADB",1}, {"VWMD",2}, {"VWND",2}, {"WGD",32} } },
+        { "AMD Radeon R9 M370X Compute Engine",              XgemmDirectParameters[2] },
+        { "ATI Radeon HD 6750M",                             XgemmDirectParameters[1] },
+        { "Fiji",                                            XgemmDirectParameters[2] },
+        { "Tonga",                                           XgemmDirectParameters[18] },
+        { "Turks",                                           XgemmDirectParameters[19] },
+        { "default",                                         XgemmDirectParameters[18] },
       }
     },
     { // Intel CPUs
       kDeviceTypeCPU, "Intel", {
-        { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       { {"KWID",2}, {"MDIMAD",8}, {"MDIMCD",8}, {"NDIMBD",8}, {"NDIMCD",8}, {"PADA",0}, {"PADB",0}, {"VWMD",4}, {"VWND",4}, {"WGD",32} } },
-        { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        { {"KWID",2}, {"MDIMAD",8}, {"MDIMCD",8}, {"NDIMBD",16}, {"NDIMCD",8}, {"PADA",1}, {"PADB",1}, {"VWMD",2}, {"VWND",1}, {"WGD",32} } },
-        { "default",                                         { {"KWID",2}, {"MDIMAD",8}, {"MDIMCD",8}, {"NDIMBD",8}, {"NDIMCD",8}, {"PADA",1}, {"PADB",1}, {"VWMD",4}, {"VWND",4}, {"WGD",32} } },
+        { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       XgemmDirectParameters[20] },
+        { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        XgemmDirectParameters[21] },
+        { "default",                                         XgemmDirectParameters[22] },
       }
     },
     { // Intel GPUs
       kDeviceTypeGPU, "Intel", {
-        { "Intel(R) HD Graphics Skylake ULT GT2",            { {"KWID",2}, {"MDIMAD",16}, {"MDIMCD",16}, {"NDIMBD",16}, {"NDIMCD",16}, {"PADA",1}, {"PADB",1}, {"VWMD",1}, {"VWND",1}, {"WGD",16} } },
-        { "Iris Pro",                                        { {"KWID",2}, {"MDIMAD",16}, {"MDIMCD",16}, {"NDIMBD",8}, {"NDIMCD",8}, {"PADA",1}, {"PADB",1}, {"VWMD",2}, {"VWND",2}, {"WGD",32} } },
-        { "default",                                         { {"KWID",2}, {"MDIMAD",16}, {"MDIMCD",16}, {"NDIMBD",16}, {"NDIMCD",16}, {"PADA",1}, {"PADB",1}, {"VWMD",1}, {"VWND",1}, {"WGD",16} } },
+        { "Intel(R) HD Graphics Skylake ULT GT2",            XgemmDirectParameters[2] },
+        { "Iris Pro",                                        XgemmDirectParameters[23] },
+        { "default",                                         XgemmDirectParameters[2] },
       }
     },
     { // NVIDIA GPUs
       kDeviceTypeGPU, "NVIDIA", {
-        { "GeForce GTX 1080",                                { {"KWID",8}, {"MDIMAD",8}, {"MDIMCD",16}, {"NDIMBD",16}, {"NDIMCD",8}, {"PADA",1}, {"PADB",1}, {"VWMD",2}, {"VWND",2}, {"WGD",32} } },
-        { "GeForce GTX 750 Ti",                              { {"KWID",16}, {"MDIMAD",8}, {"MDIMCD",8}, {"NDIMBD",16}, {"NDIMCD",8}, {"PADA",1}, {"PADB",1}, {"VWMD",2}, {"VWND",1}, {"WGD",16} } },
-        { "GeForce GTX TITAN Black",                         { {"KWID",2}, {"MDIMAD",8}, {"MDIMCD",8}, {"NDIMBD",16}, {"NDIMCD",16}, {"PADA",1}, {"PADB",1}, {"VWMD",1}, {"VWND",1}, {"WGD",16} } },
-        { "TITAN X (Pascal)",                                { {"KWID",2}, {"MDIMAD",16}, {"MDIMCD",16}, {"NDIMBD",8}, {"NDIMCD",8}, {"PADA",1}, {"PADB",1}, {"VWMD",1}, {"VWND",1}, {"WGD",16} } },
-        { "default",                                         { {"KWID",2}, {"MDIMAD",8}, {"MDIMCD",8}, {"NDIMBD",8}, {"NDIMCD",8}, {"PADA",1}, {"PADB",1}, {"VWMD",1}, {"VWND",2}, {"WGD",16} } },
+        { "GeForce GTX 1080",                                XgemmDirectParameters[24] },
+        { "GeForce GTX 750 Ti",                              XgemmDirectParameters[25] },
+        { "GeForce GTX TITAN Black",                         XgemmDirectParameters[26] },
+        { "TITAN X (Pascal)",                                XgemmDirectParameters[6] },
+        { "default",                                         XgemmDirectParameters[27] },
       }
     },
     { // Default
       kDeviceTypeAll, "default", {
-        { "default",                                         { {"KWID",2}, {"MDIMAD",8}, {"MDIMCD",8}, {"NDIMBD",8}, {"NDIMCD",8}, {"PADA",1}, {"PADB",1}, {"VWMD",1}, {"VWND",2}, {"WGD",16} } },
+        { "default",                                         XgemmDirectParameters[27] },
       }
     },
   }
@@ -135,32 +178,32 @@ const Database::DatabaseEntry XgemmDirectDouble = {
   "XgemmDirect", Precision::kDouble, {
     { // AMD GPUs
       kDeviceTypeGPU, "AMD", {
-        { "AMD Radeon R9 M370X Compute Engine",              { {"KWID",2}, {"MDIMAD",16}, {"MDIMCD",16}, {"NDIMBD",8}, {"NDIMCD",8}, {"PADA",1}, {"PADB",1}, {"VWMD",1}, {"VWND",1}, {"WGD",16} } },
-        { "Ellesmere",                                       { {"KWID",8}, {"MDIMAD",16}, {"MDIMCD",16}, {"NDIMBD",8}, {"NDIMCD",16}, {"PADA",1}, {"PADB",1}, {"VWMD",2}, {"VWND",1}, {"WGD",32} } },
-        { "Fiji",                                            { {"KWID",16}, {"MDIMAD",8}, {"MDIMCD",8}, {"NDIMBD",8}, {"NDIMCD",16}, {"PADA",1}, {"PADB",1}, {"VWMD",1}, {"VWND",1}, {"WGD",16} } },
-        { "Tonga",                                           { {"KWID",2}, {"MDIMAD",16}, {"MDIMCD",16}, {"NDIMBD",16}, {"NDIMCD",16}, {"PADA",1}, {"PADB",1}, {"VWMD",1}, {"VWND",1}, {"WGD",32} } },
-        { "default",                                         { {"KWID",2}, {"MDIMAD",16}, {"MDIMCD",16}, {"NDIMBD",16}, {"NDIMCD",16}, {"PADA",1}, {"PADB",1}, {"VWMD",1}, {"VWND",1}, {"WGD",16} } },
+        { "AMD Radeon R9 M370X Compute Engine",              XgemmDirectParameters[6] },
+        { "Ellesmere",                                       XgemmDirectParameters[28] },
+        { "Fiji",                                            XgemmDirectParameters[29] },
+        { "Tonga",                                           XgemmDirectParameters[30] },
+        { "default",                                         XgemmDirectParameters[2] },
       }
     },
     { // Intel CPUs
       kDeviceTypeCPU, "Intel", {
-        { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       { {"KWID",2}, {"MDIMAD",8}, {"MDIMCD",8}, {"NDIMBD",8}, {"NDIMCD",8}, {"PADA",1}, {"PADB",1}, {"VWMD",4}, {"VWND",4}, {"WGD",32} } },
-        { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        { {"KWID",2}, {"MDIMAD",8}, {"MDIMCD",8}, {"NDIMBD",8}, {"NDIMCD",8}, {"PADA",1}, {"PADB",1}, {"VWMD",4}, {"VWND",4}, {"WGD",32} } },
-        { "default",                                         { {"KWID",2}, {"MDIMAD",8}, {"MDIMCD",8}, {"NDIMBD",8}, {"NDIMCD",8}, {"PADA",1}, {"PADB",1}, {"VWMD",4}, {"VWND",4}, {"WGD",32} } },
+        { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       XgemmDirectParameters[22] },
+        { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        XgemmDirectParameters[22] },
+        { "default",                                         XgemmDirectParameters[22] },
       }
     },
     { // NVIDIA GPUs
       kDeviceTypeGPU, "NVIDIA", {
-        { "GeForce GTX 1080",                                { {"KWID",2}, {"MDIMAD",16}, {"MDIMCD",16}, {"NDIMBD",8}, {"NDIMCD",8}, {"PADA",1}, {"PADB",1}, {"VWMD",1}, {"VWND",2}, {"WGD",16} } },
-        { "GeForce GTX 750 Ti",                              { {"KWID",2}, {"MDIMAD",8}, {"MDIMCD",8}, {"NDIMBD",8}, {"NDIMCD",8}, {"PADA",1}, {"PADB",1}, {"VWMD",2}, {"VWND",4}, {"WGD",32} } },
-        { "GeForce GTX TITAN Black",                         { {"KWID",8}, {"MDIMAD",16}, {"MDIMCD",16}, {"NDIMBD",16}, {"NDIMCD",8}, {"PADA",1}, {"PADB",0}, {"VWMD",1}, {"VWND",1}, {"WGD",16} } },
-        { "TITAN X (Pascal)",                                { {"KWID",2}, {"MDIMAD",8}, {"MDIMCD",8}, {"NDIMBD",8}, {"NDIMCD",8}, {"PADA",1}, {"PADB",1}, {"VWMD",1}, {"VWND",1}, {"WGD",16} } },
-        { "default",                                         { {"KWID",2}, {"MDIMAD",8}, {"MDIMCD",8}, {"NDIMBD",8}, {"NDIMCD",8}, {"PADA",1}, {"PADB",1}, {"VWMD",1}, {"VWND",2}, {"WGD",16} } },
+        { "GeForce GTX 1080",                                XgemmDirectParameters[31] },
+        { "GeForce GTX 750 Ti",                              XgemmDirectParameters[11] },
+        { "GeForce GTX TITAN Black",                         XgemmDirectParameters[32] },
+        { "TITAN X (Pascal)",                                XgemmDirectParameters[8] },
+        { "default",                                         XgemmDirectParameters[27] },
       }
     },
     { // Default
       kDeviceTypeAll, "default", {
-        { "default",                                         { {"KWID",2}, {"MDIMAD",8}, {"MDIMCD",8}, {"NDIMBD",8}, {"NDIMCD",8}, {"PADA",1}, {"PADB",1}, {"VWMD",2}, {"VWND",2}, {"WGD",16} } },
+        { "default",                                         XgemmDirectParameters[19] },
       }
     },
   }
@@ -172,32 +215,32 @@ const Database::DatabaseEntry XgemmDirectComplexDouble = {
   "XgemmDirect", Precision::kComplexDouble, {
     { // AMD GPUs
       kDeviceTypeGPU, "AMD", {
-        { "AMD Radeon R9 M370X Compute Engine",              { {"KWID",2}, {"MDIMAD",16}, {"MDIMCD",16}, {"NDIMBD",16}, {"NDIMCD",16}, {"PADA",1}, {"PADB",1}, {"VWMD",1}, {"VWND",1}, {"WGD",16} } },
-        { "Ellesmere",                                       { {"KWID",16}, {"MDIMAD",32}, {"MDIMCD",32}, {"NDIMBD",16}, {"NDIMCD",8}, {"PADA",0}, {"PADB",0}, {"VWMD",1}, {"VWND",1}, {"WGD",32} } },
-        { "Fiji",                                            { {"KWID",2}, {"MDIMAD",16}, {"MDIMCD",16}, {"NDIMBD",16}, {"NDIMCD",16}, {"PADA",1}, {"PADB",1}, {"VWMD",1}, {"VWND",1}, {"WGD",16} } },
-        { "Tonga",                                           { {"KWID",2}, {"MDIMAD",16}, {"MDIMCD",16}, {"NDIMBD",16}, {"NDIMCD",16}, {"PADA",1}, {"PADB",1}, {"VWMD",1}, {"VWND",1}, {"WGD",16} } },
-        { "default",                                         { {"KWID",2}, {"MDIMAD",16}, {"MDIMCD",16}, {"NDIMBD",16}, {"NDIMCD",16}, {"PADA",1}, {"PADB",1}, {"VWMD",1}, {"VWND",1}, {"WGD",16} } },
+        { "AMD Radeon R9 M370X Compute Engine",              XgemmDirectParameters[2] },
+        { "Ellesmere",                                       XgemmDirectParameters[33] },
+        { "Fiji",                                            XgemmDirectParameters[2] },
+        { "Tonga",                                           XgemmDirectParameters[2] },
+        { "default",                                         XgemmDirectParameters[2] },
       }
     },
     { // Intel CPUs
       kDeviceTypeCPU, "Intel", {
-        { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       { {"KWID",2}, {"MDIMAD",8}, {"MDIMCD",8}, {"NDIMBD",32}, {"NDIMCD",8}, {"PADA",0}, {"PADB",0}, {"VWMD",1}, {"VWND",1}, {"WGD",32} } },
-        { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        { {"KWID",8}, {"MDIMAD",16}, {"MDIMCD",8}, {"NDIMBD",8}, {"NDIMCD",8}, {"PADA",0}, {"PADB",0}, {"VWMD",2}, {"VWND",2}, {"WGD",32} } },
-        { "default",                                         { {"KWID",2}, {"MDIMAD",8}, {"MDIMCD",8}, {"NDIMBD",8}, {"NDIMCD",8}, {"PADA",1}, {"PADB",1}, {"VWMD",2}, {"VWND",2}, {"WGD",16} } },
+        { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       XgemmDirectParameters[34] },
+        { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        XgemmDirectParameters[35] },
+        { "default",                                         XgemmDirectParameters[19] },
       }
     },
     { // NVIDIA GPUs
       kDeviceTypeGPU, "NVIDIA", {
-        { "GeForce GTX 1080",                                { {"KWID",2}, {"MDIMAD",16}, {"MDIMCD",16}, {"NDIMBD",8}, {"NDIMCD",8}, {"PADA",1}, {"PADB",1}, {"VWMD",1}, {"VWND",1}, {"WGD",16} } },
-        { "GeForce GTX 750 Ti",                              { {"KWID",2}, {"MDIMAD",32}, {"MDIMCD",32}, {"NDIMBD",8}, {"NDIMCD",8}, {"PADA",1}, {"PADB",1}, {"VWMD",1}, {"VWND",1}, {"WGD",32} } },
-        { "GeForce GTX TITAN Black",                         { {"KWID",2}, {"MDIMAD",8}, {"MDIMCD",8}, {"NDIMBD",8}, {"NDIMCD",8}, {"PADA",1}, {"PADB",1}, {"VWMD",1}, {"VWND",1}, {"WGD",8} } },
-        { "TITAN X (Pascal)",                                { {"KWID",2}, {"MDIMAD",16}, {"MDIMCD",16}, {"NDIMBD",8}, {"NDIMCD",8}, {"PADA",1}, {"PADB",1}, {"VWMD",1}, {"VWND",2}, {"WGD",16} } },
-        { "default",                                         { {"KWID",2}, {"MDIMAD",16}, {"MDIMCD",16}, {"NDIMBD",8}, {"NDIMCD",8}, {"PADA",1}, {"PADB",1}, {"VWMD",1}, {"VWND",1}, {"WGD",16} } },
+        { "GeForce GTX 1080",                                XgemmDirectParameters[6] },
+        { "GeForce GTX 750 Ti",                              XgemmDirectParameters[36] },
+        { "GeForce GTX TITAN Black",                         XgemmDirectParameters[1] },
+        { "TITAN X (Pascal)",                                XgemmDirectParameters[31] },
+        { "default",                                         XgemmDirectParameters[6] },
       }
     },
     { // Default
       kDeviceTypeAll, "default", {
-        { "default",                                         { {"KWID",2}, {"MDIMAD",8}, {"MDIMCD",8}, {"NDIMBD",8}, {"NDIMCD",8}, {"PADA",1}, {"PADB",1}, {"VWMD",1}, {"VWND",2}, {"WGD",16} } },
+        { "default",                                         XgemmDirectParameters[27] },
       }
     },
   }
@@ -0,0 +1,86 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file populates the database with best-found tuning parameters for the 'XgemmSkinny' kernels.
+// This kernel is used by GEMM for matrices with only a few rows or columns.
+//
+// =================================================================================================
+
+namespace clblast {
+namespace database {
+// =================================================================================================
+
+// The unique parameter sets of these kernels, referred to by index below
+const auto XgemmSkinnyParameters = Database::ParameterSets({"SKINNY_NWI", "SKINNY_WGS"}, {
+  {16, 64}, // 0
+});
+
+// =================================================================================================
+
+const Database::DatabaseEntry XgemmSkinnyHalf = {
+  "XgemmSkinny", Precision::kHalf, {
+    { // Default
+      kDeviceTypeAll, "default", {
+        { "default",                                         XgemmSkinnyParameters[0] },
+      }
+    },
+  }
+};
+
+// =================================================================================================
+
+const Database::DatabaseEntry XgemmSkinnySingle = {
+  "XgemmSkinny", Precision::kSingle, {
+    { // Default
+      kDeviceTypeAll, "default", {
+        { "default",                                         XgemmSkinnyParameters[0] },
+      }
+    },
+  }
+};
+
+// =================================================================================================
+
+const Database::DatabaseEntry XgemmSkinnyComplexSingle = {
+  "XgemmSkinny", Precision::kComplexSingle, {
+    { // Default
+      kDeviceTypeAll, "default", {
+        { "default",                                         XgemmSkinnyParameters[0] },
+      }
+    },
+  }
+};
+
+// =================================================================================================
+
+const Database::DatabaseEntry XgemmSkinnyDouble = {
+  "XgemmSkinny", Precision::kDouble, {
+    { // Default
+      kDeviceTypeAll, "default", {
+        { "default",                                         XgemmSkinnyParameters[0] },
+      }
+    },
+  }
+};
+
+// =================================================================================================
+
+const Database::DatabaseEntry XgemmSkinnyComplexDouble = {
+  "XgemmSkinny", Precision::kComplexDouble, {
+    { // Default
+      kDeviceTypeAll, "default", {
+        { "default",                                         XgemmSkinnyParameters[0] },
+      }
+    },
+  }
+};
+
+// =================================================================================================
+} // namespace database
+} // namespace clblast
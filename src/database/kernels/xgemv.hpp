@@ -15,24 +15,39 @@ namespace clblast {
 namespace database {
 // =================================================================================================
 
+// The unique parameter sets of these kernels, referred to by index below
+const auto XgemvParameters = Database::ParameterSets({"WGS1", "WPT1"}, {
+  {256, 1}, // 0
+  {64, 1}, // 1
+  {128, 1}, // 2
+  {32, 1}, // 3
+  {128, 2}, // 4
+  {128, 4}, // 5
+  {64, 4}, // 6
+  {64, 2}, // 7
+  {32, 4}, // 8
+});
+
+// =================================================================================================
+
 const Database::DatabaseEntry XgemvHalf = {
   "Xgemv", Precision::kHalf, {
     { // AMD GPUs
       kDeviceTypeGPU, "AMD", {
-        { "Ellesmere",                                       { {"WGS1",256}, {"WPT1",1} } },
-        { "default",                                         { {"WGS1",256}, {"WPT1",1} } },
+        { "Ellesmere",                                       XgemvParameters[0] },
+        { "default",                                         XgemvParameters[0] },
       }
     },
     { // Intel GPUs
       kDeviceTypeGPU, "Intel", {
-        { "Intel(R) HD Graphics 5500 BroadWell U-Processor GT2", { {"WGS1",64}, {"WPT1",1} } },
-        { "Intel(R) HD Graphics Skylake ULT GT2",            { {"WGS1",256}, {"WPT1",1} } },
-        { "default",                                         { {"WGS1",64}, {"WPT1",1} } },
+        { "Intel(R) HD Graphics 5500 BroadWell U-Processor GT2", XgemvParameters[1] },
+        { "Intel(R) HD Graphics Skylake ULT GT2",            XgemvParameters[0] },
+        { "default",                                         XgemvParameters[1] },
       }
     },
     { // Default
       kDeviceTypeAll, "default", {
-        { "default",                                         { {"WGS1",64}, {"WPT1",1} } },
+        { "default",                                         XgemvParameters[1] },
       }
     },
   }
@@ -44,70 +59,70 @@ const Database::DatabaseEntry XgemvSingle = {
   "Xgemv", Precision::kSingle, {
     { // AMD GPUs
       kDeviceTypeGPU, "AMD", {
-        { "AMD Radeon R9 M370X Compute Engine",              { {"WGS1",128}, {"WPT1",1} } },
-        { "ATI Radeon HD 6750M",                             { {"WGS1",32}, {"WPT1",1} } },
-        { "Ellesmere",                                       { {"WGS1",256}, {"WPT1",1} } },
-        { "Fiji",                                            { {"WGS1",128}, {"WPT1",1} } },
-        { "Hawaii",                                          { {"WGS1",128}, {"WPT1",1} } },
-        { "Oland",                                           { {"WGS1",128}, {"WPT1",1} } },
-        { "Pitcairn",                                        { {"WGS1",256}, {"WPT1",1} } },
-        { "Tahiti",                                          { {"WGS1",256}, {"WPT1",1} } },
-        { "Tonga",                                           { {"WGS1",128}, {"WPT1",2} } },
-        { "Turks",                                           { {"WGS1",32}, {"WPT1",1} } },
-        { "default",                                         { {"WGS1",128}, {"WPT1",1} } },
+        { "AMD Radeon R9 M370X Compute Engine",              XgemvParameters[2] },
+        { "ATI Radeon HD 6750M",                             XgemvParameters[3] },
+        { "Ellesmere",                                       XgemvParameters[0] },
+        { "Fiji",                                            XgemvParameters[2] },
+        { "Hawaii",                                          XgemvParameters[2] },
+        { "Oland",                                           XgemvParameters[2] },
+        { "Pitcairn",                                        XgemvParameters[0] },
+        { "Tahiti",                                          XgemvParameters[0] },
+        { "Tonga",                                           XgemvParameters[4] },
+        { "Turks",                                           XgemvParameters[3] },
+        { "default",                                         XgemvParameters[2] },
       }
     },
     { // Intel CPUs
       kDeviceTypeCPU, "Intel", {
-        { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       { {"WGS1",128}, {"WPT1",4} } },
-        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {"WGS1",64}, {"WPT1",1} } },
-        { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         { {"WGS1",64}, {"WPT1",4} } },
-        { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        { {"WGS1",64}, {"WPT1",4} } },
-        { "default",                                         { {"WGS1",64}, {"WPT1",4} } },
+        { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       XgemvParameters[5] },
+        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        XgemvParameters[1] },
+        { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         XgemvParameters[6] },
+        { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        XgemvParameters[6] },
+        { "default",                                         XgemvParameters[6] },
       }
     },
     { // Intel GPUs
       kDeviceTypeGPU, "Intel", {
-        { "Intel(R) HD Graphics 530",                        { {"WGS1",256}, {"WPT1",1} } },
-        { "Intel(R) HD Graphics 5500 BroadWell U-Processor GT2", { {"WGS1",64}, {"WPT1",1} } },
-        { "Intel(R) HD Graphics Haswell Ultrabook GT2 Mobile", { {"WGS1",64}, {"WPT1",1} } },
-        { "Intel(R) HD Graphics IvyBridge M GT2",            { {"WGS1",256}, {"WPT1",1} } },
-        { "Intel(R) HD Graphics Skylake ULT GT2",            { {"WGS1",32}, {"WPT1",1} } },
-        { "Iris",                                            { {"WGS1",64}, {"WPT1",2} } },
-        { "Iris Pro",                                        { {"WGS1",128}, {"WPT1",1} } },
-        { "default",                                         { {"WGS1",128}, {"WPT1",1} } },
+        { "Intel(R) HD Graphics 530",                        XgemvParameters[0] },
+        { "Intel(R) HD Graphics 5500 BroadWell U-Processor GT2", XgemvParameters[1] },
+        { "Intel(R) HD Graphics Haswell Ultrabook GT2 Mobile", XgemvParameters[1] },
+        { "Intel(R) HD Graphics IvyBridge M GT2",            XgemvParameters[0] },
+        { "Intel(R) HD Graphics Skylake ULT GT2",            XgemvParameters[3] },
+        { "Iris",                                            XgemvParameters[7] },
+        { "Iris Pro",                                        XgemvParameters[2] },
+        { "default",                                         XgemvParameters[2] },
       }
     },
     { // Intel accelerators
       kDeviceTypeAccelerator, "Intel", {
-        { "Intel(R) Many Integrated Core Acceleration Card", { {"WGS1",64}, {"WPT1",1} } },
-        { "default",                                         { {"WGS1",64}, {"WPT1",1} } },
+        { "Intel(R) Many Integrated Core Acceleration Card", XgemvParameters[1] },
+        { "default",                                         XgemvParameters[1] },
       }
     },
     { // NVIDIA GPUs
       kDeviceTypeGPU, "NVIDIA", {
-        { "GRID K520",                                       { {"WGS1",256}, {"WPT1",1} } },
-        { "GeForce GT 650M",                                 { {"WGS1",256}, {"WPT1",1} } },
-        { "GeForce GTX 1070",                                { {"WGS1",128}, {"WPT1",1} } },
-        { "GeForce GTX 1080",                                { {"WGS1",32}, {"WPT1",1} } },
-        { "GeForce GTX 480",                                 { {"WGS1",64}, {"WPT1",1} } },
-        { "GeForce GTX 670",                                 { {"WGS1",64}, {"WPT1",1} } },
-        { "GeForce GTX 680",                                 { {"WGS1",256}, {"WPT1",1} } },
-        { "GeForce GTX 750",                                 { {"WGS1",256}, {"WPT1",1} } },
-        { "GeForce GTX 750 Ti",                              { {"WGS1",32}, {"WPT1",1} } },
-        { "GeForce GTX 980",                                 { {"WGS1",128}, {"WPT1",1} } },
-        { "GeForce GTX TITAN",                               { {"WGS1",256}, {"WPT1",1} } },
-        { "GeForce GTX TITAN Black",                         { {"WGS1",256}, {"WPT1",1} } },
-        { "GeForce GTX TITAN X",                             { {"WGS1",256}, {"WPT1",1} } },
-        { "TITAN X (Pascal)",                                { {"WGS1",32}, {"WPT1",1} } },
-        { "Tesla K20m",                                      { {"WGS1",128}, {"WPT1",1} } },
-        { "Tesla K40m",                                      { {"WGS1",256}, {"WPT1",1} } },
-        { "default",                                         { {"WGS1",256}, {"WPT1",1} } },
+        { "GRID K520",                                       XgemvParameters[0] },
+        { "GeForce GT 650M",                                 XgemvParameters[0] },
+        { "GeForce GTX 1070",                                XgemvParameters[2] },
+        { "GeForce GTX 1080",                                XgemvParameters[3] },
+        { "GeForce GTX 480",                                 XgemvParameters[1] },
+        { "GeForce GTX 670",                                 XgemvParameters[1] },
+        { "GeForce GTX 680",                                 XgemvParameters[0] },
+        { "GeForce GTX 750",                                 XgemvParameters[0] },
+        { "GeForce GTX 750 Ti",                              XgemvParameters[3] },
+        { "GeForce GTX 980",                                 XgemvParameters[2] },
+        { "GeForce GTX TITAN",                               XgemvParameters[0] },
+        { "GeForce GTX TITAN Black",                         XgemvParameters[0] },
+        { "GeForce GTX TITAN X",                             XgemvParameters[0] },
+        { "TITAN X (Pascal)",                                XgemvParameters[3] },
+        { "Tesla K20m",                                      XgemvParameters[2] },
+        { "Tesla K40m",                                      XgemvParameters[0] },
+        { "default",                                         XgemvParameters[0] },
       }
     },
     { // Default
       kDeviceTypeAll, "default", {
-        { "default",                                         { {"WGS1",128}, {"WPT1",1} } },
+        { "default",                                         XgemvParameters[2] },
       }
     },
   }
@@ -119,65 +134,65 @@ const Database::DatabaseEntry XgemvComplexSingle = {
   "Xgemv", Precision::kComplexSingle, {
     { // AMD GPUs
       kDeviceTypeGPU, "AMD", {
-        { "AMD Radeon R9 M370X Compute Engine",              { {"WGS1",64}, {"WPT1",1} } },
-        { "ATI Radeon HD 6750M",                             { {"WGS1",64}, {"WPT1",1} } },
-        { "Ellesmere",                                       { {"WGS1",32}, {"WPT1",1} } },
-        { "Fiji",                                            { {"WGS1",32}, {"WPT1",1} } },
-        { "Hawaii",                                          { {"WGS1",64}, {"WPT1",1} } },
-        { "Oland",                                           { {"WGS1",64}, {"WPT1",1} } },
-        { "Pitcairn",                                        { {"WGS1",64}, {"WPT1",1} } },
-        { "Tahiti",                                          { {"WGS1",64}, {"WPT1",1} } },
-        { "Tonga",                                           { {"WGS1",32}, {"WPT1",1} } },
-        { "Turks",                                           { {"WGS1",64}, {"WPT1",1} } },
-        { "default",                                         { {"WGS1",64}, {"WPT1",1} } },
+        { "AMD Radeon R9 M370X Compute Engine",              XgemvParameters[1] },
+        { "ATI Radeon HD 6750M",                             XgemvParameters[1] },
+        { "Ellesmere",                                       XgemvParameters[3] },
+        { "Fiji",                                            XgemvParameters[3] },
+        { "Hawaii",                                          XgemvParameters[1] },
+        { "Oland",                                           XgemvParameters[1] },
+        { "Pitcairn",                                        XgemvParameters[1] },
+        { "Tahiti",                                          XgemvParameters[1] },
+        { "Tonga",                                           XgemvParameters[3] },
+        { "Turks",                                           XgemvParameters[1] },
+        { "default",                                         XgemvParameters[1] },
       }
     },
     { // Intel CPUs
       kDeviceTypeCPU, "Intel", {
-        { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       { {"WGS1",32}, {"WPT1",4} } },
-        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {"WGS1",128}, {"WPT1",1} } },
-        { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         { {"WGS1",64}, {"WPT1",4} } },
-        { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        { {"WGS1",64}, {"WPT1",4} } },
-        { "default",                                         { {"WGS1",64}, {"WPT1",2} } },
+        { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       XgemvParameters[8] },
+        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        XgemvParameters[2] },
+        { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         XgemvParameters[6] },
+        { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        XgemvParameters[6] },
+        { "default",                                         XgemvParameters[7] },
       }
     },
     { // Intel GPUs
       kDeviceTypeGPU, "Intel", {
-        { "Intel(R) HD Graphics 530",                        { {"WGS1",64}, {"WPT1",1} } },
-        { "Intel(R) HD Graphics 5500 BroadWell U-Processor GT2", { {"WGS1",64}, {"WPT1",1} } },
-        { "Intel(R) HD Graphics Haswell Ultrabook GT2 Mobile", { {"WGS1",128}, {"WPT1",1} } },
-        { "Intel(R) HD Graphics IvyBridge M GT2",            { {"WGS1",256}, {"WPT1",1} } },
-        { "Intel(R) HD Graphics Skylake ULT GT2",            { {"WGS1",64}, {"WPT1",1} } },
-        { "Iris",                                            { {"WGS1",256}, {"WPT1",1} } },
-        { "Iris Pro",                                        { {"WGS1",64}, {"WPT1",1} } },
-        { "default",                                         { {"WGS1",64}, {"WPT1",1} } },
+        { "Intel(R) HD Graphics 530",                        XgemvParameters[1] },
+        { "Intel(R) HD Graphics 5500 BroadWell U-Processor GT2", XgemvParameters[1] },
+        { "Intel(R) HD Graphics Haswell Ultrabook GT2 Mobile", XgemvParameters[2] },
+        { "Intel(R) HD Graphics IvyBridge M GT2",            XgemvParameters[0] },
+        { "Intel(R) HD Graphics Skylake ULT GT2",            XgemvParameters[1] },
+        { "Iris",                                            XgemvParameters[0] },
+        { "Iris Pro",                                        XgemvParameters[1] },
+        { "default",                                         XgemvParameters[1] },
       }
     },
     { // Intel accelerators
       kDeviceTypeAccelerator, "Intel", {
-        { "Intel(R) Many Integrated Core Acceleration Card", { {"WGS1",64}, {"WPT1",1} } },
-        { "default",                                         { {"WGS1",64}, {"WPT1",1} } },
+        { "Intel(R) Many Integrated Core Acceleration Card", XgemvParameters[1] },
+        { "default",                                         XgemvParameters[1] },
       }
     },
     { // NVIDIA GPUs
       kDeviceTypeGPU, "NVIDIA", {
-        { "GRID K520",                                       { {"WGS1",256}, {"WPT1",1} } },
-        { "GeForce GTX 1070",                                { {"WGS1",64}, {"WPT1",1} } },
-        { "GeForce GTX 1080",                                { {"WGS1",32}, {"WPT1",1} } },
-        { "GeForce GTX 480",                                 { {"WGS1",64}, {"WPT1",1} } },
-        { "GeForce GTX 670",                                 { {"WGS1",64}, {"WPT1",1} } },
-        { "GeForce GTX 680",                                 { {"WGS1",64}, {"WPT1",1} } },
-        { "GeForce GTX 750",                                 { {"WGS1",128}, {"WPT1",1} } },
-        { "GeForce GTX 750 Ti",                              { {"WGS1",32}, {"WPT1",1} } },
-        { "GeForce GTX TITAN",                               { {"WGS1",256}, {"WPT1",1} } },
-        { "GeForce GTX TITAN Black",                         { {"WGS1",32}, {"WPT1",1} } },
-        { "TITAN X (Pascal)",                                { {"WGS1",32}, {"WPT1",1} } },
-        { "default",                                         { {"WGS1",64}, {"WPT1",1} } },
+        { "GRID K520",                                       XgemvParameters[0] },
+        { "GeForce GTX 1070",                                XgemvParameters[1] },
+        { "GeForce GTX 1080",                                XgemvParameters[3] },
+        { "GeForce GTX 480",                                 XgemvParameters[1] },
+        { "GeForce GTX 670",                                 XgemvParameters[1] },
+        { "GeForce GTX 680",                                 XgemvParameters[1] },
+        { "GeForce GTX 750",                                 XgemvParameters[2] },
+        { "GeForce GTX 750 Ti",                              XgemvParameters[3] },
+        { "GeForce GTX TITAN",                               XgemvParameters[0] },
+        { "GeForce GTX TITAN Black",                         XgemvParameters[3] },
+        { "TITAN X (Pascal)",                                XgemvParameters[3] },
+        { "default",                                         XgemvParameters[1] },
       }
     },
     { // Default
       kDeviceTypeAll, "default", {
-        { "default",                                         { {"WGS1",64}, {"WPT1",1} } },
+        { "default",                                         XgemvParameters[1] },
       }
     },
   }
@@ -189,55 +204,55 @@ const Database::DatabaseEntry XgemvDouble = {
   "Xgemv", Precision::kDouble, {
     { // AMD GPUs
       kDeviceTypeGPU, "AMD", {
-        { "AMD Radeon R9 M370X Compute Engine",              { {"WGS1",64}, {"WPT1",1} } },
-        { "Ellesmere",                                       { {"WGS1",32}, {"WPT1",1} } },
-        { "Fiji",                                            { {"WGS1",32}, {"WPT1",1} } },
-        { "Hawaii",                                          { {"WGS1",128}, {"WPT1",1} } },
-        { "Oland",                                           { {"WGS1",256}, {"WPT1",1} } },
-        { "Pitcairn",                                        { {"WGS1",256}, {"WPT1",1} } },
-        { "Tahiti",                                          { {"WGS1",256}, {"WPT1",1} } },
-        { "Tonga",                                           { {"WGS1",32}, {"WPT1",1} } },
-        { "default",                                         { {"WGS1",256}, {"WPT1",1} } },
+        { "AMD Radeon R9 M370X Compute Engine",              XgemvParameters[1] },
+        { "Ellesmere",                                       XgemvParameters[3] },
+        { "Fiji",                                            XgemvParameters[3] },
+        { "Hawaii",                                          XgemvParameters[2] },
+        { "Oland",                                           XgemvParameters[0] },
+        { "Pitcairn",                                        XgemvParameters[0] },
+        { "Tahiti",                                          XgemvParameters[0] },
+        { "Tonga",                                           XgemvParameters[3] },
+        { "default",                                         XgemvParameters[0] },
       }
     },
     { // Intel CPUs
       kDeviceTypeCPU, "Intel", {
-        { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       { {"WGS1",64}, {"WPT1",4} } },
-        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {"WGS1",64}, {"WPT1",2} } },
-        { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         { {"WGS1",64}, {"WPT1",4} } },
-        { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        { {"WGS1",64}, {"WPT1",4} } },
-        { "default",                                         { {"WGS1",64}, {"WPT1",4} } },
+        { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       XgemvParameters[6] },
+        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        XgemvParameters[7] },
+        { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         XgemvParameters[6] },
+        { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        XgemvParameters[6] },
+        { "default",                                         XgemvParameters[6] },
       }
     },
     { // Intel accelerators
       kDeviceTypeAccelerator, "Intel", {
-        { "Intel(R) Many Integrated Core Acceleration Card", { {"WGS1",64}, {"WPT1",1} } },
-        { "default",                                         { {"WGS1",64}, {"WPT1",1} } },
+        { "Intel(R) Many Integrated Core Acceleration Card", XgemvParameters[1] },
+        { "default",                                         XgemvParameters[1] },
       }
     },
     { // NVIDIA GPUs
       kDeviceTypeGPU, "NVIDIA", {
-        { "GRID K520",                                       { {"WGS1",128}, {"WPT1",1} } },
-        { "GeForce GTX 1070",                                { {"WGS1",64}, {"WPT1",1} } },
-        { "GeForce GTX 1080",                                { {"WGS1",32}, {"WPT1",1} } },
-        { "GeForce GTX 480",                                 { {"WGS1",256}, {"WPT1",1} } },
-        { "GeForce GTX 670",                                 { {"WGS1",128}, {"WPT1",1} } },
-        { "GeForce GTX 680",                                 { {"WGS1",128}, {"WPT1",1} } },
-        { "GeForce GTX 750",                                 { {"WGS1",64}, {"WPT1",1} } },
-        { "GeForce GTX 750 Ti",                              { {"WGS1",32}, {"WPT1",1} } },
-        { "GeForce GTX 980",                                 { {"WGS1",64}, {"WPT1",1} } },
-        { "GeForce GTX TITAN",                               { {"WGS1",256}, {"WPT1",1} } },
-        { "GeForce GTX TITAN Black",                         { {"WGS1",32}, {"WPT1",1} } },
-        { "GeForce GTX TITAN X",                             { {"WGS1",64}, {"WPT1",1} } },
-        { "TITAN X (Pascal)",                                { {"WGS1",32}, {"WPT1",1} } },
-        { "Tesla K20m",                                      { {"WGS1",256}, {"WPT1",1} } },
-        { "Tesla K40m",                                      { {"WGS1",256}, {"WPT1",1} } },
-        { "default",                                         { {"WGS1",128}, {"WPT1",1} } },
+        { "GRID K520",                                       XgemvParameters[2] },
+        { "GeForce GTX 1070",                                XgemvParameters[1] },
+        { "GeForce GTX 1080",                                XgemvParameters[3] },
+        { "GeForce GTX 480",                                 XgemvParameters[0] },
+        { "GeForce GTX 670",                                 XgemvParameters[2] },
+        { "GeForce GTX 680",                                 XgemvParameters[2] },
+        { "GeForce GTX 750",                                 XgemvParameters[1] },
+        { "GeForce GTX 750 Ti",                              XgemvParameters[3] },
+        { "GeForce GTX 980",                                 XgemvParameters[1] },
+        { "GeForce GTX TITAN",                               XgemvParameters[0] },
+        { "GeForce GTX TITAN Black",                         XgemvParameters[3] },
+        { "GeForce GTX TITAN X",                             XgemvParameters[1] },
+        { "TITAN X (Pascal)",                                XgemvParameters[3] },
+        { "Tesla K20m",                                      XgemvParameters[0] },
+        { "Tesla K40m",                                      XgemvParameters[0] },
+        { "default",                                         XgemvParameters[2] },
       }
     },
     { // Default
       kDeviceTypeAll, "default", {
-        { "default",                                         { {"WGS1",128}, {"WPT1",1} } },
+        { "default",                                         XgemvParameters[2] },
       }
     },
   }
@@ -249,43 +264,43 @@ const Database::DatabaseEntry XgemvComplexDouble = {
   "Xgemv", Precision::kComplexDouble, {
     { // AMD GPUs
       kDeviceTypeGPU, "AMD", {
-        { "AMD Radeon R9 M370X Compute Engine",              { {"WGS1",64}, {"WPT1",1} } },
-        { "Ellesmere",                                       { {"WGS1",32}, {"WPT1",1} } },
-        { "Fiji",                                            { {"WGS1",64}, {"WPT1",1} } },
-        { "Hawaii",                                          { {"WGS1",64}, {"WPT1",1} } },
-        { "Oland",                                           { {"WGS1",256}, {"WPT1",1} } },
-        { "Pitcairn",                                        { {"WGS1",256}, {"WPT1",1} } },
-        { "Tahiti",                                          { {"WGS1",256}, {"WPT1",1} } },
-        { "Tonga",                                           { {"WGS1",64}, {"WPT1",1} } },
-        { "default",                                         { {"WGS1",64}, {"WPT1",1} } },
+        { "AMD Radeon R9 M370X Compute Engine",              XgemvParameters[1] },
+        { "Ellesmere",                                       XgemvParameters[3] },
+        { "Fiji",                                            XgemvParameters[1] },
+        { "Hawaii",                                          XgemvParameters[1] },
+        { "Oland",                                           XgemvParameters[0] },
+        { "Pitcairn",                                        XgemvParameters[0] },
+        { "Tahiti",                                          XgemvParameters[0] },
+        { "Tonga",                                           XgemvParameters[1] },
+        { "default",                                         XgemvParameters[1] },
       }
     },
     { // Intel CPUs
       kDeviceTypeCPU, "Intel", {
-        { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       { {"WGS1",64}, {"WPT1",4} } },
-        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {"WGS1",64}, {"WPT1",1} } },
-        { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         { {"WGS1",64}, {"WPT1",4} } },
-        { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        { {"WGS1",32}, {"WPT1",4} } },
-        { "default",                                         { {"WGS1",64}, {"WPT1",4} } },
+        { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       XgemvParameters[6] },
+        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        XgemvParameters[1] },
+        { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         XgemvParameters[6] },
+        { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        XgemvParameters[8] },
+        { "default",                                         XgemvParameters[6] },
       }
     },
     { // Intel accelerators
       kDeviceTypeAccelerator, "Intel", {
-        { "Intel(R) Many Integrated Core Acceleration Card", { {"WGS1",64}, {"WPT1",1} } },
-        { "default",                                         { {"WGS1",64}, {"WPT1",1} } },
+        { "Intel(R) Many Integrated Core Acceleration Card", XgemvParameters[1] },
+        { "default",                                         XgemvParameters[1] },
       }
     },
     { // NVIDIA GPUs
       kDeviceTypeGPU, "NVIDIA", {
-        { "GRID K520",                                       { {"WGS1",128}, {"WPT1",1} } },
-        { "GeForce GTX 480",                                 { {"WGS1",64}, {"WPT1",1} } },
-        { "GeForce GTX 670",                                 { {"WGS1",128}, {"WPT1",1} } },
-        { "default",                                         { {"WGS1",128}, {"WPT1",1} } },
+        { "GRID K520",                                       XgemvParameters[2] },
+        { "GeForce GTX 480",                                 XgemvParameters[1] },
+        { "GeForce GTX 670",                                 XgemvParameters[2] },
+        { "default",                                         XgemvParameters[2] },
       }
     },
     { // Default
       kDeviceTypeAll, "default", {
-        { "default",                                         { {"WGS1",64}, {"WPT1",1} } },
+        { "default",                                         XgemvParameters[1] },
       }
     },
   }
@@ -0,0 +1,86 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file populates the database with best-found tuning parameters for the 'XgemvBanded' kernels.
+// This kernel is used by the banded matrix-vector routines (GBMV, SBMV, HBMV, TBMV).
+//
+// =================================================================================================
+
+namespace clblast {
+namespace database {
+// =================================================================================================
+
+// The unique parameter sets of these kernels, referred to by index below
+const auto XgemvBandedParameters = Database::ParameterSets({"WGS4", "WPT4"}, {
+  {64, 1}, // 0
+});
+
+// =================================================================================================
+
+const Database::DatabaseEntry XgemvBandedHalf = {
+  "XgemvBanded", Precision::kHalf, {
+    { // Default
+      kDeviceTypeAll, "default", {
+        { "default",                                         XgemvBandedParameters[0] },
+      }
+    },
+  }
+};
+
+// =================================================================================================
+
+const Database::DatabaseEntry XgemvBandedSingle = {
+  "XgemvBanded", Precision::kSingle, {
+    { // Default
+      kDeviceTypeAll, "default", {
+        { "default",                                         XgemvBandedParameters[0] },
+      }
+    },
+  }
+};
+
+// =================================================================================================
+
+const Database::DatabaseEntry XgemvBandedComplexSingle = {
+  "XgemvBanded", Precision::kComplexSingle, {
+    { // Default
+      kDeviceTypeAll, "default", {
+        { "default",                                         XgemvBandedParameters[0] },
+      }
+    },
+  }
+};
+
+// =================================================================================================
+
+const Database::DatabaseEntry XgemvBandedDouble = {
+  "XgemvBanded", Precision::kDouble, {
+    { // Default
+      kDeviceTypeAll, "default", {
+        { "default",                                         XgemvBandedParameters[0] },
+      }
+    },
+  }
+};
+
+// =================================================================================================
+
+const Database::DatabaseEntry XgemvBandedComplexDouble = {
+  "XgemvBanded", Precision::kComplexDouble, {
+    { // Default
+      kDeviceTypeAll, "default", {
+        { "default",                                         XgemvBandedParameters[0] },
+      }
+    },
+  }
+};
+
+// =================================================================================================
+} // namespace database
+} // namespace clblast
@@ -0,0 +1,86 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file populates the database with best-found tuning parameters for the 'XgemvBatched' kernels.
+// The batched kernel targets many small problems, hence the small default work-group size.
+//
+// =================================================================================================
+
+namespace clblast {
+namespace database {
+// =================================================================================================
+
+// The unique parameter sets of these kernels, referred to by index below
+const auto XgemvBatchedParameters = Database::ParameterSets({"WGS1", "WPT1"}, {
+  {64, 1}, // 0
+});
+
+// =================================================================================================
+
+const Database::DatabaseEntry XgemvBatchedHalf = {
+  "XgemvBatched", Precision::kHalf, {
+    { // Default
+      kDeviceTypeAll, "default", {
+        { "default",                                         XgemvBatchedParameters[0] },
+      }
+    },
+  }
+};
+
+// =================================================================================================
+
+const Database::DatabaseEntry XgemvBatchedSingle = {
+  "XgemvBatched", Precision::kSingle, {
+    { // Default
+      kDeviceTypeAll, "default", {
+        { "default",                                         XgemvBatchedParameters[0] },
+      }
+    },
+  }
+};
+
+// =================================================================================================
+
+const Database::DatabaseEntry XgemvBatchedComplexSingle = {
+  "XgemvBatched", Precision::kComplexSingle, {
+    { // Default
+      kDeviceTypeAll, "default", {
+        { "default",                                         XgemvBatchedParameters[0] },
+      }
+    },
+  }
+};
+
+// =================================================================================================
+
+const Database::DatabaseEntry XgemvBatchedDouble = {
+  "XgemvBatched", Precision::kDouble, {
+    { // Default
+      kDeviceTypeAll, "default", {
+        { "default",                                         XgemvBatchedParameters[0] },
+      }
+    },
+  }
+};
+
+// =================================================================================================
+
+const Database::DatabaseEntry XgemvBatchedComplexDouble = {
+  "XgemvBatched", Precision::kComplexDouble, {
+    { // Default
+      kDeviceTypeAll, "default", {
+        { "default",                                         XgemvBatchedParameters[0] },
+      }
+    },
+  }
+};
+
+// =================================================================================================
+} // namespace database
+} // namespace clblast
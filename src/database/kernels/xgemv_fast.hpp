@@ -15,24 +15,52 @@ namespace clblast {
 namespace database {
 // =================================================================================================
 
+// The unique parameter sets of these kernels, referred to by index below
+const auto XgemvFastParameters = Database::ParameterSets({"VW2", "WGS2", "WPT2"}, {
+  {1, 32, 1}, // 0
+  {1, 16, 1}, // 1
+  {4, 64, 4}, // 2
+  {1, 128, 1}, // 3
+  {2, 64, 2}, // 4
+  {1, 64, 1}, // 5
+  {1, 64, 2}, // 6
+  {1, 16, 4}, // 7
+  {1, 256, 1}, // 8
+  {1, 32, 4}, // 9
+  {4, 128, 4}, // 10
+  {1, 64, 4}, // 11
+  {2, 16, 4}, // 12
+  {2, 32, 2}, // 13
+  {1, 128, 2}, // 14
+  {2, 256, 2}, // 15
+  {2, 64, 4}, // 16
+  {4, 16, 4}, // 17
+  {2, 128, 2}, // 18
+  {1, 32, 2}, // 19
+  {4, 32, 4}, // 20
+  {1, 16, 2}, // 21
+});
+
+// =================================================================================================
+
 const Database::DatabaseEntry XgemvFastHalf = {
   "XgemvFast", Precision::kHalf, {
     { // AMD GPUs
       kDeviceTypeGPU, "AMD", {
-        { "Ellesmere",                                       { {"VW2",1}, {"WGS2",32}, {"WPT2",1} } },
-        { "default",                                         { {"VW2",1}, {"WGS2",32}, {"WPT2",1} } },
+        { "Ellesmere",                                       XgemvFastParameters[0] },
+        { "default",                                         XgemvFastParameters[0] },
       }
     },
     { // Intel GPUs
       kDeviceTypeGPU, "Intel", {
-        { "Intel(R) HD Graphics 5500 BroadWell U-Processor GT2", { {"VW2",1}, {"WGS2",16}, {"WPT2",1} } },
-        { "Intel(R) HD Graphics Skylake ULT GT2",            { {"VW2",4}, {"WGS2",64}, {"WPT2",4} } },
-        { "default",                                         { {"VW2",1}, {"WGS2",16}, {"WPT2",1} } },
+        { "Intel(R) HD Graphics 5500 BroadWell U-Processor GT2", XgemvFastParameters[1] },
+        { "Intel(R) HD Graphics Skylake ULT GT2",            XgemvFastParameters[2] },
+        { "default",                                         XgemvFastParameters[1] },
       }
     },
     { // Default
       kDeviceTypeAll, "default", {
-        { "default",                                         { {"VW2",1}, {"WGS2",16}, {"WPT2",1} } },
+        { "default",                                         XgemvFastParameters[1] },
       }
     },
   }
@@ -44,70 +72,70 @@ const Database::DatabaseEntry XgemvFastSingle = {
   "XgemvFast", Precision::kSingle, {
     { // AMD GPUs
       kDeviceTypeGPU, "AMD", {
-        { "AMD Radeon R9 M370X Compute Engine",              { {"VW2",1}, {"WGS2",128}, {"WPT2",1} } },
-        { "ATI Radeon HD 6750M",                             { {"VW2",2}, {"WGS2",64}, {"WPT2",2} } },
-        { "Ellesmere",                                       { {"VW2",1}, {"WGS2",64}, {"WPT2",1} } },
-        { "Fiji",                                            { {"VW2",1}, {"WGS2",64}, {"WPT2",2} } },
-        { "Hawaii",                                          { {"VW2",1}, {"WGS2",64}, {"WPT2",1} } },
-        { "Oland",                                           { {"VW2",1}, {"WGS2",64}, {"WPT2",1} } },
-        { "Pitcairn",                                        { {"VW2",1}, {"WGS2",64}, {"WPT2",1} } },
-        { "Tahiti",                                          { {"VW2",1}, {"WGS2",64}, {"WPT2",1} } },
-        { "Tonga",                                           { {"VW2",1}, {"WGS2",16}, {"WPT2",4} } },
-        { "Turks",                                           { {"VW2",1}, {"WGS2",256}, {"WPT2",1} } },
-        { "default",                                         { {"VW2",1}, {"WGS2",64}, {"WPT2",1} } },
+        { "AMD Radeon R9 M370X Compute Engine",              XgemvFastParameters[3] },
+        { "ATI Radeon HD 6750M",                             XgemvFastParameters[4] },
+        { "Ellesmere",                                       XgemvFastParameters[5] },
+        { "Fiji",                                            XgemvFastParameters[6] },
+        { "Hawaii",                                          XgemvFastParameters[5] },
+        { "Oland",                                           XgemvFastParameters[5] },
+        { "Pitcairn",                                        XgemvFastParameters[5] },
+        { "Tahiti",                                          XgemvFastParameters[5] },
+        { "Tonga",                                           XgemvFastParameters[7] },
+        { "Turks",                                           XgemvFastParameters[8] },
+        { "default",                                         XgemvFastParameters[5] },
       }
     },
     { // Intel CPUs
       kDeviceTypeCPU, "Intel", {
-        { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       { {"VW2",1}, {"WGS2",32}, {"WPT2",4} } },
-        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {"VW2",4}, {"WGS2",128}, {"WPT2",4} } },
-        { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         { {"VW2",1}, {"WGS2",64}, {"WPT2",4} } },
-        { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        { {"VW2",2}, {"WGS2",16}, {"WPT2",4} } },
-        { "default",                                         { {"VW2",1}, {"WGS2",64}, {"WPT2",4} } },
+        { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       XgemvFastParameters[9] },
+        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        XgemvFastParameters[10] },
+        { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         XgemvFastParameters[11] },
+        { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        XgemvFastParameters[12] },
+        { "default",                                         XgemvFastParameters[11] },
       }
     },
     { // Intel GPUs
       kDeviceTypeGPU, "Intel", {
-        { "Intel(R) HD Graphics 530",                        { {"VW2",1}, {"WGS2",256}, {"WPT2",1} } },
-        { "Intel(R) HD Graphics 5500 BroadWell U-Processor GT2", { {"VW2",2}, {"WGS2",32}, {"WPT2",2} } },
-        { "Intel(R) HD Graphics Haswell Ultrabook GT2 Mobile", { {"VW2",4}, {"WGS2",128}, {"WPT2",4} } },
-        { "Intel(R) HD Graphics IvyBridge M GT2",            { {"VW2",1}, {"WGS2",64}, {"WPT2",2} } },
-        { "Intel(R) HD Graphics Skylake ULT GT2",            { {"VW2",2}, {"WGS2",32}, {"WPT2",2} } },
-        { "Iris",                                            { {"VW2",1}, {"WGS2",128}, {"WPT2",2} } },
-        { "Iris Pro",                                        { {"VW2",4}, {"WGS2",64}, {"WPT2",4} } },
-        { "default",                                         { {"VW2",2}, {"WGS2",256}, {"WPT2",2} } },
+        { "Intel(R) HD Graphics 530",                        XgemvFastParameters[8] },
+        { "Intel(R) HD Graphics 5500 BroadWell U-Processor GT2", XgemvFastParameters[13] },
+        { "Intel(R) HD Graphics Haswell Ultrabook GT2 Mobile", XgemvFastParameters[10] },
+        { "Intel(R) HD Graphics IvyBridge M GT2",            XgemvFastParameters[6] },
+        { "Intel(R) HD Graphics Skylake ULT GT2",            XgemvFastParameters[13] },
+        { "Iris",                                            XgemvFastParameters[14] },
+        { "Iris Pro",                                        XgemvFastParameters[2] },
+        { "default",                                         XgemvFastParameters[15] },
       }
     },
     { // Intel accelerators
       kDeviceTypeAccelerator, "Intel", {
-        { "Intel(R) Many Integrated Core Acceleration Card", { {"VW2",1}, {"WGS2",64}, {"WPT2",1} } },
-        { "default",                                         { {"VW2",1}, {"WGS2",64}, {"WPT2",1} } },
+        { "Intel(R) Many Integrated Core Acceleration Card", XgemvFastParameters[5] },
+        { "default",                                         XgemvFastParameters[5] },
       }
     },
     { // NVIDIA GPUs
       kDeviceTypeGPU, "NVIDIA", {
-        { "GRID K520",                                       { {"VW2",2}, {"WGS2",256}, {"WPT2",2} } },
-        { "GeForce GT 650M",                                 { {"VW2",2}, {"WGS2",32}, {"WPT2",2} } },
-        { "GeForce GTX 1070",                                { {"VW2",1}, {"WGS2",256}, {"WPT2",1} } },
-        { "GeForce GTX 1080",                                { {"VW2",1}, {"WGS2",128}, {"WPT2",1} } },
-        { "GeForce GTX 480",                                 { {"VW2",1}, {"WGS2",128}, {"WPT2",1} } },
-        { "GeForce GTX 670",                                 { {"VW2",2}, {"WGS2",256}, {"WPT2",2} } },
-        { "GeForce GTX 680",                                 { {"VW2",1}, {"WGS2",128}, {"WPT2",1} } },
-        { "GeForce GTX 750",                                 { {"VW2",1}, {"WGS2",256}, {"WPT2",1} } },
-        { "GeForce GTX 750 Ti",                              { {"VW2",2}, {"WGS2",32}, {"WPT2",2} } },
-        { "GeForce GTX 980",                                 { {"VW2",1}, {"WGS2",256}, {"WPT2",1} } },
-        { "GeForce GTX TITAN",                               { {"VW2",1}, {"WGS2",256}, {"WPT2",1} } },
-        { "GeForce GTX TITAN Black",                         { {"VW2",1}, {"WGS2",256}, {"WPT2",1} } },
-        { "GeForce GTX TITAN X",                             { {"VW2",1}, {"WGS2",64}, {"WPT2",1} } },
-        { "TITAN X (Pascal)",                                { {"VW2",1}, {"WGS2",64}, {"WPT2",1} } },
-        { "Tesla K20m",                                      { {"VW2",1}, {"WGS2",256}, {"WPT2",1} } },
-        { "Tesla K40m",                                      { {"VW2",1}, {"WGS2",256}, {"WPT2",1} } },
-        { "default",                                         { {"VW2",1}, {"WGS2",256}, {"WPT2",1} } },
+        { "GRID K520",                                       XgemvFastParameters[15] },
+        { "GeForce GT 650M",                                 XgemvFastParameters[13] },
+        { "GeForce GTX 1070",                                XgemvFastParameters[8] },
+        { "GeForce GTX 1080",                                XgemvFastParameters[3] },
+        { "GeForce GTX 480",                                 XgemvFastParameters[3] },
+        { "GeForce GTX 670",                                 XgemvFastParameters[15] },
+        { "GeForce GTX 680",                                 XgemvFastParameters[3] },
+        { "GeForce GTX 750",                                 XgemvFastParameters[8] },
+        { "GeForce GTX 750 Ti",                              XgemvFastParameters[13] },
+        { "GeForce GTX 980",                                 XgemvFastParameters[8] },
+        { "GeForce GTX TITAN",                               XgemvFastParameters[8] },
+        { "GeForce GTX TITAN Black",                         XgemvFastParameters[8] },
+        { "GeForce GTX TITAN X",                             XgemvFastParameters[5] },
+        { "TITAN X (Pascal)",                                XgemvFastParameters[5] },
+        { "Tesla K20m",                                      XgemvFastParameters[8] },
+        { "Tesla K40m",                                      XgemvFastParameters[8] },
+        { "default",                                         XgemvFastParameters[8] },
       }
     },
     { // Default
       kDeviceTypeAll, "default", {
-        { "default",                                         { {"VW2",1}, {"WGS2",64}, {"WPT2",1} } },
+        { "default",                                         XgemvFastParameters[5] },
       }
     },
   }
@@ -119,59 +147,59 @@ const Database::DatabaseEntry XgemvFastComplexSingle = {
   "XgemvFast", Precision::kComplexSingle, {
     { // AMD GPUs
       kDeviceTypeGPU, "AMD", {
-        { "AMD Radeon R9 M370X Compute Engine",              { {"VW2",2}, {"WGS2",256}, {"WPT2",2} } },
-        { "ATI Radeon HD 6750M",                             { {"VW2",1}, {"WGS2",128}, {"WPT2",1} } },
-        { "Ellesmere",                                       { {"VW2",1}, {"WGS2",64}, {"WPT2",1} } },
-        { "Fiji",                                            { {"VW2",1}, {"WGS2",16}, {"WPT2",1} } },
-        { "Hawaii",                                          { {"VW2",1}, {"WGS2",64}, {"WPT2",1} } },
-        { "Oland",                                           { {"VW2",1}, {"WGS2",64}, {"WPT2",1} } },
-        { "Pitcairn",                                        { {"VW2",1}, {"WGS2",64}, {"WPT2",1} } },
-        { "Tahiti",                                          { {"VW2",1}, {"WGS2",128}, {"WPT2",1} } },
-        { "Tonga",                                           { {"VW2",2}, {"WGS2",32}, {"WPT2",2} } },
-        { "Turks",                                           { {"VW2",1}, {"WGS2",16}, {"WPT2",1} } },
-        { "default",                                         { {"VW2",1}, {"WGS2",64}, {"WPT2",1} } },
+        { "AMD Radeon R9 M370X Compute Engine",              XgemvFastParameters[15] },
+        { "ATI Radeon HD 6750M",                             XgemvFastParameters[3] },
+        { "Ellesmere",                                       XgemvFastParameters[5] },
+        { "Fiji",                                            XgemvFastParameters[1] },
+        { "Hawaii",                                          XgemvFastParameters[5] },
+        { "Oland",                                           XgemvFastParameters[5] },
+        { "Pitcairn",                                        XgemvFastParameters[5] },
+        { "Tahiti",                                          XgemvFastParameters[3] },
+        { "Tonga",                                           XgemvFastParameters[13] },
+        { "Turks",                                           XgemvFastParameters[1] },
+        { "default",                                         XgemvFastParameters[5] },
       }
     },
     { // Intel CPUs
       kDeviceTypeCPU, "Intel", {
-        { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       { {"VW2",2}, {"WGS2",64}, {"WPT2",4} } },
-        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {"VW2",1}, {"WGS2",128}, {"WPT2",2} } },
-        { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         { {"VW2",4}, {"WGS2",64}, {"WPT2",4} } },
-        { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        { {"VW2",4}, {"WGS2",16}, {"WPT2",4} } },
-        { "default",                                         { {"VW2",1}, {"WGS2",64}, {"WPT2",2} } },
+        { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       XgemvFastParameters[16] },
+        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        XgemvFastParameters[14] },
+        { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         XgemvFastParameters[2] },
+        { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        XgemvFastParameters[17] },
+        { "default",                                         XgemvFastParameters[6] },
       }
     },
     { // Intel GPUs
       kDeviceTypeGPU, "Intel", {
-        { "Intel(R) HD Graphics 530",                        { {"VW2",2}, {"WGS2",128}, {"WPT2",2} } },
-        { "Intel(R) HD Graphics 5500 BroadWell U-Processor GT2", { {"VW2",1}, {"WGS2",32}, {"WPT2",2} } },
-        { "Intel(R) HD Graphics Haswell Ultrabook GT2 Mobile", { {"VW2",2}, {"WGS2",128}, {"WPT2",2} } },
-        { "Intel(R) HD Graphics IvyBridge M GT2",            { {"VW2",1}, {"WGS2",32}, {"WPT2",4} } },
-        { "Intel(R) HD Graphics Skylake ULT GT2",            { {"VW2",1}, {"WGS2",32}, {"WPT2",1} } },
-        { "Iris",                                            { {"VW2",1}, {"WGS2",64}, {"WPT2",1} } },
-        { "Iris Pro",                                        { {"VW2",4}, {"WGS2",128}, {"WPT2",4} } },
-        { "default",                                         { {"VW2",1}, {"WGS2",64}, {"WPT2",1} } },
+        { "Intel(R) HD Graphics 530",                        XgemvFastParameters[18] },
+        { "Intel(R) HD Graphics 5500 BroadWell U-Processor GT2", XgemvFastParameters[19] },
+        { "Intel(R) HD Graphics Haswell Ultrabook GT2 Mobile", XgemvFastParameters[18] },
+        { "Intel(R) HD Graphics IvyBridge M GT2",            XgemvFastParameters[9] },
+        { "Intel(R) HD Graphics Skylake ULT GT2",            XgemvFastParameters[0] },
+        { "Iris",                                            XgemvFastParameters[5] },
+        { "Iris Pro",                                        XgemvFastParameters[10] },
+        { "default",                                         XgemvFastParameters[5] },
       }
     },
     { // Intel accelerators
       kDeviceTypeAccelerator, "Intel", {
-        { "Intel(R) Many Integrated Core Acceleration Card", { {"VW2",1}, {"WGS2",64}, {"WPT2",1} } },
-        { "default",                                         { {"VW2",1}, {"WGS2",64}, {"WPT2",1} } },
+        { "Intel(R) Many Integrated Core Acceleration Card", XgemvFastParameters[5] },
+        { "default",                                         XgemvFastParameters[5] },
       }
     },
     { // NVIDIA GPUs
       kDeviceTypeGPU, "NVIDIA", {
-        { "GRID K520",                                       { {"VW2",1}, {"WGS2",256}, {"WPT2",1} } },
-        { "GeForce GTX 1070",                                { {"VW2",1}, {"WGS2",64}, {"WPT2",1} } },
-        { "GeForce GTX 480",                                 { {"VW2",1}, {"WGS2",64}, {"WPT2",1} } },
-        { "GeForce GTX 670",                                 { {"VW2",1}, {"WGS2",64}, {"WPT2",1} } },
-        { "GeForce GTX 680",                                 { {"VW2",1}, {"WGS2",64}, {"WPT2",1} } },
-        { "default",                                         { {"VW2",1}, {"WGS2",64}, {"WPT2",1} } },
+        { "GRID K520",                                       XgemvFastParameters[8] },
+        { "GeForce GTX 1070",                                XgemvFastParameters[5] },
+        { "GeForce GTX 480",                                 XgemvFastParameters[5] },
+        { "GeForce GTX 670",                                 XgemvFastParameters[5] },
+        { "GeForce GTX 680",                                 XgemvFastParameters[5] },
+        { "default",                                         XgemvFastParameters[5] },
       }
     },
     { // Default
       kDeviceTypeAll, "default", {
-        { "default",                                         { {"VW2",1}, {"WGS2",64}, {"WPT2",1} } },
+        { "default",                                         XgemvFastParameters[5] },
       }
     },
   }
@@ -183,55 +211,55 @@ const Database::DatabaseEntry XgemvFastDouble = {
   "XgemvFast", Precision::kDouble, {
     { // AMD GPUs
       kDeviceTypeGPU, "AMD", {
-        { "AMD Radeon R9 M370X Compute Engine",              { {"VW2",1}, {"WGS2",256}, {"WPT2",1} } },
-        { "Ellesmere",                                       { {"VW2",1}, {"WGS2",128}, {"WPT2",1} } },
-        { "Fiji",                                            { {"VW2",1}, {"WGS2",32}, {"WPT2",1} } },
-        { "Hawaii",                                          { {"VW2",1}, {"WGS2",64}, {"WPT2",1} } },
-        { "Oland",                                           { {"VW2",1}, {"WGS2",64}, {"WPT2",1} } },
-        { "Pitcairn",                                        { {"VW2",1}, {"WGS2",64}, {"WPT2",1} } },
-        { "Tahiti",                                          { {"VW2",1}, {"WGS2",64}, {"WPT2",1} } },
-        { "Tonga",                                           { {"VW2",2}, {"WGS2",32}, {"WPT2",2} } },
-        { "default",                                         { {"VW2",1}, {"WGS2",64}, {"WPT2",1} } },
+        { "AMD Radeon R9 M370X Compute Engine",              XgemvFastParameters[8] },
+        { "Ellesmere",                                       XgemvFastParameters[3] },
+        { "Fiji",                                            XgemvFastParameters[0] },
+        { "Hawaii",                                          XgemvFastParameters[5] },
+        { "Oland",                                           XgemvFastParameters[5] },
+        { "Pitcairn",                                        XgemvFastParameters[5] },
+        { "Tahiti",                                          XgemvFastParameters[5] },
+        { "Tonga",                                           XgemvFastParameters[13] },
+        { "default",                                         XgemvFastParameters[5] },
       }
     },
     { // Intel CPUs
       kDeviceTypeCPU, "Intel", {
-        { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       { {"VW2",1}, {"WGS2",64}, {"WPT2",4} } },
-        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {"VW2",4}, {"WGS2",128}, {"WPT2",4} } },
-        { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         { {"VW2",1}, {"WGS2",64}, {"WPT2",4} } },
-        { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        { {"VW2",1}, {"WGS2",16}, {"WPT2",4} } },
-        { "default",                                         { {"VW2",1}, {"WGS2",64}, {"WPT2",4} } },
+        { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       XgemvFastParameters[11] },
+        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        XgemvFastParameters[10] },
+        { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         XgemvFastParameters[11] },
+        { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        XgemvFastParameters[7] },
+        { "default",                                         XgemvFastParameters[11] },
       }
     },
     { // Intel accelerators
       kDeviceTypeAccelerator, "Intel", {
-        { "Intel(R) Many Integrated Core Acceleration Card", { {"VW2",1}, {"WGS2",64}, {"WPT2",1} } },
-        { "default",                                         { {"VW2",1}, {"WGS2",64}, {"WPT2",1} } },
+        { "Intel(R) Many Integrated Core Acceleration Card", XgemvFastParameters[5] },
+        { "default",                                         XgemvFastParameters[5] },
       }
     },
     { // NVIDIA GPUs
       kDeviceTypeGPU, "NVIDIA", {
-        { "GRID K520",                                       { {"VW2",1}, {"WGS2",256}, {"WPT2",1} } },
-        { "GeForce GTX 1070",                                { {"VW2",1}, {"WGS2",256}, {"WPT2",1} } },
-        { "GeForce GTX 1080",                                { {"VW2",1}, {"WGS2",32}, {"WPT2",2} } },
-        { "GeForce GTX 480",                                 { {"VW2",1}, {"WGS2",64}, {"WPT2",1} } },
-        { "GeForce GTX 670",                                 { {"VW2",1}, {"WGS2",128}, {"WPT2",1} } },
-        { "GeForce GTX 680",                                 { {"VW2",1}, {"WGS2",128}, {"WPT2",1} } },
-        { "GeForce GTX 750",                                 { {"VW2",2}, {"WGS2",256}, {"WPT2",2} } },
-        { "GeForce GTX 750 Ti",                              { {"VW2",1}, {"WGS2",32}, {"WPT2",2} } },
-        { "GeForce GTX 980",                                 { {"VW2",1}, {"WGS2",64}, {"WPT2",1} } },
-        { "GeForce GTX TITAN",                               { {"VW2",1}, {"WGS2",256}, {"WPT2",1} } },
-        { "GeForce GTX TITAN Black",                         { {"VW2",1}, {"WGS2",256}, {"WPT2",1} } },
-        { "GeForce GTX TITAN X",                             { {"VW2",1}, {"WGS2",128}, {"WPT2",1} } },
-        { "TITAN X (Pascal)",                                { {"VW2",1}, {"WGS2",32}, {"WPT2",1} } },
-        { "Tesla K20m",                                      { {"VW2",1}, {"WGS2",128}, {"WPT2",1} } },
-        { "Tesla K40m",                                      { {"VW2",1}, {"WGS2",256}, {"WPT2",1} } },
-        { "default",                                         { {"VW2",1}, {"WGS2",256}, {"WPT2",1} } },
+        { "GRID K520",                                       XgemvFastParameters[8] },
+        { "GeForce GTX 1070",                                XgemvFastParameters[8] },
+        { "GeForce GTX 1080",                                XgemvFastParameters[19] },
+        { "GeForce GTX 480",                                 XgemvFastParameters[5] },
+        { "GeForce GTX 670",                                 XgemvFastParameters[3] },
+        { "GeForce GTX 680",                                 XgemvFastParameters[3] },
+        { "GeForce GTX 750",                                 XgemvFastParameters[15] },
+        { "GeForce GTX 750 Ti",                              XgemvFastParameters[19] },
+        { "GeForce GTX 980",                                 XgemvFastParameters[5] },
+        { "GeForce GTX TITAN",                               XgemvFastParameters[8] },
+        { "GeForce GTX TITAN Black",                         XgemvFastParameters[8] },
+        { "GeForce GTX TITAN X",                             XgemvFastParameters[3] },
+        { "TITAN X (Pascal)",                                XgemvFastParameters[0] },
+        { "Tesla K20m",                                      XgemvFastParameters[3] },
+        { "Tesla K40m",                                      XgemvFastParameters[8] },
+        { "default",                                         XgemvFastParameters[8] },
       }
     },
     { // Default
       kDeviceTypeAll, "default", {
-        { "default",                                         { {"VW2",1}, {"WGS2",64}, {"WPT2",1} } },
+        { "default",                                         XgemvFastParameters[5] },
       }
     },
   }
@@ -243,43 +271,43 @@ const Database::DatabaseEntry XgemvFastComplexDouble = {
   "XgemvFast", Precision::kComplexDouble, {
     { // AMD GPUs
       kDeviceTypeGPU, "AMD", {
-        { "AMD Radeon R9 M370X Compute Engine",              { {"VW2",1}, {"WGS2",256}, {"WPT2",1} } },
-        { "Ellesmere",                                       { {"VW2",1}, {"WGS2",16}, {"WPT2",1} } },
-        { "Fiji",                                            { {"VW2",1}, {"WGS2",16}, {"WPT2",1} } },
-        { "Hawaii",                                          { {"VW2",1}, {"WGS2",64}, {"WPT2",1} } },
-        { "Oland",                                           { {"VW2",1}, {"WGS2",256}, {"WPT2",1} } },
-        { "Pitcairn",                                        { {"VW2",1}, {"WGS2",64}, {"WPT2",1} } },
-        { "Tahiti",                                          { {"VW2",1}, {"WGS2",64}, {"WPT2",1} } },
-        { "Tonga",                                           { {"VW2",1}, {"WGS2",32}, {"WPT2",1} } },
-        { "default",                                         { {"VW2",1}, {"WGS2",64}, {"WPT2",1} } },
+        { "AMD Radeon R9 M370X Compute Engine",              XgemvFastParameters[8] },
+        { "Ellesmere",                                       XgemvFastParameters[1] },
+        { "Fiji",                                            XgemvFastParameters[1] },
+        { "Hawaii",                                          XgemvFastParameters[5] },
+        { "Oland",                                           XgemvFastParameters[8] },
+        { "Pitcairn",                                        XgemvFastParameters[5] },
+        { "Tahiti",                                          XgemvFastParameters[5] },
+        { "Tonga",                                           XgemvFastParameters[0] },
+        { "default",                                         XgemvFastParameters[5] },
       }
     },
     { // Intel CPUs
       kDeviceTypeCPU, "Intel", {
-        { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       { {"VW2",4}, {"WGS2",32}, {"WPT2",4} } },
-        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {"VW2",2}, {"WGS2",64}, {"WPT2",4} } },
-        { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         { {"VW2",4}, {"WGS2",64}, {"WPT2",4} } },
-        { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        { {"VW2",1}, {"WGS2",16}, {"WPT2",2} } },
-        { "default",                                         { {"VW2",4}, {"WGS2",64}, {"WPT2",4} } },
+        { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       XgemvFastParameters[20] },
+        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        XgemvFastParameters[16] },
+        { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         XgemvFastParameters[2] },
+        { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        XgemvFastParameters[21] },
+        { "default",                                         XgemvFastParameters[2] },
       }
     },
     { // Intel accelerators
       kDeviceTypeAccelerator, "Intel", {
-        { "Intel(R) Many Integrated Core Acceleration Card", { {"VW2",1}, {"WGS2",64}, {"WPT2",1} } },
-        { "default",                                         { {"VW2",1}, {"WGS2",64}, {"WPT2",1} } },
+        { "Intel(R) Many Integrated Core Acceleration Card", XgemvFastParameters[5] },
+        { "default",                                         XgemvFastParameters[5] },
       }
     },
     { // NVIDIA GPUs
       kDeviceTypeGPU, "NVIDIA", {
-        { "GRID K520",                                       { {"VW2",1}, {"WGS2",128}, {"WPT2",1} } },
-        { "GeForce GTX 480",                                 { {"VW2",1}, {"WGS2",64}, {"WPT2",1} } },
-        { "GeForce GTX 670",                                 { {"VW2",1}, {"WGS2",64}, {"WPT2",1} } },
-        { "default",                                         { {"VW2",1}, {"WGS2",64}, {"WPT2",1} } },
+        { "GRID K520",                                       XgemvFastParameters[3] },
+        { "GeForce GTX 480",                                 XgemvFastParameters[5] },
+        { "GeForce GTX 670",                                 XgemvFastParameters[5] },
+        { "default",                                         XgemvFastParameters[5] },
       }
     },
     { // Default
       kDeviceTypeAll, "default", {
-        { "default",                                         { {"VW2",1}, {"WGS2",64}, {"WPT2",1} } },
+        { "default",                                         XgemvFastParameters[5] },
       }
     },
   }
@@ -15,23 +15,49 @@ namespace clblast {
 namespace database {
 // =================================================================================================
 
+// The unique parameter sets of these kernels, referred to by index below
+const auto XgemvFastRotParameters = Database::ParameterSets({"VW3", "WGS3", "WPT3"}, {
+  {8, 32, 32}, // 0
+  {8, 128, 32}, // 1
+  {8, 64, 32}, // 2
+  {8, 128, 16}, // 3
+  {4, 32, 16}, // 4
+  {4, 32, 32}, // 5
+  {8, 16, 8}, // 6
+  {4, 64, 16}, // 7
+  {2, 32, 16}, // 8
+  {4, 16, 16}, // 9
+  {8, 32, 16}, // 10
+  {1, 16, 16}, // 11
+  {4, 128, 16}, // 12
+  {8, 16, 16}, // 13
+  {8, 32, 8}, // 14
+  {4, 32, 8}, // 15
+  {2, 16, 16}, // 16
+  {4, 128, 8}, // 17
+  {2, 32, 8}, // 18
+  {4, 16, 8}, // 19
+});
+
+// =================================================================================================
+
 const Database::DatabaseEntry XgemvFastRotHalf = {
   "XgemvFastRot", Precision::kHalf, {
     { // AMD GPUs
       kDeviceTypeGPU, "AMD", {
-        { "Ellesmere",                                       { {"VW3",8}, {"WGS3",32}, {"WPT3",32} } },
-        { "default",                                         { {"VW3",8}, {"WGS3",32}, {"WPT3",32} } },
+        { "Ellesmere",                                       XgemvFastRotParameters[0] },
+        { "default",                                         XgemvFastRotParameters[0] },
       }
     },
     { // Intel GPUs
       kDeviceTypeGPU, "Intel", {
-        { "Intel(R) HD Graphics Skylake ULT GT2",            { {"VW3",8}, {"WGS3",128}, {"WPT3",32} } },
-        { "default",                                         { {"VW3",8}, {"WGS3",128}, {"WPT3",32} } },
+        { "Intel(R) HD Graphics Skylake ULT GT2",            XgemvFastRotParameters[1] },
+        { "default",                                         XgemvFastRotParameters[1] },
       }
     },
     { // Default
       kDeviceTypeAll, "default", {
-        { "default",                                         { {"VW3",8}, {"WGS3",128}, {"WPT3",32} } },
+        { "default",                                         XgemvFastRotParameters[1] },
       }
     },
   }
@@ -43,47 +69,47 @@ const Database::DatabaseEntry XgemvFastRotSingle = {
   "XgemvFastRot", Precision::kSingle, {
     { // AMD GPUs
       kDeviceTypeGPU, "AMD", {
-        { "AMD Radeon R9 M370X Compute Engine",              { {"VW3",8}, {"WGS3",64}, {"WPT3",32} } },
-        { "ATI Radeon HD 6750M",                             { {"VW3",8}, {"WGS3",128}, {"WPT3",16} } },
-        { "Ellesmere",                                       { {"VW3",8}, {"WGS3",32}, {"WPT3",32} } },
-        { "Fiji",                                            { {"VW3",4}, {"WGS3",32}, {"WPT3",16} } },
-        { "Tonga",                                           { {"VW3",8}, {"WGS3",128}, {"WPT3",32} } },
-        { "Turks",                                           { {"VW3",8}, {"WGS3",128}, {"WPT3",16} } },
-        { "default",                                         { {"VW3",8}, {"WGS3",32}, {"WPT3",32} } },
+        { "AMD Radeon R9 M370X Compute Engine",              XgemvFastRotParameters[2] },
+        { "ATI Radeon HD 6750M",                             XgemvFastRotParameters[3] },
+        { "Ellesmere",                                       XgemvFastRotParameters[0] },
+        { "Fiji",                                            XgemvFastRotParameters[4] },
+        { "Tonga",                                           XgemvFastRotParameters[1] },
+        { "Turks",                                           XgemvFastRotParameters[3] },
+        { "default",                                         XgemvFastRotParameters[0] },
       }
     },
     { // Intel CPUs
       kDeviceTypeCPU, "Intel", {
-        { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       { {"VW3",4}, {"WGS3",32}, {"WPT3",32} } },
-        { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        { {"VW3",4}, {"WGS3",32}, {"WPT3",32} } },
-        { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        { {"VW3",8}, {"WGS3",16}, {"WPT3",8} } },
-        { "default",                                         { {"VW3",4}, {"WGS3",32}, {"WPT3",32} } },
+        { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       XgemvFastRotParameters[5] },
+        { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        XgemvFastRotParameters[5] },
+        { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        XgemvFastRotParameters[6] },
+        { "default",                                         XgemvFastRotParameters[5] },
       }
     },
     { // Intel GPUs
       kDeviceTypeGPU, "Intel", {
-        { "Intel(R) HD Graphics 5500 BroadWell U-Processor GT2", { {"VW3",8}, {"WGS3",64}, {"WPT3",32} } },
-        { "Intel(R) HD Graphics Haswell Ultrabook GT2 Mobile", { {"VW3",4}, {"WGS3",64}, {"WPT3",16} } },
-        { "Intel(R) HD Graphics IvyBridge M GT2",            { {"VW3",2}, {"WGS3",32}, {"WPT3",16} } },
-        { "Intel(R) HD Graphics Skylake ULT GT2",            { {"VW3",4}, {"WGS3",64}, {"WPT3",16} } },
-        { "Iris Pro",                                        { {"VW3",4}, {"WGS3",16}, {"WPT3",16} } },
-        { "default",                                         { {"VW3",4}, {"WGS3",64}, {"WPT3",16} } },
+        { "Intel(R) HD Graphics 5500 BroadWell U-Processor GT2", XgemvFastRotParameters[2] },
+        { "Intel(R) HD Graphics Haswell Ultrabook GT2 Mobile", XgemvFastRotParameters[7] },
+        { "Intel(R) HD Graphics IvyBridge M GT2",            XgemvFastRotParameters[8] },
+        { "Intel(R) HD Graphics Skylake ULT GT2",            XgemvFastRotParameters[7] },
+        { "Iris Pro",                                        XgemvFastRotParameters[9] },
+        { "default",                                         XgemvFastRotParameters[7] },
       }
     },
     { // NVIDIA GPUs
       kDeviceTypeGPU, "NVIDIA", {
-        { "GeForce GT 650M",                                 { {"VW3",8}, {"WGS3",32}, {"WPT3",16} } },
-        { "GeForce GTX 1080",                                { {"VW3",8}, {"WGS3",32}, {"WPT3",32} } },
-        { "GeForce GTX 750 Ti",                              { {"VW3",8}, {"WGS3",32}, {"WPT3",32} } },
-        { "GeForce GTX TITAN",                               { {"VW3",1}, {"WGS3",16}, {"WPT3",16} } },
-        { "GeForce GTX TITAN Black",                         { {"VW3",4}, {"WGS3",128}, {"WPT3",16} } },
-        { "TITAN X (Pascal)",                                { {"VW3",8}, {"WGS3",64}, {"WPT3",32} } },
-        { "default",                                         { {"VW3",8}, {"WGS3",32}, {"WPT3",32} } },
+        { "GeForce GT 650M",                                 XgemvFastRotParameters[10] },
+        { "GeForce GTX 1080",                                XgemvFastRotParameters[0] },
+        { "GeForce GTX 750 Ti",                              XgemvFastRotParameters[0] },
+        { "GeForce GTX TITAN",                               XgemvFastRotParameters[11] },
+        { "GeForce GTX TITAN Black",                         XgemvFastRotParameters[12] },
+        { "TITAN X (Pascal)",                                XgemvFastRotParameters[2] },
+        { "default",                                         XgemvFastRotParameters[0] },
       }
     },
     { // Default
       kDeviceTypeAll, "default", {
-        { "default",                                         { {"VW3",8}, {"WGS3",32}, {"WPT3",32} } },
+        { "default",                                         XgemvFastRotParameters[0] },
       }
     },
   }
@@ -95,36 +121,36 @@ const Database::DatabaseEntry XgemvFastRotComplexSingle = {
   "XgemvFastRot", Precision::kComplexSingle, {
     { // AMD GPUs
       kDeviceTypeGPU, "AMD", {
-        { "AMD Radeon R9 M370X Compute Engine",              { {"VW3",8}, {"WGS3",16}, {"WPT3",16} } },
-        { "ATI Radeon HD 6750M",                             { {"VW3",8}, {"WGS3",32}, {"WPT3",8} } },
-        { "Ellesmere",                                       { {"VW3",2}, {"WGS3",32}, {"WPT3",16} } },
-        { "Fiji",                                            { {"VW3",4}, {"WGS3",32}, {"WPT3",32} } },
-        { "Tonga",                                           { {"VW3",4}, {"WGS3",32}, {"WPT3",32} } },
-        { "Turks",                                           { {"VW3",4}, {"WGS3",32}, {"WPT3",8} } },
-        { "default",                                         { {"VW3",8}, {"WGS3",16}, {"WPT3",16} } },
+        { "AMD Radeon R9 M370X Compute Engine",              XgemvFastRotParameters[13] },
+        { "ATI Radeon HD 6750M",                             XgemvFastRotParameters[14] },
+        { "Ellesmere",                                       XgemvFastRotParameters[8] },
+        { "Fiji",                                            XgemvFastRotParameters[5] },
+        { "Tonga",                                           XgemvFastRotParameters[5] },
+        { "Turks",                                           XgemvFastRotParameters[15] },
+        { "default",                                         XgemvFastRotParameters[13] },
       }
     },
     { // Intel CPUs
       kDeviceTypeCPU, "Intel", {
-        { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       { {"VW3",4}, {"WGS3",32}, {"WPT3",32} } },
-        { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        { {"VW3",4}, {"WGS3",32}, {"WPT3",32} } },
-        { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        { {"VW3",4}, {"WGS3",16}, {"WPT3",16} } },
-        { "default",                                         { {"VW3",4}, {"WGS3",32}, {"WPT3",32} } },
+        { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       XgemvFastRotParameters[5] },
+        { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        XgemvFastRotParameters[5] },
+        { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        XgemvFastRotParameters[9] },
+        { "default",                                         XgemvFastRotParameters[5] },
       }
     },
     { // Intel GPUs
       kDeviceTypeGPU, "Intel", {
-        { "Intel(R) HD Graphics 5500 BroadWell U-Processor GT2", { {"VW3",2}, {"WGS3",16}, {"WPT3",16} } },
-        { "Intel(R) HD Graphics Haswell Ultrabook GT2 Mobile", { {"VW3",4}, {"WGS3",128}, {"WPT3",8} } },
-        { "Intel(R) HD Graphics IvyBridge M GT2",            { {"VW3",4}, {"WGS3",32}, {"WPT3",8} } },
-        { "Intel(R) HD Graphics Skylake ULT GT2",            { {"VW3",4}, {"WGS3",64}, {"WPT3",16} } },
-        { "Iris Pro",                                        { {"VW3",4}, {"WGS3",16}, {"WPT3",16} } },
-        { "default",                                         { {"VW3",2}, {"WGS3",32}, {"WPT3",8} } },
+        { "Intel(R) HD Graphics 5500 BroadWell U-Processor GT2", XgemvFastRotParameters[16] },
+        { "Intel(R) HD Graphics Haswell Ultrabook GT2 Mobile", XgemvFastRotParameters[17] },
+        { "Intel(R) HD Graphics IvyBridge M GT2",            XgemvFastRotParameters[15] },
+        { "Intel(R) HD Graphics Skylake ULT GT2",            XgemvFastRotParameters[7] },
+        { "Iris Pro",                                        XgemvFastRotParameters[9] },
+        { "default",                                         XgemvFastRotParameters[18] },
       }
     },
     { // Default
       kDeviceTypeAll, "default", {
-        { "default",                                         { {"VW3",4}, {"WGS3",16}, {"WPT3",16} } },
+        { "default",                                         XgemvFastRotParameters[9] },
       }
     },
   }
@@ -136,34 +162,34 @@ const Database::DatabaseEntry XgemvFastRotDouble = {
   "XgemvFastRot", Precision::kDouble, {
     { // AMD GPUs
       kDeviceTypeGPU, "AMD", {
-        { "AMD Radeon R9 M370X Compute Engine",              { {"VW3",4}, {"WGS3",16}, {"WPT3",16} } },
-        { "Ellesmere",                                       { {"VW3",4}, {"WGS3",16}, {"WPT3",16} } },
-        { "Fiji",                                            { {"VW3",4}, {"WGS3",32}, {"WPT3",32} } },
-        { "Tonga",                                           { {"VW3",4}, {"WGS3",16}, {"WPT3",16} } },
-        { "default",                                         { {"VW3",4}, {"WGS3",16}, {"WPT3",16} } },
+        { "AMD Radeon R9 M370X Compute Engine",              XgemvFastRotParameters[9] },
+        { "Ellesmere",                                       XgemvFastRotParameters[9] },
+        { "Fiji",                                            XgemvFastRotParameters[5] },
+        { "Tonga",                                           XgemvFastRotParameters[9] },
+        { "default",                                         XgemvFastRotParameters[9] },
       }
     },
     { // Intel CPUs
       kDeviceTypeCPU, "Intel", {
-        { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       { {"VW3",4}, {"WGS3",32}, {"WPT3",32} } },
-        { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        { {"VW3",4}, {"WGS3",32}, {"WPT3",32} } },
-        { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        { {"VW3",8}, {"WGS3",16}, {"WPT3",8} } },
-        { "default",                                         { {"VW3",8}, {"WGS3",32}, {"WPT3",32} } },
+        { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       XgemvFastRotParameters[5] },
+        { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        XgemvFastRotParameters[5] },
+        { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        XgemvFastRotParameters[6] },
+        { "default",                                         XgemvFastRotParameters[0] },
       }
     },
     { // NVIDIA GPUs
       kDeviceTypeGPU, "NVIDIA", {
-        { "GeForce GTX 1080",                                { {"VW3",8}, {"WGS3",32}, {"WPT3",32} } },
-        { "GeForce GTX 750 Ti",                              { {"VW3",4}, {"WGS3",32}, {"WPT3",16} } },
-        { "GeForce GTX TITAN",                               { {"VW3",1}, {"WGS3",16}, {"WPT3",16} } },
-        { "GeForce GTX TITAN Black",                         { {"VW3",1}, {"WGS3",16}, {"WPT3",16} } },
-        { "TITAN X (Pascal)",                                { {"VW3",8}, {"WGS3",32}, {"WPT3",32} } },
-        { "default",                                         { {"VW3",4}, {"WGS3",32}, {"WPT3",16} } },
+        { "GeForce GTX 1080",                                XgemvFastRotParameters[0] },
+        { "GeForce GTX 750 Ti",                              XgemvFastRotParameters[4] },
+        { "GeForce GTX TITAN",                               XgemvFastRotParameters[11] },
+        { "GeForce GTX TITAN Black",                         XgemvFastRotParameters[11] },
+        { "TITAN X (Pascal)",                                XgemvFastRotParameters[0] },
+        { "default",                                         XgemvFastRotParameters[4] },
       }
     },
     { // Default
       kDeviceTypeAll, "default", {
-        { "default",                                         { {"VW3",4}, {"WGS3",16}, {"WPT3",16} } },
+        { "default",                                         XgemvFastRotParameters[9] },
       }
     },
   }
@@ -175,24 +201,24 @@ const Database::DatabaseEntry XgemvFastRotComplexDouble = {
   "XgemvFastRot", Precision::kComplexDouble, {
     { // AMD GPUs
       kDeviceTypeGPU, "AMD", {
-        { "AMD Radeon R9 M370X Compute Engine",              { {"VW3",4}, {"WGS3",32}, {"WPT3",16} } },
-        { "Ellesmere",                                       { {"VW3",4}, {"WGS3",16}, {"WPT3",16} } },
-        { "Fiji",                                            { {"VW3",4}, {"WGS3",32}, {"WPT3",8} } },
-        { "Tonga",                                           { {"VW3",4}, {"WGS3",16}, {"WPT3",8} } },
-        { "default",                                         { {"VW3",8}, {"WGS3",32}, {"WPT3",16} } },
+        { "AMD Radeon R9 M370X Compute Engine",              XgemvFastRotParameters[4] },
+        { "Ellesmere",                                       XgemvFastRotParameters[9] },
+        { "Fiji",                                            XgemvFastRotParameters[15] },
+        { "Tonga",                                           XgemvFastRotParameters[19] },
+        { "default",                                         XgemvFastRotParameters[10] },
       }
     },
     { // Intel CPUs
       kDeviceTypeCPU, "Intel", {
-        { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       { {"VW3",2}, {"WGS3",16}, {"WPT3",16} } },
-        { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        { {"VW3",2}, {"WGS3",16}, {"WPT3",16} } },
-        { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        { {"VW3",8}, {"WGS3",16}, {"WPT3",16} } },
-        { "default",                                         { {"VW3",2}, {"WGS3",16}, {"WPT3",16} } },
+        { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       XgemvFastRotParameters[16] },
+        { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        XgemvFastRotParameters[16] },
+        { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        XgemvFastRotParameters[13] },
+        { "default",                                         XgemvFastRotParameters[16] },
       }
     },
     { // Default
       kDeviceTypeAll, "default", {
-        { "default",                                         { {"VW3",4}, {"WGS3",16}, {"WPT3",16} } },
+        { "default",                                         XgemvFastRotParameters[9] },
       }
     },
   }
@@ -15,24 +15,88 @@ namespace clblast {
 namespace database {
 // =================================================================================================
 
+// The unique parameter sets of these kernels, referred to by index below
+const auto XgerParameters = Database::ParameterSets({"WGS1", "WGS2", "WPT"}, {
+  {64, 1, 2}, // 0
+  {256, 1, 2}, // 1
+  {64, 1, 4}, // 2
+  {4, 8, 2}, // 3
+  {256, 1, 1}, // 4
+  {16, 16, 4}, // 5
+  {64, 4, 2}, // 6
+  {64, 2, 1}, // 7
+  {32, 4, 2}, // 8
+  {64, 1, 1}, // 9
+  {16, 16, 1}, // 10
+  {64, 4, 4}, // 11
+  {32, 4, 4}, // 12
+  {128, 2, 4}, // 13
+  {256, 4, 4}, // 14
+  {128, 1, 4}, // 15
+  {128, 8, 4}, // 16
+  {32, 1, 2}, // 17
+  {256, 2, 2}, // 18
+  {128, 1, 2}, // 19
+  {32, 16, 4}, // 20
+  {512, 1, 1}, // 21
+  {16, 4, 1}, // 22
+  {256, 1, 4}, // 23
+  {32, 8, 2}, // 24
+  {64, 16, 4}, // 25
+  {512, 2, 1}, // 26
+  {64, 4, 1}, // 27
+  {16, 8, 2}, // 28
+  {128, 2, 1}, // 29
+  {4, 8, 1}, // 30
+  {128, 1, 1}, // 31
+  {256, 2, 4}, // 32
+  {512, 4, 2}, // 33
+  {16, 1, 1}, // 34
+  {16, 2, 4}, // 35
+  {128, 2, 2}, // 36
+  {16, 64, 2}, // 37
+  {32, 2, 1}, // 38
+  {16, 32, 2}, // 39
+  {16, 16, 2}, // 40
+  {64, 2, 2}, // 41
+  {32, 4, 1}, // 42
+  {8, 16, 2}, // 43
+  {512, 16, 1}, // 44
+  {512, 8, 2}, // 45
+  {128, 8, 2}, // 46
+  {32, 8, 1}, // 47
+  {32, 32, 2}, // 48
+  {128, 4, 2}, // 49
+  {32, 16, 1}, // 50
+  {8, 16, 1}, // 51
+  {64, 2, 4}, // 52
+  {128, 4, 4}, // 53
+  {512, 2, 2}, // 54
+  {8, 128, 1}, // 55
+  {8, 4, 1}, // 56
+  {8, 32, 4}, // 57
+});
+
+// =================================================================================================
+
 const Database::DatabaseEntry XgerHalf = {
   "Xger", Precision::kHalf, {
     { // AMD GPUs
       kDeviceTypeGPU, "AMD", {
-        { "Ellesmere",                                       { {"WGS1",64}, {"WGS2",1}, {"WPT",2} } },
-        { "default",                                         { {"WGS1",64}, {"WGS2",1}, {"WPT",2} } },
+        { "Ellesmere",                                       XgerParameters[0] },
+        { "default",                                         XgerParameters[0] },
       }
     },
     { // Intel GPUs
       kDeviceTypeGPU, "Intel", {
-        { "Intel(R) HD Graphics 5500 BroadWell U-Processor GT2", { {"WGS1",256}, {"WGS2",1}, {"WPT",2} } },
-        { "Intel(R) HD Graphics Skylake ULT GT2",            { {"WGS1",64}, {"WGS2",1}, {"WPT",4} } },
-        { "default",                                         { {"WGS1",4}, {"WGS2",8}, {"WPT",2} } },
+        { "Intel(R) HD Graphics 5500 BroadWell U-Processor GT2", XgerParameters[1] },
+        { "Intel(R) HD Graphics Skylake ULT GT2",            XgerParameters[2] },
+        { "default",                                         XgerParameters[3] },
       }
     },
     { // Default
       kDeviceTypeAll, "default", {
-        { "default",                                         { {"WGS1",64}, {"WGS2",1}, {"WPT",2} } },
+        { "default",                                         XgerParameters[0] },
       }
     },
   }
@@ -44,65 +108,65 @@ const Database::DatabaseEntry XgerSingle = {
   "Xger", Precision::kSingle, {
     { // AMD GPUs
       kDeviceTypeGPU, "AMD", {
-        { "AMD Radeon R9 M370X Compute Engine",              { {"WGS1",256}, {"WGS2",1}, {"WPT",1} } },
-        { "ATI Radeon HD 6750M",                             { {"WGS1",16}, {"WGS2",16}, {"WPT",4} } },
-        { "Ellesmere",                                       { {"WGS1",64}, {"WGS2",4}, {"WPT",2} } },
-        { "Fiji",                                            { {"WGS1",256}, {"WGS2",1}, {"WPT",1} } },
-        { "Hawaii",                                          { {"WGS1",64}, {"WGS2",2}, {"WPT",1} } },
-        { "Oland",                                           { {"WGS1",32}, {"WGS2",4}, {"WPT",2} } },
-        { "Pitcairn",                                        { {"WGS1",64}, {"WGS2",1}, {"WPT",1} } },
-        { "Tahiti",                                          { {"WGS1",256}, {"WGS2",1}, {"WPT",1} } },
-        { "Tonga",                                           { {"WGS1",256}, {"WGS2",1}, {"WPT",2} } },
-        { "Turks",                                           { {"WGS1",64}, {"WGS2",4}, {"WPT",2} } },
-        { "default",                                         { {"WGS1",16}, {"WGS2",16}, {"WPT",1} } },
+        { "AMD Radeon R9 M370X Compute Engine",              XgerParameters[4] },
+        { "ATI Radeon HD 6750M",                             XgerParameters[5] },
+        { "Ellesmere",                                       XgerParameters[6] },
+        { "Fiji",                                            XgerParameters[4] },
+        { "Hawaii",                                          XgerParameters[7] },
+        { "Oland",                                           XgerParameters[8] },
+        { "Pitcairn",                                        XgerParameters[9] },
+        { "Tahiti",                                          XgerParameters[4] },
+        { "Tonga",                                           XgerParameters[1] },
+        { "Turks",                                           XgerParameters[6] },
+        { "default",                                         XgerParameters[10] },
       }
     },
     { // ARM GPUs
       kDeviceTypeGPU, "ARM", {
-        { "Mali-T628",                                       { {"WGS1",64}, {"WGS2",4}, {"WPT",4} } },
-        { "default",                                         { {"WGS1",64}, {"WGS2",4}, {"WPT",4} } },
+        { "Mali-T628",                                       XgerParameters[11] },
+        { "default",                                         XgerParameters[11] },
       }
     },
     { // Intel CPUs
       kDeviceTypeCPU, "Intel", {
-        { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       { {"WGS1",32}, {"WGS2",4}, {"WPT",4} } },
-        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {"WGS1",128}, {"WGS2",2}, {"WPT",4} } },
-        { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        { {"WGS1",256}, {"WGS2",4}, {"WPT",4} } },
-        { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        { {"WGS1",128}, {"WGS2",1}, {"WPT",4} } },
-        { "default",                                         { {"WGS1",128}, {"WGS2",8}, {"WPT",4} } },
+        { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       XgerParameters[12] },
+        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        XgerParameters[13] },
+        { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        XgerParameters[14] },
+        { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        XgerParameters[15] },
+        { "default",                                         XgerParameters[16] },
       }
     },
     { // Intel GPUs
       kDeviceTypeGPU, "Intel", {
-        { "Intel(R) HD Graphics 530",                        { {"WGS1",32}, {"WGS2",1}, {"WPT",2} } },
-        { "Intel(R) HD Graphics 5500 BroadWell U-Processor GT2", { {"WGS1",256}, {"WGS2",2}, {"WPT",2} } },
-        { "Intel(R) HD Graphics Haswell Ultrabook GT2 Mobile", { {"WGS1",128}, {"WGS2",1}, {"WPT",2} } },
-        { "Intel(R) HD Graphics IvyBridge M GT2",            { {"WGS1",64}, {"WGS2",1}, {"WPT",4} } },
-        { "Intel(R) HD Graphics Skylake ULT GT2",            { {"WGS1",32}, {"WGS2",4}, {"WPT",4} } },
-        { "Iris Pro",                                        { {"WGS1",64}, {"WGS2",1}, {"WPT",4} } },
-        { "default",                                         { {"WGS1",32}, {"WGS2",4}, {"WPT",2} } },
+        { "Intel(R) HD Graphics 530",                        XgerParameters[17] },
+        { "Intel(R) HD Graphics 5500 BroadWell U-Processor GT2", XgerParameters[18] },
+        { "Intel(R) HD Graphics Haswell Ultrabook GT2 Mobile", XgerParameters[19] },
+        { "Intel(R) HD Graphics IvyBridge M GT2",            XgerParameters[2] },
+        { "Intel(R) HD Graphics Skylake ULT GT2",            XgerParameters[12] },
+        { "Iris Pro",                                        XgerParameters[2] },
+        { "default",                                         XgerParameters[8] },
       }
     },
     { // NVIDIA GPUs
       kDeviceTypeGPU, "NVIDIA", {
-        { "GRID K520",                                       { {"WGS1",128}, {"WGS2",1}, {"WPT",2} } },
-        { "GeForce GT 650M",                                 { {"WGS1",32}, {"WGS2",16}, {"WPT",4} } },
-        { "GeForce GTX 1070",                                { {"WGS1",512}, {"WGS2",1}, {"WPT",1} } },
-        { "GeForce GTX 1080",                                { {"WGS1",16}, {"WGS2",4}, {"WPT",1} } },
-        { "GeForce GTX 480",                                 { {"WGS1",256}, {"WGS2",1}, {"WPT",4} } },
-        { "GeForce GTX 670",                                 { {"WGS1",32}, {"WGS2",8}, {"WPT",2} } },
-        { "GeForce GTX 680",                                 { {"WGS1",128}, {"WGS2",1}, {"WPT",4} } },
-        { "GeForce GTX 750",                                 { {"WGS1",64}, {"WGS2",16}, {"WPT",4} } },
-        { "GeForce GTX 750 Ti",                              { {"WGS1",64}, {"WGS2",1}, {"WPT",2} } },
-        { "GeForce GTX TITAN",                               { {"WGS1",32}, {"WGS2",4}, {"WPT",2} } },
-        { "GeForce GTX TITAN Black",                         { {"WGS1",32}, {"WGS2",4}, {"WPT",2} } },
-        { "TITAN X (Pascal)",                                { {"WGS1",512}, {"WGS2",2}, {"WPT",1} } },
-        { "default",                                         { {"WGS1",128}, {"WGS2",1}, {"WPT",2} } },
+        { "GRID K520",                                       XgerParameters[19] },
+        { "GeForce GT 650M",                                 XgerParameters[20] },
+        { "GeForce GTX 1070",                                XgerParameters[21] },
+        { "GeForce GTX 1080",                                XgerParameters[22] },
+        { "GeForce GTX 480",                                 XgerParameters[23] },
+        { "GeForce GTX 670",                                 XgerParameters[24] },
+        { "GeForce GTX 680",                                 XgerParameters[15] },
+        { "GeForce GTX 750",                                 XgerParameters[25] },
+        { "GeForce GTX 750 Ti",                              XgerParameters[0] },
+        { "GeForce GTX TITAN",                               XgerParameters[8] },
+        { "GeForce GTX TITAN Black",                         XgerParameters[8] },
+        { "TITAN X (Pascal)",                                XgerParameters[26] },
+        { "default",                                         XgerParameters[19] },
       }
     },
     { // Default
       kDeviceTypeAll, "default", {
-        { "default",                                         { {"WGS1",32}, {"WGS2",4}, {"WPT",2} } },
+        { "default",                                         XgerParameters[8] },
       }
     },
   }
@@ -114,64 +178,64 @@ const Database::DatabaseEntry XgerComplexSingle = {
   "Xger", Precision::kComplexSingle, {
     { // AMD GPUs
       kDeviceTypeGPU, "AMD", {
-        { "AMD Radeon R9 M370X Compute Engine",              { {"WGS1",64}, {"WGS2",4}, {"WPT",1} } },
-        { "ATI Radeon HD 6750M",                             { {"WGS1",16}, {"WGS2",16}, {"WPT",1} } },
-        { "Ellesmere",                                       { {"WGS1",16}, {"WGS2",8}, {"WPT",2} } },
-        { "Fiji",                                            { {"WGS1",128}, {"WGS2",2}, {"WPT",1} } },
-        { "Hawaii",                                          { {"WGS1",64}, {"WGS2",1}, {"WPT",2} } },
-        { "Oland",                                           { {"WGS1",4}, {"WGS2",8}, {"WPT",1} } },
-        { "Pitcairn",                                        { {"WGS1",128}, {"WGS2",2}, {"WPT",1} } },
-        { "Tahiti",                                          { {"WGS1",64}, {"WGS2",2}, {"WPT",1} } },
-        { "Tonga",                                           { {"WGS1",64}, {"WGS2",1}, {"WPT",1} } },
-        { "Turks",                                           { {"WGS1",128}, {"WGS2",2}, {"WPT",1} } },
-        { "default",                                         { {"WGS1",128}, {"WGS2",2}, {"WPT",1} } },
+        { "AMD Radeon R9 M370X Compute Engine",              XgerParameters[27] },
+        { "ATI Radeon HD 6750M",                             XgerParameters[10] },
+        { "Ellesmere",                                       XgerParameters[28] },
+        { "Fiji",                                            XgerParameters[29] },
+        { "Hawaii",                                          XgerParameters[0] },
+        { "Oland",                                           XgerParameters[30] },
+        { "Pitcairn",                                        XgerParameters[29] },
+        { "Tahiti",                                          XgerParameters[7] },
+        { "Tonga",                                           XgerParameters[9] },
+        { "Turks",                                           XgerParameters[29] },
+        { "default",                                         XgerParameters[29] },
       }
     },
     { // ARM GPUs
       kDeviceTypeGPU, "ARM", {
-        { "Mali-T628",                                       { {"WGS1",128}, {"WGS2",1}, {"WPT",1} } },
-        { "default",                                         { {"WGS1",128}, {"WGS2",1}, {"WPT",1} } },
+        { "Mali-T628",                                       XgerParameters[31] },
+        { "default",                                         XgerParameters[31] },
       }
     },
     { // Intel CPUs
       kDeviceTypeCPU, "Intel", {
-        { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       { {"WGS1",128}, {"WGS2",2}, {"WPT",4} } },
-        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {"WGS1",256}, {"WGS2",1}, {"WPT",4} } },
-        { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        { {"WGS1",256}, {"WGS2",2}, {"WPT",4} } },
-        { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        { {"WGS1",512}, {"WGS2",4}, {"WPT",2} } },
-        { "default",                                         { {"WGS1",256}, {"WGS2",2}, {"WPT",4} } },
+        { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       XgerParameters[13] },
+        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        XgerParameters[23] },
+        { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        XgerParameters[32] },
+        { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        XgerParameters[33] },
+        { "default",                                         XgerParameters[32] },
       }
     },
     { // Intel GPUs
       kDeviceTypeGPU, "Intel", {
-        { "Intel(R) HD Graphics 530",                        { {"WGS1",32}, {"WGS2",1}, {"WPT",2} } },
-        { "Intel(R) HD Graphics 5500 BroadWell U-Processor GT2", { {"WGS1",128}, {"WGS2",2}, {"WPT",1} } },
-        { "Intel(R) HD Graphics Haswell Ultrabook GT2 Mobile", { {"WGS1",512}, {"WGS2",1}, {"WPT",1} } },
-        { "Intel(R) HD Graphics IvyBridge M GT2",            { {"WGS1",256}, {"WGS2",1}, {"WPT",2} } },
-        { "Intel(R) HD Graphics Skylake ULT GT2",            { {"WGS1",16}, {"WGS2",1}, {"WPT",1} } },
-        { "Iris Pro",                                        { {"WGS1",16}, {"WGS2",2}, {"WPT",4} } },
-        { "default",                                         { {"WGS1",128}, {"WGS2",2}, {"WPT",2} } },
+        { "Intel(R) HD Graphics 530",                        XgerParameters[17] },
+        { "Intel(R) HD Graphics 5500 BroadWell U-Processor GT2", XgerParameters[29] },
+        { "Intel(R) HD Graphics Haswell Ultrabook GT2 Mobile", XgerParameters[21] },
+        { "Intel(R) HD Graphics IvyBridge M GT2",            XgerParameters[1] },
+        { "Intel(R) HD Graphics Skylake ULT GT2",            XgerParameters[34] },
+        { "Iris Pro",                                        XgerParameters[35] },
+        { "default",                                         XgerParameters[36] },
       }
     },
     { // NVIDIA GPUs
       kDeviceTypeGPU, "NVIDIA", {
-        { "GRID K520",                                       { {"WGS1",64}, {"WGS2",4}, {"WPT",2} } },
-        { "GeForce GTX 1070",                                { {"WGS1",16}, {"WGS2",64}, {"WPT",2} } },
-        { "GeForce GTX 1080",                                { {"WGS1",32}, {"WGS2",2}, {"WPT",1} } },
-        { "GeForce GTX 480",                                 { {"WGS1",128}, {"WGS2",2}, {"WPT",2} } },
-        { "GeForce GTX 670",                                 { {"WGS1",16}, {"WGS2",32}, {"WPT",2} } },
-        { "GeForce GTX 680",                                 { {"WGS1",32}, {"WGS2",4}, {"WPT",2} } },
-        { "GeForce GTX 750",                                 { {"WGS1",32}, {"WGS2",16}, {"WPT",4} } },
-        { "GeForce GTX 750 Ti",                              { {"WGS1",32}, {"WGS2",8}, {"WPT",2} } },
-        { "GeForce GTX TITAN",                               { {"WGS1",16}, {"WGS2",16}, {"WPT",2} } },
-        { "GeForce GTX TITAN Black",                         { {"WGS1",16}, {"WGS2",16}, {"WPT",2} } },
-        { "TITAN X (Pascal)",                                { {"WGS1",32}, {"WGS2",2}, {"WPT",1} } },
-        { "default",                                         { {"WGS1",128}, {"WGS2",2}, {"WPT",2} } },
+        { "GRID K520",                                       XgerParameters[6] },
+        { "GeForce GTX 1070",                                XgerParameters[37] },
+        { "GeForce GTX 1080",                                XgerParameters[38] },
+        { "GeForce GTX 480",                                 XgerParameters[36] },
+        { "GeForce GTX 670",                                 XgerParameters[39] },
+        { "GeForce GTX 680",                                 XgerParameters[8] },
+        { "GeForce GTX 750",                                 XgerParameters[20] },
+        { "GeForce GTX 750 Ti",                              XgerParameters[24] },
+        { "GeForce GTX TITAN",                               XgerParameters[40] },
+        { "GeForce GTX TITAN Black",                         XgerParameters[40] },
+        { "TITAN X (Pascal)",                                XgerParameters[38] },
+        { "default",                                         XgerParameters[36] },
       }
     },
     { // Default
       kDeviceTypeAll, "default", {
-        { "default",                                         { {"WGS1",64}, {"WGS2",2}, {"WPT",2} } },
+        { "default",                                         XgerParameters[41] },
       }
     },
   }
@@ -183,51 +247,51 @@ const Database::DatabaseEntry XgerDouble = {
   "Xger", Precision::kDouble, {
     { // AMD GPUs
       kDeviceTypeGPU, "AMD", {
-        { "AMD Radeon R9 M370X Compute Engine",              { {"WGS1",32}, {"WGS2",4}, {"WPT",1} } },
-        { "Ellesmere",                                       { {"WGS1",64}, {"WGS2",1}, {"WPT",4} } },
-        { "Fiji",                                            { {"WGS1",256}, {"WGS2",1}, {"WPT",2} } },
-        { "Hawaii",                                          { {"WGS1",32}, {"WGS2",4}, {"WPT",2} } },
-        { "Oland",                                           { {"WGS1",128}, {"WGS2",1}, {"WPT",2} } },
-        { "Pitcairn",                                        { {"WGS1",64}, {"WGS2",1}, {"WPT",1} } },
-        { "Tahiti",                                          { {"WGS1",64}, {"WGS2",2}, {"WPT",1} } },
-        { "Tonga",                                           { {"WGS1",8}, {"WGS2",16}, {"WPT",2} } },
-        { "default",                                         { {"WGS1",128}, {"WGS2",2}, {"WPT",1} } },
+        { "AMD Radeon R9 M370X Compute Engine",              XgerParameters[42] },
+        { "Ellesmere",                                       XgerParameters[2] },
+        { "Fiji",                                            XgerParameters[1] },
+        { "Hawaii",                                          XgerParameters[8] },
+        { "Oland",                                           XgerParameters[19] },
+        { "Pitcairn",                                        XgerParameters[9] },
+        { "Tahiti",                                          XgerParameters[7] },
+        { "Tonga",                                           XgerParameters[43] },
+        { "default",                                         XgerParameters[29] },
       }
     },
     { // ARM GPUs
       kDeviceTypeGPU, "ARM", {
-        { "Mali-T628",                                       { {"WGS1",64}, {"WGS2",4}, {"WPT",1} } },
-        { "default",                                         { {"WGS1",64}, {"WGS2",4}, {"WPT",1} } },
+        { "Mali-T628",                                       XgerParameters[27] },
+        { "default",                                         XgerParameters[27] },
       }
     },
     { // Intel CPUs
       kDeviceTypeCPU, "Intel", {
-        { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       { {"WGS1",256}, {"WGS2",1}, {"WPT",4} } },
-        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {"WGS1",512}, {"WGS2",16}, {"WPT",1} } },
-        { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        { {"WGS1",256}, {"WGS2",4}, {"WPT",4} } },
-        { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        { {"WGS1",512}, {"WGS2",8}, {"WPT",2} } },
-        { "default",                                         { {"WGS1",256}, {"WGS2",1}, {"WPT",4} } },
+        { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       XgerParameters[23] },
+        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        XgerParameters[44] },
+        { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        XgerParameters[14] },
+        { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        XgerParameters[45] },
+        { "default",                                         XgerParameters[23] },
       }
     },
     { // NVIDIA GPUs
       kDeviceTypeGPU, "NVIDIA", {
-        { "GRID K520",                                       { {"WGS1",128}, {"WGS2",8}, {"WPT",2} } },
-        { "GeForce GTX 1070",                                { {"WGS1",32}, {"WGS2",8}, {"WPT",1} } },
-        { "GeForce GTX 1080",                                { {"WGS1",32}, {"WGS2",2}, {"WPT",1} } },
-        { "GeForce GTX 480",                                 { {"WGS1",32}, {"WGS2",4}, {"WPT",2} } },
-        { "GeForce GTX 670",                                 { {"WGS1",32}, {"WGS2",32}, {"WPT",2} } },
-        { "GeForce GTX 680",                                 { {"WGS1",128}, {"WGS2",4}, {"WPT",2} } },
-        { "GeForce GTX 750",                                 { {"WGS1",256}, {"WGS2",2}, {"WPT",2} } },
-        { "GeForce GTX 750 Ti",                              { {"WGS1",32}, {"WGS2",16}, {"WPT",1} } },
-        { "GeForce GTX TITAN",                               { {"WGS1",16}, {"WGS2",8}, {"WPT",2} } },
-        { "GeForce GTX TITAN Black",                         { {"WGS1",32}, {"WGS2",4}, {"WPT",2} } },
-        { "TITAN X (Pascal)",                                { {"WGS1",32}, {"WGS2",2}, {"WPT",1} } },
-        { "default",                                         { {"WGS1",128}, {"WGS2",1}, {"WPT",2} } },
+        { "GRID K520",                                       XgerParameters[46] },
+        { "GeForce GTX 1070",                                XgerParameters[47] },
+        { "GeForce GTX 1080",                                XgerParameters[38] },
+        { "GeForce GTX 480",                                 XgerParameters[8] },
+        { "GeForce GTX 670",                                 XgerParameters[48] },
+        { "GeForce GTX 680",                                 XgerParameters[49] },
+        { "GeForce GTX 750",                                 XgerParameters[18] },
+        { "GeForce GTX 750 Ti",                              XgerParameters[50] },
+        { "GeForce GTX TITAN",                               XgerParameters[28] },
+        { "GeForce GTX TITAN Black",                         XgerParameters[8] },
+        { "TITAN X (Pascal)",                                XgerParameters[38] },
+        { "default",                                         XgerParameters[19] },
       }
     },
     { // Default
       kDeviceTypeAll, "default", {
-        { "default",                                         { {"WGS1",128}, {"WGS2",1}, {"WPT",2} } },
+        { "default",                                         XgerParameters[19] },
       }
     },
   }
@@ -239,51 +303,51 @@ const Database::DatabaseEntry XgerComplexDouble = {
   "Xger", Precision::kComplexDouble, {
     { // AMD GPUs
       kDeviceTypeGPU, "AMD", {
-        { "AMD Radeon R9 M370X Compute Engine",              { {"WGS1",64}, {"WGS2",1}, {"WPT",1} } },
-        { "Ellesmere",                                       { {"WGS1",8}, {"WGS2",16}, {"WPT",1} } },
-        { "Fiji",                                            { {"WGS1",64}, {"WGS2",4}, {"WPT",2} } },
-        { "Hawaii",                                          { {"WGS1",128}, {"WGS2",1}, {"WPT",1} } },
-        { "Oland",                                           { {"WGS1",16}, {"WGS2",16}, {"WPT",2} } },
-        { "Pitcairn",                                        { {"WGS1",64}, {"WGS2",4}, {"WPT",1} } },
-        { "Tahiti",                                          { {"WGS1",32}, {"WGS2",4}, {"WPT",1} } },
-        { "Tonga",                                           { {"WGS1",16}, {"WGS2",4}, {"WPT",1} } },
-        { "default",                                         { {"WGS1",32}, {"WGS2",4}, {"WPT",1} } },
+        { "AMD Radeon R9 M370X Compute Engine",              XgerParameters[9] },
+        { "Ellesmere",                                       XgerParameters[51] },
+        { "Fiji",                                            XgerParameters[6] },
+        { "Hawaii",                                          XgerParameters[31] },
+        { "Oland",                                           XgerParameters[40] },
+        { "Pitcairn",                                        XgerParameters[27] },
+        { "Tahiti",                                          XgerParameters[42] },
+        { "Tonga",                                           XgerParameters[22] },
+        { "default",                                         XgerParameters[42] },
       }
     },
     { // ARM GPUs
       kDeviceTypeGPU, "ARM", {
-        { "Mali-T628",                                       { {"WGS1",64}, {"WGS2",2}, {"WPT",4} } },
-        { "default",                                         { {"WGS1",64}, {"WGS2",2}, {"WPT",4} } },
+        { "Mali-T628",                                       XgerParameters[52] },
+        { "default",                                         XgerParameters[52] },
       }
     },
     { // Intel CPUs
       kDeviceTypeCPU, "Intel", {
-        { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       { {"WGS1",128}, {"WGS2",4}, {"WPT",4} } },
-        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {"WGS1",512}, {"WGS2",4}, {"WPT",2} } },
-        { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        { {"WGS1",512}, {"WGS2",2}, {"WPT",2} } },
-        { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        { {"WGS1",256}, {"WGS2",1}, {"WPT",2} } },
-        { "default",                                         { {"WGS1",256}, {"WGS2",1}, {"WPT",2} } },
+        { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       XgerParameters[53] },
+        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        XgerParameters[33] },
+        { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        XgerParameters[54] },
+        { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        XgerParameters[1] },
+        { "default",                                         XgerParameters[1] },
       }
     },
     { // NVIDIA GPUs
       kDeviceTypeGPU, "NVIDIA", {
-        { "GRID K520",                                       { {"WGS1",16}, {"WGS2",8}, {"WPT",2} } },
-        { "GeForce GTX 1070",                                { {"WGS1",8}, {"WGS2",128}, {"WPT",1} } },
-        { "GeForce GTX 1080",                                { {"WGS1",8}, {"WGS2",4}, {"WPT",1} } },
-        { "GeForce GTX 480",                                 { {"WGS1",64}, {"WGS2",2}, {"WPT",2} } },
-        { "GeForce GTX 670",                                 { {"WGS1",8}, {"WGS2",16}, {"WPT",2} } },
-        { "GeForce GTX 680",                                 { {"WGS1",8}, {"WGS2",16}, {"WPT",1} } },
-        { "GeForce GTX 750",                                 { {"WGS1",8}, {"WGS2",32}, {"WPT",4} } },
-        { "GeForce GTX 750 Ti",                              { {"WGS1",32}, {"WGS2",8}, {"WPT",2} } },
-        { "GeForce GTX TITAN",                               { {"WGS1",32}, {"WGS2",4}, {"WPT",2} } },
-        { "GeForce GTX TITAN Black",                         { {"WGS1",16}, {"WGS2",16}, {"WPT",2} } },
-        { "TITAN X (Pascal)",                                { {"WGS1",4}, {"WGS2",8}, {"WPT",1} } },
-        { "default",                                         { {"WGS1",16}, {"WGS2",8}, {"WPT",2} } },
+        { "GRID K520",                                       XgerParameters[28] },
+        { "GeForce GTX 1070",                                XgerParameters[55] },
+        { "GeForce GTX 1080",                                XgerParameters[56] },
+        { "GeForce GTX 480",                                 XgerParameters[41] },
+        { "GeForce GTX 670",                                 XgerParameters[43] },
+        { "GeForce GTX 680",                                 XgerParameters[51] },
+        { "GeForce GTX 750",                                 XgerParameters[57] },
+        { "GeForce GTX 750 Ti",                              XgerParameters[24] },
+        { "GeForce GTX TITAN",                               XgerParameters[8] },
+        { "GeForce GTX TITAN Black",                         XgerParameters[40] },
+        { "TITAN X (Pascal)",                                XgerParameters[30] },
+        { "default",                                         XgerParameters[28] },
       }
     },
     { // Default
       kDeviceTypeAll, "default", {
-        { "default",                                         { {"WGS1",64}, {"WGS2",2}, {"WPT",2} } },
+        { "default",                                         XgerParameters[41] },
       }
     },
   }
@@ -15,11 +15,18 @@ namespace clblast {
 namespace database {
 // =================================================================================================
 
+// The unique parameter sets of these kernels, referred to by index below
+const auto XtrsvParameters = Database::ParameterSets({"TRSV_BLOCK_SIZE"}, {
+  {32}, // 0
+});
+
+// =================================================================================================
+
 const Database::DatabaseEntry XtrsvHalf = {
   "Xtrsv", Precision::kHalf, {
     { // Default
       kDeviceTypeAll, "default", {
-        { "default",                                         { {"TRSV_BLOCK_SIZE",32} } },
+        { "default",                                         XtrsvParameters[0] },
       }
     },
   }
@@ -31,7 +38,7 @@ const Database::DatabaseEntry XtrsvSingle = {
   "Xtrsv", Precision::kSingle, {
     { // Default
       kDeviceTypeAll, "default", {
-        { "default",                                         { {"TRSV_BLOCK_SIZE",32} } },
+        { "default",                                         XtrsvParameters[0] },
       }
     },
   }
@@ -43,7 +50,7 @@ const Database::DatabaseEntry XtrsvComplexSingle = {
   "Xtrsv", Precision::kComplexSingle, {
     { // Default
       kDeviceTypeAll, "default", {
-        { "default",                                         { {"TRSV_BLOCK_SIZE",32} } },
+        { "default",                                         XtrsvParameters[0] },
       }
     },
   }
@@ -55,7 +62,7 @@ const Database::DatabaseEntry XtrsvDouble = {
   "Xtrsv", Precision::kDouble, {
     { // Default
       kDeviceTypeAll, "default", {
-        { "default",                                         { {"TRSV_BLOCK_SIZE",32} } },
+        { "default",                                         XtrsvParameters[0] },
       }
     },
   }
@@ -67,7 +74,7 @@ const Database::DatabaseEntry XtrsvComplexDouble = {
   "Xtrsv", Precision::kComplexDouble, {
     { // Default
       kDeviceTypeAll, "default", {
-        { "default",                                         { {"TRSV_BLOCK_SIZE",32} } },
+        { "default",                                         XtrsvParameters[0] },
       }
     },
   }
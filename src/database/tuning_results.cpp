@@ -0,0 +1,513 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the loading of tuning results at run-time (see the header for more
+// information).
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <mutex>
+#include <fstream>
+#include <sstream>
+#include <cctype>
+#include <cstdlib>
+#include <cstdio>
+#include <algorithm>
+
+#if defined(_WIN32)
+  #ifndef NOMINMAX
+    #define NOMINMAX
+  #endif
+  #include <windows.h>
+#else
+  #include <dirent.h>
+#endif
+
+#include "database/tuning_results.hpp"
+
+namespace clblast {
+// =================================================================================================
+namespace {
+
+// A parsed JSON value. Only what the tuners write is supported: objects, arrays, strings and
+// numbers. Booleans are stored as numbers and 'null' as an empty value.
+struct JsonValue {
+  enum class Type { kNull, kNumber, kString, kArray, kObject };
+  Type type = Type::kNull;
+  double number = 0.0;
+  std::string string;
+  std::vector<std::string> keys; // only for objects
+  std::vector<JsonValue> values; // the elements of an array or the values of an object
+};
+
+// A small recursive-descent JSON parser, throwing on malformed input
+class JsonParser {
+ public:
+  explicit JsonParser(const std::string &text): text_(text), pos_(0) { }
+
+  JsonValue Parse() {
+    const auto value = ParseValue();
+    SkipWhitespace();
+    if (pos_ != text_.size()) { Fail(); }
+    return value;
+  }
+
+ private:
+  void Fail() const { throw RuntimeErrorCode(StatusCode::kInvalidTuningResults); }
+
+  void SkipWhitespace() {
+    while (pos_ < text_.size() && std::isspace(static_cast<unsigned char>(text_[pos_]))) { pos_++; }
+  }
+  bool Consume(const char c) {
+    SkipWhitespace();
+    if (pos_ < text_.size() && text_[pos_] == c) { pos_++; return true; }
+    return false;
+  }
+  void Expect(const char c) {
+    if (!Consume(c)) { Fail(); }
+  }
+
+  JsonValue ParseValue() {
+    SkipWhitespace();
+    if (pos_ >= text_.size()) { Fail(); }
+    auto value = JsonValue();
+    if (Consume('{')) {
+      value.type = JsonValue::Type::kObject;
+      if (Consume('}')) { return value; }
+      do {
+        SkipWhitespace();
+        value.keys.push_back(ParseString());
+        Expect(':');
+        value.values.push_back(ParseValue());
+      } while (Consume(','));
+      Expect('}');
+    }
+    else if (Consume('[')) {
+      value.type = JsonValue::Type::kArray;
+      if (Consume(']')) { return value; }
+      do {
+        value.values.push_back(ParseValue());
+      } while (Consume(','));
+      Expect(']');
+    }
+    else if (text_[pos_] == '"') {
+      value.type = JsonValue::Type::kString;
+      value.string = ParseString();
+    }
+    else if (text_.compare(pos_, 4, "null") == 0) {
+      pos_ += 4;
+    }
+    else if (text_.compare(pos_, 4, "true") == 0 || text_.compare(pos_, 5, "false") == 0) {
+      value.type = JsonValue::Type::kNumber;
+      value.number = (text_[pos_] == 't') ? 1.0 : 0.0;
+      pos_ += (text_[pos_] == 't') ? 4 : 5;
+    }
+    else {
+      const auto start = text_.c_str() + pos_;
+      auto end = static_cast<char*>(nullptr);
+      value.type = JsonValue::Type::kNumber;
+      value.number = std::strtod(start, &end);
+      if (end == start) { Fail(); }
+      pos_ += static_cast<size_t>(end - start);
+    }
+    return value;
+  }
+
+  // Parses a string, translating the common escape sequences (unicode ones are not expected)
+  std::string ParseString() {
+    if (pos_ >= text_.size() || text_[pos_] != '"') { Fail(); }
+    pos_++;
+    auto result = std::string{};
+    while (pos_ < text_.size() && text_[pos_] != '"') {
+      auto c = text_[pos_++];
+      if (c == '\\') {
+        if (pos_ >= text_.size()) { Fail(); }
+        c = text_[pos_++];
+        if (c == 'n') { c = '\n'; }
+        else if (c == 't') { c = '\t'; }
+        else if (c == 'r') { c = '\r'; }
+        else if (c == 'u') { pos_ += 4; c = '?'; }
+      }
+      result += c;
+    }
+    if (pos_ >= text_.size()) { Fail(); }
+    pos_++;
+    return result;
+  }
+
+  const std::string &text_;
+  size_t pos_;
+};
+
+// Retrieves a field of a JSON object, throwing if it is missing or of the wrong type
+const JsonValue& Field(const JsonValue &object, const std::string &key,
+                       const JsonValue::Type type) {
+  for (auto i = size_t{0}; i < object.keys.size(); ++i) {
+    if (object.keys[i] == key && object.values[i].type == type) { return object.values[i]; }
+  }
+  throw RuntimeErrorCode(StatusCode::kInvalidTuningResults);
+}
+
+// =================================================================================================
+
+// The overlay database and a flag to process the environmental variable once
+struct TuningResultsState {
+  std::mutex mutex;
+  std::once_flag environment_flag;
+  std::unordered_map<std::string, std::vector<Database::DatabaseEntry>> entries;
+};
+TuningResultsState& State() {
+  static TuningResultsState state;
+  return state;
+}
+
+// Whether two single-device entries are for the same kernel, precision and device
+bool IsSameTarget(const Database::DatabaseEntry &a, const Database::DatabaseEntry &b) {
+  return a.kernel == b.kernel && a.precision == b.precision &&
+         a.vendors.front().type == b.vendors.front().type &&
+         a.vendors.front().name == b.vendors.front().name &&
+         a.vendors.front().devices.front().name == b.vendors.front().devices.front().name;
+}
+
+// The best result of a tuner's JSON file as a single-device database entry, which holds only the
+// parameters tuned by this file. Also holds the regular kernel name (without shape class), the
+// best result itself, the meta-data and the name of the file.
+struct FileResult {
+  Database::DatabaseEntry entry;
+  std::string regular_kernel;
+  TuningResult best;
+  Metadata metadata;
+  std::string filename;
+};
+
+// The overlay database, indexed by kernel name
+using Overlay = std::unordered_map<std::string, std::vector<Database::DatabaseEntry>>;
+
+// Converts the best result of a tuner's JSON file into a single-device database entry
+FileResult ReadTuningResults(const std::string &filename) {
+  auto metadata = Metadata();
+  const auto results = ReadTuningResultsFile(filename, metadata);
+
+  // Retrieves the meta-data
+  auto GetMetadata = [&metadata](const std::string &key) -> std::string {
+    for (const auto &item : metadata) {
+      if (item.first == key) { return item.second; }
+    }
+    throw RuntimeErrorCode(StatusCode::kInvalidTuningResults);
+  };
+  const auto kernel_family = GetMetadata("kernel_family");
+  const auto device_name = GetMetadata("device");
+  const auto device_vendor = GetMetadata("device_vendor");
+  const auto device_type = GetMetadata("device_type");
+  auto precision = Precision::kAny;
+  try {
+    precision = static_cast<Precision>(std::stoi(GetMetadata("precision")));
+  } catch (const std::exception &) {
+    throw RuntimeErrorCode(StatusCode::kInvalidTuningResults);
+  }
+
+  // Selects the fastest result
+  auto best_result = static_cast<const TuningResult*>(nullptr);
+  for (const auto &result : results) {
+    if (best_result == nullptr || result.time < best_result->time) { best_result = &result; }
+  }
+  if (best_result == nullptr) { throw RuntimeErrorCode(StatusCode::kInvalidTuningResults); }
+
+  // The database name of the kernel follows from the kernel family, as the 'kernel' field holds the
+  // name of the OpenCL kernel (e.g. 'CopyMatrixFast' for the 'Copy' entries). Results of a specific
+  // shape class (e.g. from 'xgemm_1_small') are stored as a separate kernel.
+  auto family = kernel_family;
+  auto shape_bucket = std::string{""};
+  for (const auto &bucket : {database::kShapeBucketSmall, database::kShapeBucketWide,
+                             database::kShapeBucketDeep}) {
+    const auto suffix = "_" + bucket;
+    if (family.size() > suffix.size() &&
+        family.compare(family.size() - suffix.size(), suffix.size(), suffix) == 0) {
+      family = family.substr(0, family.size() - suffix.size());
+      shape_bucket = bucket;
+    }
+  }
+  const auto kernel = Database::FamilyKernelName(family);
+
+  // Retrieves the parameters, except for the 'PRECISION' parameter which is redundant
+  auto parameters = best_result->parameters;
+  parameters.erase("PRECISION");
+
+  const auto kernel_name = Database::ShapeBucketKernelName(kernel, shape_bucket);
+  const auto database_device = Database::DatabaseDevice{device_name, parameters};
+  const auto database_vendor = Database::DatabaseVendor{device_type,
+                                                        Database::ShortVendorName(device_vendor),
+                                                        {database_device}};
+  const auto entry = Database::DatabaseEntry{kernel_name, precision, {database_vendor}};
+  return FileResult{entry, kernel, *best_result, metadata, filename};
+}
+
+// Adds a file which could not be loaded to the list of errors
+void SkipFile(std::vector<TuningResultsError> &errors, const std::string &filename,
+              const StatusCode status) {
+  #ifdef VERBOSE
+    printf("[DEBUG] Skipping the tuning results of '%s' (status code %d)\n",
+           filename.c_str(), static_cast<int>(status));
+  #endif
+  errors.push_back({filename, status});
+}
+
+// Reads the files, grouping the results per target (e.g. from the 'xdot_1' and 'xdot_2' tuners).
+// The results of each target are sorted by time, fastest first.
+std::vector<std::vector<FileResult>> ReadTargets(const std::vector<std::string> &filenames,
+                                                 std::vector<TuningResultsError> &errors) {
+  auto targets = std::vector<std::vector<FileResult>>();
+  for (const auto &filename : filenames) {
+    try {
+      const auto result = ReadTuningResults(filename);
+      const auto it = std::find_if(targets.begin(), targets.end(),
+                                   [&result](const std::vector<FileResult> &t) { return IsSameTarget(t.front().entry, result.entry); });
+      if (it == targets.end()) { targets.push_back({result}); }
+      else { it->push_back(result); }
+    } catch (const RuntimeErrorCode &e) {
+      SkipFile(errors, filename, e.status());
+    } catch (const std::exception &) {
+      SkipFile(errors, filename, StatusCode::kInvalidTuningResults);
+    }
+  }
+  for (auto &target : targets) {
+    std::stable_sort(target.begin(), target.end(), [](const FileResult &a, const FileResult &b) {
+      return a.best.time < b.best.time;
+    });
+  }
+  return targets;
+}
+
+// Merges the results of multiple files for the same target (sorted by time) into a single entry. Of
+// parameters found in multiple files, the value of the fastest result is used. Parameters which are
+// not tuned by any of the files are taken from the current parameters of the device: those in the
+// overlay for this device, or otherwise those of the built-in database (the parameters of the
+// regular kernel in case of a shape class). Throws if the kernel is unknown or if the parameters are
+// incomplete compared to the entry of the built-in database matching this device.
+Database::DatabaseEntry MergeTuningResults(const std::vector<FileResult> &results,
+                                           const Overlay &overlay) {
+  const auto &target = results.front().entry;
+  const auto &vendor = target.vendors.front();
+  const auto &device_name = vendor.devices.front().name;
+  auto parameters = Database::Parameters();
+  for (const auto &result : results) {
+    const auto &result_parameters = *result.entry.vendors.front().devices.front().parameters;
+    parameters.insert(result_parameters.begin(), result_parameters.end());
+  }
+
+  // Finds the current and the built-in parameters of the device, preferring the shape class
+  auto kernel_names = std::vector<std::string>{target.kernel};
+  if (results.front().regular_kernel != target.kernel) {
+    kernel_names.push_back(results.front().regular_kernel);
+  }
+  auto current = static_cast<const Database::DatabaseDevice*>(nullptr);
+  auto built_in = static_cast<const Database::DatabaseDevice*>(nullptr);
+  for (const auto &kernel_name : kernel_names) {
+    const auto overlay_entries = overlay.find(kernel_name);
+    if (current == nullptr && overlay_entries != overlay.end()) {
+      current = Database::Search(kernel_name, vendor.type, vendor.name, device_name,
+                                 target.precision, overlay_entries->second, false);
+    }
+    if (built_in == nullptr) {
+      built_in = Database::Search(kernel_name, vendor.type, vendor.name, device_name,
+                                  target.precision, Database::database);
+    }
+  }
+  if (built_in == nullptr) { throw RuntimeErrorCode(StatusCode::kInvalidOverrideKernel); }
+  if (current == nullptr) { current = built_in; }
+
+  // Fills the gaps and verifies that the parameters are complete
+  parameters.insert(current->parameters->begin(), current->parameters->end());
+  for (const auto &parameter : *built_in->parameters) {
+    if (parameters.find(parameter.first) == parameters.end()) {
+      throw RuntimeErrorCode(StatusCode::kMissingOverrideParameter);
+    }
+  }
+  const auto database_device = Database::DatabaseDevice{device_name, parameters};
+  const auto database_vendor = Database::DatabaseVendor{vendor.type, vendor.name,
+                                                        {database_device}};
+  return Database::DatabaseEntry{target.kernel, target.precision, {database_vendor}};
+}
+
+} // anonymous namespace
+// =================================================================================================
+
+// Lists the JSON files in a directory, or returns the path itself if it is not a directory
+std::vector<std::string> ListFiles(const std::string &path) {
+  auto files = std::vector<std::string>();
+  #if defined(_WIN32)
+    const auto attributes = GetFileAttributesA(path.c_str());
+    if (attributes == INVALID_FILE_ATTRIBUTES || !(attributes & FILE_ATTRIBUTE_DIRECTORY)) {
+      return {path};
+    }
+    auto find_data = WIN32_FIND_DATAA{};
+    const auto handle = FindFirstFileA((path + "\\*.json").c_str(), &find_data);
+    if (handle != INVALID_HANDLE_VALUE) {
+      do {
+        files.push_back(path + "\\" + find_data.cFileName);
+      } while (FindNextFileA(handle, &find_data));
+      FindClose(handle);
+    }
+  #else
+    const auto directory = opendir(path.c_str());
+    if (directory == nullptr) { return {path}; }
+    while (const auto entry = readdir(directory)) {
+      const auto name = std::string{entry->d_name};
+      if (name.size() > 5 && name.compare(name.size() - 5, 5, ".json") == 0) {
+        files.push_back(path + "/" + name);
+      }
+    }
+    closedir(directory);
+  #endif
+  std::sort(files.begin(), files.end());
+  return files;
+}
+
+// Reads all results and the meta-data of a tuner's JSON file
+std::vector<TuningResult> ReadTuningResultsFile(const std::string &filename, Metadata &metadata) {
+  std::ifstream file(filename);
+  if (!file) { throw RuntimeErrorCode(StatusCode::kInvalidTuningResults); }
+  std::stringstream contents;
+  contents << file.rdbuf();
+  const auto text = contents.str();
+  const auto json = JsonParser(text).Parse();
+  if (json.type != JsonValue::Type::kObject) {
+    throw RuntimeErrorCode(StatusCode::kInvalidTuningResults);
+  }
+
+  // The meta-data are all the string fields, e.g. 'kernel_family' or 'device'
+  using Type = JsonValue::Type;
+  metadata.clear();
+  for (auto i = size_t{0}; i < json.keys.size(); ++i) {
+    if (json.values[i].type == Type::kString) {
+      metadata.push_back({json.keys[i], json.values[i].string});
+    }
+  }
+
+  // Retrieves the results, including the 'PRECISION' parameter
+  auto results = std::vector<TuningResult>();
+  for (const auto &json_result : Field(json, "results", Type::kArray).values) {
+    auto result = TuningResult();
+    result.kernel = Field(json_result, "kernel", Type::kString).string;
+    result.time = Field(json_result, "time", Type::kNumber).number;
+    const auto &json_parameters = Field(json_result, "parameters", Type::kObject);
+    for (auto i = size_t{0}; i < json_parameters.keys.size(); ++i) {
+      const auto &value = json_parameters.values[i];
+      if (value.type != Type::kNumber || value.number < 0.0) {
+        throw RuntimeErrorCode(StatusCode::kInvalidTuningResults);
+      }
+      result.parameters[json_parameters.keys[i]] = static_cast<size_t>(value.number);
+    }
+    results.push_back(result);
+  }
+  return results;
+}
+
+// Writes the results in the same layout as the tuners do, with the parameters sorted by name
+void WriteTuningResultsFile(const std::string &filename, const Metadata &metadata,
+                            const std::vector<TuningResult> &results) {
+  std::ofstream file(filename);
+  if (!file) { throw RuntimeErrorCode(StatusCode::kInvalidTuningResults); }
+  file << "{\n";
+  for (const auto &item : metadata) {
+    file << "  \"" << item.first << "\": \"" << item.second << "\",\n";
+  }
+  file << "  \"results\": [\n";
+  for (auto r = size_t{0}; r < results.size(); ++r) {
+    auto names = std::vector<std::string>();
+    for (const auto &parameter : results[r].parameters) { names.push_back(parameter.first); }
+    std::sort(names.begin(), names.end());
+    char time[32];
+    snprintf(time, sizeof(time), "%.3lf", results[r].time);
+    file << "    {\n";
+    file << "      \"kernel\": \"" << results[r].kernel << "\",\n";
+    file << "      \"time\": " << time << ",\n";
+    file << "      \"parameters\": {";
+    for (auto i = size_t{0}; i < names.size(); ++i) {
+      file << "\"" << names[i] << "\": " << results[r].parameters.at(names[i]);
+      if (i + 1 < names.size()) { file << ","; }
+    }
+    file << "}\n";
+    file << "    }" << ((r + 1 < results.size()) ? ",\n" : "\n");
+  }
+  file << "  ]\n";
+  file << "}\n";
+}
+
+// Reads the files and merges the results without adding them to the overlay database
+std::vector<MergedTuningResult> MergeTuningResultsFiles(const std::vector<std::string> &filenames,
+                                                        std::vector<TuningResultsError> &errors) {
+  auto merged_results = std::vector<MergedTuningResult>();
+  for (const auto &target : ReadTargets(filenames, errors)) {
+    auto entry = Database::DatabaseEntry{};
+    try {
+      entry = MergeTuningResults(target, Overlay());
+    } catch (const RuntimeErrorCode &e) {
+      for (const auto &result : target) { SkipFile(errors, result.filename, e.status()); }
+      continue;
+    }
+    auto result = target.front().best;
+    result.parameters = *entry.vendors.front().devices.front().parameters;
+    result.parameters["PRECISION"] = static_cast<size_t>(entry.precision);
+    merged_results.push_back({entry.kernel, target.front().metadata, result});
+  }
+  return merged_results;
+}
+
+// Loads the files and merges the results into the overlay database
+std::vector<std::string> LoadTuningResultsOverlay(const std::string &path,
+                                                  std::vector<TuningResultsError> &errors) {
+
+  // Reads all files first, outside of the lock
+  const auto targets = ReadTargets(ListFiles(path), errors);
+
+  // Adds the results to the overlay, replacing earlier results for the same target
+  auto &state = State();
+  std::lock_guard<std::mutex> lock(state.mutex);
+  auto kernel_names = std::vector<std::string>();
+  for (const auto &target : targets) {
+    auto entry = Database::DatabaseEntry{};
+    try {
+      entry = MergeTuningResults(target, state.entries);
+    } catch (const RuntimeErrorCode &e) {
+      for (const auto &result : target) { SkipFile(errors, result.filename, e.status()); }
+      continue;
+    }
+    auto &kernel_entries = state.entries[entry.kernel];
+    const auto it = std::find_if(kernel_entries.begin(), kernel_entries.end(),
+                                 [&entry](const Database::DatabaseEntry &e) { return IsSameTarget(e, entry); });
+    if (it == kernel_entries.end()) { kernel_entries.push_back(entry); }
+    else { *it = entry; }
+    if (std::find(kernel_names.begin(), kernel_names.end(), entry.kernel) == kernel_names.end()) {
+      kernel_names.push_back(entry.kernel);
+    }
+  }
+  return kernel_names;
+}
+
+// Retrieves the overlay entries, loading the results from the environmental variable on first use
+std::vector<Database::DatabaseEntry> TuningResultsOverlay(const std::string &kernel_name) {
+  auto &state = State();
+  std::call_once(state.environment_flag, []() {
+    const auto path = ConvertArgument(std::getenv(kTuningResultsVariable.c_str()), std::string{""});
+    if (path.empty()) { return; }
+    auto errors = std::vector<TuningResultsError>(); // invalid results are simply not used
+    try { LoadTuningResultsOverlay(path, errors); } catch (...) { }
+  });
+  std::lock_guard<std::mutex> lock(state.mutex);
+  const auto it = state.entries.find(kernel_name);
+  if (it == state.entries.end()) { return {}; }
+  return it->second;
+}
+
+// =================================================================================================
+} // namespace clblast
@@ -0,0 +1,93 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the loading of tuning results at run-time. The JSON files as written by the
+// tuners (e.g. 'clblast_xgemm_1_32.json') are turned into an overlay database, indexed by kernel
+// name, which is searched before the built-in database. This serves the same purpose as running
+// the 'scripts/database/database.py' script, but without re-building the library.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_DATABASE_TUNING_RESULTS_H_
+#define CLBLAST_DATABASE_TUNING_RESULTS_H_
+
+#include <string>
+#include <vector>
+#include <utility>
+
+#include "utilities/utilities.hpp"
+#include "database/database.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// The environmental variable with a file or a directory of tuning results to load on first use
+const std::string kTuningResultsVariable = "CLBLAST_TUNING_RESULTS";
+
+// A file of tuning results which could not be loaded, and the reason
+using TuningResultsError = std::pair<std::string,StatusCode>;
+
+// Loads a tuner's JSON file, or all '*.json' files in a directory, and adds the best results to the
+// overlay database. The results of multiple files for the same kernel, precision and device are
+// merged, e.g. those of the 'xdot_1' and 'xdot_2' tuners which each tune their own parameters. The
+// parameters which are not tuned are taken from the current parameters of the device. Results for
+// the same target replace the ones loaded earlier. Files which cannot be read or are not valid are
+// skipped and added to 'errors'. Returns the names of the kernels for which results were loaded.
+std::vector<std::string> LoadTuningResultsOverlay(const std::string &path,
+                                                  std::vector<TuningResultsError> &errors);
+
+// The meta-data of a tuner's JSON file, e.g. {"kernel_family", "xgemm_1"}
+using Metadata = std::vector<std::pair<std::string,std::string>>;
+
+// A single result of a tuner's JSON file: the OpenCL kernel, its execution time in milliseconds and
+// the values of the parameters (including the 'PRECISION' parameter)
+struct TuningResult {
+  std::string kernel;
+  double time;
+  Database::Parameters parameters;
+};
+
+// Reads all results of a tuner's JSON file, as well as its meta-data (e.g. 'kernel_family' or
+// 'device') in the order of the file. Throws if the file cannot be read or is not valid.
+std::vector<TuningResult> ReadTuningResultsFile(const std::string &filename, Metadata &metadata);
+
+// Writes results and meta-data in the format of the tuners' JSON files, such that these can be
+// processed as any other tuning results
+void WriteTuningResultsFile(const std::string &filename, const Metadata &metadata,
+                            const std::vector<TuningResult> &results);
+
+// The merged results of the tuners' JSON files for a single kernel, precision and device: the name
+// of the kernel in the database, the meta-data of the file with the fastest result, and that result
+// with the merged and completed parameters (including the 'PRECISION' parameter)
+struct MergedTuningResult {
+  std::string kernel_name;
+  Metadata metadata;
+  TuningResult result;
+};
+
+// Reads tuners' JSON files and merges their results per kernel, precision and device in the same
+// way as 'LoadTuningResultsOverlay' above, but without adding them to the overlay database: the
+// parameters which are not tuned are taken from the built-in database. Files which cannot be read
+// or are not valid are skipped and added to 'errors'.
+std::vector<MergedTuningResult> MergeTuningResultsFiles(const std::vector<std::string> &filenames,
+                                                        std::vector<TuningResultsError> &errors);
+
+// Lists the JSON files in a directory (sorted by name), or returns the path itself if it is not a
+// directory
+std::vector<std::string> ListFiles(const std::string &path);
+
+// Retrieves the entries of the overlay database for a kernel. The first call also loads the
+// tuning results from the path in the environmental variable above (if set), ignoring errors.
+std::vector<Database::DatabaseEntry> TuningResultsOverlay(const std::string &kernel_name);
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_DATABASE_TUNING_RESULTS_H_
+#endif
@@ -0,0 +1,384 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the online tuning mode (see the header for more information).
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <memory>
+#include <chrono>
+#include <functional>
+#include <limits>
+#include <fstream>
+#include <sstream>
+#include <cstdlib>
+#include <algorithm>
+
+#include "online_tuning.hpp"
+#include "routines/level1/xaxpy.hpp"
+#include "routines/level1/xdot.hpp"
+#include "routines/level2/xgemv.hpp"
+#include "routines/level2/xger.hpp"
+#include "routines/level3/xgemm.hpp"
+
+namespace clblast {
+// =================================================================================================
+namespace {
+
+// The kernels which can be tuned online
+const std::vector<std::string> kOnlineTunableKernels = {"Xaxpy", "Xdot", "Xgemv", "XgemvFast",
+                                                        "Xger", "Xgemm", "XgemmDirect"};
+
+// Sizes of the synthetic problems: the generic GEMV kernel is benchmarked on a size which is not a
+// multiple of any work-group size, such that the routine doesn't select the fast kernel instead
+constexpr auto kVectorSize = size_t{4*1024*1024};
+constexpr auto kMatrixSize = size_t{2048};
+constexpr auto kMatrixSizeOdd = size_t{2047};
+constexpr auto kGemmSize = size_t{1024};
+constexpr auto kNumRuns = size_t{3};
+
+// The state of the online tuner: the path of the local database file (empty if disabled) and the
+// entries of the local database, both loaded on first use
+struct OnlineTuningState {
+  std::recursive_mutex mutex;
+  bool loaded = false;
+  std::string path;
+  std::vector<Database::DatabaseEntry> entries;
+};
+OnlineTuningState& State() {
+  static OnlineTuningState state;
+  return state;
+}
+
+// =================================================================================================
+
+// Loads the local database from disk (if the online tuning mode is enabled)
+void LoadLocalDatabase(OnlineTuningState &state) {
+  if (state.loaded) { return; }
+  state.loaded = true;
+  state.path = ConvertArgument(std::getenv(kOnlineTuningVariable.c_str()), std::string{""});
+  if (state.path.empty()) { return; }
+  state.entries = ReadLocalDatabase(state.path);
+}
+
+// =================================================================================================
+
+// Collects the candidate configurations: the current parameters followed by the unique parameters
+// of the kernel in the built-in database, first of the same vendor and device type, then of others
+std::vector<Database::Parameters> Candidates(const std::string &kernel_name,
+                                             const Precision precision,
+                                             const std::string &device_type,
+                                             const std::string &device_vendor,
+                                             const Database::Parameters &current) {
+  auto candidates = std::vector<Database::Parameters>{current};
+  for (auto same_vendor : {true, false}) {
+    for (const auto &entry : Database::database) {
+      if (entry.kernel != kernel_name) { continue; }
+      if (entry.precision != precision && entry.precision != Precision::kAny) { continue; }
+      for (const auto &vendor : entry.vendors) {
+        const auto is_same_vendor = (vendor.name == device_vendor && vendor.type == device_type);
+        if (is_same_vendor != same_vendor) { continue; }
+        for (const auto &device : vendor.devices) {
+          if (candidates.size() >= kOnlineTuningMaxCandidates) { return candidates; }
+          const auto found = std::find(candidates.begin(), candidates.end(), *device.parameters);
+          if (found == candidates.end()) {
+            candidates.push_back(*device.parameters);
+          }
+        }
+      }
+    }
+  }
+  return candidates;
+}
+
+// Runs a routine once as a warm-up and then times a couple of runs (in seconds)
+double TimeRuns(Queue &queue, const std::function<void()> &run) {
+  run();
+  queue.Finish();
+  const auto start_time = std::chrono::steady_clock::now();
+  for (auto r = size_t{0}; r < kNumRuns; ++r) { run(); }
+  queue.Finish();
+  const auto elapsed_time = std::chrono::steady_clock::now() - start_time;
+  return std::chrono::duration<double>(elapsed_time).count() / kNumRuns;
+}
+
+// Creates the routine for a candidate configuration of a kernel, which compiles its program, and
+// returns a function running it on the synthetic inputs. Throws in case the configuration is invalid
+// for this device.
+template <typename T>
+std::function<void()> PrepareRun(Queue &queue, const std::string &kernel_name,
+                                 const std::vector<Database::DatabaseEntry> &candidate,
+                                 const std::vector<Buffer<T>> &buffers) {
+  const auto alpha = ConstantOne<T>();
+  const auto beta = ConstantOne<T>();
+  if (kernel_name == "Xaxpy") {
+    const auto routine = std::make_shared<Xaxpy<T>>(queue, nullptr, "AXPY", candidate);
+    return [routine, alpha, &buffers]() {
+      routine->DoAxpy(kVectorSize, alpha, buffers[0], 0, 1, buffers[1], 0, 1);
+    };
+  }
+  if (kernel_name == "Xdot") {
+    const auto routine = std::make_shared<Xdot<T>>(queue, nullptr, "DOT", candidate);
+    return [routine, &buffers]() {
+      routine->DoDot(kVectorSize, buffers[2], 0, buffers[0], 0, 1, buffers[1], 0, 1);
+    };
+  }
+  if (kernel_name == "Xgemv" || kernel_name == "XgemvFast") {
+    const auto size = (kernel_name == "Xgemv") ? kMatrixSizeOdd : kMatrixSize;
+    const auto routine = std::make_shared<Xgemv<T>>(queue, nullptr, "GEMV", candidate);
+    return [routine, size, alpha, beta, &buffers]() {
+      routine->DoGemv(Layout::kColMajor, Transpose::kNo, size, size, alpha,
+                      buffers[2], 0, size, buffers[0], 0, 1, beta, buffers[1], 0, 1);
+    };
+  }
+  if (kernel_name == "Xger") {
+    const auto routine = std::make_shared<Xger<T>>(queue, nullptr, "GER", candidate);
+    return [routine, alpha, &buffers]() {
+      routine->DoGer(Layout::kColMajor, kMatrixSize, kMatrixSize, alpha,
+                     buffers[0], 0, 1, buffers[1], 0, 1, buffers[2], 0, kMatrixSize);
+    };
+  }
+  if (kernel_name == "Xgemm") {
+    const auto routine = std::make_shared<Xgemm<T>>(queue, nullptr, "GEMM",
+                                                    std::vector<std::string>{}, candidate);
+    return [routine, alpha, beta, &buffers]() {
+      routine->GemmIndirect(kGemmSize, kGemmSize, kGemmSize, alpha,
+                            buffers[0], 0, kGemmSize, buffers[1], 0, kGemmSize, beta,
+                            buffers[2], 0, kGemmSize, false, true, false, false, false,
+                            kGemmSize, kGemmSize, false, kGemmSize, kGemmSize, true,
+                            kGemmSize, kGemmSize, false, nullptr, {});
+    };
+  }
+  if (kernel_name == "XgemmDirect") {
+    const auto routine = std::make_shared<Xgemm<T>>(queue, nullptr, "GEMM",
+                                                    std::vector<std::string>{}, candidate);
+    return [routine, alpha, beta, &buffers]() {
+      routine->GemmDirect(kGemmSize, kGemmSize, kGemmSize, alpha,
+                          buffers[0], 0, kGemmSize, buffers[1], 0, kGemmSize, beta,
+                          buffers[2], 0, kGemmSize, false, true, false, false, false,
+                          nullptr, {});
+    };
+  }
+  throw RuntimeErrorCode(StatusCode::kInvalidOverrideKernel);
+}
+
+// Prepares a batch of candidates at once, such that their programs are compiled on multiple host
+// threads. The OpenCL compiler runs on the host, so this hides most of the compilation time on
+// systems with multiple cores. Invalid candidates result in an empty function.
+template <typename T>
+std::vector<std::function<void()>> PrepareRuns(Queue &queue, const std::string &kernel_name,
+                                               const std::vector<Database::Parameters> &candidates,
+                                               const std::vector<Buffer<T>> &buffers) {
+  auto runs = std::vector<std::function<void()>>(candidates.size());
+  auto PrepareCandidate = [&](const size_t c) {
+    const auto database_device = Database::DatabaseDevice{"default", candidates[c]};
+    const auto database_vendor = Database::DatabaseVendor{database::kDeviceTypeAll, "default",
+                                                          {database_device}};
+    const auto candidate = std::vector<Database::DatabaseEntry>{
+      Database::DatabaseEntry{kernel_name, PrecisionValue<T>(), {database_vendor}}
+    };
+    try {
+      runs[c] = PrepareRun<T>(queue, kernel_name, candidate, buffers);
+    } catch (...) { } // e.g. a configuration exceeding the limits of this device: skipped
+  };
+  auto threads = std::vector<std::thread>();
+  for (auto c = size_t{1}; c < candidates.size(); ++c) {
+    threads.push_back(std::thread(PrepareCandidate, c));
+  }
+  if (!candidates.empty()) { PrepareCandidate(0); }
+  for (auto &thread : threads) { thread.join(); }
+  return runs;
+}
+
+// Benchmarks the candidates until the time budget is spent, returning the index of the fastest one.
+// The candidates are compiled in batches of one per host thread, each batch being benchmarked
+// before the next one is compiled, such that the compilation time counts towards the budget too.
+template <typename T>
+size_t TuneKernel(const Context &context, const Device &device, const std::string &kernel_name,
+                  const std::vector<Database::Parameters> &candidates) {
+  auto queue = Queue(context, device);
+  const auto budget = OnlineTuningBudget();
+  const auto start_time = std::chrono::steady_clock::now();
+  auto IsBudgetSpent = [&start_time, budget]() -> bool {
+    const auto elapsed_time = std::chrono::steady_clock::now() - start_time;
+    return std::chrono::duration<double>(elapsed_time).count() > static_cast<double>(budget);
+  };
+
+  // Creates the synthetic inputs, large enough for all the problems above
+  const auto host_buffer = std::vector<T>(kVectorSize, ConstantZero<T>());
+  auto buffers = std::vector<Buffer<T>>();
+  for (auto i = 0; i < 3; ++i) {
+    buffers.push_back(Buffer<T>(context, queue, host_buffer.begin(), host_buffer.end()));
+  }
+
+  // Compiles and benchmarks the candidates batch by batch
+  const auto batch_size = std::max(size_t{1},
+                                   static_cast<size_t>(std::thread::hardware_concurrency()));
+  auto best_index = candidates.size();
+  auto best_time = std::numeric_limits<double>::max();
+  for (auto first = size_t{0}; first < candidates.size(); first += batch_size) {
+    const auto last = std::min(first + batch_size, candidates.size());
+    const auto batch = std::vector<Database::Parameters>(candidates.begin() + first,
+                                                         candidates.begin() + last);
+    const auto runs = PrepareRuns<T>(queue, kernel_name, batch, buffers);
+    for (auto c = size_t{0}; c < batch.size(); ++c) {
+      if (runs[c]) {
+        try {
+          const auto time = TimeRuns(queue, runs[c]);
+          if (time < best_time) {
+            best_time = time;
+            best_index = first + c;
+          }
+        } catch (...) { } // e.g. a configuration failing to launch on this device: skipped
+      }
+      if (IsBudgetSpent()) { return best_index; }
+    }
+  }
+  return best_index;
+}
+
+} // anonymous namespace
+// =================================================================================================
+
+// Parses a line of the local database file
+bool ParseLocalDatabaseEntry(const std::string &line, Database::DatabaseEntry &entry) {
+  auto fields = std::vector<std::string>();
+  auto field = std::string{};
+  std::istringstream line_stream(line);
+  while (std::getline(line_stream, field, '\t')) { fields.push_back(field); }
+  if (!line.empty() && line.back() == '\t') { fields.push_back(""); } // an empty last field
+  if (fields.size() != 6) { return false; }
+  try {
+    auto parameters = Database::Parameters();
+    auto parameter = std::string{};
+    std::istringstream parameter_stream(fields[5]);
+    while (parameter_stream >> parameter) {
+      const auto split = parameter.find('=');
+      if (split == std::string::npos) { return false; }
+      parameters[parameter.substr(0, split)] = std::stoul(parameter.substr(split + 1));
+    }
+    const auto precision = static_cast<Precision>(std::stoi(fields[1]));
+    const auto database_device = Database::DatabaseDevice{fields[4], parameters};
+    const auto database_vendor = Database::DatabaseVendor{fields[2], fields[3], {database_device}};
+    entry = Database::DatabaseEntry{fields[0], precision, {database_vendor}};
+  } catch (const std::exception &) {
+    return false;
+  }
+  return true;
+}
+
+// Formats a line of the local database file
+std::string FormatLocalDatabaseEntry(const Database::DatabaseEntry &entry) {
+  const auto &vendor = entry.vendors.front();
+  const auto &device = vendor.devices.front();
+  const auto parameters = std::map<std::string,size_t>(device.parameters->begin(),
+                                                        device.parameters->end());
+  auto line = std::ostringstream();
+  line << entry.kernel << "\t" << static_cast<int>(entry.precision) << "\t" << vendor.type << "\t"
+       << vendor.name << "\t" << device.name << "\t";
+  for (auto it = parameters.begin(); it != parameters.end(); ++it) {
+    line << ((it == parameters.begin()) ? "" : " ") << it->first << "=" << it->second;
+  }
+  return line.str();
+}
+
+// Reads a local database file
+std::vector<Database::DatabaseEntry> ReadLocalDatabase(const std::string &path) {
+  auto entries = std::vector<Database::DatabaseEntry>();
+  std::ifstream file(path);
+  auto line = std::string{};
+  while (std::getline(file, line)) {
+    auto entry = Database::DatabaseEntry{};
+    if (!line.empty() && line[0] != '#' && ParseLocalDatabaseEntry(line, entry)) {
+      entries.push_back(entry);
+    }
+  }
+  return entries;
+}
+
+// Appends to a local database file
+void AppendLocalDatabaseEntry(const std::string &path, const Database::DatabaseEntry &entry) {
+  std::ofstream file(path, std::ios::app);
+  file << FormatLocalDatabaseEntry(entry) << "\n";
+}
+
+// Retrieves the time budget, ignoring invalid values
+size_t OnlineTuningBudget() {
+  const auto value = std::getenv(kOnlineTuningBudgetVariable.c_str());
+  if (value == nullptr) { return kOnlineTuningDefaultBudget; }
+  try {
+    auto length = size_t{0};
+    const auto budget = std::stol(value, &length);
+    if (budget >= 0 && value[length] == '\0') { return static_cast<size_t>(budget); }
+  } catch (const std::exception &) { }
+  return kOnlineTuningDefaultBudget;
+}
+
+// Retrieves the (possibly empty) local database
+std::vector<Database::DatabaseEntry> OnlineTuningDatabase() {
+  auto &state = State();
+  std::lock_guard<std::recursive_mutex> lock(state.mutex);
+  LoadLocalDatabase(state);
+  return state.entries;
+}
+
+// Tunes a kernel and stores the result in the local database
+bool OnlineTune(const Context &context, const Device &device, const std::string &kernel_name,
+                const Precision precision) {
+  auto &state = State();
+  std::lock_guard<std::recursive_mutex> lock(state.mutex);
+  LoadLocalDatabase(state);
+  if (state.path.empty()) { return false; }
+  const auto &kernels = kOnlineTunableKernels;
+  if (std::find(kernels.begin(), kernels.end(), kernel_name) == kernels.end()) { return false; }
+
+  // Tunes only once: another thread might have tuned this kernel already
+  const auto current = Database(device, kernel_name, precision, state.entries);
+  if (current.IsDeviceSpecific()) { return true; }
+
+  // Collects the candidates, starting with the current parameters
+  const auto device_type = device.Type();
+  const auto device_vendor = Database::ShortVendorName(device.Vendor());
+  auto current_parameters = Database::Parameters();
+  for (const auto &name : current.GetParameterNames()) { current_parameters[name] = current[name]; }
+  const auto candidates = Candidates(kernel_name, precision, device_type, device_vendor,
+                                     current_parameters);
+
+  // Runs the benchmarks
+  auto best_index = candidates.size();
+  try {
+    switch (precision) {
+      case Precision::kHalf: best_index = TuneKernel<half>(context, device, kernel_name, candidates); break;
+      case Precision::kSingle: best_index = TuneKernel<float>(context, device, kernel_name, candidates); break;
+      case Precision::kDouble: best_index = TuneKernel<double>(context, device, kernel_name, candidates); break;
+      case Precision::kComplexSingle: best_index = TuneKernel<float2>(context, device, kernel_name, candidates); break;
+      case Precision::kComplexDouble: best_index = TuneKernel<double2>(context, device, kernel_name, candidates); break;
+      default: return false;
+    }
+  } catch (...) { return false; } // e.g. not enough device memory for the synthetic inputs
+  if (best_index >= candidates.size()) { return false; }
+
+  // Stores the winner for this exact device, also when the current parameters are the fastest, such
+  // that the kernel is not tuned again
+  const auto database_device = Database::DatabaseDevice{device.Name(), candidates[best_index]};
+  const auto database_vendor = Database::DatabaseVendor{device_type, device_vendor,
+                                                        {database_device}};
+  const auto entry = Database::DatabaseEntry{kernel_name, precision, {database_vendor}};
+  state.entries.push_back(entry);
+  AppendLocalDatabaseEntry(state.path, entry);
+  return true;
+}
+
+// =================================================================================================
+} // namespace clblast
@@ -0,0 +1,75 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the opt-in online tuning mode. It is enabled by setting the environmental
+// variable CLBLAST_ONLINE_TUNING to the path of a local database file. On first use of a kernel on
+// a device without tuned parameters, a small set of candidate configurations is benchmarked with
+// synthetic inputs within a time budget. The winner is stored in the local database file, which is
+// overlaid on the built-in database from then on, also in later runs of the application.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_ONLINE_TUNING_H_
+#define CLBLAST_ONLINE_TUNING_H_
+
+#include <string>
+#include <vector>
+
+#include "utilities/utilities.hpp"
+#include "database/database.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// The environmental variables enabling the online tuning mode (set to the path of the local
+// database file) and optionally setting its time budget per kernel (in seconds)
+const std::string kOnlineTuningVariable = "CLBLAST_ONLINE_TUNING";
+const std::string kOnlineTuningBudgetVariable = "CLBLAST_ONLINE_TUNING_BUDGET";
+
+// The default time budget per kernel (in seconds) and the maximum number of candidates to try
+constexpr auto kOnlineTuningDefaultBudget = size_t{10};
+constexpr auto kOnlineTuningMaxCandidates = size_t{16};
+
+// Retrieves the entries of the local database of the online tuner, loading these from disk on
+// first use. This is an empty database if the online tuning mode is disabled.
+std::vector<Database::DatabaseEntry> OnlineTuningDatabase();
+
+// Parses a single line of the local database file into an entry with a single device: tab-separated
+// kernel name, precision, device type, vendor and device name, followed by space-separated
+// parameters in the form 'NAME=value'. Returns false for a malformed line.
+bool ParseLocalDatabaseEntry(const std::string &line, Database::DatabaseEntry &entry);
+
+// Formats an entry with a single device as a line of the local database file (without newline),
+// with the parameters sorted by name. This is the inverse of the above function.
+std::string FormatLocalDatabaseEntry(const Database::DatabaseEntry &entry);
+
+// Reads the entries of a local database file, skipping empty lines, comments and malformed lines.
+// A missing file results in an empty database.
+std::vector<Database::DatabaseEntry> ReadLocalDatabase(const std::string &path);
+
+// Appends an entry with a single device to a local database file
+void AppendLocalDatabaseEntry(const std::string &path, const Database::DatabaseEntry &entry);
+
+// Retrieves the time budget per kernel (in seconds) from its environmental variable, falling back
+// to the default if it is not set or not a non-negative number
+size_t OnlineTuningBudget();
+
+// Tunes a kernel for a device without tuned parameters, if the online tuning mode is enabled and
+// the kernel can be tuned online. The candidates are the current parameters followed by those of
+// other devices in the built-in database, preferably of the same vendor and device type. These are
+// benchmarked on a separate queue until the time budget is spent, after which the best one is added
+// to the local database, both in memory and on disk. Returns whether the local database changed.
+bool OnlineTune(const Context &context, const Device &device, const std::string &kernel_name,
+                const Precision precision);
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_ONLINE_TUNING_H_
+#endif
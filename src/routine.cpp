@@ -17,24 +17,38 @@
 #include <cstdlib>
 
 #include "routine.hpp"
+#include "online_tuning.hpp"
+#include "compilation_cache.hpp"
+#include "database/tuning_results.hpp"
 
 namespace clblast {
 // =================================================================================================
 
 // For each kernel this map contains a list of routines it is used in
-const std::vector<std::string> Routine::routines_axpy = {"AXPY", "COPY", "SCAL", "SWAP"};
-const std::vector<std::string> Routine::routines_dot = {"AMAX", "ASUM", "DOT", "DOTC", "DOTU", "MAX", "MIN", "NRM2", "SUM"};
-const std::vector<std::string> Routine::routines_ger = {"GER", "GERC", "GERU", "HER", "HER2", "HPR", "HPR2", "SPR", "SPR2", "SYR", "SYR2"};
-const std::vector<std::string> Routine::routines_gemv = {"GBMV", "GEMV", "HBMV", "HEMV", "HPMV", "SBMV", "SPMV", "SYMV", "TMBV", "TPMV", "TRMV", "TRSV"};
+const std::vector<std::string> Routine::routines_axpy = {"AXPBY", "AXPY", "COPY", "SCAL", "SWAP", "WAXPBY"};
+const std::vector<std::string> Routine::routines_dot = {"AMAX", "ASUM", "AXPYDOT", "AXPYNRM2", "DOT", "DOT2", "DOTC", "DOTU", "FUSED", "MAX", "MIN", "NRM2", "SUM"};
+const std::vector<std::string> Routine::routines_rot = {"ROT", "ROTG", "ROTM", "ROTMG"};
+const std::vector<std::string> Routine::routines_ger = {"GER", "GERC", "GERK", "GERU", "HER", "HER2", "HPR", "HPR2", "SPR", "SPR2", "SYR", "SYR2"};
+const std::vector<std::string> Routine::routines_gemv = {"GBMV", "GEMV", "HBMV", "HEMV", "HPMV", "SBMV", "SPMV", "SYMV", "TBSV", "TMBV", "TPMV", "TPSV", "TRMV", "TRSV"};
 const std::vector<std::string> Routine::routines_gemm = {"GEMM", "HEMM", "SYMM", "TRMM"};
 const std::vector<std::string> Routine::routines_gemm_syrk = {"GEMM", "HEMM", "HER2K", "HERK", "SYMM", "SYR2K", "SYRK", "TRMM", "TRSM"};
 const std::vector<std::string> Routine::routines_trsm = {"TRSM"};
+const std::vector<std::string> Routine::routines_invert = {"INVERT"};
+const std::vector<std::string> Routine::routines_fill = {"GBMV", "GEMV", "HBMV", "HEMV", "HPMV", "INVERT", "SBMV", "SPMV", "SYMV", "TBMV", "TBSV", "TPMV", "TPSV", "TRMV", "TRSV"};
+const std::vector<std::string> Routine::routines_dot_batched = {"DOTBATCHED", "NRM2BATCHED"};
+const std::vector<std::string> Routine::routines_gemv_batched = {"GEMVBATCHED"};
+const std::vector<std::string> Routine::routines_kernel_selection = {"AMAX", "ASUM", "DOT", "DOTC", "DOTU", "GEMM", "HEMM", "MAX", "MIN", "NRM2", "SUM", "SYMM", "TRMM", "TRSM"};
 const std::unordered_map<std::string, const std::vector<std::string>> Routine::routines_by_kernel = {
   {"Xaxpy", routines_axpy},
   {"Xdot", routines_dot},
+  {"XdotBatched", routines_dot_batched},
+  {"Xrot", routines_rot},
   {"Xgemv", routines_gemv},
   {"XgemvFast", routines_gemv},
   {"XgemvFastRot", routines_gemv},
+  {"XgemvBatched", routines_gemv_batched},
+  {"XgemvBanded", routines_gemv},
+  {"XgemvTiled", routines_gemv},
   {"Xtrsv", routines_gemv},
   {"Xger", routines_ger},
   {"Copy", routines_gemm_syrk},
@@ -43,31 +57,150 @@ const std::unordered_map<std::string, const std::vector<std::string>> Routine::r
   {"Padtranspose", routines_gemm_syrk},
   {"Xgemm", routines_gemm_syrk},
   {"XgemmDirect", routines_gemm},
-  {"KernelSelection", routines_gemm},
-  {"Invert", routines_trsm},
+  {"XgemmSkinny", routines_gemm},
+  {"KernelSelection", routines_kernel_selection},
+  {"Invert", routines_invert},
+  {"Xtrsm", routines_trsm},
+  {"Fill", routines_fill},
 };
 // =================================================================================================
 
-// The constructor does all heavy work, errors are returned as exceptions
+// Returns whether a program belongs to a routine (see the header)
+bool Routine::IsProgramOfRoutine(const std::string &program_name, const std::string &routine_name) {
+  if (program_name == routine_name) { return true; }
+  return program_name.size() > routine_name.size() &&
+         program_name.compare(0, routine_name.size(), routine_name) == 0 &&
+         program_name[routine_name.size()] == '_';
+}
+
+// =================================================================================================
+
+// The constructors forward to the common constructor with either the static or the generated source
 Routine::Routine(Queue &queue, EventPointer event, const std::string &name,
                  const std::vector<std::string> &kernel_names, const Precision precision,
                  const std::vector<Database::DatabaseEntry> &userDatabase,
-                 std::initializer_list<const char *> source):
+                 std::initializer_list<const char *> source,
+                 const bool defer_program):
+    Routine(queue, event, name, kernel_names, precision, userDatabase, source, nullptr,
+            defer_program) {
+}
+
+Routine::Routine(Queue &queue, EventPointer event, const std::string &name,
+                 const std::vector<std::string> &kernel_names, const Precision precision,
+                 const std::vector<Database::DatabaseEntry> &userDatabase,
+                 const std::function<std::string()> &source_generator):
+    Routine(queue, event, name, kernel_names, precision, userDatabase, {}, source_generator,
+            false) {
+}
+
+// The common constructor does all heavy work, errors are returned as exceptions
+Routine::Routine(Queue &queue, EventPointer event, const std::string &name,
+                 const std::vector<std::string> &kernel_names, const Precision precision,
+                 const std::vector<Database::DatabaseEntry> &userDatabase,
+                 std::initializer_list<const char *> source,
+                 const std::function<std::string()> &source_generator,
+                 const bool defer_program):
     precision_(precision),
     routine_name_(name),
     kernel_names_(kernel_names),
+    source_(source),
+    source_generator_(source_generator),
+    user_database_(userDatabase),
     queue_(queue),
     event_(event),
     context_(queue_.GetContext()),
     device_(queue_.GetDevice()),
     device_name_(device_.Name()),
-    db_(kernel_names) {
+    db_(kernel_names),
+    program_deferred_(defer_program && userDatabase.empty()) {
 
   InitDatabase(userDatabase);
-  InitProgram(source);
+  if (!program_deferred_) { InitProgram(routine_name_); }
+  InitAuxiliaryQueues();
+}
+
+void Routine::InitAuxiliaryQueues() {
+
+  // Out-of-order queues can already run independent steps concurrently
+  auto has_auxiliary_queues = false;
+  auxiliary_queues_ = AuxiliaryQueueCache::Instance().Get(queue_(), &has_auxiliary_queues);
+  if (has_auxiliary_queues && queue_.IsOutOfOrder()) {
+    auxiliary_queues_.clear();
+  }
+}
+
+Queue& Routine::IndependentQueue(const size_t index) {
+  if (index == 0 || auxiliary_queues_.empty()) { return queue_; }
+  return auxiliary_queues_[(index - 1) % auxiliary_queues_.size()];
+}
+
+std::vector<Event> Routine::IndependentWaitList(const size_t index,
+                                                const std::vector<Event> &waitForEvents) {
+  auto wait_list = waitForEvents;
+  if (index == 0 || auxiliary_queues_.empty()) { return wait_list; }
+  if (main_queue_marker_() == nullptr) {
+    queue_.EnqueueMarker(main_queue_marker_.pointer());
+  }
+  wait_list.push_back(main_queue_marker_);
+  return wait_list;
+}
+
+std::vector<Buffer<unsigned int>> Routine::ReductionScratch(const size_t num_partials) {
+  const auto partials_size = num_partials * (sizeof(double2) / sizeof(unsigned int));
+
+  // Re-uses the existing buffers for this queue if these are large enough, otherwise allocates new
+  // buffers, initializing the counter to zero
+  return ScratchCache::Instance().GetOrCreate(
+    ScratchKey{queue_(), context_(), "reduction"},
+    [partials_size](const std::vector<Buffer<unsigned int>> &scratch) -> bool {
+      return scratch[1].GetSize() >= partials_size * sizeof(unsigned int);
+    },
+    [this, partials_size, num_partials]() -> std::vector<Buffer<unsigned int>> {
+      const auto zero = std::vector<unsigned int>{0};
+      return std::vector<Buffer<unsigned int>>{
+        Buffer<unsigned int>(context_, queue_, zero.begin(), zero.end()),
+        Buffer<unsigned int>(context_, partials_size),
+        Buffer<unsigned int>(context_, num_partials)
+      };
+    });
+}
+
+Buffer<unsigned int> Routine::ScratchBuffer(const std::string &kind, const size_t size) {
+  const auto buffer_size = CeilDiv(size, sizeof(unsigned int));
+  return ScratchCache::Instance().GetOrCreate(
+    ScratchKey{queue_(), context_(), kind},
+    [buffer_size](const std::vector<Buffer<unsigned int>> &scratch) -> bool {
+      return scratch[0].GetSize() >= buffer_size * sizeof(unsigned int);
+    },
+    [this, buffer_size]() -> std::vector<Buffer<unsigned int>> {
+      return std::vector<Buffer<unsigned int>>{Buffer<unsigned int>(context_, buffer_size)};
+    })[0];
+}
+
+namespace {
+
+// Combines the overlays of the built-in database for a kernel: the tuning results loaded at run-time
+// take precedence over the results of the online tuner
+std::vector<Database::DatabaseEntry> DatabaseOverlay(const std::string &kernel_name) {
+  auto overlay = TuningResultsOverlay(kernel_name);
+  const auto online_tuning_database = OnlineTuningDatabase();
+  overlay.insert(overlay.end(), online_tuning_database.begin(), online_tuning_database.end());
+  return overlay;
 }
 
+} // anonymous namespace
+
 void Routine::InitDatabase(const std::vector<Database::DatabaseEntry> &userDatabase) {
+
+  // A user-provided database (e.g. a candidate configuration of the online tuner) is used as-is,
+  // bypassing the cache
+  if (!userDatabase.empty()) {
+    for (const auto &kernel_name : kernel_names_) {
+      db_(kernel_name) = Database(device_, kernel_name, precision_, userDatabase);
+    }
+    return;
+  }
+
   for (const auto &kernel_name : kernel_names_) {
 
     // Queries the cache to see whether or not the kernel parameter database is already there
@@ -76,19 +209,87 @@ void Routine::InitDatabase(const std::vector<Database::DatabaseEntry> &userDatab
                                                      &has_db);
     if (has_db) { continue; }
 
-    // Builds the parameter database for this device and routine set and stores it in the cache
-    db_(kernel_name) = Database(device_, kernel_name, precision_, userDatabase);
+    // Builds the parameter database for this device and routine set, overlaid with the loaded
+    // tuning results and the local database of the online tuner (if enabled). If there are no
+    // parameters tuned for this device, the online tuner (if enabled) tries to find these first.
+    auto database = Database(device_, kernel_name, precision_, DatabaseOverlay(kernel_name));
+    if (!database.IsDeviceSpecific() && OnlineTune(context_, device_, kernel_name, precision_)) {
+      database = Database(device_, kernel_name, precision_, DatabaseOverlay(kernel_name));
+    }
+
+    // Prints the origin of the parameters in case of debugging in verbose mode
+    #ifdef VERBOSE
+      printf("[DEBUG] Using the parameters of %s for kernel '%s'\n",
+             database.GetDatabaseEntry().c_str(), kernel_name.c_str());
+    #endif
+
+    // Stores the parameter database in the cache
+    db_(kernel_name) = database;
     DatabaseCache::Instance().Store(DatabaseKey{ precision_, device_name_, kernel_name },
                                     Database{ db_(kernel_name) });
   }
 }
 
-void Routine::InitProgram(std::initializer_list<const char *> source) {
+void Routine::SelectShapeBucket(const std::vector<std::string> &kernel_names,
+                                const size_t m, const size_t n, const size_t k) {
+  // Parameters from a user-provided database are used as given for all shapes
+  if (!user_database_.empty()) { return; }
+  const auto shape_bucket = Database::ShapeBucket(m, n, k);
+  if (shape_bucket == shape_bucket_ && !program_deferred_) { return; }
+
+  // Retrieves the shape-specific parameters of each kernel, if any. The database cache also stores
+  // the absence of these (as the regular parameters without a shape bucket).
+  auto databases = std::vector<Database>();
+  auto found_shape_bucket = false;
+  if (!shape_bucket.empty()) {
+    for (const auto &kernel_name : kernel_names) {
+      const auto bucket_kernel_name = Database::ShapeBucketKernelName(kernel_name, shape_bucket);
+      bool has_db;
+      auto db = DatabaseCache::Instance().Get(DatabaseKeyRef{ precision_, device_name_, bucket_kernel_name },
+                                              &has_db);
+      if (!has_db) {
+        auto overlay = TuningResultsOverlay(bucket_kernel_name);
+        const auto kernel_overlay = DatabaseOverlay(kernel_name);
+        overlay.insert(overlay.end(), kernel_overlay.begin(), kernel_overlay.end());
+        db = Database(device_, kernel_name, precision_, overlay, shape_bucket);
+        DatabaseCache::Instance().Store(DatabaseKey{ precision_, device_name_, bucket_kernel_name },
+                                        Database{ db });
+      }
+      if (!db.GetShapeBucket().empty()) { found_shape_bucket = true; }
+      databases.push_back(db);
+    }
+  }
+
+  // A shape class without any specific parameters is treated as a regular shape. A deferred program
+  // is compiled now, only for the shape class in use.
+  const auto new_shape_bucket = (found_shape_bucket) ? shape_bucket : std::string{};
+  if (new_shape_bucket == shape_bucket_ && !program_deferred_) { return; }
+  shape_bucket_ = new_shape_bucket;
+  program_deferred_ = false;
+
+  // Restores the regular parameters and program, or overrides these with the shape-specific ones
+  InitDatabase(user_database_);
+  if (shape_bucket_.empty()) {
+    InitProgram(routine_name_);
+    return;
+  }
+  for (auto i = size_t{0}; i < kernel_names.size(); ++i) {
+    if (!databases[i].GetShapeBucket().empty()) { db_(kernel_names[i]) = databases[i]; }
+  }
+  InitProgram(routine_name_ + "_" + shape_bucket_);
+}
+
+void Routine::InitProgram(const std::string &program_name) {
+
+  // Programs compiled with a user-provided database bypass the program and binary caches
+  const auto use_cache = user_database_.empty();
 
   // Queries the cache to see whether or not the program (context-specific) is already there
-  bool has_program;
-  program_ = ProgramCache::Instance().Get(ProgramKeyRef{ context_(), device_(), precision_, routine_name_ },
-                                          &has_program);
+  bool has_program = false;
+  if (use_cache) {
+    program_ = ProgramCache::Instance().Get(ProgramKeyRef{ context_(), device_(), precision_, program_name },
+                                            &has_program);
+  }
   if (has_program) { return; }
 
   // Sets the build options from an environmental variable (if set)
@@ -100,13 +301,16 @@ void Routine::InitProgram(std::initializer_list<const char *> source) {
 
   // Queries the cache to see whether or not the binary (device-specific) is already there. If it
   // is, a program is created and stored in the cache
-  bool has_binary;
-  auto binary = BinaryCache::Instance().Get(BinaryKeyRef{ precision_, routine_name_, device_name_ },
-                                            &has_binary);
+  bool has_binary = false;
+  auto binary = std::string{};
+  if (use_cache) {
+    binary = BinaryCache::Instance().Get(BinaryKeyRef{ precision_, program_name, device_name_ },
+                                         &has_binary);
+  }
   if (has_binary) {
     program_ = Program(device_, context_, binary);
     program_.Build(device_, options);
-    ProgramCache::Instance().Store(ProgramKey{ context_(), device_(), precision_, routine_name_ },
+    ProgramCache::Instance().Store(ProgramKey{ context_(), device_(), precision_, program_name },
                                    Program{ program_ });
     return;
   }
@@ -158,35 +362,59 @@ void Routine::InitProgram(std::initializer_list<const char *> source) {
   ;
 
   // Adds routine-specific code to the constructed source string
-  for (const char *s: source) {
+  for (const char *s: source_) {
     source_string += s;
   }
+  if (source_generator_) {
+    source_string += source_generator_();
+  }
 
   // Prints details of the routine to compile in case of debugging in verbose mode
   #ifdef VERBOSE
     printf("[DEBUG] Compiling routine '%s-%s' for device '%s'\n",
-           routine_name_.c_str(), ToString(precision_).c_str(), device_name_.c_str());
+           program_name.c_str(), ToString(precision_).c_str(), device_name_.c_str());
     const auto start_time = std::chrono::steady_clock::now();
   #endif
 
+  // Queries the on-disk compilation cache (if enabled) for a binary of exactly this source code and
+  // these options. This also holds for programs with a user-provided database. A binary which can't
+  // be loaded (e.g. after a driver update with an unchanged version string) is ignored.
+  const auto cache_file = CompilationCacheFile(device_, source_string, options);
+  auto cache_binary = std::string{};
+  auto has_cache_binary = LoadCompiledBinary(cache_file, cache_binary);
+  if (has_cache_binary) {
+    try {
+      auto binary_options = options;
+      program_ = Program(device_, context_, cache_binary);
+      program_.Build(device_, binary_options);
+    } catch (const CLError &) {
+      has_cache_binary = false;
+    }
+  }
+
   // Compiles the kernel
-  program_ = Program(context_, source_string);
-  try {
-    program_.Build(device_, options);
-  } catch (const CLError &e) {
-    if (e.status() == CL_BUILD_PROGRAM_FAILURE) {
-      fprintf(stdout, "OpenCL compiler error/warning: %s\n",
-              program_.GetBuildInfo(device_).c_str());
+  if (!has_cache_binary) {
+    program_ = Program(context_, source_string);
+    try {
+      program_.Build(device_, options);
+    } catch (const CLError &e) {
+      if (e.status() == CL_BUILD_PROGRAM_FAILURE) {
+        fprintf(stdout, "OpenCL compiler error/warning: %s\n",
+                program_.GetBuildInfo(device_).c_str());
+      }
+      throw;
     }
-    throw;
+    if (!cache_file.empty()) { StoreCompiledBinary(cache_file, program_.GetIR()); }
   }
 
   // Store the compiled binary and program in the cache
-  BinaryCache::Instance().Store(BinaryKey{ precision_, routine_name_, device_name_ },
-                                program_.GetIR());
+  if (use_cache) {
+    BinaryCache::Instance().Store(BinaryKey{ precision_, program_name, device_name_ },
+                                  program_.GetIR());
 
-  ProgramCache::Instance().Store(ProgramKey{ context_(), device_(), precision_, routine_name_ },
-                                 Program{ program_ });
+    ProgramCache::Instance().Store(ProgramKey{ context_(), device_(), precision_, program_name },
+                                   Program{ program_ });
+  }
 
   // Prints the elapsed compilation time in case of debugging in verbose mode
   #ifdef VERBOSE
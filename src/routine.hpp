@@ -19,6 +19,7 @@
 #include <string>
 #include <vector>
 #include <unordered_map>
+#include <functional>
 
 #include "utilities/utilities.hpp"
 #include "cache.hpp"
@@ -34,33 +35,65 @@ class Routine {
  public:
 
   // Base class constructor. The user database is an optional extra database to override the
-  // built-in database.
-  // All heavy preparation work is done inside this constructor.
-  // NOTE: the caller must provide the same userDatabase for each combination of device, precision
-  // and routine list, otherwise the caching logic will break.
+  // built-in database. A non-empty user database bypasses the database, program and binary caches,
+  // such that e.g. candidate configurations of the online tuner do not affect other routines.
+  // All heavy preparation work is done inside this constructor. If 'defer_program' is set (and there
+  // is no user database), compilation of the program is left to the first call of
+  // 'SelectShapeBucket', such that the program is only compiled for the shape class in use.
   explicit Routine(Queue &queue, EventPointer event, const std::string &name,
                    const std::vector<std::string> &routines, const Precision precision,
                    const std::vector<Database::DatabaseEntry> &userDatabase,
-                   std::initializer_list<const char *> source);
+                   std::initializer_list<const char *> source,
+                   const bool defer_program = false);
+
+  // As above, but with kernel source code that is generated by the given function. This function is
+  // only called when the program has to be compiled, i.e. not when it is found in the cache.
+  explicit Routine(Queue &queue, EventPointer event, const std::string &name,
+                   const std::vector<std::string> &routines, const Precision precision,
+                   const std::vector<Database::DatabaseEntry> &userDatabase,
+                   const std::function<std::string()> &source_generator);
 
   // List of kernel-routine look-ups
   static const std::vector<std::string> routines_axpy;
   static const std::vector<std::string> routines_dot;
+  static const std::vector<std::string> routines_rot;
   static const std::vector<std::string> routines_ger;
   static const std::vector<std::string> routines_gemv;
   static const std::vector<std::string> routines_gemm;
   static const std::vector<std::string> routines_gemm_syrk;
   static const std::vector<std::string> routines_trsm;
+  static const std::vector<std::string> routines_invert;
+  static const std::vector<std::string> routines_fill;
+  static const std::vector<std::string> routines_dot_batched;
+  static const std::vector<std::string> routines_gemv_batched;
+  static const std::vector<std::string> routines_kernel_selection;
   static const std::unordered_map<std::string, const std::vector<std::string>> routines_by_kernel;
 
+  // Returns whether a program belongs to a routine: either the program has the routine's name, or
+  // it is a variant of the routine named '<routine>_<variant>' (e.g. a shape class or a chain of
+  // fused steps)
+  static bool IsProgramOfRoutine(const std::string &program_name, const std::string &routine_name);
+
  private:
 
-  // Initializes program_, fetching cached program or building one
-  void InitProgram(std::initializer_list<const char *> source);
+  // The common constructor of the two public ones above
+  Routine(Queue &queue, EventPointer event, const std::string &name,
+          const std::vector<std::string> &routines, const Precision precision,
+          const std::vector<Database::DatabaseEntry> &userDatabase,
+          std::initializer_list<const char *> source,
+          const std::function<std::string()> &source_generator,
+          const bool defer_program);
+
+  // Initializes program_, fetching cached program or building one. The program is cached under the
+  // given name, which is the routine's name unless compiled with shape-specific parameters.
+  void InitProgram(const std::string &program_name);
 
   // Initializes db_, fetching cached database or building one
   void InitDatabase(const std::vector<Database::DatabaseEntry> &userDatabase);
 
+  // Initializes auxiliary_queues_, fetching the queues registered for the main queue (if any)
+  void InitAuxiliaryQueues();
+
  protected:
 
   // Non-static variable for the precision
@@ -70,6 +103,12 @@ class Routine {
   const std::string routine_name_;
   const std::vector<std::string> kernel_names_;
 
+  // The routine's kernel source code (static or generated) and the user-provided database, kept
+  // for re-compilation with shape-specific parameters (see 'SelectShapeBucket' below)
+  const std::vector<const char *> source_;
+  const std::function<std::string()> source_generator_;
+  const std::vector<Database::DatabaseEntry> user_database_;
+
   // The OpenCL objects, accessible only from derived classes
   Queue queue_;
   EventPointer event_;
@@ -84,6 +123,46 @@ class Routine {
 
   // Connection to the database for all the device-specific parameters
   Databases db_;
+
+  // Returns the queue for the 'index'-th out of a set of mutually independent steps (e.g. the
+  // pre-processing of the different input matrices), such that these can run concurrently. This is
+  // the main queue for index 0 or if there are no auxiliary queues, e.g. because the main queue
+  // is already out-of-order.
+  Queue& IndependentQueue(const size_t index);
+
+  // The events that the 'index'-th independent step has to wait for: the given events and, on an
+  // auxiliary queue, a marker on the main queue such that the step is ordered after earlier work.
+  std::vector<Event> IndependentWaitList(const size_t index,
+                                         const std::vector<Event> &waitForEvents = {});
+
+  // Switches the parameters of the given kernels to those tuned for the shape class of an m-by-n-by-k
+  // problem (see 'Database::ShapeBucket'), if the database has these for this device. In that case
+  // the program is re-compiled (or retrieved from the cache) under a per-shape-class name. Has to be
+  // called before any of the routine's kernels are retrieved from the program. This also compiles
+  // the program if the constructor deferred that.
+  void SelectShapeBucket(const std::vector<std::string> &kernel_names,
+                         const size_t m, const size_t n, const size_t k);
+
+  // Retrieves the persistent scratch buffers of the single-pass reduction kernels for this queue:
+  // a work-group counter (zero when not in use), room for 'num_partials' partial results of any
+  // precision, and room for as many partial indices. These are allocated on first use only.
+  std::vector<Buffer<unsigned int>> ReductionScratch(const size_t num_partials);
+
+  // Retrieves a persistent scratch buffer of at least 'size' bytes for this queue, shared by all
+  // kernels of the given kind. The queue has to be in-order.
+  Buffer<unsigned int> ScratchBuffer(const std::string &kind, const size_t size);
+
+ private:
+
+  // Auxiliary queues for independent steps and the marker on the main queue they wait for
+  std::vector<Queue> auxiliary_queues_;
+  Event main_queue_marker_;
+
+  // The shape class of the currently selected parameters and program (empty for the regular ones)
+  std::string shape_bucket_;
+
+  // Whether the program still has to be compiled by 'SelectShapeBucket' (see the constructor)
+  bool program_deferred_;
 };
 
 // =================================================================================================
@@ -36,7 +36,7 @@ void RunKernel(Kernel &kernel, Queue &queue, const Device &device,
 // Sets all elements of a matrix to a constant value
 template <typename T>
 void FillMatrix(Queue &queue, const Device &device,
-                const Program &program, const Databases &,
+                const Program &program, const Databases &db,
                 EventPointer event, const std::vector<Event> &waitForEvents,
                 const size_t m, const size_t n, const size_t ld, const size_t offset,
                 const Buffer<T> &dest,
@@ -48,15 +48,15 @@ void FillMatrix(Queue &queue, const Device &device,
   kernel.SetArgument(3, static_cast<int>(offset));
   kernel.SetArgument(4, dest());
   kernel.SetArgument(5, GetRealArg(constant_value));
-  auto local = std::vector<size_t>{8, 8};
-  auto global = std::vector<size_t>{Ceil(m, 8), Ceil(n, 8)};
+  auto local = std::vector<size_t>{db["FILL_DIMX"], db["FILL_DIMY"]};
+  auto global = std::vector<size_t>{Ceil(m, db["FILL_DIMX"]), Ceil(n, db["FILL_DIMY"])};
   RunKernel(kernel, queue, device, global, local, event, waitForEvents);
 }
 
 // Sets all elements of a vector to a constant value
 template <typename T>
 void FillVector(Queue &queue, const Device &device,
-                const Program &program, const Databases &,
+                const Program &program, const Databases &db,
                 EventPointer event, const std::vector<Event> &waitForEvents,
                 const size_t n, const size_t inc, const size_t offset,
                 const Buffer<T> &dest,
@@ -67,6 +67,27 @@ void FillVector(Queue &queue, const Device &device,
   kernel.SetArgument(2, static_cast<int>(offset));
   kernel.SetArgument(3, dest());
   kernel.SetArgument(4, GetRealArg(constant_value));
+  auto local = std::vector<size_t>{db["FILL_WGS"]};
+  auto global = std::vector<size_t>{Ceil(n, db["FILL_WGS"])};
+  RunKernel(kernel, queue, device, global, local, event, waitForEvents);
+}
+
+// Copies a (strided) vector into another (strided) vector
+template <typename T>
+void CopyVector(Queue &queue, const Device &device,
+                const Program &program, const Databases &,
+                EventPointer event, const std::vector<Event> &waitForEvents,
+                const size_t n,
+                const size_t src_inc, const size_t src_offset, const Buffer<T> &src,
+                const size_t dest_inc, const size_t dest_offset, const Buffer<T> &dest) {
+  auto kernel = Kernel(program, "CopyVector");
+  kernel.SetArgument(0, static_cast<int>(n));
+  kernel.SetArgument(1, src());
+  kernel.SetArgument(2, static_cast<int>(src_offset));
+  kernel.SetArgument(3, static_cast<int>(src_inc));
+  kernel.SetArgument(4, dest());
+  kernel.SetArgument(5, static_cast<int>(dest_offset));
+  kernel.SetArgument(6, static_cast<int>(dest_inc));
   auto local = std::vector<size_t>{64};
   auto global = std::vector<size_t>{Ceil(n, 64)};
   RunKernel(kernel, queue, device, global, local, event, waitForEvents);
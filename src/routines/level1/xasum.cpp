@@ -22,7 +22,7 @@ namespace clblast {
 // Constructor: forwards to base class constructor
 template <typename T>
 Xasum<T>::Xasum(Queue &queue, EventPointer event, const std::string &name):
-    Routine(queue, event, name, {"Xdot"}, PrecisionValue<T>(), {}, {
+    Routine(queue, event, name, {"Xdot", "KernelSelection"}, PrecisionValue<T>(), {}, {
     #include "../../kernels/level1/xasum.opencl"
     }) {
 }
@@ -42,12 +42,33 @@ void Xasum<T>::DoAsum(const size_t n,
   TestVectorX(n, x_buffer, x_offset, x_inc);
   TestVectorScalar(1, asum_buffer, asum_offset);
 
+  // The number of workgroups, each computing an intermediate value
+  auto temp_size = 2*db_["WGS2"];
+  auto global1 = std::vector<size_t>{db_["WGS1"]*temp_size};
+  auto local1 = std::vector<size_t>{db_["WGS1"]};
+
+  // Single-pass version of the reduction: the scratch buffers are shared by all reductions on this
+  // queue, so this requires an in-order queue
+  if (db_["REDUCTION_SINGLE_PASS"] == 1 && !queue_.IsOutOfOrder()) {
+    const auto scratch = ReductionScratch(temp_size);
+    auto kernel = Kernel(program_, "XasumSinglePass");
+    kernel.SetArgument(0, static_cast<int>(n));
+    kernel.SetArgument(1, x_buffer());
+    kernel.SetArgument(2, static_cast<int>(x_offset));
+    kernel.SetArgument(3, static_cast<int>(x_inc));
+    kernel.SetArgument(4, scratch[1]());
+    kernel.SetArgument(5, scratch[0]());
+    kernel.SetArgument(6, asum_buffer());
+    kernel.SetArgument(7, static_cast<int>(asum_offset));
+    RunKernel(kernel, queue_, device_, global1, local1, event_);
+    return;
+  }
+
   // Retrieves the Xasum kernels from the compiled binary
   auto kernel1 = Kernel(program_, "Xasum");
   auto kernel2 = Kernel(program_, "XasumEpilogue");
 
   // Creates the buffer for intermediate values
-  auto temp_size = 2*db_["WGS2"];
   auto temp_buffer = Buffer<T>(context_, temp_size);
 
   // Sets the kernel arguments
@@ -61,8 +82,6 @@ void Xasum<T>::DoAsum(const size_t n,
   auto eventWaitList = std::vector<Event>();
 
   // Launches the main kernel
-  auto global1 = std::vector<size_t>{db_["WGS1"]*temp_size};
-  auto local1 = std::vector<size_t>{db_["WGS1"]};
   auto kernelEvent = Event();
   RunKernel(kernel1, queue_, device_, global1, local1, kernelEvent.pointer());
   eventWaitList.push_back(kernelEvent);
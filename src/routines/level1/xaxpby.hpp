@@ -0,0 +1,42 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xaxpby routine, computing 'y = alpha*x + beta*y' in a single pass over
+// the vectors (non-BLAS). The precision is implemented using a template argument.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_ROUTINES_XAXPBY_H_
+#define CLBLAST_ROUTINES_XAXPBY_H_
+
+#include "routine.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T>
+class Xaxpby: public Routine {
+ public:
+
+  // Constructor
+  Xaxpby(Queue &queue, EventPointer event, const std::string &name = "AXPBY");
+
+  // Templated-precision implementation of the routine
+  void DoAxpby(const size_t n, const T alpha,
+               const Buffer<T> &x_buffer, const size_t x_offset, const size_t x_inc,
+               const T beta,
+               const Buffer<T> &y_buffer, const size_t y_offset, const size_t y_inc);
+};
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_ROUTINES_XAXPBY_H_
+#endif
@@ -21,8 +21,9 @@ namespace clblast {
 
 // Constructor: forwards to base class constructor
 template <typename T>
-Xaxpy<T>::Xaxpy(Queue &queue, EventPointer event, const std::string &name):
-    Routine(queue, event, name, {"Xaxpy"}, PrecisionValue<T>(), {}, {
+Xaxpy<T>::Xaxpy(Queue &queue, EventPointer event, const std::string &name,
+                const std::vector<Database::DatabaseEntry> &userDatabase):
+    Routine(queue, event, name, {"Xaxpy"}, PrecisionValue<T>(), userDatabase, {
     #include "../../kernels/level1/level1.opencl"
     #include "../../kernels/level1/xaxpy.opencl"
     }) {
@@ -24,8 +24,9 @@ template <typename T>
 class Xaxpy: public Routine {
  public:
 
-  // Constructor
-  Xaxpy(Queue &queue, EventPointer event, const std::string &name = "AXPY");
+  // Constructor, optionally with a user-provided database to override the built-in one
+  Xaxpy(Queue &queue, EventPointer event, const std::string &name = "AXPY",
+        const std::vector<Database::DatabaseEntry> &userDatabase = {});
 
   // Templated-precision implementation of the routine
   void DoAxpy(const size_t n, const T alpha,
@@ -21,8 +21,9 @@ namespace clblast {
 
 // Constructor: forwards to base class constructor
 template <typename T>
-Xdot<T>::Xdot(Queue &queue, EventPointer event, const std::string &name):
-    Routine(queue, event, name, {"Xdot"}, PrecisionValue<T>(), {}, {
+Xdot<T>::Xdot(Queue &queue, EventPointer event, const std::string &name,
+              const std::vector<Database::DatabaseEntry> &userDatabase):
+    Routine(queue, event, name, {"Xdot", "KernelSelection"}, PrecisionValue<T>(), userDatabase, {
     #include "../../kernels/level1/xdot.opencl"
     }) {
 }
@@ -45,12 +46,37 @@ void Xdot<T>::DoDot(const size_t n,
   TestVectorY(n, y_buffer, y_offset, y_inc);
   TestVectorScalar(1, dot_buffer, dot_offset);
 
+  // The number of workgroups, each computing an intermediate value
+  auto temp_size = 2*db_["WGS2"];
+  auto global1 = std::vector<size_t>{db_["WGS1"]*temp_size};
+  auto local1 = std::vector<size_t>{db_["WGS1"]};
+
+  // Single-pass version of the reduction: the scratch buffers are shared by all reductions on this
+  // queue, so this requires an in-order queue
+  if (db_["REDUCTION_SINGLE_PASS"] == 1 && !queue_.IsOutOfOrder()) {
+    const auto scratch = ReductionScratch(temp_size);
+    auto kernel = Kernel(program_, "XdotSinglePass");
+    kernel.SetArgument(0, static_cast<int>(n));
+    kernel.SetArgument(1, x_buffer());
+    kernel.SetArgument(2, static_cast<int>(x_offset));
+    kernel.SetArgument(3, static_cast<int>(x_inc));
+    kernel.SetArgument(4, y_buffer());
+    kernel.SetArgument(5, static_cast<int>(y_offset));
+    kernel.SetArgument(6, static_cast<int>(y_inc));
+    kernel.SetArgument(7, scratch[1]());
+    kernel.SetArgument(8, scratch[0]());
+    kernel.SetArgument(9, dot_buffer());
+    kernel.SetArgument(10, static_cast<int>(dot_offset));
+    kernel.SetArgument(11, static_cast<int>(do_conjugate));
+    RunKernel(kernel, queue_, device_, global1, local1, event_);
+    return;
+  }
+
   // Retrieves the Xdot kernels from the compiled binary
   auto kernel1 = Kernel(program_, "Xdot");
   auto kernel2 = Kernel(program_, "XdotEpilogue");
 
   // Creates the buffer for intermediate values
-  auto temp_size = 2*db_["WGS2"];
   auto temp_buffer = Buffer<T>(context_, temp_size);
 
   // Sets the kernel arguments
@@ -68,8 +94,6 @@ void Xdot<T>::DoDot(const size_t n,
   auto eventWaitList = std::vector<Event>();
 
   // Launches the main kernel
-  auto global1 = std::vector<size_t>{db_["WGS1"]*temp_size};
-  auto local1 = std::vector<size_t>{db_["WGS1"]};
   auto kernelEvent = Event();
   RunKernel(kernel1, queue_, device_, global1, local1, kernelEvent.pointer());
   eventWaitList.push_back(kernelEvent);
@@ -24,8 +24,9 @@ template <typename T>
 class Xdot: public Routine {
  public:
 
-  // Constructor
-  Xdot(Queue &queue, EventPointer event, const std::string &name = "DOT");
+  // Constructor, optionally with a user-provided database to override the built-in one
+  Xdot(Queue &queue, EventPointer event, const std::string &name = "DOT",
+       const std::vector<Database::DatabaseEntry> &userDatabase = {});
 
   // Templated-precision implementation of the routine
   void DoDot(const size_t n,
@@ -0,0 +1,124 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xdot2 class (see the header for information about the class).
+//
+// =================================================================================================
+
+#include "routines/level1/xdot2.hpp"
+
+#include <string>
+#include <vector>
+
+namespace clblast {
+// =================================================================================================
+
+// Constructor: forwards to base class constructor
+template <typename T>
+Xdot2<T>::Xdot2(Queue &queue, EventPointer event, const std::string &name):
+    Routine(queue, event, name, {"Xdot", "KernelSelection"}, PrecisionValue<T>(), {}, {
+    #include "../../kernels/level1/xdot2.opencl"
+    }) {
+}
+
+// =================================================================================================
+
+// The main routine
+template <typename T>
+void Xdot2<T>::DoDot2(const size_t n,
+                      const Buffer<T> &dot_buffer, const size_t dot_offset,
+                      const Buffer<T> &x_buffer, const size_t x_offset, const size_t x_inc,
+                      const Buffer<T> &y_buffer, const size_t y_offset, const size_t y_inc,
+                      const Buffer<T> &z_buffer, const size_t z_offset, const size_t z_inc) {
+
+  // Makes sure all dimensions are larger than zero
+  if (n == 0) { throw BLASError(StatusCode::kInvalidDimension); }
+
+  // Tests the vectors for validity. There are no separate status codes for the second input
+  // vector Z, it is reported as vector Y instead.
+  TestVectorX(n, x_buffer, x_offset, x_inc);
+  TestVectorY(n, y_buffer, y_offset, y_inc);
+  TestVectorY(n, z_buffer, z_offset, z_inc);
+  TestVectorScalar(2, dot_buffer, dot_offset);
+
+  // The number of workgroups, each computing two intermediate values
+  auto temp_size = 2*db_["WGS2"];
+  auto global1 = std::vector<size_t>{db_["WGS1"]*temp_size};
+  auto local1 = std::vector<size_t>{db_["WGS1"]};
+
+  // Single-pass version of the reduction, as for Xdot
+  if (db_["REDUCTION_SINGLE_PASS"] == 1 && !queue_.IsOutOfOrder()) {
+    const auto scratch = ReductionScratch(2*temp_size);
+    auto kernel = Kernel(program_, "Xdot2SinglePass");
+    kernel.SetArgument(0, static_cast<int>(n));
+    kernel.SetArgument(1, x_buffer());
+    kernel.SetArgument(2, static_cast<int>(x_offset));
+    kernel.SetArgument(3, static_cast<int>(x_inc));
+    kernel.SetArgument(4, y_buffer());
+    kernel.SetArgument(5, static_cast<int>(y_offset));
+    kernel.SetArgument(6, static_cast<int>(y_inc));
+    kernel.SetArgument(7, z_buffer());
+    kernel.SetArgument(8, static_cast<int>(z_offset));
+    kernel.SetArgument(9, static_cast<int>(z_inc));
+    kernel.SetArgument(10, scratch[1]());
+    kernel.SetArgument(11, scratch[0]());
+    kernel.SetArgument(12, dot_buffer());
+    kernel.SetArgument(13, static_cast<int>(dot_offset));
+    RunKernel(kernel, queue_, device_, global1, local1, event_);
+    return;
+  }
+
+  // Retrieves the Xdot2 kernels from the compiled binary
+  auto kernel1 = Kernel(program_, "Xdot2");
+  auto kernel2 = Kernel(program_, "Xdot2Epilogue");
+
+  // Creates the buffer for intermediate values, holding the values for both results
+  auto temp_buffer = Buffer<T>(context_, 2*temp_size);
+
+  // Sets the kernel arguments
+  kernel1.SetArgument(0, static_cast<int>(n));
+  kernel1.SetArgument(1, x_buffer());
+  kernel1.SetArgument(2, static_cast<int>(x_offset));
+  kernel1.SetArgument(3, static_cast<int>(x_inc));
+  kernel1.SetArgument(4, y_buffer());
+  kernel1.SetArgument(5, static_cast<int>(y_offset));
+  kernel1.SetArgument(6, static_cast<int>(y_inc));
+  kernel1.SetArgument(7, z_buffer());
+  kernel1.SetArgument(8, static_cast<int>(z_offset));
+  kernel1.SetArgument(9, static_cast<int>(z_inc));
+  kernel1.SetArgument(10, temp_buffer());
+
+  // Event waiting list
+  auto eventWaitList = std::vector<Event>();
+
+  // Launches the main kernel
+  auto kernelEvent = Event();
+  RunKernel(kernel1, queue_, device_, global1, local1, kernelEvent.pointer());
+  eventWaitList.push_back(kernelEvent);
+
+  // Sets the arguments for the epilogue kernel
+  kernel2.SetArgument(0, temp_buffer());
+  kernel2.SetArgument(1, dot_buffer());
+  kernel2.SetArgument(2, static_cast<int>(dot_offset));
+
+  // Launches the epilogue kernel, using one workgroup for each of the two results
+  auto global2 = std::vector<size_t>{2*db_["WGS2"]};
+  auto local2 = std::vector<size_t>{db_["WGS2"]};
+  RunKernel(kernel2, queue_, device_, global2, local2, event_, eventWaitList);
+}
+
+// =================================================================================================
+
+// Compiles the templated class
+template class Xdot2<half>;
+template class Xdot2<float>;
+template class Xdot2<double>;
+
+// =================================================================================================
+} // namespace clblast
@@ -42,8 +42,8 @@ void Xgbmv<T>::DoGbmv(const Layout layout, const Transpose a_transpose,
   auto kl_real = (rotated) ? ku : kl;
   auto ku_real = (rotated) ? kl : ku;
 
-  // Runs the generic matrix-vector multiplication, disabling the use of fast vectorized kernels.
-  // The specific hermitian matrix-accesses are implemented in the kernel guarded by the
+  // Runs the banded matrix-vector multiplication, which only iterates over the band. The specific
+  // banded matrix-accesses are implemented in the kernel guarded by the
   // ROUTINE_GBMV define.
   bool fast_kernels = false;
   MatVec(layout, a_transpose,
@@ -52,7 +52,8 @@ void Xgbmv<T>::DoGbmv(const Layout layout, const Transpose a_transpose,
          x_buffer, x_offset, x_inc, beta,
          y_buffer, y_offset, y_inc,
          fast_kernels, fast_kernels,
-         0, false, kl_real, ku_real);
+         0, false, true, false, kl_real, ku_real,
+         event_, {});
 }
 
 // =================================================================================================
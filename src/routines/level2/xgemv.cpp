@@ -21,10 +21,13 @@ namespace clblast {
 
 // Constructor: forwards to base class constructor
 template <typename T>
-Xgemv<T>::Xgemv(Queue &queue, EventPointer event, const std::string &name):
-    Routine(queue, event, name, {"Xgemv", "XgemvFast", "XgemvFastRot", "Xtrsv"}, PrecisionValue<T>(), {}, {
+Xgemv<T>::Xgemv(Queue &queue, EventPointer event, const std::string &name,
+                const std::vector<Database::DatabaseEntry> &userDatabase):
+    Routine(queue, event, name, {"Xgemv", "XgemvFast", "XgemvFastRot", "XgemvBanded", "XgemvTiled", "Xtrsv", "Fill"}, PrecisionValue<T>(), userDatabase, {
     #include "../../kernels/level2/xgemv.opencl"
     #include "../../kernels/level2/xgemv_fast.opencl"
+    #include "../../kernels/level2/xgemv_banded.opencl"
+    #include "../../kernels/level2/xgemv_tiled.opencl"
     #include "../../kernels/level2/xtrsv.opencl"
     }) {
 }
@@ -48,7 +51,8 @@ void Xgemv<T>::DoGemv(const Layout layout, const Transpose a_transpose,
          x_buffer, x_offset, x_inc, beta,
          y_buffer, y_offset, y_inc,
          true, true,
-         0, false, 0, 0); // N/A for this routine
+         0, false, false, false, 0, 0, // N/A for this routine
+         event_, {});
 }
 
 // =================================================================================================
@@ -63,8 +67,9 @@ void Xgemv<T>::MatVec(const Layout layout, const Transpose a_transpose,
                       const T beta,
                       const Buffer<T> &y_buffer, const size_t y_offset, const size_t y_inc,
                       bool fast_kernel, bool fast_kernel_rot,
-                      const size_t parameter, const bool packed,
-                      const size_t kl, const size_t ku) {
+                      const size_t parameter, const bool packed, const bool banded, const bool symmetric,
+                      const size_t kl, const size_t ku,
+                      EventPointer event, const std::vector<Event> &waitForEvents) {
 
   // Makes sure all dimensions are larger than zero
   if (m == 0 || n == 0) { throw BLASError(StatusCode::kInvalidDimension); }
@@ -80,7 +85,7 @@ void Xgemv<T>::MatVec(const Layout layout, const Transpose a_transpose,
   const auto n_real = (a_transposed) ? m : n;
 
   // Special adjustments for banded matrices
-  if (kl != 0 || ku != 0) {
+  if (banded) {
     a_one = kl+ku+1;
   }
 
@@ -96,6 +101,14 @@ void Xgemv<T>::MatVec(const Layout layout, const Transpose a_transpose,
   TestVectorX(n_real, x_buffer, x_offset, x_inc);
   TestVectorY(m_real, y_buffer, y_offset, y_inc);
 
+  // Symmetric, hermitian and packed matrices use a separate tiled kernel followed by an epilogue
+  if (packed || symmetric) {
+    MatVecTiled(n_real, alpha, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc,
+                beta, y_buffer, y_offset, y_inc, a_rotated, a_conjugate, parameter,
+                event, waitForEvents);
+    return;
+  }
+
   // Determines whether or not the fast-version can be used
   fast_kernel = fast_kernel && (a_offset == 0) && (a_rotated == 0) && (a_conjugate == 0) &&
                 IsMultiple(m, db_["WGS2"]*db_["WPT2"]) &&
@@ -122,6 +135,13 @@ void Xgemv<T>::MatVec(const Layout layout, const Transpose a_transpose,
     local_size = db_["WGS3"];
   }
 
+  // Banded matrices use a separate kernel which only iterates over the band
+  if (banded) {
+    kernel_name = "XgemvBanded";
+    global_size = Ceil(m_real, db_["WGS4"]*db_["WPT4"]) / db_["WPT4"];
+    local_size = db_["WGS4"];
+  }
+
   // Retrieves the Xgemv kernel from the compiled binary
   auto kernel = Kernel(program_, kernel_name);
 
@@ -148,7 +168,62 @@ void Xgemv<T>::MatVec(const Layout layout, const Transpose a_transpose,
   // Launches the kernel
   auto global = std::vector<size_t>{global_size};
   auto local = std::vector<size_t>{local_size};
-  RunKernel(kernel, queue_, device_, global, local, event_);
+  RunKernel(kernel, queue_, device_, global, local, event, waitForEvents);
+}
+
+// =================================================================================================
+
+// The tiled implementation: the main kernel computes partial results per work-group, which are
+// summed by the epilogue kernel. This also stores the final result.
+template <typename T>
+void Xgemv<T>::MatVecTiled(const size_t n, const T alpha,
+                           const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                           const Buffer<T> &x_buffer, const size_t x_offset, const size_t x_inc,
+                           const T beta,
+                           const Buffer<T> &y_buffer, const size_t y_offset, const size_t y_inc,
+                           const bool a_rotated, const bool a_conjugate, const size_t parameter,
+                           EventPointer event, const std::vector<Event> &waitForEvents) {
+
+  // Creates the buffer of partial results: a row of 'n' (ceiled) values per work-group
+  const auto num_groups = CeilDiv(n, db_["WGS5"]);
+  const auto n_ceiled = num_groups * db_["WGS5"];
+  auto partials_buffer = Buffer<T>(context_, num_groups * n_ceiled);
+
+  // Retrieves the kernels from the compiled binary
+  auto kernel1 = Kernel(program_, "XgemvTiled");
+  auto kernel2 = Kernel(program_, "XgemvTiledEpilogue");
+
+  // Sets the kernel arguments
+  kernel1.SetArgument(0, static_cast<int>(n));
+  kernel1.SetArgument(1, static_cast<int>(a_rotated));
+  kernel1.SetArgument(2, a_buffer());
+  kernel1.SetArgument(3, static_cast<int>(a_offset));
+  kernel1.SetArgument(4, static_cast<int>(a_ld));
+  kernel1.SetArgument(5, x_buffer());
+  kernel1.SetArgument(6, static_cast<int>(x_offset));
+  kernel1.SetArgument(7, static_cast<int>(x_inc));
+  kernel1.SetArgument(8, partials_buffer());
+  kernel1.SetArgument(9, static_cast<int>(a_conjugate));
+  kernel1.SetArgument(10, static_cast<int>(parameter));
+
+  // Launches the main kernel
+  auto global = std::vector<size_t>{n_ceiled};
+  auto local = std::vector<size_t>{db_["WGS5"]};
+  auto kernelEvent = Event();
+  RunKernel(kernel1, queue_, device_, global, local, kernelEvent.pointer(), waitForEvents);
+  auto eventWaitList = std::vector<Event>{kernelEvent};
+
+  // Sets the arguments for the epilogue kernel
+  kernel2.SetArgument(0, static_cast<int>(n));
+  kernel2.SetArgument(1, GetRealArg(alpha));
+  kernel2.SetArgument(2, GetRealArg(beta));
+  kernel2.SetArgument(3, partials_buffer());
+  kernel2.SetArgument(4, y_buffer());
+  kernel2.SetArgument(5, static_cast<int>(y_offset));
+  kernel2.SetArgument(6, static_cast<int>(y_inc));
+
+  // Launches the epilogue kernel
+  RunKernel(kernel2, queue_, device_, global, local, event, eventWaitList);
 }
 
 // =================================================================================================
@@ -24,8 +24,9 @@ template <typename T>
 class Xgemv: public Routine {
  public:
 
-  // Constructor
-  Xgemv(Queue &queue, EventPointer event, const std::string &name = "GEMV");
+  // Constructor, optionally with a user-provided database to override the built-in one
+  Xgemv(Queue &queue, EventPointer event, const std::string &name = "GEMV",
+        const std::vector<Database::DatabaseEntry> &userDatabase = {});
 
   // Templated-precision implementation of the routine
   void DoGemv(const Layout layout, const Transpose a_transpose,
@@ -45,8 +46,20 @@ class Xgemv: public Routine {
               const T beta,
               const Buffer<T> &y_buffer, const size_t y_offset, const size_t y_inc,
               bool fast_kernel, bool fast_kernel_rot,
-              const size_t parameter, const bool packed,
-              const size_t kl, const size_t ku);
+              const size_t parameter, const bool packed, const bool banded, const bool symmetric,
+              const size_t kl, const size_t ku,
+              EventPointer event, const std::vector<Event> &waitForEvents);
+
+ private:
+
+  // Version of the above for symmetric, hermitian and packed matrices, using the tiled kernels
+  void MatVecTiled(const size_t n, const T alpha,
+                   const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                   const Buffer<T> &x_buffer, const size_t x_offset, const size_t x_inc,
+                   const T beta,
+                   const Buffer<T> &y_buffer, const size_t y_offset, const size_t y_inc,
+                   const bool a_rotated, const bool a_conjugate, const size_t parameter,
+                   EventPointer event, const std::vector<Event> &waitForEvents);
 };
 
 // =================================================================================================
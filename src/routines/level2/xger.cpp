@@ -21,8 +21,9 @@ namespace clblast {
 
 // Constructor: forwards to base class constructor
 template <typename T>
-Xger<T>::Xger(Queue &queue, EventPointer event, const std::string &name):
-    Routine(queue, event, name, {"Xger"}, PrecisionValue<T>(), {}, {
+Xger<T>::Xger(Queue &queue, EventPointer event, const std::string &name,
+              const std::vector<Database::DatabaseEntry> &userDatabase):
+    Routine(queue, event, name, {"Xger"}, PrecisionValue<T>(), userDatabase, {
     #include "../../kernels/level2/level2.opencl"
     #include "../../kernels/level2/xger.opencl"
     }) {
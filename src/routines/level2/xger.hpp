@@ -24,8 +24,9 @@ template <typename T>
 class Xger: public Routine {
  public:
 
-  // Constructor
-  Xger(Queue &queue, EventPointer event, const std::string &name = "GER");
+  // Constructor, optionally with a user-provided database to override the built-in one
+  Xger(Queue &queue, EventPointer event, const std::string &name = "GER",
+       const std::vector<Database::DatabaseEntry> &userDatabase = {});
 
   // Templated-precision implementation of the routine
   void DoGer(const Layout layout,
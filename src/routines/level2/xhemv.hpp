@@ -27,6 +27,7 @@ class Xhemv: public Xgemv<T> {
  public:
 
   // Uses the generic matrix-vector routine
+  using Xgemv<T>::event_;
   using Xgemv<T>::MatVec;
 
   // Constructor
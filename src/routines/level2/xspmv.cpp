@@ -41,8 +41,8 @@ void Xspmv<T>::DoSpmv(const Layout layout, const Triangle triangle,
   size_t is_upper = ((triangle == Triangle::kUpper && layout != Layout::kRowMajor) ||
                      (triangle == Triangle::kLower && layout == Layout::kRowMajor));
 
-  // Runs the generic matrix-vector multiplication, disabling the use of fast vectorized kernels.
-  // The specific symmetric packed matrix-accesses are implemented in the kernel guarded by the
+  // Runs the packed matrix-vector multiplication, which processes the matrix in tiles. The specific
+  // symmetric packed matrix-accesses are implemented in the kernel guarded by the
   // ROUTINE_SPMV define.
   bool fast_kernels = false;
   MatVec(layout, Transpose::kNo,
@@ -51,7 +51,8 @@ void Xspmv<T>::DoSpmv(const Layout layout, const Triangle triangle,
          x_buffer, x_offset, x_inc, beta,
          y_buffer, y_offset, y_inc,
          fast_kernels, fast_kernels,
-         is_upper, true, 0, 0);
+         is_upper, true, false, false, 0, 0,
+         event_, {});
 }
 
 // =================================================================================================
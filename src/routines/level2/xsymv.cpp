@@ -41,8 +41,8 @@ void Xsymv<T>::DoSymv(const Layout layout, const Triangle triangle,
   size_t is_upper = ((triangle == Triangle::kUpper && layout != Layout::kRowMajor) ||
                      (triangle == Triangle::kLower && layout == Layout::kRowMajor));
 
-  // Runs the generic matrix-vector multiplication, disabling the use of fast vectorized kernels.
-  // The specific symmetric matrix-accesses are implemented in the kernel guarded by the
+  // Runs the tiled matrix-vector multiplication, which reads each stored element only once. The
+  // specific symmetric matrix-accesses are implemented in the kernel guarded by the
   // ROUTINE_SYMV define.
   bool fast_kernels = false;
   MatVec(layout, Transpose::kNo,
@@ -51,7 +51,8 @@ void Xsymv<T>::DoSymv(const Layout layout, const Triangle triangle,
          x_buffer, x_offset, x_inc, beta,
          y_buffer, y_offset, y_inc,
          fast_kernels, fast_kernels,
-         is_upper, false, 0, 0);
+         is_upper, false, false, true, 0, 0,
+         event_, {});
 }
 
 // =================================================================================================
@@ -46,8 +46,8 @@ void Xtbmv<T>::DoTbmv(const Layout layout, const Triangle triangle,
   // Adds '2' to the parameter if the diagonal is unit
   auto parameter = (diagonal == Diagonal::kUnit) ? is_upper + 2 : is_upper;
 
-  // Runs the generic matrix-vector multiplication, disabling the use of fast vectorized kernels.
-  // The specific triangular banded matrix-accesses are implemented in the kernel guarded by the
+  // Runs the banded matrix-vector multiplication, which only iterates over the band. The specific
+  // triangular banded matrix-accesses are implemented in the kernel guarded by the
   // ROUTINE_TBMV define.
   auto fast_kernels = false;
   try {
@@ -57,7 +57,8 @@ void Xtbmv<T>::DoTbmv(const Layout layout, const Triangle triangle,
            scratch_buffer, x_offset, x_inc, ConstantZero<T>(),
            x_buffer, x_offset, x_inc,
            fast_kernels, fast_kernels,
-           parameter, false, k, 0);
+           parameter, false, true, false, k, 0,
+           event_, {});
   } catch (BLASError &e) {
     // Returns the proper error code (renames vector Y to X)
     switch (e.status()) {
@@ -46,8 +46,8 @@ void Xtpmv<T>::DoTpmv(const Layout layout, const Triangle triangle,
   // Adds '2' to the parameter if the diagonal is unit
   auto parameter = (diagonal == Diagonal::kUnit) ? is_upper + 2 : is_upper;
 
-  // Runs the generic matrix-vector multiplication, disabling the use of fast vectorized kernels.
-  // The specific triangular packed matrix-accesses are implemented in the kernel guarded by the
+  // Runs the packed matrix-vector multiplication, which processes the matrix in tiles. The specific
+  // triangular packed matrix-accesses are implemented in the kernel guarded by the
   // ROUTINE_TPMV define.
   auto fast_kernels = false;
   try {
@@ -57,7 +57,8 @@ void Xtpmv<T>::DoTpmv(const Layout layout, const Triangle triangle,
            scratch_buffer, x_offset, x_inc, ConstantZero<T>(),
            x_buffer, x_offset, x_inc,
            fast_kernels, fast_kernels,
-           parameter, true, 0, 0);
+           parameter, true, false, false, 0, 0,
+           event_, {});
   } catch (BLASError &e) {
     // Returns the proper error code (renames vector Y to X)
     switch (e.status()) {
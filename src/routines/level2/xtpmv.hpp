@@ -29,6 +29,7 @@ class Xtpmv: public Xgemv<T> {
   // Uses the generic matrix-vector routine
   using Xgemv<T>::queue_;
   using Xgemv<T>::context_;
+  using Xgemv<T>::event_;
   using Xgemv<T>::MatVec;
 
   // Constructor
@@ -0,0 +1,62 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xtpsv class (see the header for information about the class).
+//
+// =================================================================================================
+
+#include "routines/level2/xtpsv.hpp"
+
+#include <string>
+#include <vector>
+
+namespace clblast {
+// =================================================================================================
+
+// Constructor: forwards to base class constructor
+template <typename T>
+Xtpsv<T>::Xtpsv(Queue &queue, EventPointer event, const std::string &name):
+    Xtrsv<T>(queue, event, name) {
+}
+
+// =================================================================================================
+
+// The main routine
+template <typename T>
+void Xtpsv<T>::DoTpsv(const Layout layout, const Triangle triangle,
+                      const Transpose a_transpose, const Diagonal diagonal,
+                      const size_t n,
+                      const Buffer<T> &ap_buffer, const size_t ap_offset,
+                      const Buffer<T> &x_buffer, const size_t x_offset, const size_t x_inc) {
+
+  // Makes sure all dimensions are larger than zero
+  if (n == 0) { throw BLASError(StatusCode::kInvalidDimension); }
+
+  // Tests the matrix and vector
+  TestMatrixAP(n, ap_buffer, ap_offset);
+  TestVectorX(n, x_buffer, x_offset, x_inc);
+
+  // Runs the blocked substitution: a packed matrix is handled as a banded matrix with 'n'
+  // off-diagonals, such that each solved block updates all remaining rows
+  IndexedSolve(layout, triangle, a_transpose, diagonal, n, n,
+               ap_buffer, ap_offset, n,
+               x_buffer, x_offset, x_inc);
+}
+
+// =================================================================================================
+
+// Compiles the templated class
+template class Xtpsv<half>;
+template class Xtpsv<float>;
+template class Xtpsv<double>;
+template class Xtpsv<float2>;
+template class Xtpsv<double2>;
+
+// =================================================================================================
+} // namespace clblast
@@ -57,7 +57,8 @@ void Xtrmv<T>::DoTrmv(const Layout layout, const Triangle triangle,
            scratch_buffer, x_offset, x_inc, ConstantZero<T>(),
            x_buffer, x_offset, x_inc,
            fast_kernels, fast_kernels,
-           parameter, false, 0, 0);
+           parameter, false, false, false, 0, 0,
+           event_, {});
   } catch (BLASError &e) {
     // Returns the proper error code (renames vector Y to X)
     switch (e.status()) {
@@ -33,7 +33,8 @@ void Xtrsv<T>::Substitution(const Layout layout, const Triangle triangle,
                             const size_t n,
                             const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
                             const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_inc,
-                            const Buffer<T> &x_buffer, const size_t x_offset, const size_t x_inc) {
+                            const Buffer<T> &x_buffer, const size_t x_offset, const size_t x_inc,
+                            EventPointer event, const std::vector<Event> &waitForEvents) {
 
   if (n > db_["TRSV_BLOCK_SIZE"]) { throw BLASError(StatusCode::kUnexpectedError); };
 
@@ -69,9 +70,7 @@ void Xtrsv<T>::Substitution(const Layout layout, const Triangle triangle,
   // Launches the kernel
   const auto local = std::vector<size_t>{db_["TRSV_BLOCK_SIZE"]};
   const auto global = std::vector<size_t>{1};
-  auto event = Event();
-  RunKernel(kernel, queue_, device_, global, local, event.pointer());
-  event.WaitForCompletion();
+  RunKernel(kernel, queue_, device_, global, local, event, waitForEvents);
 }
 
 // =================================================================================================
@@ -91,20 +90,19 @@ void Xtrsv<T>::DoTrsv(const Layout layout, const Triangle triangle,
   TestMatrixA(n, n, a_buffer, a_offset, a_ld);
   TestVectorX(n, b_buffer, b_offset, b_inc);
 
-  // Creates a copy of B to avoid overwriting input while computing output
-  // TODO: Make x with 0 offset and unit increment by creating custom copy-to and copy-from kernels
-  const auto x_offset = b_offset;
-  const auto x_inc = b_inc;
-  const auto x_size = n*x_inc + x_offset;
-  auto x_buffer = Buffer<T>(context_, x_size);
-  b_buffer.CopyTo(queue_, x_size, x_buffer);
+  // Creates a temporary (compact) vector X to hold the result, such that B is not overwritten while
+  // computing the output. It is zero-initialized since the first substitution reads it.
+  const auto x_offset = size_t{0};
+  const auto x_inc = size_t{1};
+  auto x_buffer = Buffer<T>(context_, n);
 
-  // Fills the output buffer with zeros
+  // Fills the output buffer with zeros. From here on, all steps are chained through events without
+  // any synchronization with the host.
   auto eventWaitList = std::vector<Event>();
   auto fill_vector_event = Event();
   FillVector(queue_, device_, program_, db_, fill_vector_event.pointer(), eventWaitList,
              n, x_inc, x_offset, x_buffer, ConstantZero<T>());
-  fill_vector_event.WaitForCompletion();
+  eventWaitList.push_back(fill_vector_event);
 
   // Derives properties based on the arguments
   const auto is_upper = ((triangle == Triangle::kUpper && a_transpose == Transpose::kNo) ||
@@ -131,21 +129,119 @@ void Xtrsv<T>::DoTrsv(const Layout layout, const Triangle triangle,
     if (i > 0) {
       const auto gemv_m = (a_transpose == Transpose::kNo) ? block_size : i;
       const auto gemv_n = (a_transpose == Transpose::kNo) ? i : block_size;
-      DoGemv(layout, a_transpose, gemv_m, gemv_n, ConstantOne<T>(),
+      auto gemv_event = Event();
+      MatVec(layout, a_transpose, gemv_m, gemv_n, ConstantOne<T>(),
              a_buffer, a_offset + extra_offset_a, a_ld,
              x_buffer, x_offset + extra_offset_x, x_inc, ConstantOne<T>(),
-             x_buffer, x_offset + extra_offset_b, x_inc );
+             x_buffer, x_offset + extra_offset_b, x_inc,
+             true, true,
+             0, false, false, false, 0, 0, // N/A for this routine
+             gemv_event.pointer(), eventWaitList);
+      eventWaitList = std::vector<Event>{gemv_event};
     }
 
     // Runs the triangular substitution for the block size
+    auto substitution_event = Event();
     Substitution(layout, triangle, a_transpose, diagonal, block_size,
                  a_buffer, a_offset + col + col*a_ld, a_ld,
                  b_buffer, b_offset + col*b_inc, b_inc,
-                 x_buffer, x_offset + col*x_inc, x_inc);
+                 x_buffer, x_offset + col*x_inc, x_inc,
+                 substitution_event.pointer(), eventWaitList);
+    eventWaitList = std::vector<Event>{substitution_event};
   }
 
-  // Retrieves the results
-  x_buffer.CopyTo(queue_, x_size, b_buffer);
+  // Retrieves the results: the final copy signals the event of this routine
+  CopyVector(queue_, device_, program_, db_, event_, eventWaitList,
+             n, x_inc, x_offset, x_buffer, b_inc, b_offset, b_buffer);
+}
+
+// =================================================================================================
+
+// The blocked solver for banded and packed matrices
+template <typename T>
+void Xtrsv<T>::IndexedSolve(const Layout layout, const Triangle triangle,
+                            const Transpose a_transpose, const Diagonal diagonal,
+                            const size_t n, const size_t k,
+                            const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                            const Buffer<T> &x_buffer, const size_t x_offset, const size_t x_inc) {
+
+  // A row-major matrix is treated as the transpose of a column-major matrix with the other triangle
+  const auto is_upper = ((triangle == Triangle::kUpper && layout != Layout::kRowMajor) ||
+                         (triangle == Triangle::kLower && layout == Layout::kRowMajor));
+  const auto is_transposed = ((layout == Layout::kColMajor && a_transpose != Transpose::kNo) ||
+                              (layout != Layout::kColMajor && a_transpose == Transpose::kNo));
+  const auto do_conjugate = (a_transpose == Transpose::kConjugate) ? 1 : 0;
+  const auto is_unit_diagonal = (diagonal == Diagonal::kNonUnit) ? 0 : 1;
+
+  // A lower triangular system (after transposing) is solved forwards, an upper one backwards
+  const auto is_forward = (is_upper == is_transposed);
+
+  // Loops over the blocks. The solution is computed in-place in X: each block is first solved and
+  // then subtracted from the right-hand sides of the rows which depend on it. For a banded matrix
+  // these are the 'k' rows after (forward) or before (backward) the block. All steps are chained
+  // through events without any synchronization with the host.
+  const auto block_size_max = db_["TRSV_BLOCK_SIZE"];
+  const auto num_blocks = CeilDiv(n, block_size_max);
+  auto eventWaitList = std::vector<Event>();
+  for (auto b = size_t{0}; b < num_blocks; ++b) {
+    const auto block_offset = ((is_forward) ? b : num_blocks - 1 - b) * block_size_max;
+    const auto block_size = std::min(block_size_max, n - block_offset);
+    const auto row_begin = (is_forward) ? block_offset + block_size :
+                                          block_offset - std::min(k, block_offset);
+    const auto row_end = (is_forward) ? std::min(n, block_offset + block_size + k) : block_offset;
+
+    // Runs the triangular substitution for the block
+    auto kernel = Kernel(program_, "trsv_indexed");
+    kernel.SetArgument(0, static_cast<int>(n));
+    kernel.SetArgument(1, static_cast<int>(k));
+    kernel.SetArgument(2, static_cast<int>(block_offset));
+    kernel.SetArgument(3, static_cast<int>(block_size));
+    kernel.SetArgument(4, a_buffer());
+    kernel.SetArgument(5, static_cast<int>(a_offset));
+    kernel.SetArgument(6, static_cast<int>(a_ld));
+    kernel.SetArgument(7, x_buffer());
+    kernel.SetArgument(8, static_cast<int>(x_offset));
+    kernel.SetArgument(9, static_cast<int>(x_inc));
+    kernel.SetArgument(10, static_cast<int>(is_upper));
+    kernel.SetArgument(11, static_cast<int>(is_transposed));
+    kernel.SetArgument(12, static_cast<int>(is_unit_diagonal));
+    kernel.SetArgument(13, static_cast<int>(do_conjugate));
+    kernel.SetArgument(14, static_cast<int>(is_forward));
+    const auto local = std::vector<size_t>{block_size_max};
+    const auto global = std::vector<size_t>{block_size_max};
+    if (b == num_blocks - 1) { // the last block has no dependent rows and signals the event
+      RunKernel(kernel, queue_, device_, global, local, event_, eventWaitList);
+      break;
+    }
+    auto substitution_event = Event();
+    RunKernel(kernel, queue_, device_, global, local, substitution_event.pointer(), eventWaitList);
+    eventWaitList = std::vector<Event>{substitution_event};
+
+    // Runs the matrix-vector multiplication to update the dependent rows, one thread per row
+    if (row_end > row_begin) {
+      auto update_kernel = Kernel(program_, "trsv_indexed_update");
+      update_kernel.SetArgument(0, static_cast<int>(n));
+      update_kernel.SetArgument(1, static_cast<int>(k));
+      update_kernel.SetArgument(2, static_cast<int>(block_offset));
+      update_kernel.SetArgument(3, static_cast<int>(block_size));
+      update_kernel.SetArgument(4, static_cast<int>(row_begin));
+      update_kernel.SetArgument(5, static_cast<int>(row_end));
+      update_kernel.SetArgument(6, a_buffer());
+      update_kernel.SetArgument(7, static_cast<int>(a_offset));
+      update_kernel.SetArgument(8, static_cast<int>(a_ld));
+      update_kernel.SetArgument(9, x_buffer());
+      update_kernel.SetArgument(10, static_cast<int>(x_offset));
+      update_kernel.SetArgument(11, static_cast<int>(x_inc));
+      update_kernel.SetArgument(12, static_cast<int>(is_upper));
+      update_kernel.SetArgument(13, static_cast<int>(is_transposed));
+      update_kernel.SetArgument(14, static_cast<int>(do_conjugate));
+      const auto update_global = std::vector<size_t>{Ceil(row_end - row_begin, block_size_max)};
+      auto update_event = Event();
+      RunKernel(update_kernel, queue_, device_, update_global, local, update_event.pointer(),
+                eventWaitList);
+      eventWaitList = std::vector<Event>{update_event};
+    }
+  }
 }
 
 // =================================================================================================
@@ -16,6 +16,8 @@
 #ifndef CLBLAST_ROUTINES_XTRSV_H_
 #define CLBLAST_ROUTINES_XTRSV_H_
 
+#include <vector>
+
 #include "routines/level2/xgemv.hpp"
 
 namespace clblast {
@@ -32,7 +34,8 @@ class Xtrsv: public Xgemv<T> {
   using Xgemv<T>::device_;
   using Xgemv<T>::db_;
   using Xgemv<T>::program_;
-  using Xgemv<T>::DoGemv;
+  using Xgemv<T>::event_;
+  using Xgemv<T>::MatVec;
 
   // Constructor
   Xtrsv(Queue &queue, EventPointer event, const std::string &name = "TRSV");
@@ -50,7 +53,18 @@ class Xtrsv: public Xgemv<T> {
                     const size_t n,
                     const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
                     const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_inc,
-                    const Buffer<T> &x_buffer, const size_t offset_x, const size_t x_inc);
+                    const Buffer<T> &x_buffer, const size_t offset_x, const size_t x_inc,
+                    EventPointer event, const std::vector<Event> &waitForEvents);
+
+  // Solves a triangular banded (TBSV) or packed (TPSV) system in-place, block by block: a small
+  // substitution per diagonal block, followed by a matrix-vector update of the rows depending on
+  // it. The matrix is accessed through band or packed indexing, depending on the routine the
+  // kernels are built for. For a packed matrix 'k' is 'n', i.e. all rows depend on each other.
+  void IndexedSolve(const Layout layout, const Triangle triangle,
+                    const Transpose a_transpose, const Diagonal diagonal,
+                    const size_t n, const size_t k,
+                    const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                    const Buffer<T> &x_buffer, const size_t x_offset, const size_t x_inc);
 };
 
 // =================================================================================================
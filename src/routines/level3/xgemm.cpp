@@ -13,6 +13,7 @@
 
 #include "routines/level3/xgemm.hpp"
 
+#include <algorithm>
 #include <string>
 #include <vector>
 
@@ -22,9 +23,16 @@ namespace clblast {
 // Constructor: forwards to base class constructor
 template <typename T>
 Xgemm<T>::Xgemm(Queue &queue, EventPointer event, const std::string &name):
-    Routine(queue, event, name,
-            {"Copy","Pad","Transpose","Padtranspose","Xgemm","XgemmDirect","KernelSelection"},
-            PrecisionValue<T>(), {}, {
+    Xgemm(queue, event, name, {}, {}, true) {
+}
+
+// As above, but with additional kernel names for the database and an optional user database
+template <typename T>
+Xgemm<T>::Xgemm(Queue &queue, EventPointer event, const std::string &name,
+                const std::vector<std::string> &extra_kernel_names,
+                const std::vector<Database::DatabaseEntry> &userDatabase,
+                const bool defer_program):
+    Routine(queue, event, name, KernelNames(extra_kernel_names), PrecisionValue<T>(), userDatabase, {
     #include "../../kernels/level3/level3.opencl"
     #include "../../kernels/level3/copy_fast.opencl"
     #include "../../kernels/level3/copy_pad.opencl"
@@ -41,7 +49,25 @@ Xgemm<T>::Xgemm(Queue &queue, EventPointer event, const std::string &name):
     #include "../../kernels/level3/xgemm_part1.opencl"
     #include "../../kernels/level3/xgemm_part2.opencl"
     #include "../../kernels/level3/xgemm_part3.opencl"
-    }) {
+    , // separated in multiple parts to prevent C1091 in MSVC 2013
+    #include "../../kernels/level3/xgemm_streamk.opencl"
+    #include "../../kernels/level3/xgemm_skinny.opencl"
+    }, defer_program) {
+}
+
+template <typename T>
+std::vector<std::string> Xgemm<T>::KernelNames(const std::vector<std::string> &extra_kernel_names) {
+  auto kernel_names = std::vector<std::string>{"Copy", "Pad", "Transpose", "Padtranspose", "Xgemm",
+                                               "XgemmDirect", "XgemmSkinny", "KernelSelection"};
+  kernel_names.insert(kernel_names.end(), extra_kernel_names.begin(), extra_kernel_names.end());
+  return kernel_names;
+}
+
+// =================================================================================================
+
+template <typename T>
+void Xgemm<T>::SelectGemmShapeBucket(const size_t m, const size_t n, const size_t k) {
+  SelectShapeBucket({"Xgemm", "XgemmDirect"}, m, n, k);
 }
 
 // =================================================================================================
@@ -101,13 +127,36 @@ void Xgemm<T>::DoGemm(const Layout layout,
   TestMatrixB(b_one, b_two, b_buffer, b_offset, b_ld);
   TestMatrixC(c_one, c_two, c_buffer, c_offset, c_ld);
 
+  // Uses the parameters tuned for the shape class of this problem, if available for this device
+  SelectGemmShapeBucket(m, n, k);
+
   // Selects which version of GEMM to run
+  const auto do_gemm_skinny = (std::min(m, n) <= db_["XGEMM_SKINNY_MAX_N"]) &&
+                              (std::max(m, n) >= db_["XGEMM_SKINNY_MIN_M"]) &&
+                              (k <= db_["XGEMM_SKINNY_MAX_K"]);
   const auto do_gemm_direct = (m * n * k < db_["XGEMM_MIN_INDIRECT_SIZE"]);
-  if (do_gemm_direct) { // for small sizes (single kernel)
+  if (do_gemm_skinny) { // for narrow matrices (single kernel, streams through A or B only once)
+    if (n <= m) {
+      GemmSkinny(m, n, k, alpha,
+                 a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta,
+                 c_buffer, c_offset, c_ld,
+                 a_do_transpose, b_do_transpose, c_do_transpose, a_conjugate, b_conjugate,
+                 event_, {});
+    }
+    else { // computes C^T = B^T * A^T instead, such that the narrow dimension becomes 'n'
+      GemmSkinny(n, m, k, alpha,
+                 b_buffer, b_offset, b_ld, a_buffer, a_offset, a_ld, beta,
+                 c_buffer, c_offset, c_ld,
+                 b_do_transpose, a_do_transpose, !c_do_transpose, b_conjugate, a_conjugate,
+                 event_, {});
+    }
+  }
+  else if (do_gemm_direct) { // for small sizes (single kernel)
     GemmDirect(m, n, k, alpha,
                a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta,
                c_buffer, c_offset, c_ld,
-               a_do_transpose, b_do_transpose, c_do_transpose, a_conjugate, b_conjugate);
+               a_do_transpose, b_do_transpose, c_do_transpose, a_conjugate, b_conjugate,
+               event_, {});
   }
   else { // for larger sizes (pre/post-processing plus a very fast kernel)
     GemmIndirect(m, n, k, alpha,
@@ -116,7 +165,8 @@ void Xgemm<T>::DoGemm(const Layout layout,
                  a_do_transpose, b_do_transpose, c_do_transpose, a_conjugate, b_conjugate,
                  a_one, a_two, a_want_rotated,
                  b_one, b_two, b_want_rotated,
-                 c_one, c_two, c_want_rotated);
+                 c_one, c_two, c_want_rotated,
+                 event_, {});
   }
 }
 
@@ -136,7 +186,8 @@ void Xgemm<T>::GemmIndirect(const size_t m, const size_t n, const size_t k,
                             const bool a_conjugate, const bool b_conjugate,
                             const size_t a_one, const size_t a_two, const bool a_want_rotated,
                             const size_t b_one, const size_t b_two, const bool b_want_rotated,
-                            const size_t c_one, const size_t c_two, const bool c_want_rotated) {
+                            const size_t c_one, const size_t c_two, const bool c_want_rotated,
+                            EventPointer event, const std::vector<Event> &waitForEvents) {
   // Calculates the ceiled versions of m, n, and k
   const auto m_ceiled = Ceil(m, db_["MWG"]);
   const auto n_ceiled = Ceil(n, db_["NWG"]);
@@ -165,15 +216,15 @@ void Xgemm<T>::GemmIndirect(const size_t m, const size_t n, const size_t k,
   const auto c_temp = (c_no_temp) ? c_buffer : Buffer<T>(context_, c_one_i*c_two_i);
 
   // Events of all kernels (including pre/post processing kernels)
-  auto eventWaitList = std::vector<Event>();
-  auto emptyEventList = std::vector<Event>();
+  auto eventWaitList = waitForEvents;
 
   // Runs the pre-processing kernel for matrix A. This transposes the matrix, but also pads zeros
   // to fill it up until it reaches a certain multiple of size (kernel parameter dependent). In
   // case nothing has to be done, these kernels can be skipped.
   if (!a_no_temp) {
     auto eventProcessA = Event();
-    PadCopyTransposeMatrix(queue_, device_, db_, eventProcessA.pointer(), emptyEventList,
+    PadCopyTransposeMatrix(IndependentQueue(0), device_, db_,
+                           eventProcessA.pointer(), IndependentWaitList(0, waitForEvents),
                            a_one, a_two, a_ld, a_offset, a_buffer,
                            a_one_i, a_two_i, a_one_i, 0, a_temp,
                            ConstantOne<T>(), program_,
@@ -184,7 +235,8 @@ void Xgemm<T>::GemmIndirect(const size_t m, const size_t n, const size_t k,
   // As above, but now for matrix B
   if (!b_no_temp) {
     auto eventProcessB = Event();
-    PadCopyTransposeMatrix(queue_, device_, db_, eventProcessB.pointer(), emptyEventList,
+    PadCopyTransposeMatrix(IndependentQueue(1), device_, db_,
+                           eventProcessB.pointer(), IndependentWaitList(1, waitForEvents),
                            b_one, b_two, b_ld, b_offset, b_buffer,
                            b_one_i, b_two_i, b_one_i, 0, b_temp,
                            ConstantOne<T>(), program_,
@@ -195,7 +247,8 @@ void Xgemm<T>::GemmIndirect(const size_t m, const size_t n, const size_t k,
   // As above, but now for matrix C. This is only necessary if C is used both as input and output.
   if (!c_no_temp && beta != static_cast<T>(0)) {
     auto eventProcessC = Event();
-    PadCopyTransposeMatrix(queue_, device_, db_, eventProcessC.pointer(), emptyEventList,
+    PadCopyTransposeMatrix(IndependentQueue(2), device_, db_,
+                           eventProcessC.pointer(), IndependentWaitList(2, waitForEvents),
                            c_one, c_two, c_ld, c_offset, c_buffer,
                            c_one_i, c_two_i, c_one_i, 0, c_temp,
                            ConstantOne<T>(), program_,
@@ -203,35 +256,55 @@ void Xgemm<T>::GemmIndirect(const size_t m, const size_t n, const size_t k,
     eventWaitList.push_back(eventProcessC);
   }
 
-  // Retrieves the Xgemm kernel from the compiled binary
-  auto kernel = Kernel(program_, "Xgemm");
-
-  // Sets the kernel arguments
-  kernel.SetArgument(0, static_cast<int>(m_ceiled));
-  kernel.SetArgument(1, static_cast<int>(n_ceiled));
-  kernel.SetArgument(2, static_cast<int>(k_ceiled));
-  kernel.SetArgument(3, GetRealArg(alpha));
-  kernel.SetArgument(4, GetRealArg(beta));
-  kernel.SetArgument(5, a_temp());
-  kernel.SetArgument(6, b_temp());
-  kernel.SetArgument(7, c_temp());
-
-  // Computes the global and local thread sizes
-  const auto global = std::vector<size_t>{
-    (c_one_i * db_["MDIMC"]) / db_["MWG"],
-    (c_two_i * db_["NDIMC"]) / db_["NWG"]
-  };
-  const auto local = std::vector<size_t>{db_["MDIMC"], db_["NDIMC"]};
+  // Selects the stream-K version of the kernel in case of a wave-quantisation tail: the tiles fill
+  // at least one full wave of work-groups, but the partial last wave leaves too many of the compute
+  // units idle, i.e. the fraction of the launched work-group slots actually filled with tiles falls
+  // below a threshold (in percent). Problems with less than one wave of tiles are not split, as
+  // their work-groups all run concurrently anyway. This also requires at least two iterations in
+  // the k-dimension, such that tiles can be split, and an in-order queue for the shared scratch.
+  const auto num_tiles = (m_ceiled / db_["MWG"]) * (n_ceiled / db_["NWG"]);
+  const auto streamk_wgs = device_.ComputeUnits() * db_["XGEMM_STREAMK_OCCUPANCY"];
+  const auto use_streamk = (streamk_wgs > 0) && (k_ceiled > db_["KWG"]) &&
+                           (num_tiles > streamk_wgs) && (num_tiles % streamk_wgs != 0) &&
+                           (100 * num_tiles < db_["XGEMM_STREAMK_MAX_EFFICIENCY"] *
+                                              Ceil(num_tiles, streamk_wgs)) &&
+                           !queue_.IsOutOfOrder();
 
   // Launches the kernel
   auto eventKernel = Event();
-  auto eventPointer = (!c_no_temp) ? eventKernel.pointer() : event_;
-  RunKernel(kernel, queue_, device_, global, local, eventPointer, eventWaitList);
+  auto eventPointer = (!c_no_temp) ? eventKernel.pointer() : event;
+  if (use_streamk) {
+    GemmStreamK(m_ceiled, n_ceiled, k_ceiled, alpha, beta, a_temp, b_temp, c_temp,
+                streamk_wgs, eventPointer, eventWaitList);
+  }
+  else {
+
+    // Retrieves the Xgemm kernel from the compiled binary
+    auto kernel = Kernel(program_, "Xgemm");
+
+    // Sets the kernel arguments
+    kernel.SetArgument(0, static_cast<int>(m_ceiled));
+    kernel.SetArgument(1, static_cast<int>(n_ceiled));
+    kernel.SetArgument(2, static_cast<int>(k_ceiled));
+    kernel.SetArgument(3, GetRealArg(alpha));
+    kernel.SetArgument(4, GetRealArg(beta));
+    kernel.SetArgument(5, a_temp());
+    kernel.SetArgument(6, b_temp());
+    kernel.SetArgument(7, c_temp());
+
+    // Computes the global and local thread sizes
+    const auto global = std::vector<size_t>{
+      (c_one_i * db_["MDIMC"]) / db_["MWG"],
+      (c_two_i * db_["NDIMC"]) / db_["NWG"]
+    };
+    const auto local = std::vector<size_t>{db_["MDIMC"], db_["NDIMC"]};
+    RunKernel(kernel, queue_, device_, global, local, eventPointer, eventWaitList);
+  }
 
   // Runs the post-processing kernel if needed
   if (!c_no_temp) {
     eventWaitList.push_back(eventKernel);
-    PadCopyTransposeMatrix(queue_, device_, db_, event_, eventWaitList,
+    PadCopyTransposeMatrix(queue_, device_, db_, event, eventWaitList,
                            c_one_i, c_two_i, c_one_i, 0, c_temp,
                            c_one, c_two, c_ld, c_offset, c_buffer,
                            ConstantOne<T>(), program_,
@@ -240,6 +313,59 @@ void Xgemm<T>::GemmIndirect(const size_t m, const size_t n, const size_t k,
 }
 
 
+// =================================================================================================
+
+// The stream-K version of the main GEMM kernel. This operates on the same (pre-processed) matrices
+// as the regular kernel, but launches a fixed number of work-groups which each get an equal share
+// of the iterations over all tiles. Tiles which are split over multiple work-groups are completed
+// by a second (fix-up) kernel, which signals the given event.
+template <typename T>
+void Xgemm<T>::GemmStreamK(const size_t m_ceiled, const size_t n_ceiled, const size_t k_ceiled,
+                           const T alpha, const T beta,
+                           const Buffer<T> &a_temp, const Buffer<T> &b_temp,
+                           const Buffer<T> &c_temp, const size_t max_wgs,
+                           EventPointer event, const std::vector<Event> &waitForEvents) {
+
+  // Divides the iterations over the work-groups
+  const auto num_tiles = (m_ceiled / db_["MWG"]) * (n_ceiled / db_["NWG"]);
+  const auto num_iters = num_tiles * (k_ceiled / db_["KWG"]);
+  const auto iters_per_wg = CeilDiv(num_iters, max_wgs);
+  const auto num_wgs = CeilDiv(num_iters, iters_per_wg);
+
+  // Buffer for the partial results: each work-group has two tile-sized slots. This is re-used by
+  // all stream-K GEMMs on this queue.
+  const auto partials = ScratchBuffer("streamk", 2 * num_wgs * db_["MWG"] * db_["NWG"] * sizeof(T));
+
+  // Launches the stream-K kernel itself
+  auto kernel = Kernel(program_, "XgemmStreamK");
+  kernel.SetArgument(0, static_cast<int>(m_ceiled));
+  kernel.SetArgument(1, static_cast<int>(n_ceiled));
+  kernel.SetArgument(2, static_cast<int>(k_ceiled));
+  kernel.SetArgument(3, static_cast<int>(iters_per_wg));
+  kernel.SetArgument(4, GetRealArg(alpha));
+  kernel.SetArgument(5, GetRealArg(beta));
+  kernel.SetArgument(6, a_temp());
+  kernel.SetArgument(7, b_temp());
+  kernel.SetArgument(8, c_temp());
+  kernel.SetArgument(9, partials());
+  const auto local = std::vector<size_t>{db_["MDIMC"], db_["NDIMC"], 1};
+  const auto global = std::vector<size_t>{db_["MDIMC"], db_["NDIMC"], num_wgs};
+  auto eventStreamK = Event();
+  RunKernel(kernel, queue_, device_, global, local, eventStreamK.pointer(), waitForEvents);
+
+  // Launches the fix-up kernel, one work-group per tile
+  auto fixup_kernel = Kernel(program_, "XgemmStreamKFixup");
+  fixup_kernel.SetArgument(0, static_cast<int>(m_ceiled));
+  fixup_kernel.SetArgument(1, static_cast<int>(k_ceiled));
+  fixup_kernel.SetArgument(2, static_cast<int>(iters_per_wg));
+  fixup_kernel.SetArgument(3, GetRealArg(alpha));
+  fixup_kernel.SetArgument(4, GetRealArg(beta));
+  fixup_kernel.SetArgument(5, partials());
+  fixup_kernel.SetArgument(6, c_temp());
+  const auto fixup_global = std::vector<size_t>{db_["MDIMC"], db_["NDIMC"], num_tiles};
+  RunKernel(fixup_kernel, queue_, device_, fixup_global, local, event, {eventStreamK});
+}
+
 // =================================================================================================
 
 // The direct version of GEMM, requiring just one kernel, no pre or post-processing kernels.
@@ -251,7 +377,8 @@ void Xgemm<T>::GemmDirect(const size_t m, const size_t n, const size_t k,
                           const T beta,
                           const Buffer<T> &c_buffer, const size_t c_offset, const size_t c_ld,
                           const bool a_do_transpose, const bool b_do_transpose, const bool c_do_transpose,
-                          const bool a_conjugate, const bool b_conjugate) {
+                          const bool a_conjugate, const bool b_conjugate,
+                          EventPointer event, const std::vector<Event> &waitForEvents) {
 
   // Retrieves the proper XgemmDirect kernel from the compiled binary
   const auto name = (a_do_transpose) ? (b_do_transpose ? "XgemmDirectTT" : "XgemmDirectTN") :
@@ -287,7 +414,55 @@ void Xgemm<T>::GemmDirect(const size_t m, const size_t n, const size_t k,
   const auto local = std::vector<size_t>{db_["MDIMCD"], db_["NDIMCD"]};
 
   // Launches the kernel
-  RunKernel(kernel, queue_, device_, global, local, event_);
+  RunKernel(kernel, queue_, device_, global, local, event, waitForEvents);
+}
+
+// =================================================================================================
+
+// The skinny version of GEMM: each thread computes a row of a panel of columns of C
+template <typename T>
+void Xgemm<T>::GemmSkinny(const size_t m, const size_t n, const size_t k,
+                          const T alpha,
+                          const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                          const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld,
+                          const T beta,
+                          const Buffer<T> &c_buffer, const size_t c_offset, const size_t c_ld,
+                          const bool a_do_transpose, const bool b_do_transpose, const bool c_do_transpose,
+                          const bool a_conjugate, const bool b_conjugate,
+                          EventPointer event, const std::vector<Event> &waitForEvents) {
+
+  // Retrieves the XgemmSkinny kernel from the compiled binary
+  auto kernel = Kernel(program_, "XgemmSkinny");
+
+  // Sets the kernel arguments
+  kernel.SetArgument(0, static_cast<int>(m));
+  kernel.SetArgument(1, static_cast<int>(n));
+  kernel.SetArgument(2, static_cast<int>(k));
+  kernel.SetArgument(3, GetRealArg(alpha));
+  kernel.SetArgument(4, GetRealArg(beta));
+  kernel.SetArgument(5, a_buffer());
+  kernel.SetArgument(6, static_cast<int>(a_offset));
+  kernel.SetArgument(7, static_cast<int>(a_ld));
+  kernel.SetArgument(8, b_buffer());
+  kernel.SetArgument(9, static_cast<int>(b_offset));
+  kernel.SetArgument(10, static_cast<int>(b_ld));
+  kernel.SetArgument(11, c_buffer());
+  kernel.SetArgument(12, static_cast<int>(c_offset));
+  kernel.SetArgument(13, static_cast<int>(c_ld));
+  kernel.SetArgument(14, static_cast<int>(a_do_transpose));
+  kernel.SetArgument(15, static_cast<int>(b_do_transpose));
+  kernel.SetArgument(16, static_cast<int>(c_do_transpose));
+  kernel.SetArgument(17, static_cast<int>(a_conjugate));
+  kernel.SetArgument(18, static_cast<int>(b_conjugate));
+
+  // Computes the global and local thread sizes: one work-group per block of rows and panel
+  const auto m_ceiled = Ceil(m, db_["SKINNY_WGS"]);
+  const auto num_panels = CeilDiv(n, db_["SKINNY_NWI"]);
+  const auto global = std::vector<size_t>{m_ceiled * num_panels};
+  const auto local = std::vector<size_t>{db_["SKINNY_WGS"]};
+
+  // Launches the kernel
+  RunKernel(kernel, queue_, device_, global, local, event, waitForEvents);
 }
 
 // =================================================================================================
@@ -14,6 +14,9 @@
 #ifndef CLBLAST_ROUTINES_XGEMM_H_
 #define CLBLAST_ROUTINES_XGEMM_H_
 
+#include <string>
+#include <vector>
+
 #include "routine.hpp"
 
 namespace clblast {
@@ -24,9 +27,23 @@ template <typename T>
 class Xgemm: public Routine {
  public:
 
-  // Constructor
+  // Constructor. The program is compiled on the first call of 'SelectGemmShapeBucket' (see below),
+  // such that it is only compiled for the shape class of the problem.
   Xgemm(Queue &queue, EventPointer event, const std::string &name = "GEMM");
 
+  // Constructor for derived routines which also need tuning parameters of additional kernels,
+  // optionally with a user-provided database to override the built-in one. The program is compiled
+  // in the constructor unless 'defer_program' is set.
+  Xgemm(Queue &queue, EventPointer event, const std::string &name,
+        const std::vector<std::string> &extra_kernel_names,
+        const std::vector<Database::DatabaseEntry> &userDatabase = {},
+        const bool defer_program = false);
+
+  // Selects the parameters and the program for the shape class of an m-by-n-by-k GEMM (see
+  // 'Routine::SelectShapeBucket'). Derived routines which run kernels before calling 'DoGemm' call
+  // this first with the dimensions of their GEMM.
+  void SelectGemmShapeBucket(const size_t m, const size_t n, const size_t k);
+
   // Templated-precision implementation of the routine
   void DoGemm(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
               const size_t m, const size_t n, const size_t k,
@@ -47,7 +64,26 @@ class Xgemm: public Routine {
                     const bool a_conjugate, const bool b_conjugate,
                     const size_t a_one, const size_t a_two, const bool a_want_rotated,
                     const size_t b_one, const size_t b_two, const bool b_want_rotated,
-                    const size_t c_one, const size_t c_two, const bool c_want_rotated);
+                    const size_t c_one, const size_t c_two, const bool c_want_rotated,
+                    EventPointer event, const std::vector<Event> &waitForEvents);
+
+  // Stream-K version of the main kernel of the indirect GEMM (on pre-processed matrices)
+  void GemmStreamK(const size_t m_ceiled, const size_t n_ceiled, const size_t k_ceiled,
+                   const T alpha, const T beta,
+                   const Buffer<T> &a_temp, const Buffer<T> &b_temp,
+                   const Buffer<T> &c_temp, const size_t max_wgs,
+                   EventPointer event, const std::vector<Event> &waitForEvents);
+
+  // Skinny version of GEMM for narrow matrices B and C (no pre and post-processing kernels)
+  void GemmSkinny(const size_t m, const size_t n, const size_t k,
+                  const T alpha,
+                  const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                  const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld,
+                  const T beta,
+                  const Buffer<T> &c_buffer, const size_t c_offset, const size_t c_ld,
+                  const bool a_do_transpose, const bool b_do_transpose, const bool c_do_transpose,
+                  const bool a_conjugate, const bool b_conjugate,
+                  EventPointer event, const std::vector<Event> &waitForEvents);
 
   // Direct version of GEMM (no pre and post-processing kernels)
   void GemmDirect(const size_t m, const size_t n, const size_t k,
@@ -57,7 +93,12 @@ class Xgemm: public Routine {
                   const T beta,
                   const Buffer<T> &c_buffer, const size_t c_offset, const size_t c_ld,
                   const bool a_do_transpose, const bool b_do_transpose, const bool c_do_transpose,
-                  const bool a_conjugate, const bool b_conjugate);
+                  const bool a_conjugate, const bool b_conjugate,
+                  EventPointer event, const std::vector<Event> &waitForEvents);
+
+ private:
+  // Combines the names of the GEMM kernels with those of a derived routine
+  static std::vector<std::string> KernelNames(const std::vector<std::string> &extra_kernel_names);
 };
 
 // =================================================================================================
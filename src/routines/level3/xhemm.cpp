@@ -56,6 +56,10 @@ void Xhemm<T>::DoHemm(const Layout layout, const Side side, const Triangle trian
   // Temporary buffer for a copy of the hermitian matrix
   auto temp_herm = Buffer<T>(context_, k*k);
 
+  // Selects the parameters and the program for the GEMM below, which also compiles the program
+  // for the hermitian-to-squared kernel
+  SelectGemmShapeBucket(m, n, k);
+
   // Creates a general matrix from the hermitian matrix to be able to run the regular Xgemm
   // routine afterwards
   auto kernel = Kernel(program_, kernel_name);
@@ -103,14 +103,14 @@ void Xher2k<T,U>::DoHer2k(const Layout layout, const Triangle triangle, const Tr
 
   // Events of all kernels (including pre/post processing kernels)
   auto eventWaitList = std::vector<Event>();
-  auto emptyEventList = std::vector<Event>();
 
   // Runs the pre-processing kernels. This transposes the matrices A and B, but also pads zeros to
   // to fill it up until it reaches a certain multiple of size (kernel parameter dependent). In
   // case nothing has to be done, these kernels can be skipped.
   if (!a1_no_temp) {
     auto eventProcessA1 = Event();
-    PadCopyTransposeMatrix(queue_, device_, db_, eventProcessA1.pointer(), emptyEventList,
+    PadCopyTransposeMatrix(IndependentQueue(0), device_, db_,
+                           eventProcessA1.pointer(), IndependentWaitList(0),
                            ab_one, ab_two, a_ld, a_offset, a_buffer,
                            n_ceiled, k_ceiled, n_ceiled, 0, a1_temp,
                            ConstantOne<T>(), program_,
@@ -119,7 +119,8 @@ void Xher2k<T,U>::DoHer2k(const Layout layout, const Triangle triangle, const Tr
   }
   if (!a2_no_temp) {
     auto eventProcessA2 = Event();
-    PadCopyTransposeMatrix(queue_, device_, db_, eventProcessA2.pointer(), emptyEventList,
+    PadCopyTransposeMatrix(IndependentQueue(1), device_, db_,
+                           eventProcessA2.pointer(), IndependentWaitList(1),
                            ab_one, ab_two, a_ld, a_offset, a_buffer,
                            n_ceiled, k_ceiled, n_ceiled, 0, a2_temp,
                            ConstantOne<T>(), program_,
@@ -128,7 +129,8 @@ void Xher2k<T,U>::DoHer2k(const Layout layout, const Triangle triangle, const Tr
   }
   if (!b1_no_temp) {
     auto eventProcessB1 = Event();
-    PadCopyTransposeMatrix(queue_, device_, db_, eventProcessB1.pointer(), emptyEventList,
+    PadCopyTransposeMatrix(IndependentQueue(2), device_, db_,
+                           eventProcessB1.pointer(), IndependentWaitList(2),
                            ab_one, ab_two, b_ld, b_offset, b_buffer,
                            n_ceiled, k_ceiled, n_ceiled, 0, b1_temp,
                            ConstantOne<T>(), program_,
@@ -137,7 +139,8 @@ void Xher2k<T,U>::DoHer2k(const Layout layout, const Triangle triangle, const Tr
   }
   if (!b2_no_temp) {
     auto eventProcessB2 = Event();
-    PadCopyTransposeMatrix(queue_, device_, db_, eventProcessB2.pointer(), emptyEventList,
+    PadCopyTransposeMatrix(IndependentQueue(3), device_, db_,
+                           eventProcessB2.pointer(), IndependentWaitList(3),
                            ab_one, ab_two, b_ld, b_offset, b_buffer,
                            n_ceiled, k_ceiled, n_ceiled, 0, b2_temp,
                            ConstantOne<T>(), program_,
@@ -148,7 +151,8 @@ void Xher2k<T,U>::DoHer2k(const Layout layout, const Triangle triangle, const Tr
   // Furthermore, also creates a (possibly padded) copy of matrix C, since it is not allowed to
   // modify the other triangle.
   auto eventProcessC = Event();
-  PadCopyTransposeMatrix(queue_, device_, db_, eventProcessC.pointer(), emptyEventList,
+  PadCopyTransposeMatrix(IndependentQueue(4), device_, db_,
+                         eventProcessC.pointer(), IndependentWaitList(4),
                          n, n, c_ld, c_offset, c_buffer,
                          n_ceiled, n_ceiled, n_ceiled, 0, c_temp,
                          ConstantOne<T>(), program_,
@@ -56,6 +56,10 @@ void Xsymm<T>::DoSymm(const Layout layout, const Side side, const Triangle trian
   // Temporary buffer for a copy of the symmetric matrix
   auto temp_symm = Buffer<T>(context_, k*k);
 
+  // Selects the parameters and the program for the GEMM below, which also compiles the program
+  // for the symmetric-to-squared kernel
+  SelectGemmShapeBucket(m, n, k);
+
   // Creates a general matrix from the symmetric matrix to be able to run the regular Xgemm
   // routine afterwards
   auto kernel = Kernel(program_, kernel_name);
@@ -35,6 +35,7 @@ class Xsymm: public Xgemm<T> {
   using Xgemm<T>::program_;
   using Xgemm<T>::db_;
   using Xgemm<T>::DoGemm;
+  using Xgemm<T>::SelectGemmShapeBucket;
 
   // Constructor
   Xsymm(Queue &queue, EventPointer event, const std::string &name = "SYMM");
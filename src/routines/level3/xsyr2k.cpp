@@ -90,14 +90,14 @@ void Xsyr2k<T>::DoSyr2k(const Layout layout, const Triangle triangle, const Tran
 
   // Events of all kernels (including pre/post processing kernels)
   auto eventWaitList = std::vector<Event>();
-  auto emptyEventList = std::vector<Event>();
 
   // Runs the pre-processing kernels. This transposes the matrices A and B, but also pads zeros to
   // to fill it up until it reaches a certain multiple of size (kernel parameter dependent). In
   // case nothing has to be done, these kernels can be skipped.
   if (!a_no_temp) {
     auto eventProcessA = Event();
-    PadCopyTransposeMatrix(queue_, device_, db_, eventProcessA.pointer(), emptyEventList,
+    PadCopyTransposeMatrix(IndependentQueue(0), device_, db_,
+                           eventProcessA.pointer(), IndependentWaitList(0),
                            ab_one, ab_two, a_ld, a_offset, a_buffer,
                            n_ceiled, k_ceiled, n_ceiled, 0, a_temp,
                            ConstantOne<T>(), program_,
@@ -106,7 +106,8 @@ void Xsyr2k<T>::DoSyr2k(const Layout layout, const Triangle triangle, const Tran
   }
   if (!b_no_temp) {
     auto eventProcessB = Event();
-    PadCopyTransposeMatrix(queue_, device_, db_, eventProcessB.pointer(), emptyEventList,
+    PadCopyTransposeMatrix(IndependentQueue(1), device_, db_,
+                           eventProcessB.pointer(), IndependentWaitList(1),
                            ab_one, ab_two, b_ld, b_offset, b_buffer,
                            n_ceiled, k_ceiled, n_ceiled, 0, b_temp,
                            ConstantOne<T>(), program_,
@@ -117,7 +118,8 @@ void Xsyr2k<T>::DoSyr2k(const Layout layout, const Triangle triangle, const Tran
   // Furthermore, also creates a (possibly padded) copy of matrix C, since it is not allowed to
   // modify the other triangle.
   auto eventProcessC = Event();
-  PadCopyTransposeMatrix(queue_, device_, db_, eventProcessC.pointer(), emptyEventList,
+  PadCopyTransposeMatrix(IndependentQueue(2), device_, db_,
+                         eventProcessC.pointer(), IndependentWaitList(2),
                          n, n, c_ld, c_offset, c_buffer,
                          n_ceiled, n_ceiled, n_ceiled, 0, c_temp,
                          ConstantOne<T>(), program_,
@@ -68,6 +68,10 @@ void Xtrmm<T>::DoTrmm(const Layout layout, const Side side, const Triangle trian
   // Temporary buffer for a copy of the triangular matrix
   auto temp_triangular = Buffer<T>(context_, k*k);
 
+  // Selects the parameters and the program for the GEMM below, which also compiles the program
+  // for the triangular-to-squared kernel
+  SelectGemmShapeBucket(m, n, k);
+
   // Creates a general matrix from the triangular matrix to be able to run the regular Xgemm
   // routine afterwards
   auto kernel = Kernel(program_, kernel_name);
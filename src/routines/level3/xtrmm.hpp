@@ -34,6 +34,7 @@ class Xtrmm: public Xgemm<T> {
   using Xgemm<T>::program_;
   using Xgemm<T>::db_;
   using Xgemm<T>::DoGemm;
+  using Xgemm<T>::SelectGemmShapeBucket;
 
   // Constructor
   Xtrmm(Queue &queue, EventPointer event, const std::string &name = "TRMM");
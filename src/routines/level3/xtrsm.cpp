@@ -26,7 +26,7 @@ namespace clblast {
 // Constructor: forwards to base class constructor
 template <typename T>
 Xtrsm<T>::Xtrsm(Queue &queue, EventPointer event, const std::string &name):
-    Xgemm<T>(queue, event, name) {
+    Xgemm<T>(queue, event, name, {"Xtrsm"}) {
 }
 
 // =================================================================================================
@@ -63,7 +63,8 @@ void Xtrsm<T>::DoTrsm(const Layout layout, Side side, Triangle triangle,
 
 // =================================================================================================
 
-// The main routine
+// The main routine. All steps are chained through events: the host never waits for the device and
+// the event of the routine is signalled by the final copy of the result.
 template <typename T>
 void Xtrsm<T>::TrsmColMajor(const Side side, const Triangle triangle,
                             const Transpose a_transpose, const Diagonal diagonal,
@@ -72,12 +73,15 @@ void Xtrsm<T>::TrsmColMajor(const Side side, const Triangle triangle,
                             const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
                             const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld) {
 
-  // Settings
-  constexpr auto block_size = size_t{32}; // tuneable
-
   // Makes sure all dimensions are larger than zero
   if ((m == 0) || (n == 0)) { throw BLASError(StatusCode::kInvalidDimension); }
 
+  // Settings: the block size has to be a multiple of the block size of the inversion kernels, both
+  // being tuned separately
+  auto diagonal_invert_event = Event();
+  auto inverter = Xinvert<T>(queue_, diagonal_invert_event.pointer());
+  const auto block_size = Ceil(db_["TRSM_BLOCK_SIZE"], inverter.InternalBlockSize());
+
   // Computes the k dimension. This is based on whether or not matrix is A (on the left)
   // or B (on the right) in the Xgemm routine.
   const auto k = (side == Side::kLeft) ? m : n;
@@ -88,33 +92,21 @@ void Xtrsm<T>::TrsmColMajor(const Side side, const Triangle triangle,
   // Checks for validity of the input B matrix
   TestMatrixB(m, n, b_buffer, b_offset, b_ld);
 
-  // Creates a copy of B to avoid overwriting input in GEMM while computing output
-  const auto b_size = b_ld * (n - 1) + m + b_offset;
-  const auto x_one = m;
-  const auto x_two = n;
-  const auto x_size = b_size;
-  const auto x_ld = b_ld;
-  const auto x_offset = b_offset;
-  auto x_buffer = Buffer<T>(context_, x_size);
-  b_buffer.CopyTo(queue_, x_size, x_buffer);
+  // Creates a temporary (compact) matrix X to hold the solution. Every element of X is written by a
+  // GEMM with beta equal to zero before it is read, so it doesn't need to be initialized.
+  const auto x_ld = m;
+  const auto x_offset = size_t{0};
+  auto x_buffer = Buffer<T>(context_, x_ld * n);
 
   // Temporary buffer for the inverse of the A matrix
   const auto a_inv_size = Ceil(k, block_size) * block_size;
   auto a_inv_buffer = Buffer<T>(context_, a_inv_size);
 
-  // Fills the output buffer with zeros
-  auto eventWaitList = std::vector<Event>();
-  auto fill_matrix_event = Event();
-  FillMatrix(queue_, device_, program_, db_, fill_matrix_event.pointer(), eventWaitList,
-             x_one, x_two, x_ld, x_offset, x_buffer, ConstantZero<T>());
-  fill_matrix_event.WaitForCompletion();
-
   // Inverts the diagonal blocks
-  auto diagonal_invert_event = Event();
-  auto inverter = Xinvert<T>(queue_, diagonal_invert_event.pointer());
+  auto eventWaitList = std::vector<Event>();
   inverter.InvertMatrixDiagonalBlocks(Layout::kColMajor, triangle, diagonal,
                                       k, block_size, a_buffer, a_offset, a_ld, a_inv_buffer);
-  diagonal_invert_event.WaitForCompletion();
+  eventWaitList.push_back(diagonal_invert_event);
 
   // Derives properties based on the arguments
   const auto condition = ((triangle == Triangle::kUpper && a_transpose != Transpose::kNo) ||
@@ -128,18 +120,18 @@ void Xtrsm<T>::TrsmColMajor(const Side side, const Triangle triangle,
       for (auto i = size_t{0}; i < m; i += block_size) {
         const auto gemm_alpha = (i == 0) ? alpha : ConstantOne<T>();
         const auto current_block_size = std::min(m - i, block_size);
-        DoGemm(Layout::kColMajor, a_transpose, Transpose::kNo,
-               current_block_size, n, current_block_size, gemm_alpha,
-               a_inv_buffer, i * block_size, block_size,
-               b_buffer, b_offset + i, b_ld, ConstantZero<T>(),
-               x_buffer, x_offset + i, x_ld);
+        TrsmGemm(a_transpose, Transpose::kNo,
+                 current_block_size, n, current_block_size, gemm_alpha,
+                 a_inv_buffer, i * block_size, block_size,
+                 b_buffer, b_offset + i, b_ld, ConstantZero<T>(),
+                 x_buffer, x_offset + i, x_ld, eventWaitList);
         if (i + block_size >= m) { break; }
         const auto this_a_offset = (a_transpose == Transpose::kNo) ? (i + block_size) + i * a_ld : i + (block_size + i) * a_ld;
-        DoGemm(Layout::kColMajor, a_transpose, Transpose::kNo,
-               m - i - block_size, n, block_size, ConstantNegOne<T>(),
-               a_buffer, this_a_offset, a_ld,
-               x_buffer, x_offset + i, x_ld, gemm_alpha,
-               b_buffer, b_offset + i + block_size, b_ld);
+        TrsmGemm(a_transpose, Transpose::kNo,
+                 m - i - block_size, n, block_size, ConstantNegOne<T>(),
+                 a_buffer, this_a_offset + a_offset, a_ld,
+                 x_buffer, x_offset + i, x_ld, gemm_alpha,
+                 b_buffer, b_offset + i + block_size, b_ld, eventWaitList);
       }
     }
 
@@ -150,18 +142,18 @@ void Xtrsm<T>::TrsmColMajor(const Side side, const Triangle triangle,
       for (auto i = i_start; i >= 0; i -= static_cast<int>(block_size)) {
         const auto current_block_size = (i == i_start) ? special_block_size : block_size;
         const auto gemm_alpha = (i == i_start) ? alpha : ConstantOne<T>();
-        DoGemm(Layout::kColMajor, a_transpose, Transpose::kNo,
-               current_block_size, n, current_block_size, gemm_alpha,
-               a_inv_buffer, i * block_size, block_size,
-               b_buffer, b_offset + i, b_ld, ConstantZero<T>(),
-               x_buffer, x_offset + i, x_ld);
+        TrsmGemm(a_transpose, Transpose::kNo,
+                 current_block_size, n, current_block_size, gemm_alpha,
+                 a_inv_buffer, i * block_size, block_size,
+                 b_buffer, b_offset + i, b_ld, ConstantZero<T>(),
+                 x_buffer, x_offset + i, x_ld, eventWaitList);
         if (i - static_cast<int>(block_size) < 0) { break; }
         const auto this_a_offset = (a_transpose == Transpose::kNo) ? i * a_ld : i;
-        DoGemm(Layout::kColMajor, a_transpose, Transpose::kNo,
-               i, n, current_block_size, ConstantNegOne<T>(),
-               a_buffer, this_a_offset, a_ld,
-               x_buffer, x_offset + i, x_ld, gemm_alpha,
-               b_buffer, b_offset, b_ld);
+        TrsmGemm(a_transpose, Transpose::kNo,
+                 i, n, current_block_size, ConstantNegOne<T>(),
+                 a_buffer, this_a_offset + a_offset, a_ld,
+                 x_buffer, x_offset + i, x_ld, gemm_alpha,
+                 b_buffer, b_offset, b_ld, eventWaitList);
       }
     }
   }
@@ -176,18 +168,18 @@ void Xtrsm<T>::TrsmColMajor(const Side side, const Triangle triangle,
       for (auto i = i_start; i >= 0; i -= static_cast<int>(block_size)) {
         const auto current_block_size = (i == i_start) ? special_block_size : block_size;
         const auto gemm_alpha = (i == i_start) ? alpha : ConstantOne<T>();
-        DoGemm(Layout::kColMajor, Transpose::kNo, a_transpose,
-               m, current_block_size, current_block_size, gemm_alpha,
-               b_buffer, b_offset + i * b_ld, b_ld,
-               a_inv_buffer, i * block_size, block_size, ConstantZero<T>(),
-               x_buffer, x_offset + i * x_ld, x_ld);
+        TrsmGemm(Transpose::kNo, a_transpose,
+                 m, current_block_size, current_block_size, gemm_alpha,
+                 b_buffer, b_offset + i * b_ld, b_ld,
+                 a_inv_buffer, i * block_size, block_size, ConstantZero<T>(),
+                 x_buffer, x_offset + i * x_ld, x_ld, eventWaitList);
         if (i - static_cast<int>(block_size) < 0) { break; }
         const auto this_a_offset = (a_transpose == Transpose::kNo) ? i : i * a_ld;
-        DoGemm(Layout::kColMajor, Transpose::kNo, a_transpose,
-               m, i, current_block_size, ConstantNegOne<T>(),
-               x_buffer, x_offset + i * x_ld, x_ld,
-               a_buffer, this_a_offset, a_ld, gemm_alpha,
-               b_buffer, b_offset, b_ld);
+        TrsmGemm(Transpose::kNo, a_transpose,
+                 m, i, current_block_size, ConstantNegOne<T>(),
+                 x_buffer, x_offset + i * x_ld, x_ld,
+                 a_buffer, this_a_offset + a_offset, a_ld, gemm_alpha,
+                 b_buffer, b_offset, b_ld, eventWaitList);
       }
     }
 
@@ -196,24 +188,75 @@ void Xtrsm<T>::TrsmColMajor(const Side side, const Triangle triangle,
       for (auto i = size_t{0}; i < n; i += block_size) {
         const auto gemm_alpha = (i == 0) ? alpha : ConstantOne<T>();
         const auto current_block_size = std::min(n - i, block_size);
-        DoGemm(Layout::kColMajor, Transpose::kNo, a_transpose,
-               m, current_block_size, current_block_size, gemm_alpha,
-               b_buffer, b_offset + i * b_ld, b_ld,
-               a_inv_buffer, i * block_size, block_size, ConstantZero<T>(),
-               x_buffer, x_offset + i * x_ld, x_ld);
+        TrsmGemm(Transpose::kNo, a_transpose,
+                 m, current_block_size, current_block_size, gemm_alpha,
+                 b_buffer, b_offset + i * b_ld, b_ld,
+                 a_inv_buffer, i * block_size, block_size, ConstantZero<T>(),
+                 x_buffer, x_offset + i * x_ld, x_ld, eventWaitList);
         if (i + block_size >= n) { break; }
         const auto this_a_offset = (a_transpose == Transpose::kNo) ? i + (block_size + i) * a_ld : (i + block_size) + i * a_ld;
-        DoGemm(Layout::kColMajor, Transpose::kNo, a_transpose,
-               m, n - i - block_size, block_size, ConstantNegOne<T>(),
-               x_buffer, x_offset + i * x_ld, x_ld,
-               a_buffer, this_a_offset, a_ld, gemm_alpha,
-               b_buffer, b_offset + (i + block_size) * b_ld, b_ld);
+        TrsmGemm(Transpose::kNo, a_transpose,
+                 m, n - i - block_size, block_size, ConstantNegOne<T>(),
+                 x_buffer, x_offset + i * x_ld, x_ld,
+                 a_buffer, this_a_offset + a_offset, a_ld, gemm_alpha,
+                 b_buffer, b_offset + (i + block_size) * b_ld, b_ld, eventWaitList);
       }
     }
   }
 
-  // Retrieves the results
-  x_buffer.CopyTo(queue_, b_size, b_buffer);
+  // Retrieves the results: copies the solution X into B (only the m by n part), which signals the
+  // event of this routine
+  PadCopyTransposeMatrix(queue_, device_, db_, event_, eventWaitList,
+                         m, n, x_ld, x_offset, x_buffer,
+                         m, n, b_ld, b_offset, b_buffer,
+                         ConstantOne<T>(), program_,
+                         false, false, false);
+}
+
+// =================================================================================================
+
+// A single GEMM of the blocked algorithm. This selects the direct or the in-direct version of GEMM
+// in the same way as the Xgemm routine does, but chains it to the earlier steps through events. The
+// inputs have already been validated by the TRSM routine.
+template <typename T>
+void Xtrsm<T>::TrsmGemm(const Transpose a_transpose, const Transpose b_transpose,
+                        const size_t m, const size_t n, const size_t k,
+                        const T alpha,
+                        const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                        const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld,
+                        const T beta,
+                        const Buffer<T> &c_buffer, const size_t c_offset, const size_t c_ld,
+                        std::vector<Event> &eventWaitList) {
+
+  // The kernels expect a non-rotated A and a rotated B (see the Xgemm routine): col-major here
+  const auto a_rotated = (a_transpose != Transpose::kNo);
+  const auto b_rotated = (b_transpose != Transpose::kNo);
+  const auto a_do_transpose = a_rotated;
+  const auto b_do_transpose = !b_rotated;
+  const auto a_conjugate = (a_transpose == Transpose::kConjugate);
+  const auto b_conjugate = (b_transpose == Transpose::kConjugate);
+
+  // Launches the GEMM and makes it the only event to wait for in the next step
+  auto gemm_event = Event();
+  const auto do_gemm_direct = (m * n * k < db_["XGEMM_MIN_INDIRECT_SIZE"]);
+  if (do_gemm_direct) {
+    GemmDirect(m, n, k, alpha,
+               a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta,
+               c_buffer, c_offset, c_ld,
+               a_do_transpose, b_do_transpose, false, a_conjugate, b_conjugate,
+               gemm_event.pointer(), eventWaitList);
+  }
+  else {
+    GemmIndirect(m, n, k, alpha,
+                 a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta,
+                 c_buffer, c_offset, c_ld,
+                 a_do_transpose, b_do_transpose, false, a_conjugate, b_conjugate,
+                 (a_rotated) ? k : m, (a_rotated) ? m : k, false,
+                 (b_rotated) ? n : k, (b_rotated) ? k : n, true,
+                 m, n, false,
+                 gemm_event.pointer(), eventWaitList);
+  }
+  eventWaitList = std::vector<Event>{gemm_event};
 }
 
 // =================================================================================================
@@ -15,6 +15,8 @@
 #ifndef CLBLAST_ROUTINES_XTRSM_H_
 #define CLBLAST_ROUTINES_XTRSM_H_
 
+#include <vector>
+
 #include "routines/level3/xgemm.hpp"
 
 namespace clblast {
@@ -31,7 +33,9 @@ class Xtrsm: public Xgemm<T> {
   using Xgemm<T>::device_;
   using Xgemm<T>::db_;
   using Xgemm<T>::program_;
-  using Xgemm<T>::DoGemm;
+  using Xgemm<T>::event_;
+  using Xgemm<T>::GemmIndirect;
+  using Xgemm<T>::GemmDirect;
 
   // Constructor
   Xtrsm(Queue &queue, EventPointer event, const std::string &name = "TRSM");
@@ -51,6 +55,18 @@ class Xtrsm: public Xgemm<T> {
                     const T alpha,
                     const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
                     const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld);
+
+ private:
+  // Enqueues one column-major GEMM of the blocked algorithm. The GEMM waits for the events in
+  // 'eventWaitList', which is afterwards replaced by the event of this GEMM.
+  void TrsmGemm(const Transpose a_transpose, const Transpose b_transpose,
+                const size_t m, const size_t n, const size_t k,
+                const T alpha,
+                const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld,
+                const T beta,
+                const Buffer<T> &c_buffer, const size_t c_offset, const size_t c_ld,
+                std::vector<Event> &eventWaitList);
 };
 
 // =================================================================================================
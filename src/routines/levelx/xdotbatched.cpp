@@ -0,0 +1,120 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the XdotBatched class (see the header for information about the class).
+//
+// =================================================================================================
+
+#include "routines/levelx/xdotbatched.hpp"
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+namespace clblast {
+// =================================================================================================
+
+// Constructor: forwards to base class constructor
+template <typename T>
+XdotBatched<T>::XdotBatched(Queue &queue, EventPointer event, const std::string &name):
+    Routine(queue, event, name, {"XdotBatched"}, PrecisionValue<T>(), {}, {
+    #include "../../kernels/level1/xdot.opencl"
+    }) {
+}
+
+// =================================================================================================
+
+// The main routine
+template <typename T>
+void XdotBatched<T>::DoDotBatched(const size_t n,
+                                  const Buffer<T> &dot_buffer, const std::vector<size_t> &dot_offsets,
+                                  const Buffer<T> &x_buffer, const std::vector<size_t> &x_offsets, const size_t x_inc,
+                                  const Buffer<T> &y_buffer, const std::vector<size_t> &y_offsets, const size_t y_inc,
+                                  const size_t batch_count) {
+
+  // Tests for a valid batch count
+  if ((batch_count < 1) || (dot_offsets.size() != batch_count) ||
+      (x_offsets.size() != batch_count) || (y_offsets.size() != batch_count)) {
+    throw BLASError(StatusCode::kInvalidBatchCount);
+  }
+
+  // Makes sure all dimensions are larger than zero
+  if (n == 0) { throw BLASError(StatusCode::kInvalidDimension); }
+
+  // Tests the vectors for validity
+  for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+    TestVectorX(n, x_buffer, x_offsets[batch], x_inc);
+    TestVectorY(n, y_buffer, y_offsets[batch], y_inc);
+    TestVectorScalar(1, dot_buffer, dot_offsets[batch]);
+  }
+
+  // Upload the arguments to the device
+  std::vector<int> x_offsets_int(x_offsets.begin(), x_offsets.end());
+  std::vector<int> y_offsets_int(y_offsets.begin(), y_offsets.end());
+  std::vector<int> dot_offsets_int(dot_offsets.begin(), dot_offsets.end());
+  auto x_offsets_device = Buffer<int>(context_, BufferAccess::kReadOnly, batch_count);
+  auto y_offsets_device = Buffer<int>(context_, BufferAccess::kReadOnly, batch_count);
+  auto dot_offsets_device = Buffer<int>(context_, BufferAccess::kReadOnly, batch_count);
+  x_offsets_device.Write(queue_, batch_count, x_offsets_int);
+  y_offsets_device.Write(queue_, batch_count, y_offsets_int);
+  dot_offsets_device.Write(queue_, batch_count, dot_offsets_int);
+
+  // Retrieves the XdotBatched kernels from the compiled binary
+  auto kernel1 = Kernel(program_, "XdotBatched");
+  auto kernel2 = Kernel(program_, "XdotEpilogueBatched");
+
+  // Creates the buffer for intermediate values. Small vectors use fewer workgroups per batch, such
+  // that the number of launched threads scales with the actual amount of work.
+  const auto num_partials = std::min(CeilDiv(n, db_["WGS1"]), 2*db_["WGS2"]);
+  auto temp_buffer = Buffer<T>(context_, batch_count*num_partials);
+
+  // Sets the kernel arguments
+  kernel1.SetArgument(0, static_cast<int>(n));
+  kernel1.SetArgument(1, x_buffer());
+  kernel1.SetArgument(2, x_offsets_device());
+  kernel1.SetArgument(3, static_cast<int>(x_inc));
+  kernel1.SetArgument(4, y_buffer());
+  kernel1.SetArgument(5, y_offsets_device());
+  kernel1.SetArgument(6, static_cast<int>(y_inc));
+  kernel1.SetArgument(7, temp_buffer());
+  kernel1.SetArgument(8, 0); // no conjugation for the real-valued DOT routine
+
+  // Event waiting list
+  auto eventWaitList = std::vector<Event>();
+
+  // Launches the main kernel
+  auto global1 = std::vector<size_t>{db_["WGS1"]*num_partials, batch_count};
+  auto local1 = std::vector<size_t>{db_["WGS1"], 1};
+  auto kernelEvent = Event();
+  RunKernel(kernel1, queue_, device_, global1, local1, kernelEvent.pointer());
+  eventWaitList.push_back(kernelEvent);
+
+  // Sets the arguments for the epilogue kernel
+  kernel2.SetArgument(0, static_cast<int>(num_partials));
+  kernel2.SetArgument(1, temp_buffer());
+  kernel2.SetArgument(2, dot_buffer());
+  kernel2.SetArgument(3, dot_offsets_device());
+
+  // Launches the epilogue kernel
+  auto global2 = std::vector<size_t>{db_["WGS2"], batch_count};
+  auto local2 = std::vector<size_t>{db_["WGS2"], 1};
+  RunKernel(kernel2, queue_, device_, global2, local2, event_, eventWaitList);
+}
+
+// =================================================================================================
+
+// Compiles the templated class
+template class XdotBatched<half>;
+template class XdotBatched<float>;
+template class XdotBatched<double>;
+template class XdotBatched<float2>;
+template class XdotBatched<double2>;
+
+// =================================================================================================
+} // namespace clblast
@@ -0,0 +1,320 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xfused class (see the header for information about the class).
+//
+// =================================================================================================
+
+#include "routines/levelx/xfused.hpp"
+
+#include <string>
+#include <vector>
+
+namespace clblast {
+// =================================================================================================
+
+// Helpers to inspect a step: whether it writes to vector 'y' (otherwise it is a reduction), whether
+// it uses the scalar 'alpha', and whether it uses the vectors 'x' and 'y' at all
+template <typename T>
+bool StepWritesY(const VectorStep<T> &step) {
+  return step.operation != VectorOperation::kDot && step.operation != VectorOperation::kNrm2;
+}
+template <typename T>
+bool StepHasAlpha(const VectorStep<T> &step) {
+  return step.operation == VectorOperation::kScal || step.operation == VectorOperation::kAxpy;
+}
+template <typename T>
+bool StepUsesX(const VectorStep<T> &step) { return step.operation != VectorOperation::kScal; }
+template <typename T>
+bool StepUsesY(const VectorStep<T> &step) { return step.operation != VectorOperation::kNrm2; }
+
+// Names of the private variables and kernel arguments
+inline std::string Vec(const size_t index) { return "v" + ToString(index); }
+inline std::string Reg(const size_t index) { return "r" + ToString(index); }
+inline std::string Acc(const size_t index) { return "acc" + ToString(index); }
+inline std::string Element(const size_t index) {
+  return Vec(index) + "[id*" + Vec(index) + "_inc + " + Vec(index) + "_offset]";
+}
+
+// =================================================================================================
+
+// Constructor: forwards to base class constructor with the source code generator, such that the
+// source code is only generated when the program is not in the cache yet. Its name (and thus its
+// entry in the program cache) is the signature of the chain of steps.
+template <typename T>
+Xfused<T>::Xfused(Queue &queue, EventPointer event, const std::vector<VectorStep<T>> &steps,
+                  const size_t num_vectors):
+    Routine(queue, event, Signature(steps, num_vectors), {"Xdot"}, PrecisionValue<T>(), {},
+            [steps, num_vectors]() -> std::string { return GenerateSource(steps, num_vectors); }),
+    steps_(steps),
+    num_vectors_(num_vectors) {
+}
+
+// =================================================================================================
+
+// The signature lists the number of vectors and the operation and the vectors of each step, e.g.
+// 'FUSED_3_A0_1_D1_2' for an AXPY from vector 0 into vector 1 followed by a DOT of vectors 1 and 2.
+// As the source code is not generated for cached programs, the steps are validated here.
+template <typename T>
+std::string Xfused<T>::Signature(const std::vector<VectorStep<T>> &steps,
+                                 const size_t num_vectors) {
+  if (steps.empty()) { throw BLASError(StatusCode::kInvalidValue, "no steps given"); }
+  for (const auto &step : steps) {
+    if ((StepUsesX(step) && step.x >= num_vectors) || (StepUsesY(step) && step.y >= num_vectors)) {
+      throw BLASError(StatusCode::kInvalidValue, "step refers to a non-existing vector");
+    }
+  }
+  auto signature = "FUSED_" + ToString(num_vectors);
+  for (const auto &step : steps) {
+    switch (step.operation) {
+      case VectorOperation::kCopy: signature += "_C"; break;
+      case VectorOperation::kScal: signature += "_S"; break;
+      case VectorOperation::kAxpy: signature += "_A"; break;
+      case VectorOperation::kMul: signature += "_M"; break;
+      case VectorOperation::kAdd: signature += "_P"; break;
+      case VectorOperation::kDot: signature += "_D"; break;
+      case VectorOperation::kNrm2: signature += "_N"; break;
+    }
+    if (StepUsesX(step)) { signature += ToString(step.x); }
+    if (StepUsesX(step) && StepUsesY(step)) { signature += "_"; }
+    if (StepUsesY(step)) { signature += ToString(step.y); }
+  }
+  return signature;
+}
+
+// =================================================================================================
+
+// Generates the kernels. The main kernel loads each vector element into a private register at its
+// first use, applies all steps to the registers, and stores the registers of the modified vectors.
+// Each reduction is accumulated in its own register and reduced per workgroup as in Xdot. The
+// epilogue kernel is launched with one workgroup per reduction.
+template <typename T>
+std::string Xfused<T>::GenerateSource(const std::vector<VectorStep<T>> &steps,
+                                      const size_t num_vectors) {
+  Signature(steps, num_vectors); // validates the steps
+
+  // The kernel arguments: the scalars, the vectors and the output for the partial results
+  auto num_reductions = size_t{0};
+  auto num_alphas = size_t{0};
+  auto arguments = std::string{"const int n"};
+  for (const auto &step : steps) {
+    if (StepHasAlpha(step)) { arguments += ", const real_arg arg_alpha" + ToString(num_alphas++); }
+    if (!StepWritesY(step)) { num_reductions++; }
+  }
+  for (auto v = size_t{0}; v < num_vectors; ++v) {
+    arguments += ",\n                __global real* " + Vec(v);
+    arguments += ", const int " + Vec(v) + "_offset, const int " + Vec(v) + "_inc";
+  }
+  if (num_reductions > 0) { arguments += ",\n                __global real* output"; }
+
+  // The main kernel: initialization
+  auto source = std::string{"\n__kernel __attribute__((reqd_work_group_size(WGS1, 1, 1)))\n"};
+  source += "void XfusedMain(" + arguments + ") {\n";
+  if (num_reductions > 0) {
+    source += "  __local real lm[" + ToString(num_reductions) + "*WGS1];\n";
+  }
+  for (auto a = size_t{0}; a < num_alphas; ++a) {
+    source += "  const real alpha" + ToString(a) + " = GetRealArg(arg_alpha" + ToString(a) + ");\n";
+  }
+  source += "  const int lid = get_local_id(0);\n";
+  source += "  const int wgid = get_group_id(0);\n";
+  source += "  const int num_groups = get_num_groups(0);\n";
+  for (auto r = size_t{0}; r < num_reductions; ++r) {
+    source += "  real " + Acc(r) + ";\n  SetToZero(" + Acc(r) + ");\n";
+  }
+
+  // The main kernel: the loop over the elements with the steps
+  source += "  int id = wgid*WGS1 + lid;\n";
+  source += "  while (id < n) {\n";
+  auto is_loaded = std::vector<bool>(num_vectors, false);
+  auto is_written = std::vector<bool>(num_vectors, false);
+  auto load = [&](const size_t v) {
+    if (is_loaded[v]) { return; }
+    source += "    real " + Reg(v) + " = " + Element(v) + ";\n";
+    is_loaded[v] = true;
+  };
+  auto alpha_id = size_t{0};
+  auto reduction_id = size_t{0};
+  for (const auto &step : steps) {
+    if (StepUsesX(step)) { load(step.x); }
+    if (StepUsesY(step) && step.operation != VectorOperation::kCopy) { load(step.y); }
+    const auto x = Reg(step.x);
+    const auto y = Reg(step.y);
+    switch (step.operation) {
+      case VectorOperation::kCopy:
+        if (!is_loaded[step.y]) { source += "    real " + y + ";\n"; is_loaded[step.y] = true; }
+        source += "    " + y + " = " + x + ";\n";
+        break;
+      case VectorOperation::kScal:
+        source += "    Multiply(" + y + ", alpha" + ToString(alpha_id++) + ", " + y + ");\n";
+        break;
+      case VectorOperation::kAxpy:
+        source += "    MultiplyAdd(" + y + ", alpha" + ToString(alpha_id++) + ", " + x + ");\n";
+        break;
+      case VectorOperation::kMul:
+        source += "    Multiply(" + y + ", " + x + ", " + y + ");\n";
+        break;
+      case VectorOperation::kAdd:
+        source += "    Add(" + y + ", " + x + ", " + y + ");\n";
+        break;
+      case VectorOperation::kDot:
+        source += "    MultiplyAdd(" + Acc(reduction_id++) + ", " + x + ", " + y + ");\n";
+        break;
+      case VectorOperation::kNrm2:
+        source += "    MultiplyAdd(" + Acc(reduction_id++) + ", " + x + ", " + x + ");\n";
+        break;
+    }
+    if (StepWritesY(step)) { is_written[step.y] = true; }
+  }
+  for (auto v = size_t{0}; v < num_vectors; ++v) {
+    if (is_written[v]) {
+      source += "    " + Element(v) + " = " + Reg(v) + ";\n";
+    }
+  }
+  source += "    id += WGS1*num_groups;\n";
+  source += "  }\n";
+
+  // The main kernel: the reductions in local memory and the per-workgroup results
+  if (num_reductions > 0) {
+    for (auto r = size_t{0}; r < num_reductions; ++r) {
+      source += "  lm[" + ToString(r) + "*WGS1 + lid] = " + Acc(r) + ";\n";
+    }
+    source += "  barrier(CLK_LOCAL_MEM_FENCE);\n";
+    source += "  #pragma unroll\n";
+    source += "  for (int s=WGS1/2; s>0; s=s>>1) {\n";
+    source += "    if (lid < s) {\n";
+    for (auto r = size_t{0}; r < num_reductions; ++r) {
+      const auto index = ToString(r) + "*WGS1 + lid";
+      source += "      Add(lm[" + index + "], lm[" + index + "], lm[" + index + " + s]);\n";
+    }
+    source += "    }\n";
+    source += "    barrier(CLK_LOCAL_MEM_FENCE);\n";
+    source += "  }\n";
+    source += "  if (lid == 0) {\n";
+    for (auto r = size_t{0}; r < num_reductions; ++r) {
+      const auto r_string = ToString(r);
+      source += "    output[" + r_string + "*num_groups + wgid] = lm[" + r_string + "*WGS1];\n";
+    }
+    source += "  }\n";
+  }
+  source += "}\n";
+
+  // The epilogue kernel, taking the square root for the results of the NRM2 steps
+  if (num_reductions > 0) {
+    auto sqrt_condition = std::string{"0"};
+    reduction_id = 0;
+    for (const auto &step : steps) {
+      if (step.operation == VectorOperation::kNrm2) {
+        sqrt_condition += " || result == " + ToString(reduction_id);
+      }
+      if (!StepWritesY(step)) { reduction_id++; }
+    }
+    source += "\n__kernel __attribute__((reqd_work_group_size(WGS2, 1, 1)))\n";
+    source += "void XfusedEpilogue(const __global real* restrict input,\n";
+    source += "                    __global real* results, const int results_offset) {\n";
+    source += "  __local real lm[WGS2];\n";
+    source += "  const int lid = get_local_id(0);\n";
+    source += "  const int result = get_group_id(0);\n";
+    source += "  const int input_offset = result*2*WGS2;\n";
+    source += "  Add(lm[lid], input[input_offset + lid], input[input_offset + lid + WGS2]);\n";
+    source += "  barrier(CLK_LOCAL_MEM_FENCE);\n";
+    source += "  #pragma unroll\n";
+    source += "  for (int s=WGS2/2; s>0; s=s>>1) {\n";
+    source += "    if (lid < s) {\n";
+    source += "      Add(lm[lid], lm[lid], lm[lid + s]);\n";
+    source += "    }\n";
+    source += "    barrier(CLK_LOCAL_MEM_FENCE);\n";
+    source += "  }\n";
+    source += "  if (lid == 0) {\n";
+    source += "    results[results_offset + result] = (" + sqrt_condition + ") ?\n";
+    source += "                                       sqrt(lm[0]) : lm[0];\n";
+    source += "  }\n";
+    source += "}\n";
+  }
+  return source;
+}
+
+// =================================================================================================
+
+// The main routine
+template <typename T>
+void Xfused<T>::DoFused(const size_t n,
+                        const std::vector<Buffer<T>> &buffers,
+                        const std::vector<size_t> &offsets, const std::vector<size_t> &incs,
+                        const Buffer<T> &result_buffer, const size_t result_offset) {
+
+  // Makes sure all dimensions are larger than zero
+  if (n == 0) { throw BLASError(StatusCode::kInvalidDimension); }
+
+  // Tests the vectors for validity: vectors that are written are tested as vector Y, others as X
+  if (buffers.size() != num_vectors_ || offsets.size() != num_vectors_ ||
+      incs.size() != num_vectors_) {
+    throw BLASError(StatusCode::kInvalidValue, "number of buffers, offsets and increments differ");
+  }
+  auto num_reductions = size_t{0};
+  for (const auto &step : steps_) {
+    if (StepUsesX(step)) { TestVectorX(n, buffers[step.x], offsets[step.x], incs[step.x]); }
+    if (StepWritesY(step)) { TestVectorY(n, buffers[step.y], offsets[step.y], incs[step.y]); }
+    else { num_reductions++; }
+  }
+  if (num_reductions > 0) { TestVectorScalar(num_reductions, result_buffer, result_offset); }
+
+  // Retrieves the main kernel from the compiled binary and sets its arguments
+  auto kernel1 = Kernel(program_, "XfusedMain");
+  auto arg_id = 0;
+  kernel1.SetArgument(arg_id++, static_cast<int>(n));
+  for (const auto &step : steps_) {
+    if (StepHasAlpha(step)) { kernel1.SetArgument(arg_id++, GetRealArg(step.alpha)); }
+  }
+  for (auto v = size_t{0}; v < num_vectors_; ++v) {
+    kernel1.SetArgument(arg_id++, buffers[v]());
+    kernel1.SetArgument(arg_id++, static_cast<int>(offsets[v]));
+    kernel1.SetArgument(arg_id++, static_cast<int>(incs[v]));
+  }
+
+  // The number of workgroups, each computing an intermediate value for each reduction
+  auto temp_size = 2*db_["WGS2"];
+  auto global1 = std::vector<size_t>{db_["WGS1"]*temp_size};
+  auto local1 = std::vector<size_t>{db_["WGS1"]};
+
+  // Without reductions, only the main kernel is launched
+  if (num_reductions == 0) {
+    RunKernel(kernel1, queue_, device_, global1, local1, event_);
+    return;
+  }
+
+  // Creates the buffer for intermediate values
+  auto temp_buffer = Buffer<T>(context_, num_reductions*temp_size);
+  kernel1.SetArgument(arg_id++, temp_buffer());
+
+  // Launches the main kernel
+  auto eventWaitList = std::vector<Event>();
+  auto kernelEvent = Event();
+  RunKernel(kernel1, queue_, device_, global1, local1, kernelEvent.pointer());
+  eventWaitList.push_back(kernelEvent);
+
+  // Sets the arguments for the epilogue kernel and launches it
+  auto kernel2 = Kernel(program_, "XfusedEpilogue");
+  kernel2.SetArgument(0, temp_buffer());
+  kernel2.SetArgument(1, result_buffer());
+  kernel2.SetArgument(2, static_cast<int>(result_offset));
+  auto global2 = std::vector<size_t>{num_reductions*db_["WGS2"]};
+  auto local2 = std::vector<size_t>{db_["WGS2"]};
+  RunKernel(kernel2, queue_, device_, global2, local2, event_, eventWaitList);
+}
+
+// =================================================================================================
+
+// Compiles the templated class
+template class Xfused<half>;
+template class Xfused<float>;
+template class Xfused<double>;
+
+// =================================================================================================
+} // namespace clblast
@@ -0,0 +1,62 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xfused routine, evaluating a chain of level-1 vector operations with a
+// single generated kernel (non-BLAS). The kernel source is generated from the chain of steps and
+// the routine name is the signature of the chain, such that the compiled program is cached per
+// signature and the source code is only generated for programs that are not cached yet. The scalars
+// are kernel arguments and are not part of the signature. The precision is implemented using a
+// template argument.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_ROUTINES_XFUSED_H_
+#define CLBLAST_ROUTINES_XFUSED_H_
+
+#include <string>
+#include <vector>
+
+#include "routine.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T>
+class Xfused: public Routine {
+ public:
+
+  // Constructor: generates and compiles (or retrieves from the cache) the kernel for these steps
+  Xfused(Queue &queue, EventPointer event, const std::vector<VectorStep<T>> &steps,
+         const size_t num_vectors);
+
+  // Templated-precision implementation of the routine
+  void DoFused(const size_t n,
+               const std::vector<Buffer<T>> &buffers,
+               const std::vector<size_t> &offsets, const std::vector<size_t> &incs,
+               const Buffer<T> &result_buffer, const size_t result_offset);
+
+  // Retrieves the signature of a chain of steps, used as the routine name. Throws if the steps are
+  // invalid, e.g. if they refer to a non-existing vector.
+  static std::string Signature(const std::vector<VectorStep<T>> &steps, const size_t num_vectors);
+
+  // Generates the OpenCL source code of the main and epilogue kernels for a chain of steps
+  static std::string GenerateSource(const std::vector<VectorStep<T>> &steps,
+                                    const size_t num_vectors);
+
+ private:
+  const std::vector<VectorStep<T>> steps_;
+  const size_t num_vectors_;
+};
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_ROUTINES_XFUSED_H_
+#endif
@@ -189,7 +189,6 @@ void XgemmBatched<T>::BatchedGemmIndirect(const size_t m, const size_t n, const
 
   // Events of all kernels (including pre/post processing kernels)
   auto eventWaitList = std::vector<Event>();
-  auto emptyEventList = std::vector<Event>();
 
   // Runs the pre-processing kernel for matrix A. This transposes the matrix, but also pads zeros
   // to fill it up until it reaches a certain multiple of size (kernel parameter dependent). In
@@ -200,7 +199,8 @@ void XgemmBatched<T>::BatchedGemmIndirect(const size_t m, const size_t n, const
     a_offsets_device.Write(queue_, batch_count, a_offsets);
     a_offsets_i_device.Write(queue_, batch_count, a_offsets_i);
     auto eventProcessA = Event();
-    PadCopyTransposeMatrixBatched(queue_, device_, db_, eventProcessA.pointer(), emptyEventList,
+    PadCopyTransposeMatrixBatched(IndependentQueue(0), device_, db_,
+                                  eventProcessA.pointer(), IndependentWaitList(0),
                                   a_one, a_two, a_ld, a_offsets_device, a_buffer,
                                   a_one_i, a_two_i, a_one_i, a_offsets_i_device, a_temp,
                                   program_, true, a_do_transpose, a_conjugate, batch_count);
@@ -214,7 +214,8 @@ void XgemmBatched<T>::BatchedGemmIndirect(const size_t m, const size_t n, const
     b_offsets_device.Write(queue_, batch_count, b_offsets);
     b_offsets_i_device.Write(queue_, batch_count, b_offsets_i);
     auto eventProcessB = Event();
-    PadCopyTransposeMatrixBatched(queue_, device_, db_, eventProcessB.pointer(), emptyEventList,
+    PadCopyTransposeMatrixBatched(IndependentQueue(1), device_, db_,
+                                  eventProcessB.pointer(), IndependentWaitList(1),
                                   b_one, b_two, b_ld, b_offsets_device, b_buffer,
                                   b_one_i, b_two_i, b_one_i, b_offsets_i_device, b_temp,
                                   program_, true, b_do_transpose, b_conjugate, batch_count);
@@ -228,7 +229,8 @@ void XgemmBatched<T>::BatchedGemmIndirect(const size_t m, const size_t n, const
     c_offsets_device.Write(queue_, batch_count, c_offsets);
     c_offsets_i_device.Write(queue_, batch_count, c_offsets_i);
     auto eventProcessC = Event();
-    PadCopyTransposeMatrixBatched(queue_, device_, db_, eventProcessC.pointer(), emptyEventList,
+    PadCopyTransposeMatrixBatched(IndependentQueue(2), device_, db_,
+                                  eventProcessC.pointer(), IndependentWaitList(2),
                                   c_one, c_two, c_ld, c_offsets_device, c_buffer,
                                   c_one_i, c_two_i, c_one_i, c_offsets_i_device, c_temp,
                                   program_, true, c_do_transpose, false, batch_count);
@@ -26,7 +26,7 @@ namespace clblast {
 // Constructor: forwards to base class constructor
 template <typename T>
 Xinvert<T>::Xinvert(Queue &queue, EventPointer event, const std::string &name):
-    Routine(queue, event, name, {"Invert"}, PrecisionValue<T>(), {}, {
+    Routine(queue, event, name, {"Invert", "Fill"}, PrecisionValue<T>(), {}, {
     #include "../../kernels/level3/level3.opencl"
     #include "../../kernels/level3/invert_diagonal_blocks.opencl"
     }) {
@@ -48,7 +48,7 @@ void Xinvert<T>::InvertMatrixDiagonalBlocks(const Layout layout, const Triangle
 
   // Helper variables
   const auto internal_block_size = static_cast<size_t>(db_["INTERNAL_BLOCK_SIZE"]);
-  assert(internal_block_size == 16);
+  assert(internal_block_size == 16 || internal_block_size == 32 || internal_block_size == 64);
   const auto num_blocks = CeilDiv(n, block_size);
   const auto num_internal_blocks = CeilDiv(n, internal_block_size);
   const auto unit_diagonal = (diag == Diagonal::kUnit) ? true : false;
@@ -91,7 +91,7 @@ void Xinvert<T>::InvertMatrixDiagonalBlocks(const Layout layout, const Triangle
   auto base_kernel_event = Event();
   auto base_kernel_event_pointer = (internal_block_size == block_size) ? event_ : base_kernel_event.pointer();
   RunKernel(kernel, queue_, device_, global, local, base_kernel_event_pointer, event_wait_list);
-  if (internal_block_size == block_size) { event_wait_list.push_back(base_kernel_event); }
+  if (internal_block_size != block_size) { event_wait_list.push_back(base_kernel_event); }
 
   // Builds up block_size x block_size blocks. For example, internal_block_size=16:
   // use   16 x 16  blocks to build  32 x 32  blocks,  1 x (1 x npages) grid,  4 x 4 threads;
@@ -120,8 +120,9 @@ void Xinvert<T>::InvertMatrixDiagonalBlocks(const Layout layout, const Triangle
     RunKernel(kernel1, queue_, device_, global, local, kernel1_event.pointer(), event_wait_list);
     event_wait_list.push_back(kernel1_event);
 
-    // Part 2
-    const bool is_last_kernel = (current_size * 2 >= block_size);
+    // Part 2. This is the last kernel if the blocks are complete or if they reach beyond the bounds
+    // of the input matrix (see below), in which case it signals the event of this routine.
+    const bool is_last_kernel = (current_size * 2 >= block_size) || (current_size * 2 >= n);
     auto kernel2 = Kernel(program_, "TripleMatMul" + ToString(current_size) + "Part2" + name_postfix);
     kernel2.SetArgument(0, static_cast<int>(n));
     kernel2.SetArgument(1, dest());
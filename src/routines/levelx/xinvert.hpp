@@ -31,6 +31,10 @@ class Xinvert: public Routine {
                                   const size_t n, const size_t block_size,
                                   const Buffer<T> &src, const size_t offset, const size_t ld_src,
                                   Buffer<T> &dest);
+
+  // Retrieves the size of the diagonal blocks inverted by a single work-group: the block size given
+  // to the above method has to be a multiple of it
+  size_t InternalBlockSize() const { return db_["INTERNAL_BLOCK_SIZE"]; }
 };
 
 // =================================================================================================
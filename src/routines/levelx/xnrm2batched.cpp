@@ -0,0 +1,109 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xnrm2Batched class (see the header for information about the class).
+//
+// =================================================================================================
+
+#include "routines/levelx/xnrm2batched.hpp"
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+namespace clblast {
+// =================================================================================================
+
+// Constructor: forwards to base class constructor
+template <typename T>
+Xnrm2Batched<T>::Xnrm2Batched(Queue &queue, EventPointer event, const std::string &name):
+    Routine(queue, event, name, {"XdotBatched"}, PrecisionValue<T>(), {}, {
+    #include "../../kernels/level1/xnrm2.opencl"
+    }) {
+}
+
+// =================================================================================================
+
+// The main routine
+template <typename T>
+void Xnrm2Batched<T>::DoNrm2Batched(const size_t n,
+                                    const Buffer<T> &nrm2_buffer, const std::vector<size_t> &nrm2_offsets,
+                                    const Buffer<T> &x_buffer, const std::vector<size_t> &x_offsets, const size_t x_inc,
+                                    const size_t batch_count) {
+
+  // Tests for a valid batch count
+  if ((batch_count < 1) || (nrm2_offsets.size() != batch_count) || (x_offsets.size() != batch_count)) {
+    throw BLASError(StatusCode::kInvalidBatchCount);
+  }
+
+  // Makes sure all dimensions are larger than zero
+  if (n == 0) { throw BLASError(StatusCode::kInvalidDimension); }
+
+  // Tests the vectors for validity
+  for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+    TestVectorX(n, x_buffer, x_offsets[batch], x_inc);
+    TestVectorScalar(1, nrm2_buffer, nrm2_offsets[batch]);
+  }
+
+  // Upload the arguments to the device
+  std::vector<int> x_offsets_int(x_offsets.begin(), x_offsets.end());
+  std::vector<int> nrm2_offsets_int(nrm2_offsets.begin(), nrm2_offsets.end());
+  auto x_offsets_device = Buffer<int>(context_, BufferAccess::kReadOnly, batch_count);
+  auto nrm2_offsets_device = Buffer<int>(context_, BufferAccess::kReadOnly, batch_count);
+  x_offsets_device.Write(queue_, batch_count, x_offsets_int);
+  nrm2_offsets_device.Write(queue_, batch_count, nrm2_offsets_int);
+
+  // Retrieves the Xnrm2Batched kernels from the compiled binary
+  auto kernel1 = Kernel(program_, "Xnrm2Batched");
+  auto kernel2 = Kernel(program_, "Xnrm2EpilogueBatched");
+
+  // Creates the buffer for intermediate values (see the XdotBatched routine)
+  const auto num_partials = std::min(CeilDiv(n, db_["WGS1"]), 2*db_["WGS2"]);
+  auto temp_buffer = Buffer<T>(context_, batch_count*num_partials);
+
+  // Sets the kernel arguments
+  kernel1.SetArgument(0, static_cast<int>(n));
+  kernel1.SetArgument(1, x_buffer());
+  kernel1.SetArgument(2, x_offsets_device());
+  kernel1.SetArgument(3, static_cast<int>(x_inc));
+  kernel1.SetArgument(4, temp_buffer());
+
+  // Event waiting list
+  auto eventWaitList = std::vector<Event>();
+
+  // Launches the main kernel
+  auto global1 = std::vector<size_t>{db_["WGS1"]*num_partials, batch_count};
+  auto local1 = std::vector<size_t>{db_["WGS1"], 1};
+  auto kernelEvent = Event();
+  RunKernel(kernel1, queue_, device_, global1, local1, kernelEvent.pointer());
+  eventWaitList.push_back(kernelEvent);
+
+  // Sets the arguments for the epilogue kernel
+  kernel2.SetArgument(0, static_cast<int>(num_partials));
+  kernel2.SetArgument(1, temp_buffer());
+  kernel2.SetArgument(2, nrm2_buffer());
+  kernel2.SetArgument(3, nrm2_offsets_device());
+
+  // Launches the epilogue kernel
+  auto global2 = std::vector<size_t>{db_["WGS2"], batch_count};
+  auto local2 = std::vector<size_t>{db_["WGS2"], 1};
+  RunKernel(kernel2, queue_, device_, global2, local2, event_, eventWaitList);
+}
+
+// =================================================================================================
+
+// Compiles the templated class
+template class Xnrm2Batched<half>;
+template class Xnrm2Batched<float>;
+template class Xnrm2Batched<double>;
+template class Xnrm2Batched<float2>;
+template class Xnrm2Batched<double2>;
+
+// =================================================================================================
+} // namespace clblast
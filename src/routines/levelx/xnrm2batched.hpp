@@ -0,0 +1,43 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xnrm2Batched routine. This is a non-blas batched version of NRM2.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_ROUTINES_XNRM2BATCHED_H_
+#define CLBLAST_ROUTINES_XNRM2BATCHED_H_
+
+#include <vector>
+
+#include "routine.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T>
+class Xnrm2Batched: public Routine {
+ public:
+
+  // Constructor
+  Xnrm2Batched(Queue &queue, EventPointer event, const std::string &name = "NRM2BATCHED");
+
+  // Templated-precision implementation of the routine
+  void DoNrm2Batched(const size_t n,
+                     const Buffer<T> &nrm2_buffer, const std::vector<size_t> &nrm2_offsets,
+                     const Buffer<T> &x_buffer, const std::vector<size_t> &x_offsets, const size_t x_inc,
+                     const size_t batch_count);
+};
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_ROUTINES_XNRM2BATCHED_H_
+#endif
@@ -0,0 +1,165 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file uses the CLTune auto-tuner to tune the fill OpenCL kernels. Two variants are tuned:
+// 1: The matrix version of the kernel (FillMatrix), used by the diagonal block inversion
+// 2: The vector version of the kernel (FillVector), used by the triangular solvers
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+
+#include "utilities/utilities.hpp"
+#include "tuning/tuning.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T, int V>
+class TuneFill {
+ public:
+
+  // The representative kernel and the source code. The kernels are only compiled for the routines
+  // using them, hence the routine defines.
+  static std::string KernelFamily() { return "fill_"+std::to_string(V); }
+  static std::string KernelName() { return (V==1) ? "FillMatrix" : "FillVector"; }
+  static std::string GetSources() {
+    if (V==1) {
+      return
+        #include "../src/kernels/common.opencl"
+        "#define ROUTINE_INVERT\n"
+        #include "../src/kernels/level3/level3.opencl"
+      ;
+    }
+    return
+      #include "../src/kernels/common.opencl"
+      "#define ROUTINE_TRSV\n"
+      #include "../src/kernels/level2/xtrsv.opencl"
+    ;
+  }
+
+  // The list of arguments relevant for this routine
+  static std::vector<std::string> GetOptions() {
+    return (V==1) ? std::vector<std::string>{kArgM, kArgN} : std::vector<std::string>{kArgN};
+  }
+
+  // Tests for valid arguments
+  static void TestValidArguments(const Arguments<T> &) { }
+
+  // Sets the default values for the arguments
+  static size_t DefaultM() { return 1024; }
+  static size_t DefaultN() { return (V==1) ? 1024 : 1024*1024; }
+  static size_t DefaultK() { return 1; } // N/A for this kernel
+  static size_t DefaultBatchCount() { return 1; } // N/A for this kernel
+  static double DefaultFraction() { return 1.0; } // N/A for this kernel
+  static size_t DefaultNumRuns() { return 10; } // run every kernel this many times for averaging
+
+  // Describes how to obtain the sizes of the buffers
+  static size_t GetSizeX(const Arguments<T> &args) { return (V==1) ? 1 : args.n; }
+  static size_t GetSizeY(const Arguments<T> &) { return 1; } // N/A for this kernel
+  static size_t GetSizeA(const Arguments<T> &args) { return (V==1) ? args.m * args.n : 1; }
+  static size_t GetSizeB(const Arguments<T> &) { return 1; } // N/A for this kernel
+  static size_t GetSizeC(const Arguments<T> &) { return 1; } // N/A for this kernel
+  static size_t GetSizeTemp(const Arguments<T> &) { return 1; } // N/A for this kernel
+
+  // Sets the tuning parameters and their possible values
+  static void SetParameters(cltune::Tuner &tuner, const size_t id) {
+    if (V==1) {
+      tuner.AddParameter(id, "FILL_DIMX", {8, 16, 32, 64});
+      tuner.AddParameter(id, "FILL_DIMY", {1, 2, 4, 8, 16, 32});
+    }
+    else {
+      tuner.AddParameter(id, "FILL_WGS", {32, 64, 128, 256, 512, 1024});
+    }
+  }
+
+  // Sets the constraints and local memory size
+  static void SetConstraints(cltune::Tuner &, const size_t) { }
+  static void SetLocalMemorySize(cltune::Tuner &, const size_t, const Arguments<T> &) { }
+
+  // Sets the base thread configuration
+  static std::vector<size_t> GlobalSize(const Arguments<T> &args) {
+    return (V==1) ? std::vector<size_t>{args.m, args.n} : std::vector<size_t>{args.n};
+  }
+  static std::vector<size_t> GlobalSizeRef(const Arguments<T> &args) { return GlobalSize(args); }
+  static std::vector<size_t> LocalSize() {
+    return (V==1) ? std::vector<size_t>{1, 1} : std::vector<size_t>{1};
+  }
+  static std::vector<size_t> LocalSizeRef() {
+    return (V==1) ? std::vector<size_t>{8, 8} : std::vector<size_t>{64};
+  }
+
+  // Transforms the thread configuration based on the parameters
+  using TransformVector = std::vector<std::vector<std::string>>;
+  static TransformVector MulLocal() {
+    return (V==1) ? TransformVector{{"FILL_DIMX", "FILL_DIMY"}} : TransformVector{{"FILL_WGS"}};
+  }
+  static TransformVector DivLocal() { return {}; }
+  static TransformVector MulGlobal() { return {}; }
+  static TransformVector DivGlobal() { return {}; }
+
+  // Sets the kernel's arguments
+  static void SetArguments(cltune::Tuner &tuner, const Arguments<T> &args,
+                           std::vector<T> &x_vec, std::vector<T> &,
+                           std::vector<T> &a_mat, std::vector<T> &, std::vector<T> &,
+                           std::vector<T> &) {
+    if (V==1) {
+      tuner.AddArgumentScalar(static_cast<int>(args.m));
+      tuner.AddArgumentScalar(static_cast<int>(args.n));
+      tuner.AddArgumentScalar(static_cast<int>(args.m)); // leading dimension
+      tuner.AddArgumentScalar(0);
+      tuner.AddArgumentOutput(a_mat);
+    }
+    else {
+      tuner.AddArgumentScalar(static_cast<int>(args.n));
+      tuner.AddArgumentScalar(1);
+      tuner.AddArgumentScalar(0);
+      tuner.AddArgumentOutput(x_vec);
+    }
+    tuner.AddArgumentScalar(GetRealArg(GetScalar<T>()));
+  }
+
+  // Describes how to compute the performance metrics
+  static size_t GetMetric(const Arguments<T> &args) {
+    return (V==1) ? args.m * args.n * GetBytes(args.precision) : args.n * GetBytes(args.precision);
+  }
+  static std::string PerformanceUnit() { return "GB/s"; }
+};
+
+// =================================================================================================
+} // namespace clblast
+
+// Shortcuts to the clblast namespace
+using half = clblast::half;
+using float2 = clblast::float2;
+using double2 = clblast::double2;
+
+// Function to tune a specific variation V (not within the clblast namespace)
+template <int V>
+void StartVariation(int argc, char *argv[]) {
+  const auto command_line_args = clblast::RetrieveCommandLineArguments(argc, argv);
+  switch(clblast::GetPrecision(command_line_args)) {
+    case clblast::Precision::kHalf: clblast::Tuner<clblast::TuneFill<half,V>, half>(argc, argv); break;
+    case clblast::Precision::kSingle: clblast::Tuner<clblast::TuneFill<float,V>, float>(argc, argv); break;
+    case clblast::Precision::kDouble: clblast::Tuner<clblast::TuneFill<double,V>, double>(argc, argv); break;
+    case clblast::Precision::kComplexSingle: clblast::Tuner<clblast::TuneFill<float2,V>, float2>(argc, argv); break;
+    case clblast::Precision::kComplexDouble: clblast::Tuner<clblast::TuneFill<double2,V>, double2>(argc, argv); break;
+  }
+}
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  StartVariation<1>(argc, argv);
+  StartVariation<2>(argc, argv);
+  return 0;
+}
+
+// =================================================================================================
@@ -0,0 +1,153 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file uses the CLTune auto-tuner to tune the skinny xgemm kernel. It is tuned for a tall
+// matrix A multiplied with a matrix B of only a few columns ('n'), all stored column-major.
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+
+#include "utilities/utilities.hpp"
+#include "tuning/tuning.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T>
+class TuneXgemmSkinny {
+ public:
+
+  // The representative kernel and the source code
+  static std::string KernelFamily() { return "xgemm_skinny"; }
+  static std::string KernelName() { return "XgemmSkinny"; }
+  static std::string GetSources() {
+    return
+      #include "../src/kernels/common.opencl"
+      #include "../src/kernels/level3/xgemm_skinny.opencl"
+    ;
+  }
+
+  // The list of arguments relevant for this routine
+  static std::vector<std::string> GetOptions() { return {kArgM, kArgN, kArgK, kArgAlpha, kArgBeta}; }
+
+  // Tests for valid arguments
+  static void TestValidArguments(const Arguments<T> &args) {
+    if (!IsMultiple(args.m, 256)) {
+      throw std::runtime_error("'XgemmSkinny' requires 'm' to be a multiple of 256");
+    }
+    if (!IsMultiple(args.n, 32)) {
+      throw std::runtime_error("'XgemmSkinny' requires 'n' to be a multiple of 32");
+    }
+  }
+
+  // Sets the default values for the arguments
+  static size_t DefaultM() { return 2048; }
+  static size_t DefaultN() { return 32; }
+  static size_t DefaultK() { return 2048; }
+  static size_t DefaultBatchCount() { return 1; } // N/A for this kernel
+  static double DefaultFraction() { return 1.0; } // N/A for this kernel
+  static size_t DefaultNumRuns() { return 10; } // run every kernel this many times for averaging
+
+  // Describes how to obtain the sizes of the buffers
+  static size_t GetSizeX(const Arguments<T> &) { return 1; } // N/A for this kernel
+  static size_t GetSizeY(const Arguments<T> &) { return 1; } // N/A for this kernel
+  static size_t GetSizeA(const Arguments<T> &args) { return args.m * args.k; }
+  static size_t GetSizeB(const Arguments<T> &args) { return args.n * args.k; }
+  static size_t GetSizeC(const Arguments<T> &args) { return args.m * args.n; }
+  static size_t GetSizeTemp(const Arguments<T> &) { return 1; } // N/A for this kernel
+
+  // Sets the tuning parameters and their possible values
+  static void SetParameters(cltune::Tuner &tuner, const size_t id) {
+    tuner.AddParameter(id, "SKINNY_WGS", {32, 64, 128, 256});
+    tuner.AddParameter(id, "SKINNY_NWI", {4, 8, 16, 32});
+  }
+
+  // Sets the constraints and local memory size
+  static void SetConstraints(cltune::Tuner &, const size_t) { }
+  static void SetLocalMemorySize(cltune::Tuner &tuner, const size_t id, const Arguments<T> &args) {
+    // A panel of B plus a padded tile of 16 columns of a transposed A (SKINNY_TILE_K)
+    auto LocalMemorySize = [args] (std::vector<size_t> v) {
+      return v[0]*(v[1] + 16 + 1)*GetBytes(args.precision);
+    };
+    tuner.SetLocalMemoryUsage(id, LocalMemorySize, {"SKINNY_WGS", "SKINNY_NWI"});
+  }
+
+  // Sets the base thread configuration (the reference uses the kernel's default SKINNY_NWI of 16)
+  static std::vector<size_t> GlobalSize(const Arguments<T> &args) { return {args.m * args.n}; }
+  static std::vector<size_t> GlobalSizeRef(const Arguments<T> &args) {
+    return {args.m * CeilDiv(args.n, 16)};
+  }
+  static std::vector<size_t> LocalSize() { return {1}; }
+  static std::vector<size_t> LocalSizeRef() { return {64}; }
+
+  // Transforms the thread configuration based on the parameters
+  using TransformVector = std::vector<std::vector<std::string>>;
+  static TransformVector MulLocal() { return {{"SKINNY_WGS"}}; }
+  static TransformVector DivLocal() { return {}; }
+  static TransformVector MulGlobal() { return {}; }
+  static TransformVector DivGlobal() { return {{"SKINNY_NWI"}}; }
+
+  // Sets the kernel's arguments
+  static void SetArguments(cltune::Tuner &tuner, const Arguments<T> &args,
+                           std::vector<T> &, std::vector<T> &,
+                           std::vector<T> &a_mat, std::vector<T> &b_mat, std::vector<T> &c_mat,
+                           std::vector<T> &) {
+    tuner.AddArgumentScalar(static_cast<int>(args.m));
+    tuner.AddArgumentScalar(static_cast<int>(args.n));
+    tuner.AddArgumentScalar(static_cast<int>(args.k));
+    tuner.AddArgumentScalar(GetRealArg(args.alpha));
+    tuner.AddArgumentScalar(GetRealArg(args.beta));
+    tuner.AddArgumentInput(a_mat);
+    tuner.AddArgumentScalar(0); // a_offset
+    tuner.AddArgumentScalar(static_cast<int>(args.m)); // a_ld
+    tuner.AddArgumentInput(b_mat);
+    tuner.AddArgumentScalar(0); // b_offset
+    tuner.AddArgumentScalar(static_cast<int>(args.k)); // b_ld
+    tuner.AddArgumentOutput(c_mat);
+    tuner.AddArgumentScalar(0); // c_offset
+    tuner.AddArgumentScalar(static_cast<int>(args.m)); // c_ld
+    tuner.AddArgumentScalar(0); // a_transpose
+    tuner.AddArgumentScalar(1); // b_transpose
+    tuner.AddArgumentScalar(0); // c_transpose
+    tuner.AddArgumentScalar(0); // a_conjugate
+    tuner.AddArgumentScalar(0); // b_conjugate
+  }
+
+  // Describes how to compute the performance metrics
+  static size_t GetMetric(const Arguments<T> &args) {
+    return 2 * args.m * args.n * args.k;
+  }
+  static std::string PerformanceUnit() { return "GFLOPS"; }
+};
+
+// =================================================================================================
+} // namespace clblast
+
+// Shortcuts to the clblast namespace
+using half = clblast::half;
+using float2 = clblast::float2;
+using double2 = clblast::double2;
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  const auto command_line_args = clblast::RetrieveCommandLineArguments(argc, argv);
+  switch(clblast::GetPrecision(command_line_args)) {
+    case clblast::Precision::kHalf: clblast::Tuner<clblast::TuneXgemmSkinny<half>, half>(argc, argv); break;
+    case clblast::Precision::kSingle: clblast::Tuner<clblast::TuneXgemmSkinny<float>, float>(argc, argv); break;
+    case clblast::Precision::kDouble: clblast::Tuner<clblast::TuneXgemmSkinny<double>, double>(argc, argv); break;
+    case clblast::Precision::kComplexSingle: clblast::Tuner<clblast::TuneXgemmSkinny<float2>, float2>(argc, argv); break;
+    case clblast::Precision::kComplexDouble: clblast::Tuner<clblast::TuneXgemmSkinny<double2>, double2>(argc, argv); break;
+  }
+  return 0;
+}
+
+// =================================================================================================
@@ -0,0 +1,151 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file uses the CLTune auto-tuner to tune the batched xgemv OpenCL kernel. This is the full
+// version of the xgemv kernel, running many (small) matrix-vector multiplications in one launch.
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+
+#include "utilities/utilities.hpp"
+#include "tuning/tuning.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T>
+class TuneXgemvBatched {
+ public:
+
+  // The representative kernel and the source code
+  static std::string KernelFamily() { return "xgemv_batched"; }
+  static std::string KernelName() { return "XgemvBatched"; }
+  static std::string GetSources() {
+    return
+      #include "../src/kernels/common.opencl"
+      #include "../src/kernels/level2/xgemv.opencl"
+    ;
+  }
+
+  // The list of arguments relevant for this routine
+  static std::vector<std::string> GetOptions() {
+    return {kArgM, kArgN, kArgAlpha, kArgBeta, kArgBatchCount};
+  }
+
+  // Tests for valid arguments
+  static void TestValidArguments(const Arguments<T> &) { }
+
+  // Sets the default values for the arguments
+  static size_t DefaultM() { return 1024; }
+  static size_t DefaultN() { return 256; }
+  static size_t DefaultK() { return 1; } // N/A for this kernel
+  static size_t DefaultBatchCount() { return 16; }
+  static double DefaultFraction() { return 1.0; } // N/A for this kernel
+  static size_t DefaultNumRuns() { return 10; } // run every kernel this many times for averaging
+
+  // Describes how to obtain the sizes of the buffers
+  static size_t GetSizeX(const Arguments<T> &args) { return args.n * args.batch_count; }
+  static size_t GetSizeY(const Arguments<T> &args) { return args.m * args.batch_count; }
+  static size_t GetSizeA(const Arguments<T> &args) { return args.m * args.n * args.batch_count; }
+  static size_t GetSizeB(const Arguments<T> &) { return 1; } // N/A for this kernel
+  static size_t GetSizeC(const Arguments<T> &) { return 1; } // N/A for this kernel
+  static size_t GetSizeTemp(const Arguments<T> &) { return 1; } // N/A for this kernel
+
+  // Sets the tuning parameters and their possible values
+  static void SetParameters(cltune::Tuner &tuner, const size_t id) {
+    tuner.AddParameter(id, "WGS1", {32, 64, 128, 256});
+    tuner.AddParameter(id, "WPT1", {1, 2, 4});
+  }
+
+  // Sets the constraints and local memory size
+  static void SetConstraints(cltune::Tuner &, const size_t) { }
+  static void SetLocalMemorySize(cltune::Tuner &tuner, const size_t id, const Arguments<T> &args) {
+    auto LocalMemorySize = [args] (std::vector<size_t> v) { return v[0]*GetBytes(args.precision); };
+    tuner.SetLocalMemoryUsage(id, LocalMemorySize, {"WGS1"});
+  }
+
+  // Sets the base thread configuration: the batches are in the second dimension
+  static std::vector<size_t> GlobalSize(const Arguments<T> &args) {
+    return {args.m, args.batch_count};
+  }
+  static std::vector<size_t> GlobalSizeRef(const Arguments<T> &args) { return GlobalSize(args); }
+  static std::vector<size_t> LocalSize() { return {1, 1}; }
+  static std::vector<size_t> LocalSizeRef() { return {64, 1}; }
+
+  // Transforms the thread configuration based on the parameters
+  using TransformVector = std::vector<std::vector<std::string>>;
+  static TransformVector MulLocal() { return {{"WGS1"}}; }
+  static TransformVector DivLocal() { return {}; }
+  static TransformVector MulGlobal() { return {}; }
+  static TransformVector DivGlobal() { return {{"WPT1"}}; }
+
+  // Sets the kernel's arguments
+  static void SetArguments(cltune::Tuner &tuner, const Arguments<T> &args,
+                           std::vector<T> &x_vec, std::vector<T> &y_vec,
+                           std::vector<T> &a_mat, std::vector<T> &, std::vector<T> &,
+                           std::vector<T> &) {
+    auto alphas = std::vector<T>(args.batch_count, args.alpha);
+    auto betas = std::vector<T>(args.batch_count, args.beta);
+    auto a_offsets = std::vector<int>(args.batch_count);
+    auto x_offsets = std::vector<int>(args.batch_count);
+    auto y_offsets = std::vector<int>(args.batch_count);
+    for (auto batch = size_t{0}; batch < args.batch_count; ++batch) {
+      a_offsets[batch] = static_cast<int>(batch * args.m * args.n);
+      x_offsets[batch] = static_cast<int>(batch * args.n);
+      y_offsets[batch] = static_cast<int>(batch * args.m);
+    }
+    tuner.AddArgumentScalar(static_cast<int>(args.m));
+    tuner.AddArgumentScalar(static_cast<int>(args.n));
+    tuner.AddArgumentInput(alphas);
+    tuner.AddArgumentInput(betas);
+    tuner.AddArgumentScalar(0); // a_rotated
+    tuner.AddArgumentInput(a_mat);
+    tuner.AddArgumentInput(a_offsets);
+    tuner.AddArgumentScalar(static_cast<int>(args.m));
+    tuner.AddArgumentInput(x_vec);
+    tuner.AddArgumentInput(x_offsets);
+    tuner.AddArgumentScalar(1);
+    tuner.AddArgumentOutput(y_vec);
+    tuner.AddArgumentInput(y_offsets);
+    tuner.AddArgumentScalar(1);
+    tuner.AddArgumentScalar(0); // Conjugate transpose
+  }
+
+  // Describes how to compute the performance metrics
+  static size_t GetMetric(const Arguments<T> &args) {
+    return (args.m*args.n + 2*args.m + args.n) * args.batch_count * GetBytes(args.precision);
+  }
+  static std::string PerformanceUnit() { return "GB/s"; }
+};
+
+// =================================================================================================
+} // namespace clblast
+
+// Shortcuts to the clblast namespace
+using half = clblast::half;
+using float2 = clblast::float2;
+using double2 = clblast::double2;
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  const auto command_line_args = clblast::RetrieveCommandLineArguments(argc, argv);
+  switch(clblast::GetPrecision(command_line_args)) {
+    case clblast::Precision::kHalf: clblast::Tuner<clblast::TuneXgemvBatched<half>, half>(argc, argv); break;
+    case clblast::Precision::kSingle: clblast::Tuner<clblast::TuneXgemvBatched<float>, float>(argc, argv); break;
+    case clblast::Precision::kDouble: clblast::Tuner<clblast::TuneXgemvBatched<double>, double>(argc, argv); break;
+    case clblast::Precision::kComplexSingle: clblast::Tuner<clblast::TuneXgemvBatched<float2>, float2>(argc, argv); break;
+    case clblast::Precision::kComplexDouble: clblast::Tuner<clblast::TuneXgemvBatched<double2>, double2>(argc, argv); break;
+  }
+  return 0;
+}
+
+// =================================================================================================
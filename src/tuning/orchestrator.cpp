@@ -0,0 +1,331 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the tuning orchestrator, which tunes CLBlast for all OpenCL devices of a
+// system in one go. It runs all tuners (see 'tuning.hpp') for all precisions, with one worker per
+// device such that the devices are tuned in parallel. The tuners run as separate processes in a
+// directory per device: they write their results to the current directory and CLTune is not meant
+// to be used by multiple threads. The completed tuning runs are recorded per device, such that an
+// interrupted orchestrator continues where it left off when started again. Finally, the best results
+// of the tuning runs are merged per kernel and collected in a single directory, which is ready to be
+// loaded at run-time with 'LoadTuningResults' or through the CLBLAST_TUNING_RESULTS variable.
+//
+// All tuning runs share an on-disk compilation cache (see 'compilation_cache.hpp'), such that the
+// programs compiled by the routine-level tuners are re-used when the orchestrator is started again.
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <fstream>
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+
+#if defined(_WIN32)
+  #include <direct.h>
+#else
+  #include <sys/stat.h>
+  #include <unistd.h>
+#endif
+
+#include "utilities/utilities.hpp"
+#include "database/tuning_results.hpp"
+#include "compilation_cache.hpp"
+
+// The names of the compiled tuners as comma-separated lists, set by CMake
+#ifndef CLBLAST_KERNEL_TUNERS
+  #define CLBLAST_KERNEL_TUNERS ""
+#endif
+#ifndef CLBLAST_ROUTINE_TUNERS
+  #define CLBLAST_ROUTINE_TUNERS ""
+#endif
+
+namespace clblast {
+// =================================================================================================
+
+// Command-line arguments of the orchestrator
+constexpr auto kArgOutput = "output";
+constexpr auto kArgTunerDir = "tuner_dir";
+constexpr auto kArgTunerArgs = "tuner_args";
+
+// The precisions to tune for, as for the 'alltuners' target. The routine-level tuners don't
+// support half-precision.
+const std::vector<Precision> kTuningPrecisions = {
+  Precision::kSingle, Precision::kDouble, Precision::kComplexSingle, Precision::kComplexDouble,
+  Precision::kHalf
+};
+
+// The file in each device's directory with the device name and the completed tuning runs, and the
+// directory with the collected results of all devices
+const std::string kProgressFile = "progress.txt";
+const std::string kOverlayDirectory = "overlay";
+
+// The directory of the compilation cache shared by all tuning runs, unless set by the user
+const std::string kCompilationCacheDirectory = "compilation_cache";
+
+#if defined(_WIN32)
+  const std::string kPathSeparator = "\\";
+#else
+  const std::string kPathSeparator = "/";
+#endif
+
+// A single tuning run: one tuner binary for one precision
+struct TuningJob {
+  std::string executable; // e.g. 'clblast_tuner_xgemm'
+  Precision precision;
+  std::string Name() const { return executable + "_" + ToString(static_cast<size_t>(precision)); }
+};
+
+// A device to tune, with the directory holding its results
+struct TuningDevice {
+  size_t platform_id;
+  size_t device_id;
+  std::string name;
+  std::string directory_name; // e.g. 'platform0_device1'
+  std::string directory;
+};
+
+// =================================================================================================
+
+// Splits a comma-separated list, skipping empty items
+std::vector<std::string> SplitList(const std::string &list) {
+  auto items = std::vector<std::string>();
+  auto start = size_t{0};
+  while (start <= list.size()) {
+    const auto end = std::min(list.find(',', start), list.size());
+    if (end > start) { items.push_back(list.substr(start, end - start)); }
+    start = end + 1;
+  }
+  return items;
+}
+
+// Creates a directory, doing nothing if it already exists
+void MakeDirectory(const std::string &path) {
+  #if defined(_WIN32)
+    _mkdir(path.c_str());
+  #else
+    mkdir(path.c_str(), 0755);
+  #endif
+}
+
+// Turns a relative path into an absolute one, as the tuners run in the device's directory
+std::string AbsolutePath(const std::string &path) {
+  #if defined(_WIN32)
+    const auto is_absolute = (path.size() >= 2 && path[1] == ':') ||
+                             (!path.empty() && (path[0] == '\\' || path[0] == '/'));
+    char buffer[4096];
+    const auto cwd = _getcwd(buffer, sizeof(buffer));
+  #else
+    const auto is_absolute = (!path.empty() && path[0] == '/');
+    char buffer[4096];
+    const auto cwd = getcwd(buffer, sizeof(buffer));
+  #endif
+  if (is_absolute || cwd == nullptr) { return path; }
+  if (path.empty() || path == ".") { return std::string{cwd}; }
+  return std::string{cwd} + kPathSeparator + path;
+}
+
+// Retrieves the directory part of a path, or an empty string if there is none
+std::string DirectoryOf(const std::string &path) {
+  const auto position = path.find_last_of("/\\");
+  if (position == std::string::npos) { return ""; }
+  return path.substr(0, position);
+}
+
+// =================================================================================================
+
+// Tunes a single device: runs all tuning jobs one after the other, skipping the ones completed
+// earlier according to the device's progress file
+void TuneDevice(const TuningDevice &device, const std::vector<TuningJob> &jobs,
+                const std::string &tuner_dir, const std::string &tuner_args,
+                std::mutex &print_mutex) {
+  auto Print = [&](const std::string &message) {
+    std::lock_guard<std::mutex> lock(print_mutex);
+    printf("[%s] %s\n", device.directory_name.c_str(), message.c_str());
+    fflush(stdout);
+  };
+
+  // Reads the progress file, ignoring it if it was written for another device (e.g. after the
+  // order of the devices changed)
+  const auto progress_filename = device.directory + kPathSeparator + kProgressFile;
+  auto completed_jobs = std::vector<std::string>();
+  {
+    std::ifstream progress_file(progress_filename);
+    auto line = std::string{""};
+    if (std::getline(progress_file, line) && line == device.name) {
+      while (std::getline(progress_file, line)) { completed_jobs.push_back(line); }
+    }
+  }
+  if (completed_jobs.empty()) {
+    std::ofstream progress_file(progress_filename);
+    progress_file << device.name << std::endl;
+  }
+
+  // Runs the tuners for this device
+  auto num_completed = size_t{0};
+  for (const auto &job : jobs) {
+    const auto job_name = job.Name();
+    if (std::find(completed_jobs.begin(), completed_jobs.end(), job_name) != completed_jobs.end()) {
+      Print("Skipping '" + job_name + "': completed in an earlier run");
+      ++num_completed;
+      continue;
+    }
+    const auto executable = (tuner_dir.empty()) ? job.executable
+                                                : tuner_dir + kPathSeparator + job.executable;
+    #if defined(_WIN32)
+      auto command = "cd /d \"" + device.directory + "\" && \"" + executable + "\"";
+    #else
+      auto command = "cd \"" + device.directory + "\" && \"" + executable + "\"";
+    #endif
+    command += " -" + std::string{kArgPlatform} + " " + ToString(device.platform_id);
+    command += " -" + std::string{kArgDevice} + " " + ToString(device.device_id);
+    command += " -" + std::string{kArgPrecision} + " ";
+    command += ToString(static_cast<size_t>(job.precision));
+    if (!tuner_args.empty()) { command += " " + tuner_args; }
+    command += " > \"" + job_name + ".log\" 2>&1";
+    Print("Starting '" + job_name + "'");
+    const auto status = std::system(command.c_str());
+    if (status != 0) {
+      Print("Failed '" + job_name + "' (exit status " + ToString(status) + "), see '" +
+            job_name + ".log'");
+      continue;
+    }
+    std::ofstream progress_file(progress_filename, std::ios::app);
+    progress_file << job_name << std::endl;
+    ++num_completed;
+    Print("Completed '" + job_name + "'");
+  }
+  Print("Done: completed " + ToString(num_completed) + " out of " + ToString(jobs.size()) +
+        " tuning runs");
+}
+
+// Collects the results of all devices in the overlay directory. The results of the tuning runs for
+// the same kernel and precision (e.g. of 'xdot_1' and 'xdot_2') are merged into a single file with
+// a complete set of parameters. Returns the number of files written.
+size_t CollectResults(const std::vector<TuningDevice> &devices, const std::string &overlay_dir) {
+  MakeDirectory(overlay_dir);
+  auto num_files = size_t{0};
+  for (const auto &device : devices) {
+
+    // Skips devices without a directory: nothing was tuned
+    const auto filenames = ListFiles(device.directory);
+    if (filenames.size() == 1 && filenames.front() == device.directory) { continue; }
+    auto errors = std::vector<TuningResultsError>();
+    const auto merged_results = MergeTuningResultsFiles(filenames, errors);
+    for (const auto &error : errors) {
+      printf("* Skipping '%s': not a valid tuning results file (status %d)\n",
+             error.first.c_str(), static_cast<int>(error.second));
+    }
+    for (const auto &merged : merged_results) {
+      const auto precision = merged.result.parameters.at("PRECISION");
+      const auto overlay_filename = overlay_dir + kPathSeparator + device.directory_name +
+                                    "_clblast_" + merged.kernel_name + "_" + ToString(precision) +
+                                    ".json";
+      WriteTuningResultsFile(overlay_filename, merged.metadata, {merged.result});
+      ++num_files;
+    }
+  }
+  return num_files;
+}
+
+// =================================================================================================
+
+// See comment at top of file for a description of the function
+void TuneAllDevices(int argc, char* argv[]) {
+  auto command_line_args = RetrieveCommandLineArguments(argc, argv);
+  auto help = std::string{"* Options given/available:\n"};
+  const auto output_dir = AbsolutePath(GetArgument(command_line_args, help, kArgOutput,
+                                                   std::string{"clblast_tuning"}));
+  const auto default_tuner_dir = DirectoryOf(std::string{argv[0]});
+  const auto tuner_dir_argument = GetArgument(command_line_args, help, kArgTunerDir,
+                                              default_tuner_dir);
+  const auto tuner_dir = (tuner_dir_argument.empty()) ? "" : AbsolutePath(tuner_dir_argument);
+  const auto tuner_args = GetArgument(command_line_args, help, kArgTunerArgs, std::string{""});
+  fprintf(stdout, "%s\n", help.c_str());
+
+  // Lists the tuning jobs: all tuners for all precisions
+  auto jobs = std::vector<TuningJob>();
+  for (const auto &kernel : SplitList(CLBLAST_KERNEL_TUNERS)) {
+    for (const auto precision : kTuningPrecisions) {
+      jobs.push_back({"clblast_tuner_" + kernel, precision});
+    }
+  }
+  for (const auto &routine : SplitList(CLBLAST_ROUTINE_TUNERS)) {
+    for (const auto precision : kTuningPrecisions) {
+      if (precision == Precision::kHalf) { continue; }
+      jobs.push_back({"clblast_tuner_routine_" + routine, precision});
+    }
+  }
+
+  // Lists the devices of all platforms, each with its own directory
+  MakeDirectory(output_dir);
+
+  // Enables the compilation cache for all tuners started from here on
+  const auto cache_dir = output_dir + kPathSeparator + kCompilationCacheDirectory;
+  if (std::getenv(kCompilationCacheVariable.c_str()) == nullptr) {
+    #if defined(_WIN32)
+      _putenv_s(kCompilationCacheVariable.c_str(), cache_dir.c_str());
+    #else
+      setenv(kCompilationCacheVariable.c_str(), cache_dir.c_str(), 0);
+    #endif
+  }
+  auto devices = std::vector<TuningDevice>();
+  const auto platforms = GetAllPlatforms();
+  for (auto platform_id = size_t{0}; platform_id < platforms.size(); ++platform_id) {
+    const auto num_devices = platforms[platform_id].NumDevices();
+    for (auto device_id = size_t{0}; device_id < num_devices; ++device_id) {
+      const auto device = Device(platforms[platform_id], device_id);
+      const auto directory_name = "platform" + ToString(platform_id) +
+                                  "_device" + ToString(device_id);
+      const auto directory = output_dir + kPathSeparator + directory_name;
+      MakeDirectory(directory);
+      devices.push_back({platform_id, device_id, device.Name(), directory_name, directory});
+      printf("* Found device '%s' (%s)\n", device.Name().c_str(), directory_name.c_str());
+    }
+  }
+  printf("* Running %zu tuning runs for each of the %zu devices\n\n", jobs.size(), devices.size());
+
+  // Tunes all devices in parallel: one worker per device
+  std::mutex print_mutex;
+  auto workers = std::vector<std::thread>();
+  for (const auto &device : devices) {
+    workers.push_back(std::thread(TuneDevice, std::cref(device), std::cref(jobs),
+                                  std::cref(tuner_dir), std::cref(tuner_args),
+                                  std::ref(print_mutex)));
+  }
+  for (auto &worker : workers) { worker.join(); }
+
+  // Collects the results of all devices
+  const auto overlay_dir = output_dir + kPathSeparator + kOverlayDirectory;
+  const auto num_files = CollectResults(devices, overlay_dir);
+  printf("\n* Collected the best results of %zu kernels in '%s'\n", num_files,
+         overlay_dir.c_str());
+
+  // Verifies that the collected results can be loaded
+  const auto status = LoadTuningResults(overlay_dir);
+  if (status != StatusCode::kSuccess) {
+    printf("* Error %d while loading the collected results\n", static_cast<int>(status));
+    return;
+  }
+  printf("* Load these with 'LoadTuningResults' or by setting CLBLAST_TUNING_RESULTS\n");
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  clblast::TuneAllDevices(argc, argv);
+  return 0;
+}
+
+// =================================================================================================
@@ -0,0 +1,101 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the common parts of the routine-level tuners. Contrary to the kernel tuners
+// (see 'tuning.hpp'), these don't use CLTune: they run a complete routine through the regular API
+// for each value of a parameter, which is set through 'OverrideParameters'. This is meant for
+// parameters such as block sizes, which influence several kernels (and the amount of work of each
+// of them) at once, such that these can't be tuned per kernel. The results are written in the
+// format of the kernel tuners, such that these can be added to the database in the same way.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_TUNING_ROUTINES_ROUTINE_TUNING_H_
+#define CLBLAST_TUNING_ROUTINES_ROUTINE_TUNING_H_
+
+#include <string>
+#include <vector>
+#include <chrono>
+#include <cstdio>
+
+#include "utilities/utilities.hpp"
+#include "database/tuning_results.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// Runs a routine (given as a function returning a status code) once as a warm-up, e.g. to compile
+// its kernels with the current parameters, and subsequently times it for a number of runs. Stores
+// the average time in milliseconds. Returns the status code of the first failing run, if any.
+template <typename F>
+StatusCode TimeRoutine(const size_t num_runs, const Queue &queue, F routine, double &time_ms) {
+  auto status = routine();
+  if (status != StatusCode::kSuccess) { return status; }
+  queue.Finish();
+  const auto start_time = std::chrono::steady_clock::now();
+  for (auto r = size_t{0}; r < num_runs; ++r) {
+    status = routine();
+    if (status != StatusCode::kSuccess) { return status; }
+  }
+  queue.Finish();
+  const auto elapsed_time = std::chrono::steady_clock::now() - start_time;
+  const auto time_total = std::chrono::duration<double, std::milli>(elapsed_time).count();
+  time_ms = time_total / static_cast<double>(num_runs);
+  return StatusCode::kSuccess;
+}
+
+// Collects the meta-data of a tuning run as written by CLTune for the kernel tuners
+template <typename T>
+Metadata RoutineTuningMetadata(const Device &device, const std::string &kernel_family) {
+  return {
+    {"kernel_family", kernel_family},
+    {"precision", std::to_string(static_cast<size_t>(PrecisionValue<T>()))},
+    {"device", device.Name()},
+    {"device_vendor", device.Vendor()},
+    {"device_type", device.Type()},
+    {"device_core_clock", std::to_string(device.CoreClock())},
+    {"device_compute_units", std::to_string(device.ComputeUnits())}
+  };
+}
+
+// Creates a result as read from a tuner's JSON file. As there is no single OpenCL kernel, the
+// 'kernel' field holds the name of the tuned routine instead.
+template <typename T>
+TuningResult RoutineTuningResult(const std::string &routine_name, const double time_ms,
+                                 const Database::Parameters &parameters) {
+  auto result = TuningResult{routine_name, time_ms, parameters};
+  result.parameters["PRECISION"] = static_cast<size_t>(PrecisionValue<T>());
+  return result;
+}
+
+// Writes the results of a routine-level tuner to disk and prints the best result to screen
+inline void PrintRoutineTuningResults(const std::string &filename, const Metadata &metadata,
+                                      const std::vector<TuningResult> &results) {
+  if (results.empty()) {
+    printf("* No valid configurations found, not writing '%s'\n", filename.c_str());
+    return;
+  }
+  auto best = results.front();
+  for (const auto &result : results) {
+    if (result.time < best.time) { best = result; }
+  }
+  printf("* Best configuration (%.3lf ms):", best.time);
+  for (const auto &parameter : best.parameters) {
+    if (parameter.first == "PRECISION") { continue; }
+    printf(" %s=%zu", parameter.first.c_str(), parameter.second);
+  }
+  printf("\n* Writing results to '%s'\n", filename.c_str());
+  WriteTuningResultsFile(filename, metadata, results);
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_TUNING_ROUTINES_ROUTINE_TUNING_H_
+#endif
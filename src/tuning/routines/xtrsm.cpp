@@ -0,0 +1,173 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file tunes the block sizes of the TRSM routine: the size of the diagonal blocks which are
+// inverted (TRSM_BLOCK_SIZE) and the size of the blocks inverted by a single work-group within
+// those (INTERNAL_BLOCK_SIZE of the 'Invert' kernels). The first has to be a multiple of the
+// second and determines the sizes of the GEMM calls, so both are tuned together on the level of
+// the routine (see 'routine_tuning.hpp'). The best pair is written as two files: one per kernel.
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+#include <random>
+#include <cstdio>
+#include <cstdlib>
+#include <limits>
+#include <stdexcept>
+
+#include "utilities/utilities.hpp"
+#include "tuning/routines/routine_tuning.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// The block sizes to evaluate. The inversion kernels support block sizes up to 128.
+const std::vector<size_t> kTrsmBlockSizes = {16, 32, 64, 128};
+const std::vector<size_t> kInvertInternalBlockSizes = {16, 32, 64};
+
+// See comment at top of file for a description of the function
+template <typename T>
+void TuneXtrsm(int argc, char* argv[]) {
+  constexpr auto kSeed = 42; // fixed seed for reproducibility
+
+  // Sets the platform/device and the problem size (command-line options)
+  auto command_line_args = RetrieveCommandLineArguments(argc, argv);
+  auto help = std::string{"* Options given/available:\n"};
+  const auto platform_id = GetArgument(command_line_args, help, kArgPlatform, ConvertArgument(std::getenv("CLBLAST_PLATFORM"), size_t{0}));
+  const auto device_id = GetArgument(command_line_args, help, kArgDevice, ConvertArgument(std::getenv("CLBLAST_DEVICE"), size_t{0}));
+  const auto precision = GetArgument(command_line_args, help, kArgPrecision, Precision::kSingle);
+  const auto m = GetArgument(command_line_args, help, kArgM, size_t{1024});
+  const auto n = GetArgument(command_line_args, help, kArgN, size_t{1024});
+  const auto num_runs = GetArgument(command_line_args, help, kArgNumRuns, size_t{10});
+  fprintf(stdout, "%s\n", help.c_str());
+
+  // Initializes the OpenCL device
+  const auto platform = Platform(platform_id);
+  const auto device = Device(platform, device_id);
+  if (!PrecisionSupported<T>(device)) {
+    printf("* Unsupported precision, skipping this tuning run\n\n");
+    return;
+  }
+  const auto context = Context(device);
+  auto queue = Queue(context, device);
+
+  // Creates the triangular matrix (on the left) and the right-hand side matrix with random data
+  auto a_mat = std::vector<T>(m * m);
+  auto b_mat = std::vector<T>(m * n);
+  std::mt19937 mt(kSeed);
+  std::uniform_real_distribution<double> dist(kTestDataLowerLimit, kTestDataUpperLimit);
+  PopulateVector(a_mat, mt, dist);
+  PopulateVector(b_mat, mt, dist);
+  auto a_buffer = Buffer<T>(context, m * m);
+  auto b_buffer = Buffer<T>(context, m * n);
+  a_buffer.Write(queue, m * m, a_mat);
+  b_buffer.Write(queue, m * n, b_mat);
+
+  // The routine to tune: the unit diagonal keeps the solution within range over the runs
+  auto RunRoutine = [&]() -> StatusCode {
+    auto queue_plain = queue();
+    return Trsm(Layout::kColMajor, Side::kLeft, Triangle::kLower, Transpose::kNo, Diagonal::kUnit,
+                m, n, ConstantOne<T>(), a_buffer(), 0, m, b_buffer(), 0, m, &queue_plain);
+  };
+
+  // Runs the routine once, such that the parameters of both kernels are in the cache and can be
+  // overridden
+  const auto status = RunRoutine();
+  if (status != StatusCode::kSuccess) {
+    printf("* Error %d while running TRSM, skipping this tuning run\n\n", static_cast<int>(status));
+    return;
+  }
+
+  // Evaluates all valid combinations of block sizes supported by the device, keeping the best
+  auto best_time_ms = std::numeric_limits<double>::max();
+  auto best_block_size = size_t{0};
+  auto best_internal_block_size = size_t{0};
+  for (const auto internal_block_size : kInvertInternalBlockSizes) {
+    const auto local_memory = internal_block_size * internal_block_size * sizeof(T);
+    if (!device.IsThreadConfigValid({internal_block_size}) ||
+        !device.IsLocalMemoryValid(local_memory)) {
+      printf("* INTERNAL_BLOCK_SIZE=%zu: not supported by the device\n", internal_block_size);
+      continue;
+    }
+    const auto invert_parameters = Database::Parameters{
+      {"INTERNAL_BLOCK_SIZE", internal_block_size}
+    };
+    for (const auto block_size : kTrsmBlockSizes) {
+      if (block_size < internal_block_size || block_size % internal_block_size != 0) { continue; }
+      const auto trsm_parameters = Database::Parameters{{"TRSM_BLOCK_SIZE", block_size}};
+      auto time_ms = 0.0;
+      auto result = OverrideParameters(device(), "Invert", precision, invert_parameters);
+      if (result == StatusCode::kSuccess) {
+        result = OverrideParameters(device(), "Xtrsm", precision, trsm_parameters);
+      }
+      if (result == StatusCode::kSuccess) {
+        result = TimeRoutine(num_runs, queue, RunRoutine, time_ms);
+      }
+      if (result != StatusCode::kSuccess) {
+        printf("* TRSM_BLOCK_SIZE=%zu INTERNAL_BLOCK_SIZE=%zu: error %d\n", block_size,
+               internal_block_size, static_cast<int>(result));
+        continue;
+      }
+      printf("* TRSM_BLOCK_SIZE=%zu INTERNAL_BLOCK_SIZE=%zu: %.3lf ms\n", block_size,
+             internal_block_size, time_ms);
+      if (time_ms < best_time_ms) {
+        best_time_ms = time_ms;
+        best_block_size = block_size;
+        best_internal_block_size = internal_block_size;
+      }
+    }
+  }
+  if (best_block_size == 0) {
+    printf("* No valid block sizes found, skipping this tuning run\n\n");
+    return;
+  }
+
+  // Outputs the best pair of block sizes as JSON to disk, including some meta-data. The two block
+  // sizes are only valid together, so both files hold the same (single) result.
+  printf("* Best: TRSM_BLOCK_SIZE=%zu INTERNAL_BLOCK_SIZE=%zu: %.3lf ms\n", best_block_size,
+         best_internal_block_size, best_time_ms);
+  const auto precision_string = std::to_string(static_cast<size_t>(precision));
+  for (const auto &kernel_family : {std::string{"xtrsm"}, std::string{"invert"}}) {
+    auto metadata = RoutineTuningMetadata<T>(device, kernel_family);
+    metadata.push_back({"arg_m", std::to_string(m)});
+    metadata.push_back({"arg_n", std::to_string(n)});
+    const auto parameters = (kernel_family == "xtrsm") ?
+      Database::Parameters{{"TRSM_BLOCK_SIZE", best_block_size}} :
+      Database::Parameters{{"INTERNAL_BLOCK_SIZE", best_internal_block_size}};
+    const auto results = std::vector<TuningResult>{
+      RoutineTuningResult<T>("TRSM", best_time_ms, parameters)
+    };
+    PrintRoutineTuningResults("clblast_" + kernel_family + "_" + precision_string + ".json",
+                              metadata, results);
+  }
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// Shortcuts to the clblast namespace
+using float2 = clblast::float2;
+using double2 = clblast::double2;
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  const auto command_line_args = clblast::RetrieveCommandLineArguments(argc, argv);
+  switch(clblast::GetPrecision(command_line_args)) {
+    case clblast::Precision::kHalf: throw std::runtime_error("Unsupported precision mode");
+    case clblast::Precision::kSingle: clblast::TuneXtrsm<float>(argc, argv); break;
+    case clblast::Precision::kDouble: clblast::TuneXtrsm<double>(argc, argv); break;
+    case clblast::Precision::kComplexSingle: clblast::TuneXtrsm<float2>(argc, argv); break;
+    case clblast::Precision::kComplexDouble: clblast::TuneXtrsm<double2>(argc, argv); break;
+  }
+  return 0;
+}
+
+// =================================================================================================
@@ -0,0 +1,132 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file tunes the block size of the TRSV routine (TRSV_BLOCK_SIZE). This determines both the
+// size of the diagonal blocks solved by a single work-group and the sizes of the GEMV calls in
+// between, so it is tuned on the level of the routine (see 'routine_tuning.hpp').
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+#include <random>
+#include <cstdio>
+#include <cstdlib>
+#include <stdexcept>
+
+#include "utilities/utilities.hpp"
+#include "tuning/routines/routine_tuning.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// The block sizes to evaluate
+const std::vector<size_t> kTrsvBlockSizes = {16, 32, 64, 128};
+
+// See comment at top of file for a description of the function
+template <typename T>
+void TuneXtrsv(int argc, char* argv[]) {
+  constexpr auto kSeed = 42; // fixed seed for reproducibility
+
+  // Sets the platform/device and the problem size (command-line options)
+  auto command_line_args = RetrieveCommandLineArguments(argc, argv);
+  auto help = std::string{"* Options given/available:\n"};
+  const auto platform_id = GetArgument(command_line_args, help, kArgPlatform, ConvertArgument(std::getenv("CLBLAST_PLATFORM"), size_t{0}));
+  const auto device_id = GetArgument(command_line_args, help, kArgDevice, ConvertArgument(std::getenv("CLBLAST_DEVICE"), size_t{0}));
+  const auto precision = GetArgument(command_line_args, help, kArgPrecision, Precision::kSingle);
+  const auto n = GetArgument(command_line_args, help, kArgN, size_t{4096});
+  const auto num_runs = GetArgument(command_line_args, help, kArgNumRuns, size_t{10});
+  fprintf(stdout, "%s\n", help.c_str());
+
+  // Initializes the OpenCL device
+  const auto platform = Platform(platform_id);
+  const auto device = Device(platform, device_id);
+  if (!PrecisionSupported<T>(device)) {
+    printf("* Unsupported precision, skipping this tuning run\n\n");
+    return;
+  }
+  const auto context = Context(device);
+  auto queue = Queue(context, device);
+
+  // Creates the triangular matrix and the vector with random data
+  auto a_mat = std::vector<T>(n * n);
+  auto x_vec = std::vector<T>(n);
+  std::mt19937 mt(kSeed);
+  std::uniform_real_distribution<double> dist(kTestDataLowerLimit, kTestDataUpperLimit);
+  PopulateVector(a_mat, mt, dist);
+  PopulateVector(x_vec, mt, dist);
+  auto a_buffer = Buffer<T>(context, n * n);
+  auto x_buffer = Buffer<T>(context, n);
+  a_buffer.Write(queue, n * n, a_mat);
+  x_buffer.Write(queue, n, x_vec);
+
+  // The routine to tune: the unit diagonal keeps the solution within range over the runs
+  auto RunRoutine = [&]() -> StatusCode {
+    auto queue_plain = queue();
+    return Trsv<T>(Layout::kColMajor, Triangle::kLower, Transpose::kNo, Diagonal::kUnit, n,
+                   a_buffer(), 0, n, x_buffer(), 0, 1, &queue_plain);
+  };
+
+  // Runs the routine once, such that its parameters are in the cache and can be overridden
+  const auto status = RunRoutine();
+  if (status != StatusCode::kSuccess) {
+    printf("* Error %d while running TRSV, skipping this tuning run\n\n", static_cast<int>(status));
+    return;
+  }
+
+  // Evaluates all block sizes supported by the device
+  auto results = std::vector<TuningResult>();
+  for (const auto block_size : kTrsvBlockSizes) {
+    const auto local_memory = (block_size * block_size + block_size) * sizeof(T);
+    if (!device.IsThreadConfigValid({block_size}) || !device.IsLocalMemoryValid(local_memory)) {
+      printf("* TRSV_BLOCK_SIZE=%zu: not supported by the device\n", block_size);
+      continue;
+    }
+    const auto parameters = Database::Parameters{{"TRSV_BLOCK_SIZE", block_size}};
+    auto time_ms = 0.0;
+    auto result = OverrideParameters(device(), "Xtrsv", precision, parameters);
+    if (result == StatusCode::kSuccess) {
+      result = TimeRoutine(num_runs, queue, RunRoutine, time_ms);
+    }
+    if (result != StatusCode::kSuccess) {
+      printf("* TRSV_BLOCK_SIZE=%zu: error %d\n", block_size, static_cast<int>(result));
+      continue;
+    }
+    printf("* TRSV_BLOCK_SIZE=%zu: %.3lf ms\n", block_size, time_ms);
+    results.push_back(RoutineTuningResult<T>("TRSV", time_ms, parameters));
+  }
+
+  // Outputs the results as JSON to disk, including some meta-data
+  auto metadata = RoutineTuningMetadata<T>(device, "xtrsv");
+  metadata.push_back({"arg_n", std::to_string(n)});
+  const auto precision_string = std::to_string(static_cast<size_t>(precision));
+  PrintRoutineTuningResults("clblast_xtrsv_" + precision_string + ".json", metadata, results);
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// Shortcuts to the clblast namespace
+using float2 = clblast::float2;
+using double2 = clblast::double2;
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  const auto command_line_args = clblast::RetrieveCommandLineArguments(argc, argv);
+  switch(clblast::GetPrecision(command_line_args)) {
+    case clblast::Precision::kHalf: throw std::runtime_error("Unsupported precision mode");
+    case clblast::Precision::kSingle: clblast::TuneXtrsv<float>(argc, argv); break;
+    case clblast::Precision::kDouble: clblast::TuneXtrsv<double>(argc, argv); break;
+    case clblast::Precision::kComplexSingle: clblast::TuneXtrsv<float2>(argc, argv); break;
+    case clblast::Precision::kComplexDouble: clblast::TuneXtrsv<double2>(argc, argv); break;
+  }
+  return 0;
+}
+
+// =================================================================================================
@@ -0,0 +1,120 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the helpers for the search strategies of the tuners (see the header for more
+// information).
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+#include <fstream>
+#include <algorithm>
+
+#include "tuning/search.hpp"
+#include "database/device_matching.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// Collects the parameters of the most similar tuned devices and of the defaults
+std::vector<Database::Parameters> SeedConfigurations(const Device &device,
+                                                     const std::string &kernel_name,
+                                                     const Precision precision,
+                                                     const size_t num_devices) {
+  const auto properties = GetDeviceProperties(device);
+  auto candidates = std::vector<std::pair<int, Database::Parameters>>();
+  auto defaults = std::vector<Database::Parameters>();
+  for (const auto &entry : Database::database) {
+    if (entry.kernel != kernel_name) { continue; }
+    if (entry.precision != precision && entry.precision != Precision::kAny) { continue; }
+    for (const auto &vendor : entry.vendors) {
+      const auto is_general = (vendor.name == Database::kDeviceVendorAll);
+      if (!is_general && (vendor.name != properties.vendor || vendor.type != properties.type)) {
+        continue;
+      }
+      for (const auto &database_device : vendor.devices) {
+        if (database_device.name == "default") {
+          if (is_general) { defaults.push_back(*database_device.parameters); }
+          else { defaults.insert(defaults.begin(), *database_device.parameters); } // vendor first
+          continue;
+        }
+        const auto candidate = DatabaseDeviceProperties(vendor.name, vendor.type,
+                                                        database_device.name);
+        const auto score = DeviceMatchScore(properties, candidate);
+        candidates.push_back({score, *database_device.parameters});
+      }
+    }
+  }
+
+  // Orders the tuned devices by similarity, keeping the database order for equal scores
+  std::stable_sort(candidates.begin(), candidates.end(),
+                   [](const std::pair<int, Database::Parameters> &a,
+                      const std::pair<int, Database::Parameters> &b) { return a.first > b.first; });
+  auto configurations = std::vector<Database::Parameters>();
+  auto AddUnique = [&configurations](const Database::Parameters &parameters) {
+    const auto it = std::find(configurations.begin(), configurations.end(), parameters);
+    if (it == configurations.end()) { configurations.push_back(parameters); }
+  };
+  for (const auto &candidate : candidates) {
+    if (configurations.size() == num_devices) { break; }
+    AddUnique(candidate.second);
+  }
+  for (const auto &parameters : defaults) { AddUnique(parameters); }
+  return configurations;
+}
+
+// =================================================================================================
+
+// Selects the fastest configurations within a factor of the best time
+std::vector<Database::Parameters> ScreenConfigurations(const std::vector<TuningResult> &results,
+                                                       const double best_time,
+                                                       const double factor) {
+  auto sorted_results = results;
+  std::stable_sort(sorted_results.begin(), sorted_results.end(),
+                   [](const TuningResult &a, const TuningResult &b) { return a.time < b.time; });
+  auto configurations = std::vector<Database::Parameters>();
+  for (const auto &result : sorted_results) {
+    if (configurations.size() == kMaxScreenedConfigurations) { break; }
+    if (result.time > factor * best_time) { break; }
+    auto parameters = result.parameters;
+    parameters.erase("PRECISION");
+    configurations.push_back(parameters);
+  }
+  return configurations;
+}
+
+// =================================================================================================
+
+// Loads a checkpoint file, verifying that it belongs to this tuning run
+bool LoadCheckpoint(const std::string &filename, const std::string &device_name,
+                    const std::string &settings, std::vector<TuningResult> &results,
+                    Metadata &metadata) {
+  if (!std::ifstream(filename)) { return false; }
+  auto file_results = std::vector<TuningResult>();
+  auto file_metadata = Metadata();
+  try {
+    file_results = ReadTuningResultsFile(filename, file_metadata);
+  } catch (const RuntimeErrorCode &) {
+    return false; // e.g. a partially written file: the pass is simply run again
+  }
+  auto is_same_device = false;
+  auto is_same_settings = false;
+  for (const auto &item : file_metadata) {
+    if (item.first == "device" && item.second == device_name) { is_same_device = true; }
+    if (item.first == kCheckpointSettings && item.second == settings) { is_same_settings = true; }
+  }
+  if (!is_same_device || !is_same_settings) { return false; }
+  results = file_results;
+  metadata = file_metadata;
+  return true;
+}
+
+// =================================================================================================
+} // namespace clblast
@@ -0,0 +1,80 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the helpers for the search strategies of the tuners (see 'tuning.hpp'): the
+// seed configurations from the parameters of similar devices in the database (evaluated as extra
+// candidates next to the search), the screening of configurations after a single run, and the
+// checkpointing of the individual tuning passes.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_TUNING_SEARCH_H_
+#define CLBLAST_TUNING_SEARCH_H_
+
+#include <string>
+#include <vector>
+#include <utility>
+
+#include "utilities/utilities.hpp"
+#include "database/database.hpp"
+#include "database/tuning_results.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// The search strategies of the tuners. Apart from the full search, these explore only a fraction
+// of the search space as given by the 'fraction' command-line argument.
+const std::string kStrategyFull = "full";           // all configurations
+const std::string kStrategyRandom = "random";       // random sampling
+const std::string kStrategyAnnealing = "annealing"; // simulated annealing
+const std::string kStrategyPSO = "pso";             // particle swarm optimisation
+const std::string kStrategyModel = "model";         // random sampling followed by a model's picks
+
+// Settings of the search strategies as implemented by CLTune
+constexpr auto kAnnealingMaxTemperature = 4.0;
+constexpr auto kPSOSwarms = size_t{3};
+constexpr auto kPSOInfluenceGlobal = 0.4;
+constexpr auto kPSOInfluenceLocal = 0.0;
+constexpr auto kPSOInfluenceRandom = 0.4;
+constexpr auto kModelValidationFraction = 0.1f;
+constexpr auto kModelTestTopConfigurations = size_t{20};
+
+// The maximum number of configurations which are re-run after screening
+constexpr auto kMaxScreenedConfigurations = size_t{32};
+
+// Retrieves the parameters of a kernel in the database for the tuned devices most similar to the
+// given device (see 'device_matching.hpp'), followed by the vendor and the general defaults. As
+// for the look-up at run-time, entries for any precision are used as well. Duplicates are removed,
+// such that each returned configuration is unique.
+std::vector<Database::Parameters> SeedConfigurations(const Device &device,
+                                                     const std::string &kernel_name,
+                                                     const Precision precision,
+                                                     const size_t num_devices);
+
+// Selects the configurations of a single-run tuning pass worth re-running: those at most 'factor'
+// times slower than the best time so far. Returns at most 'kMaxScreenedConfigurations' of them,
+// fastest first, without the 'PRECISION' parameter.
+std::vector<Database::Parameters> ScreenConfigurations(const std::vector<TuningResult> &results,
+                                                       const double best_time,
+                                                       const double factor);
+
+// The meta-data field holding the settings of a checkpointed tuning pass
+const std::string kCheckpointSettings = "checkpoint_settings";
+
+// Loads the results of a completed tuning pass from a checkpoint file. Returns false if there is
+// no such file or if it was written for a different device or with different settings.
+bool LoadCheckpoint(const std::string &filename, const std::string &device_name,
+                    const std::string &settings, std::vector<TuningResult> &results,
+                    Metadata &metadata);
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_TUNING_SEARCH_H_
+#endif
@@ -18,10 +18,16 @@
 #include <vector>
 #include <string>
 #include <random>
+#include <algorithm>
+#include <limits>
+#include <cstdio>
 
 #include <cltune.h>
 
 #include "utilities/utilities.hpp"
+#include "database/database.hpp"
+#include "database/tuning_results.hpp"
+#include "tuning/search.hpp"
 
 namespace clblast {
 // =================================================================================================
@@ -51,15 +57,25 @@ void Tuner(int argc, char* argv[]) {
   }
   const auto num_runs = GetArgument(command_line_args, help, kArgNumRuns, C::DefaultNumRuns());
 
+  // Sets the search strategy and its extensions (command-line options)
+  const auto is_full_search = (args.fraction == 1.0 || args.fraction == 0.0);
+  const auto default_strategy = (is_full_search) ? kStrategyFull : kStrategyRandom;
+  const auto strategy = GetArgument(command_line_args, help, kArgStrategy, default_strategy);
+  const auto seed_devices = GetArgument(command_line_args, help, kArgSeedDevices, size_t{0});
+  const auto screening = GetArgument(command_line_args, help, kArgScreening, 0.0);
+  const auto checkpoint = GetArgument(command_line_args, help, kArgCheckpoint, std::string{""});
+
   fprintf(stdout, "%s\n", help.c_str());
 
   // Tests validity of the given arguments
   C::TestValidArguments(args);
 
-  // Tests for validity of the precision and retrieves properties
+  // Tests for validity of the precision and retrieves properties as well as the seed configurations
   auto isAMD = false;
   auto isARM = false;
   auto isGPU = false;
+  auto device_name = std::string{""};
+  auto seeds = std::vector<Database::Parameters>();
   {
     const auto platform = Platform(args.platform_id);
     const auto device = Device(platform, args.device_id);
@@ -70,6 +86,11 @@ void Tuner(int argc, char* argv[]) {
     isAMD = device.IsAMD();
     isARM = device.IsARM();
     isGPU = device.IsGPU();
+    device_name = device.Name();
+    if (seed_devices != 0) {
+      const auto kernel_name = Database::FamilyKernelName(C::KernelFamily());
+      seeds = SeedConfigurations(device, kernel_name, args.precision, seed_devices);
+    }
   }
 
   // Creates input buffers with random data
@@ -88,18 +109,6 @@ void Tuner(int argc, char* argv[]) {
   PopulateVector(c_mat, mt, dist);
   PopulateVector(temp, mt, dist);
 
-  // Initializes the tuner for the chosen device
-  cltune::Tuner tuner(args.platform_id, args.device_id);
-
-  // Use full-search to explore all parameter combinations or random-search to search only a part of
-  // the parameter values. The fraction is set as a command-line argument.
-  if (args.fraction == 1.0 || args.fraction == 0.0) {
-    tuner.UseFullSearch();
-  }
-  else {
-    tuner.UseRandomSearch(1.0/args.fraction);
-  }
-
   // Set extra settings for specific defines. This mimics src/routine.cc.
   auto defines = std::string{""};
   if (isAMD && isGPU) {
@@ -110,47 +119,90 @@ void Tuner(int argc, char* argv[]) {
     defines += "#define GLOBAL_MEM_FENCE 1\n";
   }
 
-  // Loads the kernel sources and defines the kernel to tune
-  auto sources = defines + C::GetSources();
-  auto id = tuner.AddKernelFromString(sources, C::KernelName(), C::GlobalSize(args), C::LocalSize());
-  tuner.SetReferenceFromString(sources, C::KernelName(), C::GlobalSizeRef(args), C::LocalSizeRef());
-
-  // Sets the tunable parameters and their possible values
-  C::SetParameters(tuner, id);
-  C::SetConstraints(tuner, id);
-  C::SetLocalMemorySize(tuner, id, args);
-
-  // Tests for a specific precision
-  tuner.AddParameter(id, "PRECISION", {static_cast<size_t>(args.precision)});
-  tuner.AddParameterReference("PRECISION", static_cast<size_t>(args.precision));
-
-  // Modifies the thread-sizes (both global and local) based on the parameters
-  for (auto &parameters: C::MulLocal()) { tuner.MulLocalSize(id, parameters); }
-  for (auto &parameters: C::DivLocal()) { tuner.DivLocalSize(id, parameters); }
-  for (auto &parameters: C::MulGlobal()) { tuner.MulGlobalSize(id, parameters); }
-  for (auto &parameters: C::DivGlobal()) { tuner.DivGlobalSize(id, parameters); }
-
-  // Sets the function's arguments
-  C::SetArguments(tuner, args, x_vec, y_vec, a_mat, b_mat, c_mat, temp);
-
-  // Starts the tuning process
-  tuner.SetNumRuns(num_runs);
-  tuner.Tune();
-
-  // Prints the results to screen
-  auto time_ms = tuner.PrintToScreen();
-  tuner.PrintFormatted();
-
-  // Also prints the performance of the best-case in terms of GB/s or GFLOPS
-  if (time_ms != 0.0) {
-    printf("[ -------> ] %.2lf ms", time_ms);
-    printf(" or %.1lf %s\n", C::GetMetric(args)/(time_ms*1.0e6), C::PerformanceUnit().c_str());
+  // Use full-search to explore all parameter combinations or one of the other search strategies to
+  // search only a part of the parameter values. The fraction is set as a command-line argument.
+  auto SetStrategy = [&args](cltune::Tuner &tuner, const std::string &strategy) {
+    const auto fraction = (args.fraction == 0.0) ? 1.0 : 1.0/args.fraction;
+    if (strategy == kStrategyFull) { tuner.UseFullSearch(); }
+    else if (strategy == kStrategyAnnealing) {
+      tuner.UseAnnealing(fraction, kAnnealingMaxTemperature);
+    }
+    else if (strategy == kStrategyPSO) {
+      tuner.UsePSO(fraction, kPSOSwarms, kPSOInfluenceGlobal, kPSOInfluenceLocal,
+                   kPSOInfluenceRandom);
+    }
+    else { tuner.UseRandomSearch(fraction); } // also the first stage of the model-based search
+  };
+
+  // Sets up the kernel: its source, the tunable parameters and their constraints, the threads and
+  // the arguments. For a seed, the parameters are instead fixed to the single given configuration. For
+  // a screened pass, the search space is limited to the given configurations.
+  auto SetUp = [&](cltune::Tuner &tuner, const std::vector<Database::Parameters> &configurations,
+                   const bool is_seed) {
+
+    // Loads the kernel sources and defines the kernel to tune
+    auto sources = defines + C::GetSources();
+    auto id = tuner.AddKernelFromString(sources, C::KernelName(), C::GlobalSize(args), C::LocalSize());
+    tuner.SetReferenceFromString(sources, C::KernelName(), C::GlobalSizeRef(args), C::LocalSizeRef());
+
+    // Sets the tunable parameters and their possible values
+    if (is_seed) {
+      for (const auto &parameter : configurations.front()) {
+        tuner.AddParameter(id, parameter.first, {parameter.second});
+      }
+    }
+    else {
+      C::SetParameters(tuner, id);
+      C::SetConstraints(tuner, id);
+      if (!configurations.empty()) {
+        auto names = std::vector<std::string>();
+        for (const auto &parameter : configurations.front()) { names.push_back(parameter.first); }
+        auto IsListed = [configurations, names] (std::vector<size_t> v) -> bool {
+          for (const auto &configuration : configurations) {
+            auto is_equal = true;
+            for (auto i = size_t{0}; i < names.size(); ++i) {
+              const auto value = configuration.find(names[i]);
+              if (value == configuration.end() || value->second != v[i]) {
+                is_equal = false;
+                break;
+              }
+            }
+            if (is_equal) { return true; }
+          }
+          return false;
+        };
+        tuner.AddConstraint(id, IsListed, names);
+      }
+    }
+    C::SetLocalMemorySize(tuner, id, args);
+
+    // Tests for a specific precision
+    tuner.AddParameter(id, "PRECISION", {static_cast<size_t>(args.precision)});
+    tuner.AddParameterReference("PRECISION", static_cast<size_t>(args.precision));
+
+    // Modifies the thread-sizes (both global and local) based on the parameters
+    for (auto &parameters: C::MulLocal()) { tuner.MulLocalSize(id, parameters); }
+    for (auto &parameters: C::DivLocal()) { tuner.DivLocalSize(id, parameters); }
+    for (auto &parameters: C::MulGlobal()) { tuner.MulGlobalSize(id, parameters); }
+    for (auto &parameters: C::DivGlobal()) { tuner.DivGlobalSize(id, parameters); }
+
+    // Sets the function's arguments
+    C::SetArguments(tuner, args, x_vec, y_vec, a_mat, b_mat, c_mat, temp);
+  };
+
+  // Results for a problem of a specific shape class are stored as a separate kernel family (e.g.
+  // 'xgemm_1_small'), such that these end up in the shape-specific entries of the database
+  auto kernel_family = C::KernelFamily();
+  const auto &bucket_families = database::kShapeBucketFamilies;
+  if (std::find(bucket_families.begin(), bucket_families.end(), kernel_family) != bucket_families.end()) {
+    const auto shape_bucket = Database::ShapeBucket(args.m, args.n, args.k);
+    if (!shape_bucket.empty()) { kernel_family += "_" + shape_bucket; }
   }
 
-  // Outputs the results as JSON to disk, including some meta-data
+  // Collects the meta-data to output along with the results
   auto precision_string = std::to_string(static_cast<size_t>(args.precision));
   auto metadata = std::vector<std::pair<std::string,std::string>>{
-    {"kernel_family", C::KernelFamily()},
+    {"kernel_family", kernel_family},
     {"precision", precision_string}
   };
   for (auto &o: C::GetOptions()) {
@@ -161,7 +213,131 @@ void Tuner(int argc, char* argv[]) {
     if (o == kArgBeta)  { metadata.push_back({"arg_beta", ToString(args.beta)}); }
     if (o == kArgBatchCount) { metadata.push_back({"arg_batch_count", ToString(args.batch_count)}); }
   }
-  tuner.PrintJSON("clblast_"+C::KernelFamily()+"_"+precision_string+".json", metadata);
+  const auto filename = "clblast_" + kernel_family + "_" + precision_string + ".json";
+
+  // A single tuning pass, as long as the search isn't seeded, screened or checkpointed
+  if (seed_devices == 0 && screening == 0.0 && checkpoint.empty()) {
+    cltune::Tuner tuner(args.platform_id, args.device_id);
+    SetStrategy(tuner, strategy);
+    SetUp(tuner, {}, false);
+
+    // Starts the tuning process
+    tuner.SetNumRuns(num_runs);
+    tuner.Tune();
+    if (strategy == kStrategyModel) {
+      tuner.ModelPrediction(cltune::Model::kNeuralNetwork, kModelValidationFraction,
+                            kModelTestTopConfigurations);
+    }
+
+    // Prints the results to screen
+    auto time_ms = tuner.PrintToScreen();
+    tuner.PrintFormatted();
+
+    // Also prints the performance of the best-case in terms of GB/s or GFLOPS
+    if (time_ms != 0.0) {
+      printf("[ -------> ] %.2lf ms", time_ms);
+      printf(" or %.1lf %s\n", C::GetMetric(args)/(time_ms*1.0e6), C::PerformanceUnit().c_str());
+    }
+
+    // Outputs the results as JSON to disk, including some meta-data
+    tuner.PrintJSON(filename, metadata);
+    return;
+  }
+
+  // Otherwise, the tuning consists of multiple passes, of which the results are stored on disk.
+  // When checkpointing, the results of completed passes are re-used when tuning again with the same
+  // settings, e.g. after an interruption.
+  auto settings = strategy + " fraction=" + ToString(args.fraction) +
+                  " runs=" + ToString(num_runs) + " seeds=" + ToString(seed_devices) +
+                  " screening=" + ToString(screening);
+  for (const auto &item : metadata) { settings += " " + item.first + "=" + item.second; }
+  auto pass_metadata = metadata;
+  pass_metadata.push_back({kCheckpointSettings, settings});
+  auto device_metadata = Metadata();
+  auto RunPass = [&](const std::string &pass_name,
+                     const std::vector<Database::Parameters> &configurations, const bool is_seed, const std::string &pass_strategy,
+                     const size_t pass_num_runs) -> std::vector<TuningResult> {
+    const auto prefix = (checkpoint.empty()) ? "clblast_" + kernel_family + "_" + precision_string
+                                             : checkpoint;
+    const auto pass_filename = prefix + "." + pass_name;
+    auto results = std::vector<TuningResult>();
+    if (!checkpoint.empty() &&
+        LoadCheckpoint(pass_filename, device_name, settings, results, device_metadata)) {
+      printf("* Re-using the results of tuning pass '%s' from '%s'\n", pass_name.c_str(),
+             pass_filename.c_str());
+      return results;
+    }
+    printf("* Starting tuning pass '%s'\n", pass_name.c_str());
+    cltune::Tuner tuner(args.platform_id, args.device_id);
+    SetStrategy(tuner, pass_strategy);
+    SetUp(tuner, configurations, is_seed);
+    tuner.SetNumRuns(pass_num_runs);
+    tuner.Tune();
+    if (pass_strategy == kStrategyModel) {
+      tuner.ModelPrediction(cltune::Model::kNeuralNetwork, kModelValidationFraction,
+                            kModelTestTopConfigurations);
+    }
+    tuner.PrintToScreen();
+    tuner.PrintJSON(pass_filename, pass_metadata);
+    results = ReadTuningResultsFile(pass_filename, device_metadata);
+    if (checkpoint.empty()) { std::remove(pass_filename.c_str()); }
+    return results;
+  };
+
+  // Evaluates the parameters of similar devices in the database first, as extra candidates for the
+  // final result. These don't steer the search below: CLTune doesn't allow starting its annealing,
+  // particle-swarm or model-based searches from given configurations.
+  auto final_results = std::vector<TuningResult>();
+  for (auto s = size_t{0}; s < seeds.size(); ++s) {
+    const auto seed_results = RunPass("seed" + std::to_string(s), {seeds[s]}, true,
+                                      kStrategyFull, num_runs);
+    final_results.insert(final_results.end(), seed_results.begin(), seed_results.end());
+  }
+
+  // Searches the parameter space. With screening, each configuration is run only once, after which
+  // only the ones close to the best are run again the regular number of times. This saves the extra
+  // runs of slow configurations, but doesn't stop a configuration during its first run: CLTune
+  // runs each configuration to completion.
+  const auto search_num_runs = (screening == 0.0) ? num_runs : size_t{1};
+  const auto search_results = RunPass("search", {}, false, strategy, search_num_runs);
+  if (screening == 0.0) {
+    final_results.insert(final_results.end(), search_results.begin(), search_results.end());
+  }
+  else {
+    auto best_time = std::numeric_limits<double>::max();
+    for (const auto &result : final_results) { best_time = std::min(best_time, result.time); }
+    for (const auto &result : search_results) { best_time = std::min(best_time, result.time); }
+    const auto screened = ScreenConfigurations(search_results, best_time, screening);
+    printf("* Screening: %zu out of %zu configurations are within %.1lfx of the best\n",
+           screened.size(), search_results.size(), screening);
+    if (!screened.empty()) {
+      const auto screened_results = RunPass("screened", screened, false, kStrategyFull, num_runs);
+      final_results.insert(final_results.end(), screened_results.begin(), screened_results.end());
+    }
+  }
+
+  // Prints the best result to screen, also in terms of GB/s or GFLOPS
+  auto best_result = static_cast<const TuningResult*>(nullptr);
+  for (const auto &result : final_results) {
+    if (best_result == nullptr || result.time < best_result->time) { best_result = &result; }
+  }
+  if (best_result != nullptr) {
+    printf("[ -------> ] %.2lf ms", best_result->time);
+    printf(" or %.1lf %s\n", C::GetMetric(args)/(best_result->time*1.0e6),
+           C::PerformanceUnit().c_str());
+    printf("[ -------> ]");
+    for (const auto &parameter : best_result->parameters) {
+      printf(" %s=%zu", parameter.first.c_str(), parameter.second);
+    }
+    printf("\n");
+  }
+
+  // Outputs the results of all passes as JSON to disk, with the meta-data as the tuner writes it
+  auto final_metadata = Metadata();
+  for (const auto &item : device_metadata) {
+    if (item.first != kCheckpointSettings) { final_metadata.push_back(item); }
+  }
+  WriteTuningResultsFile(filename, final_metadata, final_results);
 }
 
 // =================================================================================================
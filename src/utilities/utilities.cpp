@@ -103,6 +103,10 @@ std::string ToString(T value) {
 template std::string ToString<int>(int value);
 template std::string ToString<size_t>(size_t value);
 template <>
+std::string ToString(std::string value) {
+  return value;
+}
+template <>
 std::string ToString(float value) {
   std::ostringstream result;
   result << std::fixed << std::setprecision(2) << value;
@@ -279,6 +283,7 @@ template float GetArgument<float>(const std::vector<std::string>&, std::string&,
 template double GetArgument<double>(const std::vector<std::string>&, std::string&, const std::string&, const double);
 template float2 GetArgument<float2>(const std::vector<std::string>&, std::string&, const std::string&, const float2);
 template double2 GetArgument<double2>(const std::vector<std::string>&, std::string&, const std::string&, const double2);
+template std::string GetArgument<std::string>(const std::vector<std::string>&, std::string&, const std::string&, const std::string);
 template Layout GetArgument<Layout>(const std::vector<std::string>&, std::string&, const std::string&, const Layout);
 template Transpose GetArgument<Transpose>(const std::vector<std::string>&, std::string&, const std::string&, const Transpose);
 template Side GetArgument<Side>(const std::vector<std::string>&, std::string&, const std::string&, const Side);
@@ -80,6 +80,10 @@ constexpr auto kArgBatchCount = "batch_num";
 
 // The tuner-specific arguments in string form
 constexpr auto kArgFraction = "fraction";
+constexpr auto kArgStrategy = "strategy";
+constexpr auto kArgSeedDevices = "seed_devices";
+constexpr auto kArgScreening = "screening";
+constexpr auto kArgCheckpoint = "checkpoint";
 
 // The client-specific arguments in string form
 constexpr auto kArgCompareclblas = "clblas";
@@ -89,6 +93,9 @@ constexpr auto kArgStepSize = "step";
 constexpr auto kArgNumSteps = "num_steps";
 constexpr auto kArgNumRuns = "runs";
 constexpr auto kArgWarmUp = "warm_up";
+constexpr auto kArgRoofline = "roofline";
+constexpr auto kArgRooflineCache = "roofline_cache";
+constexpr auto kArgJsonOutput = "json";
 
 // The test-specific arguments in string form
 constexpr auto kArgFullTest = "full_test";
@@ -177,6 +184,8 @@ struct Arguments {
   std::vector<size_t> a_offsets; // = {0};
   std::vector<size_t> b_offsets; // = {0};
   std::vector<size_t> c_offsets; // = {0};
+  std::vector<size_t> dot_offsets; // = {0};
+  std::vector<size_t> nrm2_offsets; // = {0};
   std::vector<T> alphas; // = {ConstantOne<T>()};
   std::vector<T> betas; // = {ConstantOne<T>()};
   // Sizes
@@ -0,0 +1,133 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file contains the tests for the SetAuxiliaryQueues function: a routine with independent
+// pre-processing steps is run on a queue with and without registered auxiliary queues, after which
+// the results are compared.
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+#include <random>
+#include <cstdio>
+
+#include "utilities/utilities.hpp"
+#include "test/correctness/tester.hpp"
+#include "test/routines/level3/xsyr2k.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+template <typename T>
+size_t RunAuxiliaryQueuesTests(int argc, char *argv[], const bool silent,
+                               const std::string &routine_name) {
+  auto arguments = RetrieveCommandLineArguments(argc, argv);
+  auto errors = size_t{0};
+  auto passed = size_t{0};
+  constexpr auto kSeed = 42; // fixed seed for reproducibility
+  constexpr auto kNumAuxiliaryQueues = size_t{2};
+
+  // Retrieves the arguments. The sizes are not multiples of the tile sizes and A is transposed,
+  // such that all the input matrices are pre-processed.
+  auto help = std::string{"Options given/available:\n"};
+  const auto platform_id = GetArgument(arguments, help, kArgPlatform, ConvertArgument(std::getenv("CLBLAST_PLATFORM"), size_t{0}));
+  const auto device_id = GetArgument(arguments, help, kArgDevice, ConvertArgument(std::getenv("CLBLAST_DEVICE"), size_t{0}));
+  auto args = Arguments<T>{};
+  args.n = GetArgument(arguments, help, kArgN, size_t{123});
+  args.k = GetArgument(arguments, help, kArgK, size_t{71});
+  args.layout = GetArgument(arguments, help, kArgLayout, Layout::kColMajor);
+  args.triangle = GetArgument(arguments, help, kArgTriangle, Triangle::kUpper);
+  args.a_transpose = GetArgument(arguments, help, kArgATransp, Transpose::kYes);
+  args.a_ld = GetArgument(arguments, help, kArgALeadDim, args.n + 3);
+  args.b_ld = GetArgument(arguments, help, kArgBLeadDim, args.n + 3);
+  args.c_ld = GetArgument(arguments, help, kArgCLeadDim, args.n);
+  args.a_offset = GetArgument(arguments, help, kArgAOffset, size_t{0});
+  args.b_offset = GetArgument(arguments, help, kArgBOffset, size_t{0});
+  args.c_offset = GetArgument(arguments, help, kArgCOffset, size_t{0});
+  args.alpha = GetArgument(arguments, help, kArgAlpha, GetScalar<T>());
+  args.beta  = GetArgument(arguments, help, kArgBeta, GetScalar<T>());
+  TestXsyr2k<T>::SetSizes(args);
+
+  // Prints the help message (command-line arguments)
+  if (!silent) { fprintf(stdout, "\n* %s\n", help.c_str()); }
+
+  // Initializes OpenCL, including the auxiliary queues
+  const auto platform = Platform(platform_id);
+  const auto device = Device(platform, device_id);
+  const auto context = Context(device);
+  auto queue = Queue(context, device);
+  auto auxiliary_queues = std::vector<Queue>();
+  auto auxiliary_queues_plain = std::vector<cl_command_queue>();
+  for (auto i = size_t{0}; i < kNumAuxiliaryQueues; ++i) {
+    auxiliary_queues.push_back(Queue(context, device));
+    auxiliary_queues_plain.push_back(auxiliary_queues.back()());
+  }
+
+  // Populates host matrices with some example data and copies them to the device
+  auto host_a = std::vector<T>(args.a_size);
+  auto host_b = std::vector<T>(args.b_size);
+  auto host_c = std::vector<T>(args.c_size);
+  std::mt19937 mt(kSeed);
+  std::uniform_real_distribution<double> dist(kTestDataLowerLimit, kTestDataUpperLimit);
+  PopulateVector(host_a, mt, dist);
+  PopulateVector(host_b, mt, dist);
+  PopulateVector(host_c, mt, dist);
+  auto device_a = Buffer<T>(context, host_a.size());
+  auto device_b = Buffer<T>(context, host_b.size());
+  auto device_c = Buffer<T>(context, host_c.size());
+  device_a.Write(queue, host_a.size(), host_a);
+  device_b.Write(queue, host_b.size(), host_b);
+  auto dummy = Buffer<T>(context, 1);
+  auto buffers = Buffers<T>{dummy, dummy, device_a, device_b, device_c, dummy, dummy};
+
+  // Runs the routine without and with the auxiliary queues, starting from the same C
+  fprintf(stdout, "* Testing SetAuxiliaryQueues for '%s'\n", routine_name.c_str());
+  auto results = std::vector<std::vector<T>>();
+  for (const auto use_auxiliary_queues : {false, true}) {
+    const auto registered = (use_auxiliary_queues) ? auxiliary_queues_plain :
+                                                     std::vector<cl_command_queue>();
+    if (SetAuxiliaryQueues(queue(), registered) != StatusCode::kSuccess) { errors++; break; }
+    device_c.Write(queue, host_c.size(), host_c);
+    if (TestXsyr2k<T>::RunRoutine(args, buffers, queue) != StatusCode::kSuccess) {
+      errors++;
+      break;
+    }
+    results.push_back(std::vector<T>(host_c.size()));
+    device_c.Read(queue, host_c.size(), results.back());
+  }
+  if (SetAuxiliaryQueues(queue(), {}) != StatusCode::kSuccess) { errors++; }
+
+  // Compares the results
+  if (results.size() == 2) {
+    for (auto i = size_t{0}; i < host_c.size(); ++i) {
+      if (!TestSimilarity(results[0][i], results[1][i])) { errors++; }
+      else { passed++; }
+    }
+  }
+
+  // Prints and returns the statistics
+  fprintf(stdout, "    %zu test(s) passed\n", passed);
+  fprintf(stdout, "    %zu test(s) failed\n", errors);
+  fprintf(stdout, "\n");
+  return errors;
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  auto errors = size_t{0};
+  errors += clblast::RunAuxiliaryQueuesTests<float>(argc, argv, false, "SSYR2K");
+  errors += clblast::RunAuxiliaryQueuesTests<clblast::float2>(argc, argv, true, "CSYR2K");
+  if (errors > 0) { return 1; } else { return 0; }
+}
+
+// =================================================================================================
@@ -0,0 +1,233 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file contains the tests of the TRSM and TRSV routines with non-default block sizes of the
+// inversion, TRSM, fill and TRSV kernels, set through the OverrideParameters function. The results
+// are compared with those computed with the default parameters.
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+#include <utility>
+#include <unordered_map>
+#include <random>
+#include <algorithm>
+#include <cstdio>
+
+#include "utilities/utilities.hpp"
+#include "test/correctness/tester.hpp"
+#include "test/routines/level2/xtrsv.hpp"
+#include "test/routines/level3/xtrsm.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// A set of parameters for some of the kernels
+using BlockSizeSetting = std::vector<std::pair<std::string, std::unordered_map<std::string,size_t>>>;
+
+// Prepares the input data of each problem and runs the routine, returning the results. Failing
+// problems result in an empty result.
+template <typename C, typename T>
+std::vector<std::vector<T>> RunProblems(const std::vector<Arguments<T>> &problems,
+                                        const Context &context, Queue &queue) {
+  constexpr auto kSeed = 42; // fixed seed for reproducibility
+  auto results = std::vector<std::vector<T>>();
+  for (const auto &args : problems) {
+
+    // Populates host buffers with some example data, prepared for the routine
+    std::mt19937 mt(kSeed);
+    std::uniform_real_distribution<double> dist(kTestDataLowerLimit, kTestDataUpperLimit);
+    auto host = BuffersHost<T>{std::vector<T>(args.x_size), std::vector<T>(args.y_size),
+                               std::vector<T>(args.a_size), std::vector<T>(args.b_size),
+                               std::vector<T>(args.c_size), std::vector<T>(args.ap_size),
+                               std::vector<T>(args.scalar_size)};
+    PopulateVector(host.x_vec, mt, dist);
+    PopulateVector(host.a_mat, mt, dist);
+    PopulateVector(host.b_mat, mt, dist);
+    C::PrepareData(args, queue, kSeed, host.x_vec, host.y_vec, host.a_mat, host.b_mat, host.c_mat,
+                   host.ap_mat, host.scalar);
+
+    // Copies the data to the device and runs the routine
+    auto ToDevice = [&context, &queue](const std::vector<T> &host_buffer) {
+      auto device_buffer = Buffer<T>(context, std::max(host_buffer.size(), size_t{1}));
+      if (!host_buffer.empty()) { device_buffer.Write(queue, host_buffer.size(), host_buffer); }
+      return device_buffer;
+    };
+    auto buffers = Buffers<T>{ToDevice(host.x_vec), ToDevice(host.y_vec), ToDevice(host.a_mat),
+                              ToDevice(host.b_mat), ToDevice(host.c_mat), ToDevice(host.ap_mat),
+                              ToDevice(host.scalar)};
+    if (C::RunRoutine(args, buffers, queue) != StatusCode::kSuccess) {
+      results.push_back(std::vector<T>());
+      continue;
+    }
+    results.push_back(C::DownloadResult(args, buffers, queue));
+  }
+  return results;
+}
+
+// Compares the results of each problem with the reference results
+template <typename T>
+void CompareResults(const std::vector<std::vector<T>> &results,
+                    const std::vector<std::vector<T>> &reference, const std::string &name,
+                    size_t &passed, size_t &errors) {
+  for (auto p = size_t{0}; p < results.size(); ++p) {
+    if (results[p].empty() || results[p].size() != reference[p].size()) {
+      fprintf(stdout, "   Error: %s problem %zu failed to run\n", name.c_str(), p);
+      errors++;
+      continue;
+    }
+    auto num_errors = size_t{0};
+    for (auto i = size_t{0}; i < results[p].size(); ++i) {
+      if (!TestSimilarity(results[p][i], reference[p][i])) { num_errors++; }
+    }
+    if (num_errors == 0) { passed++; continue; }
+    fprintf(stdout, "   Error: %s problem %zu has %zu different value(s)\n",
+            name.c_str(), p, num_errors);
+    errors++;
+  }
+}
+
+// =================================================================================================
+
+template <typename T>
+size_t RunBlockSizeTests(int argc, char *argv[], const bool silent, const std::string &routine_name) {
+  auto arguments = RetrieveCommandLineArguments(argc, argv);
+  auto errors = size_t{0};
+  auto passed = size_t{0};
+
+  // The settings to test. With an internal block size of 16 and a TRSM block size of 64, the
+  // inversion of a matrix smaller than half the TRSM block size stops building up the blocks early.
+  const auto precision = PrecisionValue<T>();
+  const auto kernel_names = std::vector<std::string>{"Invert", "Xtrsm", "Fill", "Xtrsv"};
+  const auto settings = std::vector<BlockSizeSetting>{
+    {{"Invert", {{"INTERNAL_BLOCK_SIZE", 16}}}, {"Xtrsm", {{"TRSM_BLOCK_SIZE", 64}}}},
+    {{"Invert", {{"INTERNAL_BLOCK_SIZE", 16}}}, {"Xtrsm", {{"TRSM_BLOCK_SIZE", 128}}}},
+    {{"Invert", {{"INTERNAL_BLOCK_SIZE", 32}}}, {"Xtrsm", {{"TRSM_BLOCK_SIZE", 64}}}},
+    {{"Invert", {{"INTERNAL_BLOCK_SIZE", 32}}}, {"Xtrsm", {{"TRSM_BLOCK_SIZE", 128}}}},
+    {{"Invert", {{"INTERNAL_BLOCK_SIZE", 64}}}, {"Xtrsm", {{"TRSM_BLOCK_SIZE", 64}}}},
+    {{"Invert", {{"INTERNAL_BLOCK_SIZE", 64}}}, {"Xtrsm", {{"TRSM_BLOCK_SIZE", 128}}}},
+    {{"Fill", {{"FILL_DIMX", 16}, {"FILL_DIMY", 4}, {"FILL_WGS", 128}}},
+     {"Xtrsv", {{"TRSV_BLOCK_SIZE", 16}}}},
+    {{"Fill", {{"FILL_DIMX", 32}, {"FILL_DIMY", 2}, {"FILL_WGS", 32}}},
+     {"Xtrsv", {{"TRSV_BLOCK_SIZE", 64}}}},
+  };
+
+  // Retrieves the arguments
+  auto help = std::string{"Options given/available:\n"};
+  const auto platform_id = GetArgument(arguments, help, kArgPlatform, ConvertArgument(std::getenv("CLBLAST_PLATFORM"), size_t{0}));
+  const auto device_id = GetArgument(arguments, help, kArgDevice, ConvertArgument(std::getenv("CLBLAST_DEVICE"), size_t{0}));
+
+  // Prints the help message (command-line arguments)
+  if (!silent) { fprintf(stdout, "\n* %s\n", help.c_str()); }
+
+  // Initializes OpenCL
+  const auto platform = Platform(platform_id);
+  const auto device = Device(platform, device_id);
+  const auto context = Context(device);
+  auto queue = Queue(context, device);
+
+  // The TRSM problems: a triangular matrix smaller than half of the block sizes and one spanning
+  // multiple blocks, with a partial last block, on both sides
+  auto trsm_problems = std::vector<Arguments<T>>();
+  for (const auto k : {size_t{20}, size_t{200}}) {
+    for (const auto side : {Side::kLeft, Side::kRight}) {
+      auto args = Arguments<T>{};
+      args.layout = Layout::kColMajor;
+      args.side = side;
+      args.triangle = (side == Side::kLeft) ? Triangle::kLower : Triangle::kUpper;
+      args.a_transpose = (side == Side::kLeft) ? Transpose::kNo : Transpose::kYes;
+      args.diagonal = Diagonal::kNonUnit;
+      args.m = (side == Side::kLeft) ? k : 33;
+      args.n = (side == Side::kLeft) ? 33 : k;
+      args.a_ld = k;
+      args.b_ld = args.m;
+      args.alpha = GetScalar<T>();
+      TestXtrsm<T>::SetSizes(args);
+      trsm_problems.push_back(args);
+    }
+  }
+
+  // The TRSV problems: as above, for both triangles
+  auto trsv_problems = std::vector<Arguments<T>>();
+  for (const auto n : {size_t{20}, size_t{200}}) {
+    for (const auto triangle : {Triangle::kLower, Triangle::kUpper}) {
+      auto args = Arguments<T>{};
+      args.layout = Layout::kColMajor;
+      args.triangle = triangle;
+      args.a_transpose = Transpose::kNo;
+      args.diagonal = Diagonal::kNonUnit;
+      args.n = n;
+      args.a_ld = n;
+      args.x_inc = 1;
+      TestXtrsv<T>::SetSizes(args);
+      trsv_problems.push_back(args);
+    }
+  }
+
+  // Computes the reference results with the default parameters, which also stores these in the
+  // database cache such that they can be retrieved and restored afterwards
+  const auto trsm_reference = RunProblems<TestXtrsm<T>, T>(trsm_problems, context, queue);
+  const auto trsv_reference = RunProblems<TestXtrsv<T>, T>(trsv_problems, context, queue);
+  auto regular_parameters = BlockSizeSetting();
+  for (const auto &kernel_name : kernel_names) {
+    auto parameters = std::unordered_map<std::string,size_t>();
+    auto database_entry = std::string{};
+    if (RetrieveParameters(device(), kernel_name, precision, parameters,
+                           database_entry) != StatusCode::kSuccess) {
+      fprintf(stdout, "   Error: no parameters found for kernel '%s'\n", kernel_name.c_str());
+      return errors + 1;
+    }
+    regular_parameters.push_back({kernel_name, parameters});
+  }
+  auto Apply = [&device, precision](const BlockSizeSetting &setting) -> bool {
+    for (const auto &kernel : setting) {
+      if (OverrideParameters(device(), kernel.first, precision,
+                             kernel.second) != StatusCode::kSuccess) { return false; }
+    }
+    return true;
+  };
+
+  // Runs the problems for each setting on top of the regular parameters
+  for (const auto &setting : settings) {
+    fprintf(stdout, "* Testing TRSM and TRSV for '%s' with", routine_name.c_str());
+    for (const auto &kernel : setting) {
+      for (const auto &parameter : kernel.second) {
+        fprintf(stdout, " %s=%zu", parameter.first.c_str(), parameter.second);
+      }
+    }
+    fprintf(stdout, "\n");
+    if (!Apply(regular_parameters) || !Apply(setting)) { errors++; continue; }
+    const auto trsm_results = RunProblems<TestXtrsm<T>, T>(trsm_problems, context, queue);
+    const auto trsv_results = RunProblems<TestXtrsv<T>, T>(trsv_problems, context, queue);
+    CompareResults(trsm_results, trsm_reference, "TRSM", passed, errors);
+    CompareResults(trsv_results, trsv_reference, "TRSV", passed, errors);
+  }
+
+  // Restores the regular parameters
+  if (!Apply(regular_parameters)) { errors++; }
+
+  // Prints and returns the statistics
+  fprintf(stdout, "    %zu test(s) passed\n", passed);
+  fprintf(stdout, "    %zu test(s) failed\n", errors);
+  fprintf(stdout, "\n");
+  return errors;
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  auto errors = size_t{0};
+  errors += clblast::RunBlockSizeTests<float>(argc, argv, false, "SINGLE");
+  if (errors > 0) { return 1; } else { return 0; }
+}
+
+// =================================================================================================
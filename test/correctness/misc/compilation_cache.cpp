@@ -0,0 +1,311 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file contains the tests of the on-disk compilation cache, enabled through the
+// CLBLAST_COMPILATION_CACHE environmental variable: storing a binary, re-using it after clearing
+// the in-memory caches, falling back to the source code for a corrupt binary, and storing separate
+// binaries for different kernel parameters.
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <algorithm>
+#include <fstream>
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <cctype>
+
+#if defined(_WIN32)
+  #include <io.h>
+  #include <direct.h>
+  #include <sys/types.h>
+  #include <sys/stat.h>
+  #include <sys/utime.h>
+#else
+  #include <dirent.h>
+  #include <sys/types.h>
+  #include <sys/stat.h>
+  #include <unistd.h>
+  #include <utime.h>
+#endif
+
+#include "utilities/utilities.hpp"
+#include "compilation_cache.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// The directory of the cache during the tests and an arbitrary moment in the past
+const std::string kCacheDirectory = "clblast_test_compilation_cache";
+const time_t kPastTime = 946684800; // 1st of January 2000
+
+// Sets or (with an empty value) removes an environmental variable
+void SetEnvironmentVariable(const std::string &name, const std::string &value) {
+  #if defined(_WIN32)
+    _putenv_s(name.c_str(), value.c_str());
+  #else
+    if (value.empty()) { unsetenv(name.c_str()); }
+    else { setenv(name.c_str(), value.c_str(), 1); }
+  #endif
+}
+
+// Returns whether a file name is of the form 'clblast_<hash>_<size>.bin'
+bool IsCacheFileName(const std::string &name) {
+  const auto prefix = std::string{"clblast_"};
+  const auto suffix = std::string{".bin"};
+  if (name.size() <= prefix.size() + suffix.size()) { return false; }
+  if (name.compare(0, prefix.size(), prefix) != 0) { return false; }
+  if (name.compare(name.size() - suffix.size(), suffix.size(), suffix) != 0) { return false; }
+  const auto hash_and_size = name.substr(prefix.size(),
+                                         name.size() - prefix.size() - suffix.size());
+  const auto separator = hash_and_size.find('_');
+  if (separator == 0 || separator == std::string::npos ||
+      separator == hash_and_size.size() - 1) { return false; }
+  for (auto i = size_t{0}; i < hash_and_size.size(); ++i) {
+    const auto character = static_cast<unsigned char>(hash_and_size[i]);
+    if (i < separator && !std::isxdigit(character)) { return false; }
+    if (i > separator && !std::isdigit(character)) { return false; }
+  }
+  return true;
+}
+
+// Lists the (sorted) names of all cache files in a directory, skipping temporary files
+std::vector<std::string> ListCacheFiles(const std::string &directory) {
+  auto names = std::vector<std::string>();
+  #if defined(_WIN32)
+    auto data = _finddata_t{};
+    const auto handle = _findfirst((directory + "/clblast_*").c_str(), &data);
+    if (handle != -1) {
+      do {
+        if (IsCacheFileName(data.name)) { names.push_back(data.name); }
+      } while (_findnext(handle, &data) == 0);
+      _findclose(handle);
+    }
+  #else
+    const auto dir = opendir(directory.c_str());
+    if (dir != nullptr) {
+      for (auto entry = readdir(dir); entry != nullptr; entry = readdir(dir)) {
+        if (IsCacheFileName(entry->d_name)) { names.push_back(entry->d_name); }
+      }
+      closedir(dir);
+    }
+  #endif
+  std::sort(names.begin(), names.end());
+  return names;
+}
+
+// Removes all cache files and the directory itself
+void RemoveCacheDirectory(const std::string &directory) {
+  for (const auto &name : ListCacheFiles(directory)) {
+    std::remove((directory + "/" + name).c_str());
+  }
+  #if defined(_WIN32)
+    _rmdir(directory.c_str());
+  #else
+    rmdir(directory.c_str());
+  #endif
+}
+
+// Overwrites the contents of a file
+void WriteFile(const std::string &filename, const std::string &contents) {
+  std::ofstream file(filename, std::ios::binary | std::ios::trunc);
+  file.write(contents.data(), static_cast<std::streamsize>(contents.size()));
+}
+
+// Retrieves and modifies the modification time of a file. A file that is not re-written keeps a
+// modification time set to the past.
+time_t GetModificationTime(const std::string &filename) {
+  #if defined(_WIN32)
+    struct _stat info;
+    if (_stat(filename.c_str(), &info) != 0) { return 0; }
+  #else
+    struct stat info;
+    if (stat(filename.c_str(), &info) != 0) { return 0; }
+  #endif
+  return info.st_mtime;
+}
+void SetModificationTime(const std::string &filename, const time_t time) {
+  #if defined(_WIN32)
+    struct _utimbuf times;
+    times.actime = time;
+    times.modtime = time;
+    _utime(filename.c_str(), &times);
+  #else
+    struct utimbuf times;
+    times.actime = time;
+    times.modtime = time;
+    utime(filename.c_str(), &times);
+  #endif
+}
+
+// Runs AXPY on fixed input data and returns the result, or an empty vector on failure
+template <typename T>
+std::vector<T> RunAxpy(const Context &context, Queue &queue) {
+  constexpr auto kSize = size_t{4096};
+  auto x_host = std::vector<T>(kSize);
+  auto y_host = std::vector<T>(kSize);
+  for (auto i = size_t{0}; i < kSize; ++i) {
+    x_host[i] = static_cast<T>(i % 13) / static_cast<T>(7);
+    y_host[i] = static_cast<T>(i % 11) / static_cast<T>(3);
+  }
+  auto x_device = Buffer<T>(context, kSize);
+  auto y_device = Buffer<T>(context, kSize);
+  x_device.Write(queue, kSize, x_host);
+  y_device.Write(queue, kSize, y_host);
+
+  auto queue_plain = queue();
+  auto event = cl_event{};
+  const auto status = Axpy(kSize, static_cast<T>(1.5), x_device(), 0, 1, y_device(), 0, 1,
+                           &queue_plain, &event);
+  if (status != StatusCode::kSuccess) { return std::vector<T>(); }
+  clWaitForEvents(1, &event);
+  clReleaseEvent(event);
+  y_device.Read(queue, kSize, y_host);
+  return y_host;
+}
+
+// =================================================================================================
+
+template <typename T>
+size_t RunCompilationCacheTests(int argc, char *argv[], const bool silent,
+                                const std::string &routine_name) {
+  auto arguments = RetrieveCommandLineArguments(argc, argv);
+  auto errors = size_t{0};
+  auto passed = size_t{0};
+  const auto kernel_name = std::string{"Xaxpy"};
+  const auto precision = PrecisionValue<T>();
+
+  // Retrieves the arguments
+  auto help = std::string{"Options given/available:\n"};
+  const auto platform_id = GetArgument(arguments, help, kArgPlatform, ConvertArgument(std::getenv("CLBLAST_PLATFORM"), size_t{0}));
+  const auto device_id = GetArgument(arguments, help, kArgDevice, ConvertArgument(std::getenv("CLBLAST_DEVICE"), size_t{0}));
+
+  // Prints the help message (command-line arguments)
+  if (!silent) { fprintf(stdout, "\n* %s\n", help.c_str()); }
+
+  // Initializes OpenCL
+  const auto platform = Platform(platform_id);
+  const auto device = Device(platform, device_id);
+  const auto context = Context(device);
+  auto queue = Queue(context, device);
+
+  // Starts with an empty on-disk cache and empty in-memory caches
+  fprintf(stdout, "* Testing the compilation cache for '%s'\n", routine_name.c_str());
+  RemoveCacheDirectory(kCacheDirectory);
+  SetEnvironmentVariable(kCompilationCacheVariable, kCacheDirectory);
+  ClearCache();
+
+  // Tests that compiling the routine stores a binary
+  const auto reference = RunAxpy<T>(context, queue);
+  const auto files = ListCacheFiles(kCacheDirectory);
+  if (reference.empty() || files.size() != 1) {
+    fprintf(stdout, "   Error: expected a single cache file after the first run, found %zu\n",
+            files.size());
+    SetEnvironmentVariable(kCompilationCacheVariable, "");
+    RemoveCacheDirectory(kCacheDirectory);
+    return errors + 1;
+  }
+  passed++;
+  const auto cache_file = kCacheDirectory + "/" + files.front();
+
+  // Tests that the binary is used once the in-memory caches are cleared: a compilation from source
+  // would re-write the file and thus update its modification time
+  SetModificationTime(cache_file, kPastTime);
+  ClearCache();
+  const auto cached_result = RunAxpy<T>(context, queue);
+  if (cached_result != reference) {
+    fprintf(stdout, "   Error: different results when using the stored binary\n");
+    errors++;
+  }
+  else if (GetModificationTime(cache_file) != kPastTime ||
+           ListCacheFiles(kCacheDirectory) != files) {
+    fprintf(stdout, "   Error: the stored binary was not used\n");
+    errors++;
+  }
+  else { passed++; }
+
+  // Tests that a corrupt binary falls back to compilation from source
+  WriteFile(cache_file, "this is not a valid OpenCL binary");
+  ClearCache();
+  const auto fallback_result = RunAxpy<T>(context, queue);
+  if (fallback_result != reference) {
+    fprintf(stdout, "   Error: different results when falling back from a corrupt binary\n");
+    errors++;
+  }
+  else { passed++; }
+
+  // Tests that different kernel parameters result in a separate binary
+  auto regular_parameters = std::unordered_map<std::string,size_t>();
+  auto database_entry = std::string{};
+  if (RetrieveParameters(device(), kernel_name, precision, regular_parameters,
+                         database_entry) != StatusCode::kSuccess) {
+    fprintf(stdout, "   Error: no parameters found for kernel '%s'\n", kernel_name.c_str());
+    errors++;
+  }
+  else {
+    auto parameters = regular_parameters;
+    parameters["WGS"] = (parameters["WGS"] == 64) ? 128 : 64;
+    if (OverrideParameters(device(), kernel_name, precision, parameters) != StatusCode::kSuccess) {
+      fprintf(stdout, "   Error: failed to override the parameters of '%s'\n",
+              kernel_name.c_str());
+      errors++;
+    }
+    else {
+      const auto override_result = RunAxpy<T>(context, queue);
+      const auto override_files = ListCacheFiles(kCacheDirectory);
+      if (override_result != reference) {
+        fprintf(stdout, "   Error: different results with overridden parameters\n");
+        errors++;
+      }
+      else if (override_files.size() != 2) {
+        fprintf(stdout, "   Error: expected a second cache file for different parameters\n");
+        errors++;
+      }
+      else { passed++; }
+    }
+
+    // Tests that restoring the parameters maps back onto the first binary
+    if (OverrideParameters(device(), kernel_name, precision,
+                           regular_parameters) != StatusCode::kSuccess) { errors++; }
+    else {
+      const auto restored_result = RunAxpy<T>(context, queue);
+      if (restored_result != reference || ListCacheFiles(kCacheDirectory).size() != 2) {
+        fprintf(stdout, "   Error: restoring the parameters did not re-use the first binary\n");
+        errors++;
+      }
+      else { passed++; }
+    }
+  }
+
+  // Disables the cache again and cleans up
+  SetEnvironmentVariable(kCompilationCacheVariable, "");
+  RemoveCacheDirectory(kCacheDirectory);
+  ClearCache();
+
+  // Prints and returns the statistics
+  fprintf(stdout, "    %zu test(s) passed\n", passed);
+  fprintf(stdout, "    %zu test(s) failed\n", errors);
+  fprintf(stdout, "\n");
+  return errors;
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  auto errors = size_t{0};
+  errors += clblast::RunCompilationCacheTests<float>(argc, argv, false, "SINGLE");
+  if (errors > 0) { return 1; } else { return 0; }
+}
+
+// =================================================================================================
@@ -0,0 +1,121 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file contains the tests for matching a device to the nearest tuned device in the database.
+// These work on plain device properties and don't require an OpenCL device.
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+#include <cstdio>
+
+#include "utilities/utilities.hpp"
+#include "database/device_matching.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// A device to match, the names of the tuned devices in the database, and the expected match (or an
+// empty string if none of them should match)
+struct MatchingTest {
+  DeviceProperties device;
+  std::vector<std::string> database_devices;
+  std::string expected;
+};
+
+size_t RunDeviceMatchingTests() {
+  auto errors = size_t{0};
+  auto passed = size_t{0};
+
+  // Tests the derivation of the architecture from the device name
+  fprintf(stdout, "* Testing ArchitectureFromName\n");
+  const auto architecture_tests = std::vector<std::vector<std::string>>{
+    {"NVIDIA", "GPU", "GeForce GTX 980", "SM5.2"},
+    {"NVIDIA", "GPU", "Quadro Unknown", ""},
+    {"AMD", "GPU", "Hawaii", "GFX7"},
+    {"AMD", "GPU", "gfx803", "GFX8"},
+    {"Intel", "GPU", "Intel(R) HD Graphics 5500 BroadWell U-Processor GT2", "Gen8"},
+    {"Intel", "GPU", "Intel(R) HD Graphics 620", "Gen9"},
+    {"Intel", "CPU", "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz", "Core-4"},
+    {"ARM", "GPU", "Mali-T628", "Midgard"},
+  };
+  for (const auto &test : architecture_tests) {
+    const auto architecture = ArchitectureFromName(test[0], test[1], test[2]);
+    if (architecture == test[3]) { passed++; continue; }
+    fprintf(stdout, "   Error: expected '%s' for '%s', found '%s'\n",
+            test[3].c_str(), test[2].c_str(), architecture.c_str());
+    errors++;
+  }
+
+  // Tests the selection of the nearest device
+  fprintf(stdout, "* Testing NearestDevice\n");
+  const auto nvidia_devices = std::vector<std::string>{
+    "GeForce GTX 1070", "GeForce GTX 1080", "GeForce GTX 750 Ti", "GeForce GTX 980",
+    "GeForce GTX TITAN", "TITAN X (Pascal)", "Tesla K40m"
+  };
+  const auto matching_tests = std::vector<MatchingTest>{
+    {{"GPU", "NVIDIA", "GeForce GTX 1080 Ti", "SM6.1", 28}, nvidia_devices, "GeForce GTX 1080"},
+    {{"GPU", "NVIDIA", "Tesla P100-PCIE-16GB", "SM6.0", 56}, nvidia_devices, "TITAN X (Pascal)"},
+    {{"GPU", "NVIDIA", "Tesla K80", "SM3.7", 13}, nvidia_devices, "Tesla K40m"},
+    {{"GPU", "NVIDIA", "GeForce GTX 970", "", 13}, nvidia_devices, "GeForce GTX 980"},
+    {{"GPU", "NVIDIA", "Quadro Unknown", "", 10}, nvidia_devices, ""},
+    {{"GPU", "AMD", "gfx803", "GFX8", 36}, {"Hawaii", "Tonga", "Tahiti"}, "Tonga"},
+    {{"GPU", "Intel", "Intel(R) HD Graphics 620", "Gen9", 24},
+     {"Intel(R) HD Graphics Haswell Ultrabook GT2 Mobile", "Intel(R) HD Graphics Skylake ULT GT2"},
+     "Intel(R) HD Graphics Skylake ULT GT2"},
+    {{"CPU", "Intel", "Intel(R) Core(TM) i7-6700K CPU @ 4.00GHz", "Core-6", 8},
+     {"Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz", "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz"},
+     "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz"},
+  };
+  for (const auto &test : matching_tests) {
+    auto candidates = std::vector<DeviceProperties>();
+    for (const auto &name : test.database_devices) {
+      candidates.push_back(DatabaseDeviceProperties(test.device.vendor, test.device.type, name));
+    }
+    const auto nearest = NearestDevice(test.device, candidates);
+    const auto found = (nearest < candidates.size()) ? candidates[nearest].name : std::string{""};
+    if (found == test.expected) { passed++; continue; }
+    fprintf(stdout, "   Error: expected '%s' for '%s', found '%s'\n",
+            test.expected.c_str(), test.device.name.c_str(), found.c_str());
+    errors++;
+  }
+
+  // Tests that devices of a different type or vendor never match, even with the same name
+  fprintf(stdout, "* Testing DeviceMatchScore\n");
+  const auto gpu = DeviceProperties{"GPU", "NVIDIA", "GeForce GTX 1080", "SM6.1", 20};
+  const auto mismatches = std::vector<DeviceProperties>{
+    {"CPU", "NVIDIA", "GeForce GTX 1080", "SM6.1", 20},
+    {"GPU", "AMD", "GeForce GTX 1080", "SM6.1", 20},
+  };
+  for (const auto &mismatch : mismatches) {
+    const auto score = DeviceMatchScore(gpu, mismatch);
+    if (score == 0) { passed++; continue; }
+    fprintf(stdout, "   Error: expected a score of 0 for a %s of %s, found %d\n",
+            mismatch.type.c_str(), mismatch.vendor.c_str(), score);
+    errors++;
+  }
+
+  // Prints and returns the statistics
+  fprintf(stdout, "    %zu test(s) passed\n", passed);
+  fprintf(stdout, "    %zu test(s) failed\n", errors);
+  fprintf(stdout, "\n");
+  return errors;
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// Main function (not within the clblast namespace)
+int main() {
+  const auto errors = clblast::RunDeviceMatchingTests();
+  if (errors > 0) { return 1; } else { return 0; }
+}
+
+// =================================================================================================
@@ -0,0 +1,276 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file contains the tests for the FusedVectorOperations function. It tests the signatures and
+// the generated source code of chains of steps, after which it runs chains on the device and
+// compares the results with a reference implementation on the host.
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+#include <random>
+#include <cstdio>
+#include <cmath>
+
+#include "utilities/utilities.hpp"
+#include "test/correctness/tester.hpp"
+#include "routines/levelx/xfused.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// Returns the number of occurrences of a string in the source code
+size_t CountOccurrences(const std::string &source, const std::string &text) {
+  auto count = size_t{0};
+  for (auto pos = source.find(text); pos != std::string::npos; pos = source.find(text, pos + 1)) {
+    count++;
+  }
+  return count;
+}
+
+// A chain of steps, the number of vectors, and the expected signature
+template <typename T>
+struct FusedTest {
+  std::vector<VectorStep<T>> steps;
+  size_t num_vectors;
+  std::string signature;
+};
+
+// The chains of steps to test: an AXPY followed by a DOT (an AXPYDOT), a chain without reductions,
+// and a chain with a vector that is used by multiple steps and with two reductions
+template <typename T>
+std::vector<FusedTest<T>> FusedTests() {
+  const auto alpha = GetScalar<T>();
+  return {
+    {{{VectorOperation::kAxpy, 0, 1, alpha}, {VectorOperation::kDot, 1, 1, alpha}},
+     2, "FUSED_2_A0_1_D1_1"},
+    {{{VectorOperation::kCopy, 0, 2, alpha}, {VectorOperation::kScal, 0, 2, alpha},
+      {VectorOperation::kAdd, 1, 2, alpha}},
+     3, "FUSED_3_C0_2_S2_P1_2"},
+    {{{VectorOperation::kMul, 0, 1, alpha}, {VectorOperation::kAxpy, 1, 2, alpha},
+      {VectorOperation::kNrm2, 2, 0, alpha}, {VectorOperation::kDot, 0, 1, alpha}},
+     3, "FUSED_3_M0_1_A1_2_N2_D0_1"},
+  };
+}
+
+// =================================================================================================
+
+// Tests the signatures and the source code generation, which doesn't require a device
+template <typename T>
+size_t RunFusedSourceTests() {
+  auto errors = size_t{0};
+  auto passed = size_t{0};
+
+  fprintf(stdout, "* Testing the signatures and the generated source code of fused steps\n");
+  for (const auto &test : FusedTests<T>()) {
+    const auto signature = Xfused<T>::Signature(test.steps, test.num_vectors);
+    if (signature != test.signature) {
+      fprintf(stdout, "   Error: expected signature '%s', found '%s'\n",
+              test.signature.c_str(), signature.c_str());
+      errors++;
+    }
+    else { passed++; }
+
+    // Each vector is loaded at most once, and only the vectors that are modified are stored
+    const auto source = Xfused<T>::GenerateSource(test.steps, test.num_vectors);
+    auto num_reductions = size_t{0};
+    auto is_written = std::vector<bool>(test.num_vectors, false);
+    for (const auto &step : test.steps) {
+      if (step.operation == VectorOperation::kDot || step.operation == VectorOperation::kNrm2) {
+        num_reductions++;
+      }
+      else { is_written[step.y] = true; }
+    }
+    for (auto v = size_t{0}; v < test.num_vectors; ++v) {
+      const auto v_string = ToString(v);
+      const auto element = "v" + v_string + "[id*v" + v_string + "_inc + v" + v_string + "_offset]";
+      const auto num_loads = CountOccurrences(source, " = " + element + ";");
+      const auto num_stores = CountOccurrences(source, element + " = ");
+      const auto num_expected_stores = (is_written[v]) ? size_t{1} : size_t{0};
+      if (num_loads > 1 || num_stores != num_expected_stores) {
+        fprintf(stdout, "   Error: vector %zu of '%s' is loaded %zu and stored %zu time(s)\n",
+                v, signature.c_str(), num_loads, num_stores);
+        errors++;
+      }
+      else { passed++; }
+    }
+
+    // The epilogue kernel is only generated if there are reductions
+    const auto has_epilogue = CountOccurrences(source, "XfusedEpilogue") == 1;
+    if (has_epilogue != (num_reductions > 0)) {
+      fprintf(stdout, "   Error: unexpected epilogue kernel for '%s'\n", signature.c_str());
+      errors++;
+    }
+    else { passed++; }
+  }
+
+  // Invalid chains of steps are rejected
+  const auto alpha = GetScalar<T>();
+  const auto invalid_tests = std::vector<std::vector<VectorStep<T>>>{
+    {},
+    {{VectorOperation::kAxpy, 0, 2, alpha}},
+    {{VectorOperation::kNrm2, 2, 0, alpha}},
+  };
+  for (const auto &steps : invalid_tests) {
+    try {
+      Xfused<T>::Signature(steps, 2);
+      fprintf(stdout, "   Error: an invalid chain of %zu step(s) is accepted\n", steps.size());
+      errors++;
+    } catch (const BLASError &e) {
+      if (e.status() == StatusCode::kInvalidValue) { passed++; }
+      else { errors++; }
+    }
+  }
+
+  // Prints and returns the statistics
+  fprintf(stdout, "    %zu test(s) passed\n", passed);
+  fprintf(stdout, "    %zu test(s) failed\n", errors);
+  fprintf(stdout, "\n");
+  return errors;
+}
+
+// =================================================================================================
+
+// The reference implementation: applies all steps to each element in turn
+template <typename T>
+void FusedReference(const size_t n, const std::vector<VectorStep<T>> &steps,
+                    std::vector<std::vector<T>> &vectors, const std::vector<size_t> &offsets,
+                    std::vector<T> &results) {
+  for (auto id = size_t{0}; id < n; ++id) {
+    auto reduction_id = size_t{0};
+    for (const auto &step : steps) {
+      const auto x = vectors[step.x][id + offsets[step.x]];
+      auto &y = vectors[step.y][id + offsets[step.y]];
+      switch (step.operation) {
+        case VectorOperation::kCopy: y = x; break;
+        case VectorOperation::kScal: y = step.alpha * y; break;
+        case VectorOperation::kAxpy: y = step.alpha * x + y; break;
+        case VectorOperation::kMul: y = x * y; break;
+        case VectorOperation::kAdd: y = x + y; break;
+        case VectorOperation::kDot: results[reduction_id++] += x * y; break;
+        case VectorOperation::kNrm2: results[reduction_id++] += x * x; break;
+      }
+    }
+  }
+  auto reduction_id = size_t{0};
+  for (const auto &step : steps) {
+    if (step.operation == VectorOperation::kNrm2) {
+      results[reduction_id] = std::sqrt(results[reduction_id]);
+    }
+    if (step.operation == VectorOperation::kDot || step.operation == VectorOperation::kNrm2) {
+      reduction_id++;
+    }
+  }
+}
+
+// Runs the chains of steps on the device and compares the vectors and the results with the above
+template <typename T>
+size_t RunFusedTests(int argc, char *argv[], const bool silent, const std::string &routine_name) {
+  auto arguments = RetrieveCommandLineArguments(argc, argv);
+  auto errors = size_t{0};
+  auto passed = size_t{0};
+  constexpr auto kSeed = 42; // fixed seed for reproducibility
+
+  // Retrieves the arguments
+  auto help = std::string{"Options given/available:\n"};
+  const auto platform_id = GetArgument(arguments, help, kArgPlatform, ConvertArgument(std::getenv("CLBLAST_PLATFORM"), size_t{0}));
+  const auto device_id = GetArgument(arguments, help, kArgDevice, ConvertArgument(std::getenv("CLBLAST_DEVICE"), size_t{0}));
+  const auto n = GetArgument(arguments, help, kArgN, size_t{1023});
+  const auto offset = GetArgument(arguments, help, kArgXOffset, size_t{3});
+
+  // Prints the help message (command-line arguments)
+  if (!silent) { fprintf(stdout, "\n* %s\n", help.c_str()); }
+
+  // Initializes OpenCL
+  const auto platform = Platform(platform_id);
+  const auto device = Device(platform, device_id);
+  const auto context = Context(device);
+  auto queue = Queue(context, device);
+
+  fprintf(stdout, "* Testing FusedVectorOperations for '%s'\n", routine_name.c_str());
+  for (const auto &test : FusedTests<T>()) {
+
+    // Populates the host vectors with some example data and copies them to the device. The first
+    // vector has an offset, the others don't.
+    std::mt19937 mt(kSeed);
+    std::uniform_real_distribution<double> dist(kTestDataLowerLimit, kTestDataUpperLimit);
+    auto offsets = std::vector<size_t>(test.num_vectors, 0);
+    offsets[0] = offset;
+    const auto incs = std::vector<size_t>(test.num_vectors, 1);
+    auto host_vectors = std::vector<std::vector<T>>();
+    auto device_vectors = std::vector<Buffer<T>>();
+    auto device_vectors_plain = std::vector<cl_mem>();
+    for (auto v = size_t{0}; v < test.num_vectors; ++v) {
+      host_vectors.push_back(std::vector<T>(n + offsets[v]));
+      PopulateVector(host_vectors.back(), mt, dist);
+      device_vectors.push_back(Buffer<T>(context, host_vectors.back().size()));
+      device_vectors.back().Write(queue, host_vectors.back().size(), host_vectors.back());
+      device_vectors_plain.push_back(device_vectors.back()());
+    }
+    auto num_reductions = size_t{0};
+    for (const auto &step : test.steps) {
+      if (step.operation == VectorOperation::kDot || step.operation == VectorOperation::kNrm2) {
+        num_reductions++;
+      }
+    }
+    auto host_results = std::vector<T>(num_reductions + 1, static_cast<T>(0));
+    auto device_results = Buffer<T>(context, host_results.size());
+
+    // Runs the chain on the device and on the host
+    auto queue_plain = queue();
+    auto event = cl_event{};
+    const auto status = FusedVectorOperations<T>(n, test.steps, device_vectors_plain, offsets, incs,
+                                                 device_results(), 1, &queue_plain, &event);
+    if (status != StatusCode::kSuccess) {
+      fprintf(stdout, "   Error: '%s' returned status %d\n", test.signature.c_str(),
+              static_cast<int>(status));
+      errors++;
+      continue;
+    }
+    clWaitForEvents(1, &event);
+    clReleaseEvent(event);
+    auto reference_results = std::vector<T>(num_reductions, static_cast<T>(0));
+    FusedReference(n, test.steps, host_vectors, offsets, reference_results);
+
+    // Compares the vectors and the results
+    for (auto v = size_t{0}; v < test.num_vectors; ++v) {
+      auto result = std::vector<T>(host_vectors[v].size());
+      device_vectors[v].Read(queue, result.size(), result);
+      for (auto i = size_t{0}; i < result.size(); ++i) {
+        if (!TestSimilarity(result[i], host_vectors[v][i])) { errors++; }
+        else { passed++; }
+      }
+    }
+    device_results.Read(queue, host_results.size(), host_results);
+    for (auto r = size_t{0}; r < num_reductions; ++r) {
+      if (!TestSimilarity(host_results[r + 1], reference_results[r])) { errors++; }
+      else { passed++; }
+    }
+  }
+
+  // Prints and returns the statistics
+  fprintf(stdout, "    %zu test(s) passed\n", passed);
+  fprintf(stdout, "    %zu test(s) failed\n", errors);
+  fprintf(stdout, "\n");
+  return errors;
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  auto errors = size_t{0};
+  errors += clblast::RunFusedSourceTests<float>();
+  errors += clblast::RunFusedTests<float>(argc, argv, false, "SFUSED");
+  if (errors > 0) { return 1; } else { return 0; }
+}
+
+// =================================================================================================
@@ -0,0 +1,212 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file contains the tests of routines with changed kernel-selection parameters. These force
+// implementations which the regular tests don't reach with the default parameters of a device,
+// e.g. because they are only selected for large problems.
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <random>
+#include <cstdio>
+
+#include "test/correctness/testblas.hpp"
+#include "test/routines/level1/xdot.hpp"
+#include "test/routines/level1/xnrm2.hpp"
+#include "test/routines/level1/xasum.hpp"
+#include "test/routines/level3/xgemm.hpp"
+#include "test/routines/level3/xtrsm.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// Retrieves the device to test on from the command-line arguments
+Device GetTestDevice(int argc, char *argv[]) {
+  auto arguments = RetrieveCommandLineArguments(argc, argv);
+  auto help = std::string{};
+  const auto platform_id = GetArgument(arguments, help, kArgPlatform, ConvertArgument(std::getenv("CLBLAST_PLATFORM"), size_t{0}));
+  const auto device_id = GetArgument(arguments, help, kArgDevice, ConvertArgument(std::getenv("CLBLAST_DEVICE"), size_t{0}));
+  return Device(Platform(platform_id), device_id);
+}
+
+// Changes some of the kernel-selection parameters of a device, keeping the others. The parameters
+// have to be in the database cache already, i.e. a routine using them has to have run before.
+// Optionally returns the parameters as they were before. Returns whether this succeeded.
+bool ChangeKernelSelection(const Device &device, const Precision precision,
+                           const std::unordered_map<std::string,size_t> &overrides,
+                           std::unordered_map<std::string,size_t> *previous = nullptr) {
+  const auto kernel_name = std::string{"KernelSelection"};
+  auto parameters = std::unordered_map<std::string,size_t>();
+  auto database_entry = std::string{};
+  if (RetrieveParameters(device(), kernel_name, precision, parameters,
+                         database_entry) != StatusCode::kSuccess) { return false; }
+  if (previous != nullptr) { *previous = parameters; }
+  for (const auto &parameter : overrides) { parameters[parameter.first] = parameter.second; }
+  return OverrideParameters(device(), kernel_name, precision, parameters) == StatusCode::kSuccess;
+}
+
+// =================================================================================================
+
+// Runs the regular tests of a routine, which also stores its regular parameters in the database
+// cache. Then changes some of the kernel-selection parameters, runs the tests again and restores
+// the parameters.
+template <typename C, typename T, typename U>
+size_t RunKernelSelectionTests(int argc, char *argv[], const bool silent, const std::string &name,
+                               const std::unordered_map<std::string,size_t> &overrides) {
+  auto errors = RunTests<C,T,U>(argc, argv, silent, name);
+  const auto device = GetTestDevice(argc, argv);
+  const auto precision = PrecisionValue<T>();
+
+  // Changes the parameters
+  auto regular_parameters = std::unordered_map<std::string,size_t>();
+  if (!ChangeKernelSelection(device, precision, overrides, &regular_parameters)) {
+    return errors + 1;
+  }
+
+  // Runs the tests again
+  fprintf(stdout, "* Testing '%s' with changed kernel-selection parameters:", name.c_str());
+  for (const auto &parameter : overrides) {
+    fprintf(stdout, " %s=%zu", parameter.first.c_str(), parameter.second);
+  }
+  fprintf(stdout, "\n");
+  errors += RunTests<C,T,U>(argc, argv, true, name);
+
+  // Restores the regular parameters
+  if (!ChangeKernelSelection(device, precision, regular_parameters)) { errors++; }
+  return errors;
+}
+
+// =================================================================================================
+
+// Tests the stream-K version of the in-direct GEMM kernel. It is only selected for problems with
+// more tiles than work-group slots on the device, so the size of the problem depends on the tile
+// sizes and the number of compute units. The result is compared with the regular in-direct kernel.
+template <typename T>
+size_t RunStreamKTests(int argc, char *argv[], const std::string &routine_name) {
+  auto errors = size_t{0};
+  auto passed = size_t{0};
+  constexpr auto kSeed = 42; // fixed seed for reproducibility
+  constexpr auto kOccupancy = size_t{2};
+
+  // Initializes OpenCL
+  const auto device = GetTestDevice(argc, argv);
+  const auto context = Context(device);
+  auto queue = Queue(context, device);
+  const auto precision = PrecisionValue<T>();
+
+  // Runs a tiny GEMM to store the parameters of this device in the database cache
+  auto args = Arguments<T>{};
+  args.layout = Layout::kColMajor;
+  args.a_transpose = Transpose::kNo;
+  args.b_transpose = Transpose::kNo;
+  args.m = args.n = args.k = args.a_ld = args.b_ld = args.c_ld = 1;
+  args.alpha = GetScalar<T>();
+  args.beta = GetScalar<T>();
+  auto dummy = Buffer<T>(context, 1);
+  auto tiny_buffers = Buffers<T>{dummy, dummy, dummy, dummy, dummy, dummy, dummy};
+  if (TestXgemm<T>::RunRoutine(args, tiny_buffers, queue) != StatusCode::kSuccess) { return 1; }
+  auto gemm_parameters = std::unordered_map<std::string,size_t>();
+  auto database_entry = std::string{};
+  if (RetrieveParameters(device(), "Xgemm", precision, gemm_parameters,
+                         database_entry) != StatusCode::kSuccess) { return 1; }
+
+  // One tile more than there are work-group slots: a wave-quantisation tail of a single tile. The
+  // k-dimension spans multiple iterations, such that the tiles are split.
+  const auto num_tiles_m = device.ComputeUnits() * kOccupancy + 1;
+  args.m = num_tiles_m * gemm_parameters["MWG"];
+  args.n = gemm_parameters["NWG"];
+  args.k = 3 * gemm_parameters["KWG"];
+  args.a_ld = args.m;
+  args.b_ld = args.k;
+  args.c_ld = args.m;
+
+  // Populates host matrices with some example data and copies them to the device
+  auto host_a = std::vector<T>(args.m * args.k);
+  auto host_b = std::vector<T>(args.k * args.n);
+  auto host_c = std::vector<T>(args.m * args.n);
+  std::mt19937 mt(kSeed);
+  std::uniform_real_distribution<double> dist(kTestDataLowerLimit, kTestDataUpperLimit);
+  PopulateVector(host_a, mt, dist);
+  PopulateVector(host_b, mt, dist);
+  PopulateVector(host_c, mt, dist);
+  auto device_a = Buffer<T>(context, host_a.size());
+  auto device_b = Buffer<T>(context, host_b.size());
+  auto device_c = Buffer<T>(context, host_c.size());
+  device_a.Write(queue, host_a.size(), host_a);
+  device_b.Write(queue, host_b.size(), host_b);
+  auto buffers = Buffers<T>{dummy, dummy, device_a, device_b, device_c, dummy, dummy};
+
+  // Runs the regular in-direct kernel and then the stream-K kernel, starting from the same C
+  fprintf(stdout, "* Testing the stream-K GEMM for '%s' (%zu x %zu x %zu)\n",
+          routine_name.c_str(), args.m, args.n, args.k);
+  auto regular_parameters = std::unordered_map<std::string,size_t>();
+  const auto settings = std::vector<std::unordered_map<std::string,size_t>>{
+    {{"XGEMM_MIN_INDIRECT_SIZE", 0}, {"XGEMM_SKINNY_MAX_N", 0}, {"XGEMM_STREAMK_OCCUPANCY", 0}},
+    {{"XGEMM_MIN_INDIRECT_SIZE", 0}, {"XGEMM_SKINNY_MAX_N", 0},
+     {"XGEMM_STREAMK_OCCUPANCY", kOccupancy}, {"XGEMM_STREAMK_MAX_EFFICIENCY", 100}}
+  };
+  auto results = std::vector<std::vector<T>>();
+  for (const auto &setting : settings) {
+    auto *previous = (results.empty()) ? &regular_parameters : nullptr;
+    if (!ChangeKernelSelection(device, precision, setting, previous)) { return errors + 1; }
+    device_c.Write(queue, host_c.size(), host_c);
+    if (TestXgemm<T>::RunRoutine(args, buffers, queue) != StatusCode::kSuccess) {
+      errors++;
+      break;
+    }
+    results.push_back(std::vector<T>(host_c.size()));
+    device_c.Read(queue, host_c.size(), results.back());
+  }
+  if (!ChangeKernelSelection(device, precision, regular_parameters)) { errors++; }
+
+  // Compares the results
+  if (results.size() == settings.size()) {
+    for (auto i = size_t{0}; i < host_c.size(); ++i) {
+      if (!TestSimilarity(results[0][i], results[1][i])) { errors++; }
+      else { passed++; }
+    }
+  }
+
+  // Prints and returns the statistics
+  fprintf(stdout, "    %zu test(s) passed\n", passed);
+  fprintf(stdout, "    %zu test(s) failed\n", errors);
+  fprintf(stdout, "\n");
+  return errors;
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  auto errors = size_t{0};
+
+  // TRSM with the in-direct GEMM kernel for all steps of the blocked algorithm
+  errors += clblast::RunKernelSelectionTests<clblast::TestXtrsm<float>, float, float>(argc, argv, false, "STRSM", {{"XGEMM_MIN_INDIRECT_SIZE", 0}});
+
+  // GEMM with the skinny kernel for all problems with at most 32 rows or columns
+  errors += clblast::RunKernelSelectionTests<clblast::TestXgemm<float>, float, float>(argc, argv, true, "SGEMM", {{"XGEMM_SKINNY_MAX_N", 32}, {"XGEMM_SKINNY_MIN_M", 1}, {"XGEMM_SKINNY_MAX_K", 4096}});
+  errors += clblast::RunKernelSelectionTests<clblast::TestXgemm<clblast::float2>, clblast::float2, clblast::float2>(argc, argv, true, "CGEMM", {{"XGEMM_SKINNY_MAX_N", 32}, {"XGEMM_SKINNY_MIN_M", 1}, {"XGEMM_SKINNY_MAX_K", 4096}});
+
+  // Reductions with a main and an epilogue kernel instead of the single-pass kernel
+  errors += clblast::RunKernelSelectionTests<clblast::TestXdot<float>, float, float>(argc, argv, true, "SDOT", {{"REDUCTION_SINGLE_PASS", 0}});
+  errors += clblast::RunKernelSelectionTests<clblast::TestXnrm2<float>, float, float>(argc, argv, true, "SNRM2", {{"REDUCTION_SINGLE_PASS", 0}});
+  errors += clblast::RunKernelSelectionTests<clblast::TestXnrm2<clblast::float2>, clblast::float2, clblast::float2>(argc, argv, true, "ScNRM2", {{"REDUCTION_SINGLE_PASS", 0}});
+  errors += clblast::RunKernelSelectionTests<clblast::TestXasum<float>, float, float>(argc, argv, true, "SASUM", {{"REDUCTION_SINGLE_PASS", 0}});
+
+  // GEMM with the stream-K kernel
+  errors += clblast::RunStreamKTests<float>(argc, argv, "SGEMM");
+  errors += clblast::RunStreamKTests<clblast::float2>(argc, argv, "CGEMM");
+  if (errors > 0) { return 1; } else { return 0; }
+}
+
+// =================================================================================================
@@ -0,0 +1,218 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file contains the tests for the LoadTuningResults function
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <fstream>
+#include <cstdio>
+#include <random>
+
+#if defined(_WIN32)
+  #include <direct.h>
+#else
+  #include <sys/stat.h>
+  #include <unistd.h>
+#endif
+
+#include "utilities/utilities.hpp"
+#include "test/routines/level3/xgemm.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// Writes a JSON file in the format of the tuners, with a single result for the given device
+void WriteTuningResults(const std::string &filename, const Device &device, const Precision precision,
+                        const std::string &parameters, const std::string &kernel_family = "xgemm_1",
+                        const std::string &kernel = "Xgemm") {
+  std::ofstream file(filename);
+  file << "{\n";
+  file << "  \"kernel_family\": \"" << kernel_family << "\",\n";
+  file << "  \"precision\": \"" << static_cast<int>(precision) << "\",\n";
+  file << "  \"device\": \"" << device.Name() << "\",\n";
+  file << "  \"device_vendor\": \"" << device.Vendor() << "\",\n";
+  file << "  \"device_type\": \"" << device.Type() << "\",\n";
+  file << "  \"results\": [\n";
+  file << "    { \"kernel\": \"" << kernel << "\", \"time\": 1.00, \"parameters\": {" << parameters << "} }\n";
+  file << "  ]\n";
+  file << "}\n";
+}
+
+// Creates or removes a directory for tuning results
+void MakeDirectory(const std::string &path) {
+  #if defined(_WIN32)
+    _mkdir(path.c_str());
+  #else
+    mkdir(path.c_str(), 0755);
+  #endif
+}
+void RemoveDirectory(const std::string &path) {
+  #if defined(_WIN32)
+    _rmdir(path.c_str());
+  #else
+    rmdir(path.c_str());
+  #endif
+}
+
+template <typename T>
+size_t RunLoadTuningResultsTests(int argc, char *argv[], const bool silent, const std::string &routine_name) {
+  auto arguments = RetrieveCommandLineArguments(argc, argv);
+  auto errors = size_t{0};
+  auto passed = size_t{0};
+  auto example_routine = TestXgemm<T>();
+  constexpr auto kSeed = 42; // fixed seed for reproducibility
+
+  // Determines the test settings: the name of the file is unique per precision
+  const auto precision = PrecisionValue<T>();
+  const auto filename = "clblast_test_tuning_results_" + std::to_string(static_cast<int>(precision)) + ".json";
+  const auto valid_settings = std::vector<std::string>{
+    "\"KWG\": 16, \"KWI\": 2, \"MDIMA\": 4, \"MDIMC\": 4, \"MWG\": 16, \"NDIMB\": 4, \"NDIMC\": 4, \"NWG\": 16, \"SA\": 0, \"SB\": 0, \"STRM\": 0, \"STRN\": 0, \"VWM\": 1, \"VWN\": 1",
+    "\"KWG\": 32, \"KWI\": 2, \"MDIMA\": 4, \"MDIMC\": 4, \"MWG\": 32, \"NDIMB\": 4, \"NDIMC\": 4, \"NWG\": 32, \"SA\": 0, \"SB\": 0, \"STRM\": 0, \"STRN\": 0, \"VWM\": 1, \"VWN\": 1, \"PRECISION\": 32",
+    "\"KWI\": 2, \"MDIMA\": 4, \"MDIMC\": 4, \"MWG\": 16, \"NDIMB\": 4, \"NDIMC\": 4, \"NWG\": 16, \"SA\": 0", // the others keep their current values
+  };
+  const auto invalid_settings = std::vector<std::string>{
+    "\"KWG\": 16, \"KWI\": 2, \"MDIMA\": 4,",
+  };
+
+  // Retrieves the arguments
+  auto help = std::string{"Options given/available:\n"};
+  const auto platform_id = GetArgument(arguments, help, kArgPlatform, ConvertArgument(std::getenv("CLBLAST_PLATFORM"), size_t{0}));
+  const auto device_id = GetArgument(arguments, help, kArgDevice, ConvertArgument(std::getenv("CLBLAST_DEVICE"), size_t{0}));
+  auto args = Arguments<T>{};
+  args.m = GetArgument(arguments, help, kArgM, size_t{256});
+  args.n = GetArgument(arguments, help, kArgN, size_t{256});
+  args.k = GetArgument(arguments, help, kArgK, size_t{256});
+  args.a_ld = GetArgument(arguments, help, kArgALeadDim, args.k);
+  args.b_ld = GetArgument(arguments, help, kArgBLeadDim, args.n);
+  args.c_ld = GetArgument(arguments, help, kArgCLeadDim, args.n);
+  args.a_offset = GetArgument(arguments, help, kArgAOffset, size_t{0});
+  args.b_offset = GetArgument(arguments, help, kArgBOffset, size_t{0});
+  args.c_offset = GetArgument(arguments, help, kArgCOffset, size_t{0});
+  args.layout = GetArgument(arguments, help, kArgLayout, Layout::kRowMajor);
+  args.a_transpose = GetArgument(arguments, help, kArgATransp, Transpose::kNo);
+  args.b_transpose = GetArgument(arguments, help, kArgBTransp, Transpose::kNo);
+  args.alpha = GetArgument(arguments, help, kArgAlpha, GetScalar<T>());
+  args.beta  = GetArgument(arguments, help, kArgBeta, GetScalar<T>());
+
+  // Prints the help message (command-line arguments)
+  if (!silent) { fprintf(stdout, "\n* %s\n", help.c_str()); }
+
+  // Initializes OpenCL
+  const auto platform = Platform(platform_id);
+  const auto device = Device(platform, device_id);
+  const auto context = Context(device);
+  auto queue = Queue(context, device);
+
+  // Populate host matrices with some example data
+  auto host_a = std::vector<T>(args.m * args.k);
+  auto host_b = std::vector<T>(args.n * args.k);
+  auto host_c = std::vector<T>(args.m * args.n);
+  std::mt19937 mt(kSeed);
+  std::uniform_real_distribution<double> dist(kTestDataLowerLimit, kTestDataUpperLimit);
+  PopulateVector(host_a, mt, dist);
+  PopulateVector(host_b, mt, dist);
+  PopulateVector(host_c, mt, dist);
+
+  // Copy the matrices to the device
+  auto device_a = Buffer<T>(context, host_a.size());
+  auto device_b = Buffer<T>(context, host_b.size());
+  auto device_c = Buffer<T>(context, host_c.size());
+  device_a.Write(queue, host_a.size(), host_a);
+  device_b.Write(queue, host_b.size(), host_b);
+  device_c.Write(queue, host_c.size(), host_c);
+  auto dummy = Buffer<T>(context, 1);
+  auto buffers = Buffers<T>{dummy, dummy, device_a, device_b, device_c, dummy, dummy};
+
+  // Loops over the valid tuning results: run before and run afterwards
+  fprintf(stdout, "* Testing LoadTuningResults for '%s'\n", routine_name.c_str());
+  for (const auto &setting : valid_settings) {
+    const auto status_before = example_routine.RunRoutine(args, buffers, queue);
+    if (status_before != StatusCode::kSuccess) { errors++; continue; }
+
+    // Loads the tuning results
+    WriteTuningResults(filename, device, precision, setting);
+    const auto status = LoadTuningResults(filename);
+    if (status != StatusCode::kSuccess) { errors++; continue; } // error shouldn't occur
+
+    const auto status_after = example_routine.RunRoutine(args, buffers, queue);
+    if (status_after != StatusCode::kSuccess) { errors++; continue; }
+    passed++;
+  }
+
+  // Loops over the invalid tuning results (malformed): run before and run afterwards
+  for (const auto &setting : invalid_settings) {
+    const auto status_before = example_routine.RunRoutine(args, buffers, queue);
+    if (status_before != StatusCode::kSuccess) { errors++; continue; }
+
+    // Loads the tuning results
+    WriteTuningResults(filename, device, precision, setting);
+    const auto status = LoadTuningResults(filename);
+    if (status == StatusCode::kSuccess) { errors++; continue; } // error should occur
+
+    const auto status_after = example_routine.RunRoutine(args, buffers, queue);
+    if (status_after != StatusCode::kSuccess) { errors++; continue; }
+    passed++;
+  }
+  std::remove(filename.c_str());
+
+  // Loads the results of the two DOT tuners from a directory, which also holds a malformed file. The
+  // malformed file is skipped and reported, and the results of the two tuners (each tuning their own
+  // parameter) are merged into a single entry, which is used by e.g. NRM2.
+  fprintf(stdout, "* Testing LoadTuningResults of 'xdot_1' and 'xdot_2' for '%s'\n", routine_name.c_str());
+  const auto directory = "clblast_test_tuning_results_" + std::to_string(static_cast<int>(precision));
+  const auto dot_filenames = std::vector<std::string>{
+    directory + "/clblast_xdot_1.json", directory + "/clblast_xdot_2.json", directory + "/clblast_xgemm_1.json"
+  };
+  MakeDirectory(directory);
+  WriteTuningResults(dot_filenames[0], device, precision, "\"WGS1\": 64", "xdot_1", "Xdot");
+  WriteTuningResults(dot_filenames[1], device, precision, "\"WGS2\": 32", "xdot_2", "Xdot");
+  WriteTuningResults(dot_filenames[2], device, precision, invalid_settings.back());
+  if (LoadTuningResults(directory) != StatusCode::kInvalidTuningResults) { errors++; }
+  else {
+    auto device_nrm2 = Buffer<T>(context, 1);
+    auto queue_plain = queue();
+    auto event = cl_event{};
+    const auto status = Nrm2<T>(args.k, device_nrm2(), 0, device_a(), 0, 1, &queue_plain, &event);
+    if (status != StatusCode::kSuccess) { errors++; }
+    else {
+      clWaitForEvents(1, &event);
+      clReleaseEvent(event);
+      auto parameters = std::unordered_map<std::string,size_t>();
+      auto database_entry = std::string{};
+      const auto retrieved = RetrieveParameters(device(), "Xdot", precision, parameters, database_entry);
+      if (retrieved == StatusCode::kSuccess && parameters["WGS1"] == 64 && parameters["WGS2"] == 32) { passed++; }
+      else { errors++; }
+    }
+  }
+  for (const auto &dot_filename : dot_filenames) { std::remove(dot_filename.c_str()); }
+  RemoveDirectory(directory);
+
+  // Prints and returns the statistics
+  fprintf(stdout, "    %zu test(s) passed\n", passed);
+  fprintf(stdout, "    %zu test(s) failed\n", errors);
+  fprintf(stdout, "\n");
+  return errors;
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  auto errors = size_t{0};
+  errors += clblast::RunLoadTuningResultsTests<float>(argc, argv, false, "SGEMM");
+  errors += clblast::RunLoadTuningResultsTests<clblast::float2>(argc, argv, true, "CGEMM");
+  if (errors > 0) { return 1; } else { return 0; }
+}
+
+// =================================================================================================
@@ -0,0 +1,171 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file contains the tests for the local database file and the time budget of the online
+// tuning mode. These don't require an OpenCL device.
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+#include <fstream>
+#include <cstdio>
+#include <cstdlib>
+
+#include "utilities/utilities.hpp"
+#include "online_tuning.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// Sets or (with an empty value) removes an environmental variable
+void SetEnvironmentVariable(const std::string &name, const std::string &value) {
+  #if defined(_WIN32)
+    _putenv_s(name.c_str(), value.c_str());
+  #else
+    if (value.empty()) { unsetenv(name.c_str()); }
+    else { setenv(name.c_str(), value.c_str(), 1); }
+  #endif
+}
+
+// Returns whether two entries with a single device are equal
+bool EqualEntries(const Database::DatabaseEntry &a, const Database::DatabaseEntry &b) {
+  if (a.kernel != b.kernel || a.precision != b.precision) { return false; }
+  if (a.vendors.size() != 1 || b.vendors.size() != 1) { return false; }
+  const auto &vendor_a = a.vendors.front();
+  const auto &vendor_b = b.vendors.front();
+  if (vendor_a.type != vendor_b.type || vendor_a.name != vendor_b.name) { return false; }
+  if (vendor_a.devices.size() != 1 || vendor_b.devices.size() != 1) { return false; }
+  const auto &device_a = vendor_a.devices.front();
+  const auto &device_b = vendor_b.devices.front();
+  return device_a.name == device_b.name && *device_a.parameters == *device_b.parameters;
+}
+
+size_t RunOnlineTuningTests() {
+  auto errors = size_t{0};
+  auto passed = size_t{0};
+
+  // Tests the parsing of lines of the local database file, which are formatted in the same way
+  fprintf(stdout, "* Testing ParseLocalDatabaseEntry and FormatLocalDatabaseEntry\n");
+  const auto valid_lines = std::vector<std::string>{
+    "Xaxpy\t32\tGPU\tNVIDIA\tGeForce GTX 1080\tVW=4 WGS=128 WPT=1",
+    "Xgemm\t3232\tCPU\tIntel\tIntel(R) Core(TM) i7-6700K CPU @ 4.00GHz\tKWG=32 MWG=64 NWG=64",
+    "Xdot\t64\tGPU\tAMD\tTonga\t",
+  };
+  for (const auto &line : valid_lines) {
+    auto entry = Database::DatabaseEntry{};
+    if (ParseLocalDatabaseEntry(line, entry) && FormatLocalDatabaseEntry(entry) == line) {
+      passed++;
+      continue;
+    }
+    fprintf(stdout, "   Error: line '%s' is not parsed and formatted back\n", line.c_str());
+    errors++;
+  }
+  auto parsed_entry = Database::DatabaseEntry{};
+  ParseLocalDatabaseEntry(valid_lines[0], parsed_entry);
+  const auto &parsed_device = parsed_entry.vendors.front().devices.front();
+  if (parsed_entry.kernel == "Xaxpy" && parsed_entry.precision == Precision::kSingle &&
+      parsed_entry.vendors.front().type == "GPU" && parsed_entry.vendors.front().name == "NVIDIA" &&
+      parsed_device.name == "GeForce GTX 1080" && parsed_device.parameters->size() == 3 &&
+      parsed_device.parameters->at("WGS") == 128) { passed++; }
+  else {
+    fprintf(stdout, "   Error: unexpected fields of the parsed line '%s'\n", valid_lines[0].c_str());
+    errors++;
+  }
+
+  // Tests malformed lines: missing fields, a parameter without value and non-numeric values
+  const auto invalid_lines = std::vector<std::string>{
+    "",
+    "Xaxpy\t32\tGPU\tNVIDIA\tVW=4 WGS=128 WPT=1",
+    "Xaxpy\t32\tGPU\tNVIDIA\tGeForce GTX 1080\tVW=4 WGS WPT=1",
+    "Xaxpy\t32\tGPU\tNVIDIA\tGeForce GTX 1080\tVW=4 WGS=many WPT=1",
+    "Xaxpy\tsingle\tGPU\tNVIDIA\tGeForce GTX 1080\tVW=4 WGS=128 WPT=1",
+  };
+  for (const auto &line : invalid_lines) {
+    auto entry = Database::DatabaseEntry{};
+    if (!ParseLocalDatabaseEntry(line, entry)) { passed++; continue; }
+    fprintf(stdout, "   Error: malformed line '%s' is accepted\n", line.c_str());
+    errors++;
+  }
+
+  // Tests writing and reading back a local database file, which also contains lines to skip
+  fprintf(stdout, "* Testing AppendLocalDatabaseEntry and ReadLocalDatabase\n");
+  const auto path = std::string{"clblast_test_online_tuning.db"};
+  std::remove(path.c_str());
+  if (ReadLocalDatabase(path).empty()) { passed++; }
+  else {
+    fprintf(stdout, "   Error: a missing local database file is not empty\n");
+    errors++;
+  }
+  auto entries = std::vector<Database::DatabaseEntry>();
+  for (const auto &line : valid_lines) {
+    auto entry = Database::DatabaseEntry{};
+    ParseLocalDatabaseEntry(line, entry);
+    entries.push_back(entry);
+  }
+  AppendLocalDatabaseEntry(path, entries[0]);
+  {
+    std::ofstream file(path, std::ios::app);
+    file << "# A comment\n\n" << invalid_lines[2] << "\n";
+  }
+  AppendLocalDatabaseEntry(path, entries[1]);
+  AppendLocalDatabaseEntry(path, entries[2]);
+  const auto read_entries = ReadLocalDatabase(path);
+  if (read_entries.size() == entries.size()) {
+    for (auto i = size_t{0}; i < entries.size(); ++i) {
+      if (EqualEntries(read_entries[i], entries[i])) { passed++; continue; }
+      fprintf(stdout, "   Error: entry %zu differs after writing and reading\n", i);
+      errors++;
+    }
+  }
+  else {
+    fprintf(stdout, "   Error: expected %zu entries, found %zu\n", entries.size(),
+            read_entries.size());
+    errors++;
+  }
+  std::remove(path.c_str());
+
+  // Tests the time budget: only non-negative numbers are accepted, otherwise the default is used
+  fprintf(stdout, "* Testing OnlineTuningBudget\n");
+  const auto budget_tests = std::vector<std::pair<std::string, size_t>>{
+    {"", kOnlineTuningDefaultBudget},
+    {"3", 3},
+    {"0", 0},
+    {"120", 120},
+    {"-1", kOnlineTuningDefaultBudget},
+    {"abc", kOnlineTuningDefaultBudget},
+    {"5s", kOnlineTuningDefaultBudget},
+  };
+  for (const auto &test : budget_tests) {
+    SetEnvironmentVariable(kOnlineTuningBudgetVariable, test.first);
+    const auto budget = OnlineTuningBudget();
+    if (budget == test.second) { passed++; continue; }
+    fprintf(stdout, "   Error: expected a budget of %zu for '%s', found %zu\n",
+            test.second, test.first.c_str(), budget);
+    errors++;
+  }
+  SetEnvironmentVariable(kOnlineTuningBudgetVariable, "");
+
+  // Prints and returns the statistics
+  fprintf(stdout, "    %zu test(s) passed\n", passed);
+  fprintf(stdout, "    %zu test(s) failed\n", errors);
+  fprintf(stdout, "\n");
+  return errors;
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// Main function (not within the clblast namespace)
+int main() {
+  const auto errors = clblast::RunOnlineTuningTests();
+  if (errors > 0) { return 1; } else { return 0; }
+}
+
+// =================================================================================================
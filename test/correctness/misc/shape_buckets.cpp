@@ -0,0 +1,97 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file contains the tests for the classification of problems into shape classes and for the
+// corresponding names of the kernels in the database. These don't require an OpenCL device.
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+#include <cstdio>
+
+#include "utilities/utilities.hpp"
+#include "database/database.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// An m-by-n-by-k problem and its expected shape class (or an empty string for a regular shape)
+struct ShapeBucketTest {
+  size_t m;
+  size_t n;
+  size_t k;
+  std::string expected;
+};
+
+size_t RunShapeBucketTests() {
+  auto errors = size_t{0};
+  auto passed = size_t{0};
+
+  // Tests the classification of problems, including the thresholds and the order of the checks
+  fprintf(stdout, "* Testing ShapeBucket\n");
+  const auto shape_tests = std::vector<ShapeBucketTest>{
+    {1024, 1024, 1024, ""},
+    {128, 128, 128, "small"},
+    {128, 128, 129, ""},
+    {64, 64, 64, "small"},
+    {4096, 256, 512, "wide"},
+    {4096, 257, 512, ""},
+    {256, 4096, 512, "wide"},
+    {1, 1, 1, "small"},
+    {64, 64, 1024, "deep"},
+    {64, 64, 1023, ""},
+    {64, 64, 512, "small"},
+    {64, 64, 513, ""},
+    {256, 256, 4096, "deep"},
+    {16, 256, 4096, "deep"},
+    {16, 256, 4095, "wide"},
+  };
+  for (const auto &test : shape_tests) {
+    const auto shape_bucket = Database::ShapeBucket(test.m, test.n, test.k);
+    if (shape_bucket == test.expected) { passed++; continue; }
+    fprintf(stdout, "   Error: expected '%s' for %zu x %zu x %zu, found '%s'\n",
+            test.expected.c_str(), test.m, test.n, test.k, shape_bucket.c_str());
+    errors++;
+  }
+
+  // Tests the names of the kernels of the shape classes in the database
+  fprintf(stdout, "* Testing ShapeBucketKernelName and FamilyKernelName\n");
+  const auto name_tests = std::vector<std::vector<std::string>>{
+    {Database::ShapeBucketKernelName("Xgemm", "small"), "XgemmSmall"},
+    {Database::ShapeBucketKernelName("XgemmDirect", "deep"), "XgemmDirectDeep"},
+    {Database::ShapeBucketKernelName("Xgemm", ""), "Xgemm"},
+    {Database::FamilyKernelName("xgemm_1"), "Xgemm"},
+    {Database::FamilyKernelName("xgemm_direct_2"), "XgemmDirect"},
+    {Database::FamilyKernelName("xgemm_1_small"), "XgemmSmall"},
+    {Database::FamilyKernelName("xgemm_direct_1_wide"), "XgemmDirectWide"},
+  };
+  for (const auto &test : name_tests) {
+    if (test[0] == test[1]) { passed++; continue; }
+    fprintf(stdout, "   Error: expected '%s', found '%s'\n", test[1].c_str(), test[0].c_str());
+    errors++;
+  }
+
+  // Prints and returns the statistics
+  fprintf(stdout, "    %zu test(s) passed\n", passed);
+  fprintf(stdout, "    %zu test(s) failed\n", errors);
+  fprintf(stdout, "\n");
+  return errors;
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// Main function (not within the clblast namespace)
+int main() {
+  const auto errors = clblast::RunShapeBucketTests();
+  if (errors > 0) { return 1; } else { return 0; }
+}
+
+// =================================================================================================
@@ -56,6 +56,7 @@ class TestBlas: public Tester<T,U> {
   static const std::vector<size_t> kMatrixDims;
   static const std::vector<size_t> kMatrixVectorDims;
   static const std::vector<size_t> kBandSizes;
+  static const std::vector<size_t> kRanks;
   static const std::vector<size_t> kBatchCounts;
   const std::vector<size_t> kOffsets;
   const std::vector<U> kAlphaValues;
@@ -217,7 +218,7 @@ size_t RunTests(int argc, char *argv[], const bool silent, const std::string &na
   for (auto &option: options) {
     if (option == kArgM) { ms = dimensions; }
     if (option == kArgN) { ns = dimensions; }
-    if (option == kArgK) { ks = dimensions; }
+    if (option == kArgK) { ks = (C::BLASLevel() == 2) ? tester.kRanks : dimensions; }
     if (option == kArgKU) { kus = tester.kBandSizes; }
     if (option == kArgKL) { kls = tester.kBandSizes; }
     if (option == kArgLayout) { layouts = tester.kLayouts; }
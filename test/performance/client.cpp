@@ -17,6 +17,8 @@
 #include <algorithm>
 #include <chrono>
 #include <random>
+#include <fstream>
+#include <cstdio>
 
 #include "utilities/utilities.hpp"
 #include "test/performance/client.hpp"
@@ -132,6 +134,9 @@ Arguments<U> Client<T,U>::ParseArguments(int argc, char *argv[], const size_t le
   args.silent         = CheckArgument(command_line_args, help, kArgQuiet);
   args.no_abbrv       = CheckArgument(command_line_args, help, kArgNoAbbreviations);
   warm_up_            = CheckArgument(command_line_args, help, kArgWarmUp);
+  roofline_           = CheckArgument(command_line_args, help, kArgRoofline);
+  roofline_cache_     = GetArgument(command_line_args, help, kArgRooflineCache, std::string{"clblast_roofline.txt"});
+  json_file_          = GetArgument(command_line_args, help, kArgJsonOutput, std::string{""});
 
   // Prints the chosen (or defaulted) arguments to screen. This also serves as the help message,
   // which is thus always displayed (unless silence is specified).
@@ -171,14 +176,30 @@ Arguments<U> Client<T,U>::ParseArguments(int argc, char *argv[], const size_t le
 template <typename T, typename U>
 void Client<T,U>::PerformanceTest(Arguments<U> &args, const SetMetric set_sizes) {
 
-  // Prints the header of the output table
-  PrintTableHeader(args);
-
   // Initializes OpenCL and the libraries
   auto platform = Platform(args.platform_id);
   auto device = Device(platform, args.device_id);
   auto context = Context(device);
   auto queue = Queue(context, device);
+
+  // Estimates the peaks of the device for the roofline model, or retrieves them from the cache
+  if (roofline_) {
+    try {
+      peaks_ = GetRooflinePeaks(context, device, queue, args.precision, roofline_cache_);
+      if (!args.silent) {
+        fprintf(stdout, "* Roofline peaks: %.1lf GFLOPS, %.1lf GB/s global memory, "
+                "%.1lf GB/s local memory\n\n", peaks_.gflops, peaks_.global_gbs, peaks_.local_gbs);
+      }
+    } catch (...) {
+      if (!args.silent) {
+        fprintf(stdout, "* Failed to estimate the roofline peaks of this device, disabling\n\n");
+      }
+      roofline_ = false;
+    }
+  }
+
+  // Prints the header of the output table
+  PrintTableHeader(args);
   #ifdef CLBLAST_REF_CLBLAS
     if (args.compare_clblas) { clblasSetup(); }
   #endif
@@ -187,6 +208,7 @@ void Client<T,U>::PerformanceTest(Arguments<U> &args, const SetMetric set_sizes)
   #endif
 
   // Iterates over all "num_step" values jumping by "step" each time
+  auto json_rows = std::vector<std::string>();
   auto s = size_t{0};
   while(true) {
 
@@ -256,6 +278,7 @@ void Client<T,U>::PerformanceTest(Arguments<U> &args, const SetMetric set_sizes)
 
     // Prints the performance of the tested libraries
     PrintTableRow(args, timings);
+    if (!json_file_.empty()) { json_rows.push_back(JsonTableRow(args, timings)); }
 
     // Makes the jump to the next step
     ++s;
@@ -268,6 +291,9 @@ void Client<T,U>::PerformanceTest(Arguments<U> &args, const SetMetric set_sizes)
     args.c_ld += args.step;
   }
 
+  // Writes the results to file (optional)
+  if (!json_file_.empty()) { WriteJsonFile(args, device, json_rows); }
+
   // Cleans-up and returns
   #ifdef CLBLAST_REF_CLBLAS
     if (args.compare_clblas) { clblasTeardown(); }
@@ -341,6 +367,7 @@ void Client<T,U>::PrintTableHeader(const Arguments<U>& args) {
   if (args.compare_clblas) { fprintf(stdout, ";%9s;%9s;%9s", "ms_2", "GFLOPS_2", "GBs_2"); }
   if (args.compare_cblas) { fprintf(stdout, ";%9s;%9s;%9s", "ms_3", "GFLOPS_3", "GBs_3"); }
   if (args.compare_cublas) { fprintf(stdout, ";%9s;%9s;%9s", "ms_4", "GFLOPS_4", "GBs_4"); }
+  if (roofline_) { fprintf(stdout, ";%9s", "roof_1"); }
   fprintf(stdout, "\n");
 }
 
@@ -349,45 +376,9 @@ template <typename T, typename U>
 void Client<T,U>::PrintTableRow(const Arguments<U>& args,
                                 const std::vector<std::pair<std::string, double>>& timings) {
 
-  // Creates a vector of relevant variables
-  auto integers = std::vector<size_t>{};
-  for (auto &o: options_) {
-    if      (o == kArgM) {        integers.push_back(args.m); }
-    else if (o == kArgN) {        integers.push_back(args.n); }
-    else if (o == kArgK) {        integers.push_back(args.k); }
-    else if (o == kArgKU) {       integers.push_back(args.ku); }
-    else if (o == kArgKL) {       integers.push_back(args.kl); }
-    else if (o == kArgLayout) {   integers.push_back(static_cast<size_t>(args.layout)); }
-    else if (o == kArgSide) {     integers.push_back(static_cast<size_t>(args.side)); }
-    else if (o == kArgTriangle) { integers.push_back(static_cast<size_t>(args.triangle)); }
-    else if (o == kArgATransp) {  integers.push_back(static_cast<size_t>(args.a_transpose)); }
-    else if (o == kArgBTransp) {  integers.push_back(static_cast<size_t>(args.b_transpose)); }
-    else if (o == kArgDiagonal) { integers.push_back(static_cast<size_t>(args.diagonal)); }
-    else if (o == kArgXInc) {     integers.push_back(args.x_inc); }
-    else if (o == kArgYInc) {     integers.push_back(args.y_inc); }
-    else if (o == kArgXOffset) {  integers.push_back(args.x_offset); }
-    else if (o == kArgYOffset) {  integers.push_back(args.y_offset); }
-    else if (o == kArgALeadDim) { integers.push_back(args.a_ld); }
-    else if (o == kArgBLeadDim) { integers.push_back(args.b_ld); }
-    else if (o == kArgCLeadDim) { integers.push_back(args.c_ld); }
-    else if (o == kArgAOffset) {  integers.push_back(args.a_offset); }
-    else if (o == kArgBOffset) {  integers.push_back(args.b_offset); }
-    else if (o == kArgCOffset) {  integers.push_back(args.c_offset); }
-    else if (o == kArgAPOffset) { integers.push_back(args.ap_offset); }
-    else if (o == kArgDotOffset) {integers.push_back(args.dot_offset); }
-    else if (o == kArgNrm2Offset){integers.push_back(args.nrm2_offset); }
-    else if (o == kArgAsumOffset){integers.push_back(args.asum_offset); }
-    else if (o == kArgImaxOffset){integers.push_back(args.imax_offset); }
-    else if (o == kArgBatchCount){integers.push_back(args.batch_count); }
-  }
-  auto strings = std::vector<std::string>{};
-  for (auto &o: options_) {
-    if      (o == kArgAlpha) {    strings.push_back(ToString(args.alpha)); }
-    else if (o == kArgBeta) {     strings.push_back(ToString(args.beta)); }
-  }
-
   // Outputs the argument values
-  for (auto &argument: integers) {
+  for (const auto &integer: IntegerArguments(args)) {
+    const auto argument = integer.second;
     if (!args.no_abbrv && argument >= 1024*1024 && IsMultiple(argument, 1024*1024)) {
       fprintf(stdout, "%8zuM;", argument/(1024*1024));
     }
@@ -398,8 +389,8 @@ void Client<T,U>::PrintTableRow(const Arguments<U>& args,
       fprintf(stdout, "%9zu;", argument);
     }
   }
-  for (auto &argument: strings) {
-    fprintf(stdout, "%9s;", argument.c_str());
+  for (const auto &argument: ScalarArguments(args)) {
+    fprintf(stdout, "%9s;", argument.second.c_str());
   }
 
   // Loops over all tested libraries
@@ -415,9 +406,143 @@ void Client<T,U>::PrintTableRow(const Arguments<U>& args,
     if (timing.first != "CLBlast") { fprintf(stdout, ";"); }
     fprintf(stdout, "%9.2lf;%9.1lf;%9.1lf", timing.second, gflops, gbs);
   }
+
+  // Outputs CLBlast's achieved percentage of the roofline bound (optional)
+  if (roofline_) {
+    const auto fraction = RooflineFraction(peaks_, get_flops_(args), get_bytes_(args),
+                                           timings.front().second);
+    fprintf(stdout, ";%9.1lf", 100.0 * fraction);
+  }
   fprintf(stdout, "\n");
 }
 
+// Collects the values of the integer arguments of the routine
+template <typename T, typename U>
+std::vector<std::pair<std::string, size_t>>
+Client<T,U>::IntegerArguments(const Arguments<U>& args) const {
+  auto integers = std::vector<std::pair<std::string, size_t>>{};
+  for (auto &o: options_) {
+    if      (o == kArgM) {        integers.push_back({o, args.m}); }
+    else if (o == kArgN) {        integers.push_back({o, args.n}); }
+    else if (o == kArgK) {        integers.push_back({o, args.k}); }
+    else if (o == kArgKU) {       integers.push_back({o, args.ku}); }
+    else if (o == kArgKL) {       integers.push_back({o, args.kl}); }
+    else if (o == kArgLayout) {   integers.push_back({o, static_cast<size_t>(args.layout)}); }
+    else if (o == kArgSide) {     integers.push_back({o, static_cast<size_t>(args.side)}); }
+    else if (o == kArgTriangle) { integers.push_back({o, static_cast<size_t>(args.triangle)}); }
+    else if (o == kArgATransp) {  integers.push_back({o, static_cast<size_t>(args.a_transpose)}); }
+    else if (o == kArgBTransp) {  integers.push_back({o, static_cast<size_t>(args.b_transpose)}); }
+    else if (o == kArgDiagonal) { integers.push_back({o, static_cast<size_t>(args.diagonal)}); }
+    else if (o == kArgXInc) {     integers.push_back({o, args.x_inc}); }
+    else if (o == kArgYInc) {     integers.push_back({o, args.y_inc}); }
+    else if (o == kArgXOffset) {  integers.push_back({o, args.x_offset}); }
+    else if (o == kArgYOffset) {  integers.push_back({o, args.y_offset}); }
+    else if (o == kArgALeadDim) { integers.push_back({o, args.a_ld}); }
+    else if (o == kArgBLeadDim) { integers.push_back({o, args.b_ld}); }
+    else if (o == kArgCLeadDim) { integers.push_back({o, args.c_ld}); }
+    else if (o == kArgAOffset) {  integers.push_back({o, args.a_offset}); }
+    else if (o == kArgBOffset) {  integers.push_back({o, args.b_offset}); }
+    else if (o == kArgCOffset) {  integers.push_back({o, args.c_offset}); }
+    else if (o == kArgAPOffset) { integers.push_back({o, args.ap_offset}); }
+    else if (o == kArgDotOffset) {integers.push_back({o, args.dot_offset}); }
+    else if (o == kArgNrm2Offset){integers.push_back({o, args.nrm2_offset}); }
+    else if (o == kArgAsumOffset){integers.push_back({o, args.asum_offset}); }
+    else if (o == kArgImaxOffset){integers.push_back({o, args.imax_offset}); }
+    else if (o == kArgBatchCount){integers.push_back({o, args.batch_count}); }
+  }
+  return integers;
+}
+
+// Collects the values of the scalar arguments of the routine as strings
+template <typename T, typename U>
+std::vector<std::pair<std::string, std::string>>
+Client<T,U>::ScalarArguments(const Arguments<U>& args) const {
+  auto strings = std::vector<std::pair<std::string, std::string>>{};
+  for (auto &o: options_) {
+    if      (o == kArgAlpha) {    strings.push_back({o, ToString(args.alpha)}); }
+    else if (o == kArgBeta) {     strings.push_back({o, ToString(args.beta)}); }
+  }
+  return strings;
+}
+
+// =================================================================================================
+
+// Creates a JSON object with the argument values, the performance of each tested library, and
+// CLBlast's achieved fraction of the roofline bound (if enabled)
+template <typename T, typename U>
+std::string Client<T,U>::JsonTableRow(const Arguments<U>& args,
+                                      const std::vector<std::pair<std::string, double>>& timings)
+                                      const {
+  const auto flops = get_flops_(args);
+  const auto bytes = get_bytes_(args);
+  char value[128];
+  auto row = std::string{"    {\n      \"arguments\": {"};
+  auto separator = std::string{""};
+  for (const auto &integer: IntegerArguments(args)) {
+    row += separator + "\"" + integer.first + "\": " + ToString(integer.second);
+    separator = ", ";
+  }
+  for (const auto &scalar: ScalarArguments(args)) {
+    row += separator + "\"" + scalar.first + "\": \"" + scalar.second + "\"";
+    separator = ", ";
+  }
+  row += "},\n      \"results\": [\n";
+  for (auto i = size_t{0}; i < timings.size(); ++i) {
+    const auto ms = timings[i].second;
+    const auto gflops = (ms != 0.0) ? (flops*1e-6)/ms : 0.0;
+    const auto gbs = (ms != 0.0) ? (bytes*1e-6)/ms : 0.0;
+    snprintf(value, sizeof(value), "\"ms\": %.4lf, \"GFLOPS\": %.2lf, \"GBs\": %.2lf",
+             ms, gflops, gbs);
+    row += "        {\"library\": \"" + timings[i].first + "\", " + value + "}";
+    row += (i + 1 < timings.size()) ? ",\n" : "\n";
+  }
+  row += "      ]";
+  if (bytes != 0) {
+    const auto arithmetic_intensity = static_cast<double>(flops) / static_cast<double>(bytes);
+    snprintf(value, sizeof(value), "%.4lf", arithmetic_intensity);
+    row += ",\n      \"arithmetic_intensity\": " + std::string{value};
+  }
+  if (roofline_) {
+    snprintf(value, sizeof(value), "%.2lf", RooflineBound(peaks_, flops, bytes));
+    row += ",\n      \"roofline_GFLOPS\": " + std::string{value};
+    snprintf(value, sizeof(value), "%.4lf",
+             RooflineFraction(peaks_, flops, bytes, timings.front().second));
+    row += ",\n      \"roofline_fraction\": " + std::string{value};
+  }
+  row += "\n    }";
+  return row;
+}
+
+// Writes the JSON file with the device and the (optional) roofline peaks, followed by all rows
+template <typename T, typename U>
+void Client<T,U>::WriteJsonFile(const Arguments<U>& args, const Device &device,
+                                const std::vector<std::string>& rows) const {
+  std::ofstream file(json_file_);
+  if (!file) {
+    fprintf(stdout, "* Failed to write the results to '%s'\n", json_file_.c_str());
+    return;
+  }
+  file << "{\n";
+  file << "  \"device\": \"" << device.Name() << "\",\n";
+  file << "  \"device_vendor\": \"" << device.Vendor() << "\",\n";
+  file << "  \"platform_id\": " << args.platform_id << ",\n";
+  file << "  \"device_id\": " << args.device_id << ",\n";
+  file << "  \"precision\": " << static_cast<int>(args.precision) << ",\n";
+  if (roofline_) {
+    char peaks[128];
+    snprintf(peaks, sizeof(peaks),
+             "{\"GFLOPS\": %.2lf, \"global_GBs\": %.2lf, \"local_GBs\": %.2lf}",
+             peaks_.gflops, peaks_.global_gbs, peaks_.local_gbs);
+    file << "  \"roofline\": " << peaks << ",\n";
+  }
+  file << "  \"results\": [\n";
+  for (auto r = size_t{0}; r < rows.size(); ++r) {
+    file << rows[r] << ((r + 1 < rows.size()) ? ",\n" : "\n");
+  }
+  file << "  ]\n";
+  file << "}\n";
+}
+
 // =================================================================================================
 
 // Compiles the templated class
@@ -16,6 +16,9 @@
 // This file also provides the common interface to the performance client (see the 'RunClient'
 // function for details).
 //
+// Optionally, the client reports the achieved fraction of the device's roofline bound (see
+// 'roofline.hpp') and writes all results as JSON to a file.
+//
 // =================================================================================================
 
 #ifndef CLBLAST_TEST_PERFORMANCE_CLIENT_H_
@@ -26,6 +29,7 @@
 #include <utility>
 
 #include "utilities/utilities.hpp"
+#include "test/performance/roofline.hpp"
 
 // The libraries to test
 #ifdef CLBLAST_REF_CLBLAS
@@ -82,6 +86,16 @@ class Client {
   void PrintTableRow(const Arguments<U>& args,
                      const std::vector<std::pair<std::string, double>>& timings);
 
+  // Retrieves the values of the routine-specific integer and scalar arguments, with their names
+  std::vector<std::pair<std::string, size_t>> IntegerArguments(const Arguments<U>& args) const;
+  std::vector<std::pair<std::string, std::string>> ScalarArguments(const Arguments<U>& args) const;
+
+  // Creates a JSON object with a row of performance data, and writes all such rows to a file
+  std::string JsonTableRow(const Arguments<U>& args,
+                           const std::vector<std::pair<std::string, double>>& timings) const;
+  void WriteJsonFile(const Arguments<U>& args, const Device &device,
+                     const std::vector<std::string>& rows) const;
+
   // The routine-specific functions passed to the tester
   const Routine run_routine_;
   const Reference1 run_reference1_;
@@ -95,6 +109,10 @@ class Client {
 
   // Extra arguments
   bool warm_up_; // if enabled, do a warm-up run first before measuring execution time
+  bool roofline_; // if enabled, print the achieved fraction of the roofline bound
+  std::string roofline_cache_; // the file with the cached roofline peaks of the devices
+  std::string json_file_; // if non-empty, the file to write the results to in JSON format
+  RooflinePeaks peaks_; // the roofline peaks of the current device (if enabled)
 };
 
 // =================================================================================================
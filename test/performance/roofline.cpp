@@ -0,0 +1,233 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the roofline model of the performance clients (see the header for more
+// information).
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+#include <limits>
+#include <fstream>
+#include <sstream>
+#include <algorithm>
+
+#include "test/performance/roofline.hpp"
+
+namespace clblast {
+// =================================================================================================
+namespace {
+
+// Settings of the calibration kernels: the initial and the maximum work per work-item, the minimum
+// execution time (in milliseconds) up to which the work is increased, the work-group size (at
+// most), the number of work-groups per compute unit, the size of each of the buffers of the copy,
+// and the number of timed runs of which the fastest one is used
+constexpr auto kMinIterations = size_t{512};
+constexpr auto kMaxIterations = size_t{1024*1024};
+constexpr auto kMinTimeMs = 5.0;
+constexpr auto kWorkGroupSize = size_t{128};
+constexpr auto kWorkGroupsPerComputeUnit = size_t{16};
+constexpr auto kCopyBytes = size_t{64*1024*1024};
+constexpr auto kNumRuns = size_t{3};
+
+// The calibration kernels. The multiply-add kernel runs eight independent chains per work-item,
+// starting from values unknown at compile-time, such that the compiler can't remove these. The
+// local memory kernel likewise accumulates into eight independent sums, such that it is limited by
+// the bandwidth rather than by the latency of the additions.
+const std::string kCalibrationSource = R"(
+#define MAD8 v0 = mad(v0, b, c); v1 = mad(v1, b, c); v2 = mad(v2, b, c); v3 = mad(v3, b, c); \
+             v4 = mad(v4, b, c); v5 = mad(v5, b, c); v6 = mad(v6, b, c); v7 = mad(v7, b, c);
+#define LM(offset) lm[(lid + i + (offset) * (WGS / 8)) & (WGS - 1)]
+#define LOAD8 a0 += LM(0); a1 += LM(1); a2 += LM(2); a3 += LM(3); \
+              a4 += LM(4); a5 += LM(5); a6 += LM(6); a7 += LM(7);
+
+__kernel void RooflineFlops(__global real* output, const int seed, const int iterations) {
+  const real b = ((real)seed) * ((real)0.5);
+  const real c = ((real)seed) * ((real)0.25);
+  const real start = (real)(get_global_id(0) % 8);
+  real v0 = start; real v1 = start + b; real v2 = start + c; real v3 = start - b;
+  real v4 = start - c; real v5 = start * b; real v6 = start * c; real v7 = start + b + c;
+  for (int i = 0; i < iterations; ++i) { MAD8 }
+  output[get_global_id(0)] = v0 + v1 + v2 + v3 + v4 + v5 + v6 + v7;
+}
+
+__kernel void RooflineCopy(const __global real4* restrict input, __global real4* output) {
+  output[get_global_id(0)] = input[get_global_id(0)];
+}
+
+__kernel __attribute__((reqd_work_group_size(WGS, 1, 1)))
+void RooflineLocal(__global real* output, const int seed, const int iterations) {
+  __local real lm[WGS];
+  const int lid = get_local_id(0);
+  lm[lid] = (real)(lid * seed);
+  barrier(CLK_LOCAL_MEM_FENCE);
+  real a0 = (real)0; real a1 = (real)0; real a2 = (real)0; real a3 = (real)0;
+  real a4 = (real)0; real a5 = (real)0; real a6 = (real)0; real a7 = (real)0;
+  for (int i = 0; i < iterations; ++i) { LOAD8 }
+  output[get_global_id(0)] = a0 + a1 + a2 + a3 + a4 + a5 + a6 + a7;
+}
+)";
+
+// Runs a kernel once as a warm-up and returns the execution time of the fastest of a couple of
+// runs in milliseconds. The time is measured on the device (event profiling), such that it doesn't
+// include the launch overhead.
+double TimeKernel(Queue &queue, Kernel &kernel, const size_t global, const size_t local) {
+  kernel.Launch(queue, {global}, {local}, nullptr);
+  queue.Finish();
+  auto best_time = std::numeric_limits<double>::max();
+  for (auto r = size_t{0}; r < kNumRuns; ++r) {
+    auto event = Event();
+    kernel.Launch(queue, {global}, {local}, event.pointer());
+    queue.Finish();
+    best_time = std::min(best_time, static_cast<double>(event.GetElapsedTime()));
+  }
+  return best_time;
+}
+
+// As above, but for a kernel with the number of iterations per work-item as its last argument. The
+// iterations are doubled until the kernel runs for at least 'kMinTimeMs', such that short kernels
+// are not dominated by the start-up of the work-groups and the resolution of the timer. Also
+// returns the final number of iterations.
+double TimeScaledKernel(Queue &queue, Kernel &kernel, const size_t global, const size_t local,
+                        const size_t iterations_argument, size_t &iterations) {
+  iterations = kMinIterations;
+  while (true) {
+    kernel.SetArgument(iterations_argument, static_cast<int>(iterations));
+    const auto time_ms = TimeKernel(queue, kernel, global, local);
+    if (time_ms >= kMinTimeMs || iterations >= kMaxIterations) { return time_ms; }
+    iterations *= 2;
+  }
+}
+
+// Measures the peaks by running the calibration kernels
+RooflinePeaks MeasurePeaks(const Context &context, const Device &device, Queue &queue,
+                           const Precision precision) {
+
+  // The real data-type of the precision
+  auto type = std::string{"float"};
+  auto type_size = sizeof(float);
+  auto extension = std::string{""};
+  if (precision == Precision::kHalf) {
+    type = "half";
+    type_size = sizeof(half);
+    extension = "#pragma OPENCL EXTENSION cl_khr_fp16: enable\n";
+  }
+  else if (precision == Precision::kDouble || precision == Precision::kComplexDouble) {
+    type = "double";
+    type_size = sizeof(double);
+    extension = "#pragma OPENCL EXTENSION cl_khr_fp64: enable\n";
+  }
+
+  // The largest power-of-two work-group size supported by the device
+  auto local = kWorkGroupSize;
+  while (local > 1 && !device.IsThreadConfigValid({local})) { local /= 2; }
+  const auto global = device.ComputeUnits() * kWorkGroupsPerComputeUnit * local;
+
+  // Compiles the calibration kernels
+  const auto source = extension + "#define real " + type + "\n#define real4 " + type + "4\n" +
+                      "#define WGS " + ToString(local) + "\n" + kCalibrationSource;
+  auto program = Program(context, source);
+  auto options = std::vector<std::string>();
+  program.Build(device, options);
+  const auto seed = 1;
+
+  // Peak multiply-add throughput: two flops per multiply-add
+  auto output = Buffer<char>(context, global * type_size);
+  auto flops_kernel = Kernel(program, "RooflineFlops");
+  flops_kernel.SetArgument(0, output());
+  flops_kernel.SetArgument(1, seed);
+  auto flops_iterations = size_t{0};
+  const auto flops_time = TimeScaledKernel(queue, flops_kernel, global, local, 2,
+                                           flops_iterations);
+  const auto flops = static_cast<double>(global * flops_iterations * 8 * 2);
+
+  // Peak global memory bandwidth: each element is read and written once
+  const auto vector_size = 4 * type_size;
+  const auto copy_bytes = std::min(kCopyBytes, static_cast<size_t>(device.MaxAllocSize()));
+  const auto copy_global = ((copy_bytes / vector_size) / local) * local;
+  auto input = Buffer<char>(context, copy_global * vector_size);
+  auto copy = Buffer<char>(context, copy_global * vector_size);
+  auto copy_kernel = Kernel(program, "RooflineCopy");
+  copy_kernel.SetArgument(0, input());
+  copy_kernel.SetArgument(1, copy());
+  const auto global_bytes = static_cast<double>(2 * copy_global * vector_size);
+  const auto global_time = TimeKernel(queue, copy_kernel, copy_global, local);
+
+  // Peak local memory bandwidth: each iteration reads eight elements
+  auto local_kernel = Kernel(program, "RooflineLocal");
+  local_kernel.SetArgument(0, output());
+  local_kernel.SetArgument(1, seed);
+  auto local_iterations = size_t{0};
+  const auto local_time = TimeScaledKernel(queue, local_kernel, global, local, 2,
+                                           local_iterations);
+  const auto local_bytes = static_cast<double>(global * local_iterations * 8 * type_size);
+
+  // Converts to GFLOPS and GB/s: the times are in milliseconds
+  return RooflinePeaks{flops * 1e-6 / flops_time, global_bytes * 1e-6 / global_time,
+                       local_bytes * 1e-6 / local_time};
+}
+
+} // anonymous namespace
+// =================================================================================================
+
+// Each line of the cache file holds the tab-separated device name, driver version, precision and
+// the three peaks
+RooflinePeaks GetRooflinePeaks(const Context &context, const Device &device, Queue &queue,
+                               const Precision precision, const std::string &cache_filename) {
+  const auto device_name = device.Name();
+  const auto driver_version = device.DriverVersion();
+  const auto precision_string = ToString(static_cast<int>(precision));
+
+  // Searches the cache file first
+  std::ifstream cache_file(cache_filename);
+  auto line = std::string{};
+  while (std::getline(cache_file, line)) {
+    auto fields = std::vector<std::string>();
+    auto field = std::string{};
+    std::istringstream line_stream(line);
+    while (std::getline(line_stream, field, '\t')) { fields.push_back(field); }
+    if (fields.size() != 6) { continue; }
+    if (fields[0] != device_name || fields[1] != driver_version || fields[2] != precision_string) {
+      continue;
+    }
+    try {
+      return RooflinePeaks{std::stod(fields[3]), std::stod(fields[4]), std::stod(fields[5])};
+    } catch (const std::exception &) { } // a bad line: measured again below
+  }
+  cache_file.close();
+
+  // Otherwise measures the peaks and adds them to the cache file
+  const auto peaks = MeasurePeaks(context, device, queue, precision);
+  if (!cache_filename.empty()) {
+    std::ofstream output_file(cache_filename, std::ios::app);
+    output_file << device_name << "\t" << driver_version << "\t" << precision_string << "\t"
+                << peaks.gflops << "\t" << peaks.global_gbs << "\t" << peaks.local_gbs << "\n";
+  }
+  return peaks;
+}
+
+// The lower of the compute and the memory roof
+double RooflineBound(const RooflinePeaks &peaks, const size_t flops, const size_t bytes) {
+  if (bytes == 0) { return peaks.gflops; }
+  const auto arithmetic_intensity = static_cast<double>(flops) / static_cast<double>(bytes);
+  return std::min(peaks.gflops, arithmetic_intensity * peaks.global_gbs);
+}
+
+// The fraction of the time the routine would take when running at the roofline bound
+double RooflineFraction(const RooflinePeaks &peaks, const size_t flops, const size_t bytes,
+                        const double time_ms) {
+  if (time_ms <= 0.0) { return 0.0; }
+  const auto compute_time_ms = static_cast<double>(flops) * 1e-6 / peaks.gflops;
+  const auto memory_time_ms = static_cast<double>(bytes) * 1e-6 / peaks.global_gbs;
+  return std::max(compute_time_ms, memory_time_ms) / time_ms;
+}
+
+// =================================================================================================
+} // namespace clblast
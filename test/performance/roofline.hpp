@@ -0,0 +1,56 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the roofline model of the performance clients. The peaks of a device are
+// estimated once per device and precision by running small calibration kernels: one measuring the
+// multiply-add throughput, one the global memory bandwidth (a copy) and one the local memory
+// bandwidth. These are cached in a file, such that later runs of the clients re-use them. Given the
+// arithmetic intensity of a routine (flops per byte), the roofline bound is the lower of the peak
+// compute throughput and the global memory bandwidth times the intensity.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_TEST_PERFORMANCE_ROOFLINE_H_
+#define CLBLAST_TEST_PERFORMANCE_ROOFLINE_H_
+
+#include <string>
+
+#include "utilities/utilities.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// The estimated peaks of a device for a certain precision. The compute peak is measured in real
+// arithmetic, i.e. with 'float' or 'double' for the complex precisions.
+struct RooflinePeaks {
+  double gflops;     // multiply-add throughput in GFLOPS
+  double global_gbs; // global memory bandwidth in GB/s
+  double local_gbs;  // local memory bandwidth in GB/s
+};
+
+// Retrieves the peaks of a device for a precision from the cache file, or measures these (and adds
+// them to the cache file) if they are not there yet. The cache file holds one line per device,
+// driver version and precision. An empty filename disables the cache.
+RooflinePeaks GetRooflinePeaks(const Context &context, const Device &device, Queue &queue,
+                               const Precision precision, const std::string &cache_filename);
+
+// Computes the attainable performance in GFLOPS according to the roofline model for a routine
+// performing a number of flops while transferring a number of bytes from/to global memory
+double RooflineBound(const RooflinePeaks &peaks, const size_t flops, const size_t bytes);
+
+// Computes the achieved fraction of the roofline bound of a routine given its execution time. This
+// also works for routines without flops (e.g. copies), which are bound by the bandwidth only.
+double RooflineFraction(const RooflinePeaks &peaks, const size_t flops, const size_t bytes,
+                        const double time_ms);
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_TEST_PERFORMANCE_ROOFLINE_H_
+#endif
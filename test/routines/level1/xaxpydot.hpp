@@ -0,0 +1,31 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file describes the Xaxpydot routine for the correctness tester and the performance tester,
+// using the class which it shares with the Xaxpynrm2 routine (see xaxpyreduction.hpp).
+//
+// =================================================================================================
+
+#ifndef CLBLAST_TEST_ROUTINES_XAXPYDOT_H_
+#define CLBLAST_TEST_ROUTINES_XAXPYDOT_H_
+
+#include "test/routines/level1/xaxpyreduction.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// The class describing the routine
+template <typename T>
+using TestXaxpydot = TestXaxpyReduction<T, false>;
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_TEST_ROUTINES_XAXPYDOT_H_
+#endif
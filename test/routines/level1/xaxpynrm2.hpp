@@ -0,0 +1,31 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file describes the Xaxpynrm2 routine for the correctness tester and the performance tester,
+// using the class which it shares with the Xaxpydot routine (see xaxpyreduction.hpp).
+//
+// =================================================================================================
+
+#ifndef CLBLAST_TEST_ROUTINES_XAXPYNRM2_H_
+#define CLBLAST_TEST_ROUTINES_XAXPYNRM2_H_
+
+#include "test/routines/level1/xaxpyreduction.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// The class describing the routine
+template <typename T>
+using TestXaxpynrm2 = TestXaxpyReduction<T, true>;
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_TEST_ROUTINES_XAXPYNRM2_H_
+#endif
@@ -0,0 +1,201 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements a class with static methods to describe the Xaxpydot and Xaxpynrm2 routines,
+// which differ only in the reduction that follows the vector update. Examples of such
+// 'descriptions' are how to calculate the size a of buffer or how to run the routine. These static
+// methods are used by the correctness tester and the performance tester.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_TEST_ROUTINES_XAXPYREDUCTION_H_
+#define CLBLAST_TEST_ROUTINES_XAXPYREDUCTION_H_
+
+#include "test/routines/common.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// Reference implementation of both routines: the reduction is a Euclidian norm if 'is_nrm2' is set
+// and a dot product otherwise
+template <typename T>
+StatusCode RunAxpyReductionReference(const Arguments<T> &args, BuffersHost<T> &buffers_host,
+                                     const bool is_nrm2) {
+  const auto scalar_offset = (is_nrm2) ? args.nrm2_offset : args.dot_offset;
+
+  // Checking for invalid arguments
+  if (args.n == 0) { return StatusCode::kInvalidDimension; }
+  if (args.x_inc == 0) { return StatusCode::kInvalidIncrementX; }
+  if (args.y_inc == 0) { return StatusCode::kInvalidIncrementY; }
+  if (buffers_host.x_vec.size() < (args.n - 1) * args.x_inc + 1 + args.x_offset) { return StatusCode::kInsufficientMemoryX; }
+  if (buffers_host.y_vec.size() < (args.n - 1) * args.y_inc + 1 + args.y_offset) { return StatusCode::kInsufficientMemoryY; }
+  if (buffers_host.scalar.size() < 1 + scalar_offset) { return StatusCode::kInsufficientMemoryScalar; }
+
+  // Vector update followed by its dot product with itself or its Euclidian norm
+  auto result = static_cast<T>(0);
+  for (auto id = size_t{0}; id < args.n; ++id) {
+    const auto x_index = id * args.x_inc + args.x_offset;
+    const auto y_index = id * args.y_inc + args.y_offset;
+    buffers_host.y_vec[y_index] += args.alpha * buffers_host.x_vec[x_index];
+    result += buffers_host.y_vec[y_index] * buffers_host.y_vec[y_index];
+  }
+  buffers_host.scalar[scalar_offset] = (is_nrm2) ? static_cast<T>(std::sqrt(result)) : result;
+  return StatusCode::kSuccess;
+}
+
+// Half-precision version calling the above reference implementation after conversions
+template <>
+StatusCode RunAxpyReductionReference<half>(const Arguments<half> &args,
+                                           BuffersHost<half> &buffers_host, const bool is_nrm2) {
+  auto x_buffer2 = HalfToFloatBuffer(buffers_host.x_vec);
+  auto y_buffer2 = HalfToFloatBuffer(buffers_host.y_vec);
+  auto scalar_buffer2 = HalfToFloatBuffer(buffers_host.scalar);
+  auto dummy = std::vector<float>(0);
+  auto buffers2 = BuffersHost<float>{x_buffer2, y_buffer2, dummy, dummy, dummy, dummy, scalar_buffer2};
+  auto args2 = Arguments<float>();
+  args2.n = args.n; args2.x_inc = args.x_inc; args2.y_inc = args.y_inc;
+  args2.x_offset = args.x_offset; args2.y_offset = args.y_offset;
+  args2.dot_offset = args.dot_offset; args2.nrm2_offset = args.nrm2_offset;
+  args2.alpha = HalfToFloat(args.alpha);
+  auto status = RunAxpyReductionReference(args2, buffers2, is_nrm2);
+  FloatToHalfBuffer(buffers_host.y_vec, y_buffer2);
+  FloatToHalfBuffer(buffers_host.scalar, scalar_buffer2);
+  return status;
+}
+
+// =================================================================================================
+
+// See comment at top of file for a description of the class. The reduction is a Euclidian norm
+// (Xaxpynrm2) if 'kIsNrm2' is set and a dot product (Xaxpydot) otherwise.
+template <typename T, bool kIsNrm2>
+class TestXaxpyReduction {
+ public:
+
+  // The offset of the scalar result
+  static size_t ScalarOffset(const Arguments<T> &args) {
+    return (kIsNrm2) ? args.nrm2_offset : args.dot_offset;
+  }
+
+  // The BLAS level: 1, 2, or 3
+  static size_t BLASLevel() { return 1; }
+
+  // The list of arguments relevant for this routine
+  static std::vector<std::string> GetOptions() {
+    return {kArgN,
+            kArgXInc, kArgYInc,
+            kArgXOffset, kArgYOffset, (kIsNrm2) ? kArgNrm2Offset : kArgDotOffset,
+            kArgAlpha};
+  }
+  static std::vector<std::string> BuffersIn() { return {kBufVecX, kBufVecY, kBufScalar}; }
+  static std::vector<std::string> BuffersOut() { return {kBufVecY, kBufScalar}; }
+
+  // Describes how to obtain the sizes of the buffers
+  static size_t GetSizeX(const Arguments<T> &args) {
+    return args.n * args.x_inc + args.x_offset;
+  }
+  static size_t GetSizeY(const Arguments<T> &args) {
+    return args.n * args.y_inc + args.y_offset;
+  }
+  static size_t GetSizeScalar(const Arguments<T> &args) {
+    return 1 + ScalarOffset(args);
+  }
+
+  // Describes how to set the sizes of all the buffers
+  static void SetSizes(Arguments<T> &args) {
+    args.x_size = GetSizeX(args);
+    args.y_size = GetSizeY(args);
+    args.scalar_size = GetSizeScalar(args);
+  }
+
+  // Describes what the default values of the leading dimensions of the matrices are
+  static size_t DefaultLDA(const Arguments<T> &) { return 1; } // N/A for this routine
+  static size_t DefaultLDB(const Arguments<T> &) { return 1; } // N/A for this routine
+  static size_t DefaultLDC(const Arguments<T> &) { return 1; } // N/A for this routine
+
+  // Describes which transpose options are relevant for this routine
+  using Transposes = std::vector<Transpose>;
+  static Transposes GetATransposes(const Transposes &) { return {}; } // N/A for this routine
+  static Transposes GetBTransposes(const Transposes &) { return {}; } // N/A for this routine
+
+  // Describes how to prepare the input data
+  static void PrepareData(const Arguments<T>&, Queue&, const int, std::vector<T>&,
+                          std::vector<T>&, std::vector<T>&, std::vector<T>&, std::vector<T>&,
+                          std::vector<T>&, std::vector<T>&) {} // N/A for this routine
+
+  // Describes how to run the CLBlast routine
+  static StatusCode RunRoutine(const Arguments<T> &args, Buffers<T> &buffers, Queue &queue) {
+    auto queue_plain = queue();
+    auto event = cl_event{};
+    auto status = (kIsNrm2) ?
+                  Axpynrm2<T>(args.n,
+                              buffers.scalar(), args.nrm2_offset,
+                              args.alpha,
+                              buffers.x_vec(), args.x_offset, args.x_inc,
+                              buffers.y_vec(), args.y_offset, args.y_inc,
+                              &queue_plain, &event) :
+                  Axpydot<T>(args.n,
+                             buffers.scalar(), args.dot_offset,
+                             args.alpha,
+                             buffers.x_vec(), args.x_offset, args.x_inc,
+                             buffers.y_vec(), args.y_offset, args.y_inc,
+                             &queue_plain, &event);
+    if (status == StatusCode::kSuccess) { clWaitForEvents(1, &event); clReleaseEvent(event); }
+    return status;
+  }
+
+  // Describes how to run a naive version of the routine (for correctness/performance comparison).
+  // Note that a proper clBLAS or CPU BLAS comparison is not available for non-BLAS routines.
+  static StatusCode RunReference1(const Arguments<T> &args, Buffers<T> &buffers, Queue &queue) {
+    auto buffers_host = BuffersHost<T>();
+    DeviceToHost(args, buffers, buffers_host, queue, BuffersIn());
+    const auto status = RunAxpyReductionReference(args, buffers_host, kIsNrm2);
+    HostToDevice(args, buffers, buffers_host, queue, BuffersOut());
+    return status;
+  }
+
+  static StatusCode RunReference2(const Arguments<T> &args, BuffersHost<T> &buffers_host, Queue&) {
+    return RunAxpyReductionReference(args, buffers_host, kIsNrm2);
+  }
+  static StatusCode RunReference3(const Arguments<T> &, BuffersCUDA<T> &, Queue &) {
+    return StatusCode::kUnknownError;
+  }
+
+  // Describes how to download the results of the computation (more importantly: which buffer)
+  // The result holds the updated vector Y followed by the scalar result, such that both are tested
+  static std::vector<T> DownloadResult(const Arguments<T> &args, Buffers<T> &buffers, Queue &queue) {
+    std::vector<T> result(args.y_size + args.scalar_size, static_cast<T>(0));
+    std::vector<T> scalar_result(args.scalar_size, static_cast<T>(0));
+    buffers.y_vec.Read(queue, args.y_size, result);
+    buffers.scalar.Read(queue, args.scalar_size, scalar_result);
+    std::copy(scalar_result.begin(), scalar_result.end(), result.begin() + args.y_size);
+    return result;
+  }
+
+  // Describes how to compute the indices of the result buffer
+  static size_t ResultID1(const Arguments<T> &args) { return args.n + 1; }
+  static size_t ResultID2(const Arguments<T> &) { return 1; } // N/A for this routine
+  static size_t GetResultIndex(const Arguments<T> &args, const size_t id1, const size_t) {
+    if (id1 == args.n) { return args.y_size + ScalarOffset(args); }
+    return id1*args.y_inc + args.y_offset;
+  }
+
+  // Describes how to compute performance metrics
+  static size_t GetFlops(const Arguments<T> &args) {
+    return 4 * args.n;
+  }
+  static size_t GetBytes(const Arguments<T> &args) {
+    return ((3 * args.n) + 1) * sizeof(T);
+  }
+};
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_TEST_ROUTINES_XAXPYREDUCTION_H_
+#endif
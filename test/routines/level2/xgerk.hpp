@@ -0,0 +1,190 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements a class with static methods to describe the Xgerk routine. Examples of
+// such 'descriptions' are how to calculate the size a of buffer or how to run the routine. These
+// static methods are used by the correctness tester and the performance tester.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_TEST_ROUTINES_XGERK_H_
+#define CLBLAST_TEST_ROUTINES_XGERK_H_
+
+#include "test/routines/common.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// The reference implementation: 'k' consecutive rank-1 updates as performed by GER
+template <typename T>
+StatusCode RunReference(const Arguments<T> &args, BuffersHost<T> &buffers_host) {
+
+  // Checking for invalid arguments
+  const auto a_rotated = (args.layout == Layout::kRowMajor);
+  const auto a_one = (a_rotated) ? args.n : args.m;
+  const auto a_two = (a_rotated) ? args.m : args.n;
+  if ((args.m == 0) || (args.n == 0) || (args.k == 0)) { return StatusCode::kInvalidDimension; }
+  if (args.a_ld < a_one) { return StatusCode::kInvalidLeadDimA; }
+  if (buffers_host.a_mat.size() < args.a_ld * (a_two - 1) + a_one + args.a_offset) { return StatusCode::kInsufficientMemoryA; }
+  if (args.x_inc == 0) { return StatusCode::kInvalidIncrementX; }
+  if (buffers_host.x_vec.size() < (args.m * args.k - 1) * args.x_inc + 1 + args.x_offset) { return StatusCode::kInsufficientMemoryX; }
+  if (args.y_inc == 0) { return StatusCode::kInvalidIncrementY; }
+  if (buffers_host.y_vec.size() < (args.n * args.k - 1) * args.y_inc + 1 + args.y_offset) { return StatusCode::kInsufficientMemoryY; }
+
+  // The rank-1 updates, the 'j'-th one using the 'j'-th pair of vectors
+  for (auto j = size_t{0}; j < args.k; ++j) {
+    for (auto id1 = size_t{0}; id1 < args.m; ++id1) {
+      for (auto id2 = size_t{0}; id2 < args.n; ++id2) {
+        const auto x_index = (j * args.m + id1) * args.x_inc + args.x_offset;
+        const auto y_index = (j * args.n + id2) * args.y_inc + args.y_offset;
+        const auto a_index = (a_rotated) ? id1 * args.a_ld + id2 + args.a_offset :
+                                           id2 * args.a_ld + id1 + args.a_offset;
+        buffers_host.a_mat[a_index] += args.alpha * buffers_host.x_vec[x_index] *
+                                       buffers_host.y_vec[y_index];
+      }
+    }
+  }
+  return StatusCode::kSuccess;
+}
+
+// Half-precision version calling the above reference implementation after conversions
+template <>
+StatusCode RunReference<half>(const Arguments<half> &args, BuffersHost<half> &buffers_host) {
+  auto x_buffer2 = HalfToFloatBuffer(buffers_host.x_vec);
+  auto y_buffer2 = HalfToFloatBuffer(buffers_host.y_vec);
+  auto a_buffer2 = HalfToFloatBuffer(buffers_host.a_mat);
+  auto dummy = std::vector<float>(0);
+  auto buffers2 = BuffersHost<float>{x_buffer2, y_buffer2, a_buffer2, dummy, dummy, dummy, dummy};
+  auto args2 = Arguments<float>();
+  args2.m = args.m; args2.n = args.n; args2.k = args.k; args2.layout = args.layout;
+  args2.x_inc = args.x_inc; args2.y_inc = args.y_inc; args2.a_ld = args.a_ld;
+  args2.x_offset = args.x_offset; args2.y_offset = args.y_offset; args2.a_offset = args.a_offset;
+  args2.alpha = HalfToFloat(args.alpha);
+  auto status = RunReference(args2, buffers2);
+  FloatToHalfBuffer(buffers_host.a_mat, a_buffer2);
+  return status;
+}
+
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T>
+class TestXgerk {
+ public:
+
+  // The BLAS level: 1, 2, or 3
+  static size_t BLASLevel() { return 2; }
+
+  // The list of arguments relevant for this routine
+  static std::vector<std::string> GetOptions() {
+    return {kArgM, kArgN, kArgK,
+            kArgLayout,
+            kArgALeadDim, kArgXInc, kArgYInc,
+            kArgAOffset, kArgXOffset, kArgYOffset,
+            kArgAlpha};
+  }
+  static std::vector<std::string> BuffersIn() { return {kBufMatA, kBufVecX, kBufVecY}; }
+  static std::vector<std::string> BuffersOut() { return {kBufMatA}; }
+
+  // Describes how to obtain the sizes of the buffers: the 'k' vectors are stored consecutively
+  static size_t GetSizeX(const Arguments<T> &args) {
+    return args.m * args.k * args.x_inc + args.x_offset;
+  }
+  static size_t GetSizeY(const Arguments<T> &args) {
+    return args.n * args.k * args.y_inc + args.y_offset;
+  }
+  static size_t GetSizeA(const Arguments<T> &args) {
+    auto a_rotated = (args.layout == Layout::kRowMajor);
+    auto a_two = (a_rotated) ? args.m : args.n;
+    return a_two * args.a_ld + args.a_offset;
+  }
+
+  // Describes how to set the sizes of all the buffers
+  static void SetSizes(Arguments<T> &args) {
+    args.a_size = GetSizeA(args);
+    args.x_size = GetSizeX(args);
+    args.y_size = GetSizeY(args);
+  }
+
+  // Describes what the default values of the leading dimensions of the matrices are
+  static size_t DefaultLDA(const Arguments<T> &args) { return args.n; }
+  static size_t DefaultLDB(const Arguments<T> &) { return 1; } // N/A for this routine
+  static size_t DefaultLDC(const Arguments<T> &) { return 1; } // N/A for this routine
+
+  // Describes which transpose options are relevant for this routine
+  using Transposes = std::vector<Transpose>;
+  static Transposes GetATransposes(const Transposes &) { return {}; } // N/A for this routine
+  static Transposes GetBTransposes(const Transposes &) { return {}; } // N/A for this routine
+
+  // Describes how to prepare the input data
+  static void PrepareData(const Arguments<T>&, Queue&, const int, std::vector<T>&,
+                          std::vector<T>&, std::vector<T>&, std::vector<T>&, std::vector<T>&,
+                          std::vector<T>&, std::vector<T>&) {} // N/A for this routine
+
+  // Describes how to run the CLBlast routine
+  static StatusCode RunRoutine(const Arguments<T> &args, Buffers<T> &buffers, Queue &queue) {
+    auto queue_plain = queue();
+    auto event = cl_event{};
+    auto status = Gerk(args.layout,
+                       args.m, args.n, args.k, args.alpha,
+                       buffers.x_vec(), args.x_offset, args.x_inc,
+                       buffers.y_vec(), args.y_offset, args.y_inc,
+                       buffers.a_mat(), args.a_offset, args.a_ld,
+                       &queue_plain, &event);
+    if (status == StatusCode::kSuccess) { clWaitForEvents(1, &event); clReleaseEvent(event); }
+    return status;
+  }
+
+  // Describes how to run a naive version of the routine (for correctness/performance comparison).
+  // Note that a proper clBLAS or CPU BLAS comparison is not available for non-BLAS routines.
+  static StatusCode RunReference1(const Arguments<T> &args, Buffers<T> &buffers, Queue &queue) {
+    auto buffers_host = BuffersHost<T>();
+    DeviceToHost(args, buffers, buffers_host, queue, BuffersIn());
+    const auto status = RunReference(args, buffers_host);
+    HostToDevice(args, buffers, buffers_host, queue, BuffersOut());
+    return status;
+  }
+
+  static StatusCode RunReference2(const Arguments<T> &args, BuffersHost<T> &buffers_host, Queue&) {
+    return RunReference(args, buffers_host);
+  }
+  static StatusCode RunReference3(const Arguments<T> &, BuffersCUDA<T> &, Queue &) {
+    return StatusCode::kUnknownError;
+  }
+
+  // Describes how to download the results of the computation (more importantly: which buffer)
+  static std::vector<T> DownloadResult(const Arguments<T> &args, Buffers<T> &buffers, Queue &queue) {
+    std::vector<T> result(args.a_size, static_cast<T>(0));
+    buffers.a_mat.Read(queue, args.a_size, result);
+    return result;
+  }
+
+  // Describes how to compute the indices of the result buffer
+  static size_t ResultID1(const Arguments<T> &args) { return args.m; }
+  static size_t ResultID2(const Arguments<T> &args) { return args.n; }
+  static size_t GetResultIndex(const Arguments<T> &args, const size_t id1, const size_t id2) {
+    return (args.layout == Layout::kRowMajor) ?
+           id1*args.a_ld + id2 + args.a_offset:
+           id2*args.a_ld + id1 + args.a_offset;
+  }
+
+  // Describes how to compute performance metrics
+  static size_t GetFlops(const Arguments<T> &args) {
+    return 2 * args.k * args.m * args.n;
+  }
+  static size_t GetBytes(const Arguments<T> &args) {
+    return (2*args.m*args.n + args.k*(args.m + args.n)) * sizeof(T);
+  }
+};
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_TEST_ROUTINES_XGERK_H_
+#endif